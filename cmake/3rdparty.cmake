@@ -27,7 +27,9 @@ function(get_clang_tidy_ignored_files OUTVAR)
       "controller_structs.h"
       # YUV2RGB
       "yuv_rgb.c"
+      "yuv_rgb_avx2_func.h"
       "yuv_rgb_lsx_func.h"
+      "yuv_rgb_neon_func.h"
       "yuv_rgb_sse_func.h"
       "yuv_rgb_std_func.h"
       # LIBM
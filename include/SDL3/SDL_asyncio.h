@@ -278,6 +278,54 @@ extern SDL_DECLSPEC Sint64 SDLCALL SDL_GetAsyncIOSize(SDL_AsyncIO *asyncio);
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_ReadAsyncIO(SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size, SDL_AsyncIOQueue *queue, void *userdata);
 
+/**
+ * A single read request for SDL_ReadAsyncIOBatch().
+ *
+ * \since This struct is available since SDL 3.6.0.
+ *
+ * \sa SDL_ReadAsyncIOBatch
+ */
+typedef struct SDL_AsyncIOReadRequest
+{
+    SDL_AsyncIO *asyncio;  /**< the file to read from. */
+    void *ptr;  /**< a buffer to read data into. */
+    Uint64 offset;  /**< the position to start reading in the data source. */
+    Uint64 size;  /**< the number of bytes to read from the data source. */
+    void *userdata;  /**< an app-defined pointer that will be provided with the task results. */
+} SDL_AsyncIOReadRequest;
+
+/**
+ * Start several async reads at once.
+ *
+ * This behaves like calling SDL_ReadAsyncIO() for each request in order, but
+ * the requests can come from any number of SDL_AsyncIO objects and are handed
+ * to the system together, which is much cheaper when an app issues many small
+ * reads at a time. Each request still produces its own SDL_AsyncIOOutcome in
+ * `queue`, in no particular order.
+ *
+ * Requests for back-to-back ranges of the same file that are next to each
+ * other in `requests` may be serviced by a single system call.
+ *
+ * If some requests can't be started, the ones before them are still running;
+ * the return value says how many were started, so the app can try the rest
+ * again later. The `requests` array itself is not needed after this function
+ * returns, but each `ptr` must remain available until its read is done.
+ *
+ * \param requests an array of read requests.
+ * \param num_requests the number of elements in `requests`.
+ * \param queue a queue to add the new tasks to.
+ * \returns the number of requests that were started, from the front of the
+ *          array. If this is less than `num_requests`, call SDL_GetError() for
+ *          more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_ReadAsyncIO
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_ReadAsyncIOBatch(const SDL_AsyncIOReadRequest *requests, int num_requests, SDL_AsyncIOQueue *queue);
+
 /**
  * Start an async write.
  *
@@ -541,6 +589,49 @@ extern SDL_DECLSPEC void SDLCALL SDL_SignalAsyncIOQueue(SDL_AsyncIOQueue *queue)
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_LoadFileAsync(const char *file, SDL_AsyncIOQueue *queue, void *userdata);
 
+/**
+ * Copy a file, asynchronously.
+ *
+ * This is the asynchronous counterpart to SDL_CopyFile(). It returns as
+ * quickly as possible; the data is moved in the background, in chunks, and
+ * the app is told about progress through `queue`. A failing return value from
+ * this function only means the work couldn't start at all.
+ *
+ * The copy advances as its results are pulled from the queue with
+ * SDL_GetAsyncIOResult() or SDL_WaitAsyncIOResult(), so the app must keep
+ * checking the queue until the copy is finished. Not every completed chunk
+ * produces an outcome, so those functions may occasionally report no result
+ * while a copy is in progress.
+ *
+ * The outcomes generated by a copy have a NULL `asyncio` and `buffer`:
+ *
+ * - After each chunk is written, an SDL_ASYNCIO_TASK_WRITE outcome is
+ *   reported. Its `bytes_transferred` is the total number of bytes copied so
+ *   far, and `bytes_requested` is the size of `oldpath` when the copy
+ *   started.
+ * - When the copy is done, both files are closed and a single
+ *   SDL_ASYNCIO_TASK_CLOSE outcome reports whether the whole copy succeeded,
+ *   with the same byte counts. No more outcomes follow it.
+ *
+ * The same caveats as SDL_CopyFile() apply: this is not an atomic operation,
+ * and `newpath` will hold an incomplete copy until the final outcome arrives.
+ *
+ * \param oldpath the old path.
+ * \param newpath the new path.
+ * \param queue a queue to report progress and completion to.
+ * \param userdata an app-defined pointer that will be provided with each
+ *                 outcome.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_CopyFile
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_CopyFileAsync(const char *oldpath, const char *newpath, SDL_AsyncIOQueue *queue, void *userdata);
+
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
 }
@@ -451,6 +451,23 @@ typedef struct SDL_AudioSpec
  */
 typedef struct SDL_AudioStream SDL_AudioStream;
 
+/**
+ * The filter an audio stream uses to change the sample rate.
+ *
+ * Each preset trades CPU time for fidelity; the default is
+ * SDL_AUDIO_RESAMPLE_QUALITY_HIGH.
+ *
+ * \since This enum is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetAudioStreamProperties
+ */
+typedef enum SDL_AudioResampleQuality
+{
+    SDL_AUDIO_RESAMPLE_QUALITY_LINEAR,  /**< Linear interpolation between the two nearest frames. */
+    SDL_AUDIO_RESAMPLE_QUALITY_CUBIC,   /**< Cubic (Catmull-Rom) interpolation of the four nearest frames. */
+    SDL_AUDIO_RESAMPLE_QUALITY_HIGH     /**< Bandlimited interpolation with a windowed sinc filter. */
+} SDL_AudioResampleQuality;
+
 
 /* Function prototypes */
 
@@ -1094,6 +1111,17 @@ extern SDL_DECLSPEC SDL_AudioStream * SDLCALL SDL_CreateAudioStream(const SDL_Au
  *   be cleaned up. Streams that are not cleaned up will still be unbound from
  *   devices when the audio subsystem quits. This property was added in SDL
  *   3.4.0.
+ * - `SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER`: an SDL_AudioResampleQuality
+ *   value that selects the filter used when the stream changes the sample
+ *   rate, including for SDL_SetAudioStreamFrequencyRatio(). Lower presets
+ *   cost less CPU time per frame. Defaults to
+ *   SDL_AUDIO_RESAMPLE_QUALITY_HIGH. This property was added in SDL 3.6.0.
+ * - `SDL_PROP_AUDIOSTREAM_SCRATCH_ALLOCATED_NUMBER`: the total number of bytes
+ *   of scratch space SDL has allocated while converting data out of this
+ *   stream, including space it shares with the device it is bound to. This
+ *   is 0 when the stream is created and SDL updates it when the total grows;
+ *   once playback is steady it should stop changing. This property is
+ *   read-only and was added in SDL 3.6.0.
  *
  * \param stream the SDL_AudioStream to query.
  * \returns a valid property ID on success or 0 on failure; call
@@ -1106,6 +1134,8 @@ extern SDL_DECLSPEC SDL_AudioStream * SDLCALL SDL_CreateAudioStream(const SDL_Au
 extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetAudioStreamProperties(SDL_AudioStream *stream);
 
 #define SDL_PROP_AUDIOSTREAM_AUTO_CLEANUP_BOOLEAN "SDL.audiostream.auto_cleanup"
+#define SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER "SDL.audiostream.resample_quality"
+#define SDL_PROP_AUDIOSTREAM_SCRATCH_ALLOCATED_NUMBER "SDL.audiostream.scratch_allocated"
 
 
 /**
@@ -451,6 +451,8 @@ extern SDL_DECLSPEC bool SDLCALL SDL_RenamePath(const char *oldpath, const char
  *               access to specific paths from other threads if appropriate.
  *
  * \since This function is available since SDL 3.2.0.
+ *
+ * \sa SDL_CopyFileAsync
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_CopyFile(const char *oldpath, const char *newpath);
 
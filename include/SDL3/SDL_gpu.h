@@ -390,6 +390,7 @@
 #define SDL_gpu_h_
 
 #include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_iostream.h>
 #include <SDL3/SDL_pixels.h>
 #include <SDL3/SDL_properties.h>
 #include <SDL3/SDL_rect.h>
@@ -2584,6 +2585,16 @@ extern SDL_DECLSPEC SDL_GPUShaderFormat SDLCALL SDL_GetGPUShaderFormats(SDL_GPUD
  * Driver Branch: promo490_3_Google
  * ```
  *
+ * `SDL_PROP_GPU_DEVICE_PIPELINE_CACHE_HITS_NUMBER`: The number of pipelines
+ * created so far that were found in the pipeline cache, see
+ * SDL_LoadGPUPipelineCache(). This is only available if the driver reports
+ * it. Since SDL 3.6.0.
+ *
+ * `SDL_PROP_GPU_DEVICE_PIPELINE_CACHE_MISSES_NUMBER`: The number of pipelines
+ * created so far that had to be compiled because they weren't in the
+ * pipeline cache. This is only available if the driver reports it. Since SDL
+ * 3.6.0.
+ *
  * \param device a GPU context to query.
  * \returns a valid property ID on success or 0 on failure; call
  *          SDL_GetError() for more information.
@@ -2598,6 +2609,8 @@ extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetGPUDeviceProperties(SDL_GPUD
 #define SDL_PROP_GPU_DEVICE_DRIVER_NAME_STRING        "SDL.gpu.device.driver_name"
 #define SDL_PROP_GPU_DEVICE_DRIVER_VERSION_STRING     "SDL.gpu.device.driver_version"
 #define SDL_PROP_GPU_DEVICE_DRIVER_INFO_STRING        "SDL.gpu.device.driver_info"
+#define SDL_PROP_GPU_DEVICE_PIPELINE_CACHE_HITS_NUMBER   "SDL.gpu.device.pipeline_cache.hits"
+#define SDL_PROP_GPU_DEVICE_PIPELINE_CACHE_MISSES_NUMBER "SDL.gpu.device.pipeline_cache.misses"
 
 
 /* State Creation */
@@ -2680,6 +2693,75 @@ extern SDL_DECLSPEC SDL_GPUGraphicsPipeline * SDLCALL SDL_CreateGPUGraphicsPipel
 
 #define SDL_PROP_GPU_GRAPHICSPIPELINE_CREATE_NAME_STRING "SDL.gpu.graphicspipeline.create.name"
 
+/**
+ * Load previously saved pipeline cache data into a GPU device.
+ *
+ * Pipelines are compiled from their shaders by the driver when they are
+ * created, which can take a noticeable amount of time. If a device has cache
+ * data for a pipeline, it can skip most of that work. Call this right after
+ * creating the device, before creating any pipelines, with data that was
+ * written by SDL_SaveGPUPipelineCache() on a previous run.
+ *
+ * The data is only accepted if it was saved with the same GPU and driver
+ * version. Cache data that doesn't match, for example after a driver update,
+ * is rejected and this function returns false; the device keeps working and
+ * the data should be replaced by saving the cache again later.
+ *
+ * To use cache data from SDL_Storage, read it with SDL_ReadStorageFile() and
+ * pass it in with SDL_IOFromConstMem().
+ *
+ * This is currently only supported by the Vulkan backend.
+ *
+ * \param device a GPU context.
+ * \param src the data stream for the pipeline cache data.
+ * \param closeio if true, calls SDL_CloseIO() on `src` before returning, even
+ *                in the case of an error.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_SaveGPUPipelineCache
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_LoadGPUPipelineCache(
+    SDL_GPUDevice *device,
+    SDL_IOStream *src,
+    bool closeio);
+
+/**
+ * Save the pipeline cache data of a GPU device.
+ *
+ * The cache contains every pipeline the device has created, along with
+ * anything that was loaded with SDL_LoadGPUPipelineCache(). This is usually
+ * done when the application quits, or after loading a level.
+ *
+ * The number of pipelines that were or weren't found in the cache are
+ * available as `SDL_PROP_GPU_DEVICE_PIPELINE_CACHE_HITS_NUMBER` and
+ * `SDL_PROP_GPU_DEVICE_PIPELINE_CACHE_MISSES_NUMBER` in the properties
+ * returned by SDL_GetGPUDeviceProperties(), if the driver reports them.
+ *
+ * This is currently only supported by the Vulkan backend.
+ *
+ * \param device a GPU context.
+ * \param dst the data stream to write the pipeline cache data to.
+ * \param closeio if true, calls SDL_CloseIO() on `dst` before returning, even
+ *                in the case of an error.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_LoadGPUPipelineCache
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SaveGPUPipelineCache(
+    SDL_GPUDevice *device,
+    SDL_IOStream *dst,
+    bool closeio);
+
 /**
  * Creates a sampler object to be used when binding textures in a graphics
  * workflow.
@@ -668,6 +668,23 @@ extern "C" {
  */
 #define SDL_HINT_CAMERA_DRIVER "SDL_CAMERA_DRIVER"
 
+/**
+ * A variable that makes the dummy camera driver offer a camera showing a
+ * still test pattern.
+ *
+ * The value is a FOURCC code and a frame size, such as "NV12 640x480". The
+ * camera delivers frames in that format and size, so frame conversion and
+ * scaling can be tested without camera hardware. The dummy driver is only
+ * used when it is requested with SDL_HINT_CAMERA_DRIVER.
+ *
+ * By default this hint is unset, and the dummy driver offers no cameras.
+ *
+ * This hint needs to be set before the camera subsystem is initialized.
+ *
+ * \since This hint is available since SDL 3.6.0.
+ */
+#define SDL_HINT_CAMERA_DUMMY_TEST_PATTERN "SDL_CAMERA_DUMMY_TEST_PATTERN"
+
 /**
  * A variable that limits what CPU features are available.
  *
@@ -695,6 +712,8 @@ extern "C" {
  * - "sve2"
  * - "lsx"
  * - "lasx"
+ * - "pclmul" (since SDL 3.6.0, only used internally)
+ * - "arm-crc32" (since SDL 3.6.0, only used internally)
  *
  * The items can be prefixed by '+'/'-' to add/remove features.
  *
@@ -1318,6 +1337,23 @@ extern "C" {
  */
 #define SDL_HINT_IOS_HIDE_HOME_INDICATOR "SDL_IOS_HIDE_HOME_INDICATOR"
 
+/**
+ * A variable setting the number of worker threads used by the job system.
+ *
+ * By default SDL starts one worker thread per logical CPU core, minus one for
+ * the thread submitting work, with a minimum of one and a maximum of 16.
+ *
+ * The variable can be set to a number of threads, or "0" to run every job on
+ * the thread that submits or waits for it.
+ *
+ * This hint should be set before the job system is first used.
+ *
+ * \since This hint is available since SDL 3.6.0.
+ *
+ * \sa SDL_SubmitJob
+ */
+#define SDL_HINT_JOB_THREADS "SDL_JOB_THREADS"
+
 /**
  * A variable that lets you enable joystick (and gamecontroller) events even
  * when your app is in the background.
@@ -2299,6 +2335,32 @@ extern "C" {
  */
 #define SDL_HINT_JOYSTICK_HIDAPI_GIP_RESET_FOR_METADATA "SDL_JOYSTICK_HIDAPI_GIP_RESET_FOR_METADATA"
 
+/**
+ * A variable controlling whether a background thread should read joystick
+ * input as soon as it arrives.
+ *
+ * Normally controller input is read when SDL_UpdateJoysticks() is called,
+ * usually from SDL_PumpEvents(), so input latency and timestamps depend on
+ * how often the application pumps events. With this hint enabled, a
+ * dedicated thread waits for input on open devices and processes it
+ * immediately.
+ *
+ * Joystick and gamepad events are sent from the input thread when this is
+ * enabled, so event filters and watchers may be called on that thread.
+ *
+ * This is currently supported for HIDAPI and evdev devices on Linux.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Joystick input is read when joysticks are updated. (default)
+ * - "1": Joystick input is read on a separate thread as it arrives.
+ *
+ * This hint should be set before SDL is initialized.
+ *
+ * \since This hint is available since SDL 3.6.0.
+ */
+#define SDL_HINT_JOYSTICK_INPUT_THREAD "SDL_JOYSTICK_INPUT_THREAD"
+
 /**
  * A variable controlling whether IOKit should be used for controller
  * handling.
@@ -3665,6 +3727,41 @@ extern "C" {
  */
 #define SDL_HINT_STORAGE_USER_DRIVER "SDL_STORAGE_USER_DRIVER"
 
+/**
+ * A variable controlling whether large software blits are split across
+ * threads.
+ *
+ * When enabled, SDL_BlitSurface(), SDL_BlitSurfaceScaled(),
+ * SDL_FillSurfaceRects() and SDL_ConvertPixels() split operations covering at
+ * least SDL_HINT_SURFACE_PARALLEL_BLIT_MIN_AREA pixels into bands of rows and
+ * run them on the job system's worker threads. The calling thread still
+ * waits for the whole operation to finish.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": All blits run on the calling thread. (default)
+ * - "1": Large blits are spread across worker threads.
+ *
+ * This hint can be set anytime.
+ *
+ * \since This hint is available since SDL 3.6.0.
+ */
+#define SDL_HINT_SURFACE_PARALLEL_BLIT "SDL_SURFACE_PARALLEL_BLIT"
+
+/**
+ * A variable setting the minimum number of destination pixels a blit needs
+ * before it is split across threads.
+ *
+ * This only has an effect when SDL_HINT_SURFACE_PARALLEL_BLIT is enabled.
+ *
+ * The default value is 262144 (512x512).
+ *
+ * This hint can be set anytime.
+ *
+ * \since This hint is available since SDL 3.6.0.
+ */
+#define SDL_HINT_SURFACE_PARALLEL_BLIT_MIN_AREA "SDL_SURFACE_PARALLEL_BLIT_MIN_AREA"
+
 /**
  * Specifies whether SDL_THREAD_PRIORITY_TIME_CRITICAL should be treated as
  * realtime.
@@ -4012,11 +4109,24 @@ extern "C" {
  * frames.
  *
  * This only saves frames that are generated using software rendering, not
- * accelerated OpenGL rendering.
+ * accelerated OpenGL rendering. Frames are written on a background thread,
+ * and only the parts of the window surface that were updated are copied for
+ * it.
  *
  * - "0": Video frames are not saved to disk. (default)
- * - "1": Video frames are saved to files in the format "SDL_windowX-Y.bmp",
- *   where X is the window ID, and Y is the frame number.
+ * - "1" or "bmp": Video frames are saved to files in the format
+ *   "SDL_windowX-Y.bmp", where X is the window ID, and Y is the frame number.
+ * - "png": Video frames are saved to files in the format "SDL_windowX-Y.png".
+ * - "raw": Video frames are written as tightly packed XRGB8888 pixels, one
+ *   frame after another, to the stream in the window's
+ *   `SDL_PROP_WINDOW_OFFSCREEN_FRAME_STREAM_POINTER` property, or to the file
+ *   "SDL_windowX.raw" if that isn't set.
+ * - "hash": A line with the frame number, size and a 32-bit hash of the
+ *   color channels of each frame is written to the stream in the window's
+ *   `SDL_PROP_WINDOW_OFFSCREEN_FRAME_STREAM_POINTER` property, or to the file
+ *   "SDL_windowX-hashes.txt" if that isn't set. The unused byte of each
+ *   pixel is left out of the hash. This is useful for comparing output
+ *   against known good frames without saving images.
  *
  * This hint can be set anytime.
  *
@@ -413,6 +413,58 @@ extern SDL_DECLSPEC SDL_IOStream * SDLCALL SDL_IOFromDynamicMem(void);
 #define SDL_PROP_IOSTREAM_DYNAMIC_MEMORY_POINTER    "SDL.iostream.dynamic.memory"
 #define SDL_PROP_IOSTREAM_DYNAMIC_CHUNKSIZE_NUMBER  "SDL.iostream.dynamic.chunksize"
 
+/**
+ * Flags that describe how a memory-mapped file will be accessed.
+ *
+ * These are only hints; platforms that can't act on them will ignore them.
+ *
+ * \since This datatype is available since SDL 3.6.0.
+ *
+ * \sa SDL_IOFromMappedFile
+ */
+typedef Uint32 SDL_IOMapFlags;
+
+#define SDL_IO_MAP_SEQUENTIAL   (1u << 0)   /**< The data will be read front to back; read ahead aggressively. */
+#define SDL_IO_MAP_RANDOM       (1u << 1)   /**< The data will be read in no particular order; don't read ahead. */
+#define SDL_IO_MAP_HUGEPAGES    (1u << 2)   /**< Back the mapping with huge pages, if possible. */
+
+/**
+ * Use this function to map a file into memory for reading with SDL_IOStream.
+ *
+ * The whole file is mapped read-only into the address space, and reads are
+ * served by copying out of the mapping, so no system calls are made after
+ * the stream is opened. The mapped data can also be used directly, without
+ * copying it at all, with SDL_GetIOMappedPointer().
+ *
+ * The file's contents must not be truncated by anyone while the stream is
+ * open; on many platforms, touching the missing part of the mapping will
+ * crash the program.
+ *
+ * On platforms without support for memory mapping, or for files that can't
+ * be mapped (such as Android assets, pipes, devices, or files like the ones in
+ * /proc that don't report their size), the file is loaded into memory
+ * instead, and the stream behaves the same way.
+ *
+ * The following properties will be set at creation time by SDL:
+ *
+ * - `SDL_PROP_IOSTREAM_MEMORY_POINTER`: the start of the mapped file data.
+ * - `SDL_PROP_IOSTREAM_MEMORY_SIZE_NUMBER`: the size of the file.
+ *
+ * \param file a UTF-8 string representing the filename to open.
+ * \param flags SDL_IOMapFlags describing how the data will be accessed, or 0.
+ * \returns a pointer to a new read-only SDL_IOStream structure or NULL on
+ *          failure; call SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_CloseIO
+ * \sa SDL_GetIOMappedPointer
+ * \sa SDL_IOFromFile
+ */
+extern SDL_DECLSPEC SDL_IOStream * SDLCALL SDL_IOFromMappedFile(const char *file, SDL_IOMapFlags flags);
+
 /* @} *//* IOFrom functions */
 
 
@@ -573,6 +625,37 @@ extern SDL_DECLSPEC Sint64 SDLCALL SDL_SeekIO(SDL_IOStream *context, Sint64 offs
  */
 extern SDL_DECLSPEC Sint64 SDLCALL SDL_TellIO(SDL_IOStream *context);
 
+/**
+ * Get direct access to the data of a memory-backed SDL_IOStream.
+ *
+ * This works for streams created with SDL_IOFromMappedFile(),
+ * SDL_IOFromMem() and SDL_IOFromConstMem(), and lets a parser look at the
+ * data in place instead of copying it out with SDL_ReadIO().
+ *
+ * The returned pointer is the data at the stream's current read position,
+ * and `size` is set to the number of bytes from there to the end of the
+ * stream. The stream's position is not changed; use SDL_SeekIO() to skip
+ * past anything that was consumed through the pointer.
+ *
+ * The pointer remains valid until the stream is closed. Data from
+ * SDL_IOFromMappedFile() and SDL_IOFromConstMem() must not be written to.
+ *
+ * \param context an SDL_IOStream structure.
+ * \param size a pointer filled in with the number of bytes available.
+ * \returns a pointer to the data at the current position, or NULL if the
+ *          stream isn't backed by memory; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety Do not use the same SDL_IOStream from two threads at once.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_IOFromMappedFile
+ * \sa SDL_IOFromMem
+ * \sa SDL_IOFromConstMem
+ */
+extern SDL_DECLSPEC const void * SDLCALL SDL_GetIOMappedPointer(SDL_IOStream *context, size_t *size);
+
 /**
  * Read from a data source.
  *
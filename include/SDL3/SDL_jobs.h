@@ -0,0 +1,252 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/* WIKI CATEGORY: Jobs */
+
+/**
+ * # CategoryJobs
+ *
+ * SDL offers a shared job system: a pool of worker threads that run small
+ * pieces of work ("jobs") submitted from any thread.
+ *
+ * Each worker keeps its own queue of jobs. Jobs submitted from inside a job
+ * go on the current worker's queue, and idle workers steal work from busy
+ * ones, so nested work stays on warm caches without leaving other cores
+ * idle. SDL uses the same workers for its own parallel work, such as large
+ * software blits, so an app that uses the job system doesn't end up with
+ * several competing pools. Blocking work, like the fallback implementation
+ * of async I/O, stays on its own threads.
+ *
+ * The general usage pattern is:
+ *
+ * - Create an SDL_JobCounter with SDL_CreateJobCounter for each group of jobs
+ *   that needs to be waited on.
+ * - Submit jobs with SDL_SubmitJob, naming the counter they should count
+ *   against and, optionally, a counter that has to reach zero before they may
+ *   start.
+ * - Call SDL_WaitJobCounter to wait for a group of jobs to finish; the
+ *   waiting thread runs queued jobs while it waits instead of sleeping.
+ *
+ * For loops whose iterations are independent, SDL_ParallelFor splits the
+ * range into chunks and runs them across the workers and the calling thread.
+ *
+ * Jobs should not block for long periods, on I/O or on each other, except
+ * through SDL_WaitJobCounter, since a blocked job ties up one of a small
+ * number of worker threads.
+ */
+
+#ifndef SDL_jobs_h_
+#define SDL_jobs_h_
+
+#include <SDL3/SDL_stdinc.h>
+
+#include <SDL3/SDL_begin_code.h>
+/* Set up for C function definitions, even when using C++ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A counter that tracks a group of jobs.
+ *
+ * Every job submitted against a counter increments it, and the counter is
+ * decremented as each job finishes, so it reaches zero when the whole group
+ * is done. Jobs can also name a counter as a dependency, which holds them
+ * back until that counter reaches zero.
+ *
+ * \since This struct is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateJobCounter
+ * \sa SDL_SubmitJob
+ * \sa SDL_WaitJobCounter
+ */
+typedef struct SDL_JobCounter SDL_JobCounter;
+
+/**
+ * A function run by the job system.
+ *
+ * \param userdata the pointer passed to SDL_SubmitJob.
+ *
+ * \threadsafety This function is called on a job system worker thread, or on
+ *               a thread waiting on a counter.
+ *
+ * \since This datatype is available since SDL 3.6.0.
+ *
+ * \sa SDL_SubmitJob
+ */
+typedef void (SDLCALL *SDL_JobFunction)(void *userdata);
+
+/**
+ * A function run on a chunk of a parallel loop.
+ *
+ * \param userdata the pointer passed to SDL_ParallelFor.
+ * \param start the first index of the chunk.
+ * \param end one past the last index of the chunk.
+ *
+ * \threadsafety This function may be called on several threads at once, each
+ *               with a different range.
+ *
+ * \since This datatype is available since SDL 3.6.0.
+ *
+ * \sa SDL_ParallelFor
+ */
+typedef void (SDLCALL *SDL_ParallelForFunction)(void *userdata, int start, int end);
+
+/**
+ * Create a job counter.
+ *
+ * \returns a new job counter with a count of zero, or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_DestroyJobCounter
+ * \sa SDL_SubmitJob
+ */
+extern SDL_DECLSPEC SDL_JobCounter * SDLCALL SDL_CreateJobCounter(void);
+
+/**
+ * Submit a job to run on the job system.
+ *
+ * The job runs as soon as a worker is free, unless `dependency` is non-NULL
+ * and has a non-zero count, in which case it is held back until that count
+ * reaches zero.
+ *
+ * If the job system has no worker threads, the job runs before this function
+ * returns, or when `dependency` reaches zero.
+ *
+ * \param func the function to run.
+ * \param userdata a pointer that is passed to `func`.
+ * \param counter a counter to increment until the job finishes, or NULL.
+ * \param dependency a counter that must reach zero before the job can start,
+ *                   or NULL.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, including
+ *               from inside a job.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_ParallelFor
+ * \sa SDL_WaitJobCounter
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SubmitJob(SDL_JobFunction func, void *userdata, SDL_JobCounter *counter, SDL_JobCounter *dependency);
+
+/**
+ * Check whether every job counted by a counter has finished.
+ *
+ * \param counter the counter to check.
+ * \returns true if the counter is zero, false otherwise.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_WaitJobCounter
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_IsJobCounterDone(SDL_JobCounter *counter);
+
+/**
+ * Wait for every job counted by a counter to finish.
+ *
+ * While the counter is non-zero, the calling thread runs other queued jobs
+ * instead of sleeping, so it is safe to wait from inside a job.
+ *
+ * \param counter the counter to wait on.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_IsJobCounterDone
+ * \sa SDL_SubmitJob
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_WaitJobCounter(SDL_JobCounter *counter);
+
+/**
+ * Destroy a job counter.
+ *
+ * This waits for every job counted by the counter to finish first. Jobs that
+ * name this counter as a dependency must have been released before it is
+ * destroyed.
+ *
+ * \param counter the counter to destroy.
+ *
+ * \threadsafety It is safe to call this function from any thread, as long as
+ *               no other thread is submitting jobs against the counter.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateJobCounter
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_DestroyJobCounter(SDL_JobCounter *counter);
+
+/**
+ * Run a loop in parallel on the job system.
+ *
+ * The range [0, `count`) is split into chunks of `grain` indices, which are
+ * handed to `func` on the worker threads and on the calling thread. This
+ * function returns once every chunk has been run.
+ *
+ * The calling thread only runs chunks of this loop, never other jobs, so a
+ * parallel loop can't be held up by unrelated work that happens to be queued.
+ *
+ * \param count the number of indices in the loop.
+ * \param grain the number of indices in each chunk, or 0 to pick a size that
+ *              gives each thread a few chunks.
+ * \param func the function to run on each chunk.
+ * \param userdata a pointer that is passed to `func`.
+ *
+ * \threadsafety It is safe to call this function from any thread, including
+ *               from inside a job.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_SubmitJob
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_ParallelFor(int count, int grain, SDL_ParallelForFunction func, void *userdata);
+
+/**
+ * Get the number of worker threads in the job system.
+ *
+ * This starts the job system if it isn't already running.
+ *
+ * \returns the number of worker threads, which may be zero if jobs run on
+ *          the threads that submit them.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_HINT_JOB_THREADS
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_GetNumJobThreads(void);
+
+/* Ends C function definitions when using C++ */
+#ifdef __cplusplus
+}
+#endif
+#include <SDL3/SDL_close_code.h>
+
+#endif /* SDL_jobs_h_ */
@@ -294,6 +294,10 @@ extern SDL_DECLSPEC SDL_Renderer * SDLCALL SDL_CreateRenderer(SDL_Window *window
  * - `SDL_PROP_RENDERER_CREATE_PRESENT_VSYNC_NUMBER`: non-zero if you want
  *   present synchronized with the refresh rate. This property can take any
  *   value that is supported by SDL_SetRenderVSync() for the renderer.
+ * - `SDL_PROP_RENDERER_CREATE_REORDER_COMMANDS_BOOLEAN`: true if queued draws
+ *   may be reordered so that draws using the same texture and blend mode can
+ *   be batched together, defaults to false. Draws are never moved past draws
+ *   that they overlap, so the result is the same. (Since SDL 3.6.0)
  *
  * With the SDL GPU renderer (since SDL 3.4.0):
  *
@@ -342,6 +346,7 @@ extern SDL_DECLSPEC SDL_Renderer * SDLCALL SDL_CreateRendererWithProperties(SDL_
 #define SDL_PROP_RENDERER_CREATE_SURFACE_POINTER                            "SDL.renderer.create.surface"
 #define SDL_PROP_RENDERER_CREATE_OUTPUT_COLORSPACE_NUMBER                   "SDL.renderer.create.output_colorspace"
 #define SDL_PROP_RENDERER_CREATE_PRESENT_VSYNC_NUMBER                       "SDL.renderer.create.present_vsync"
+#define SDL_PROP_RENDERER_CREATE_REORDER_COMMANDS_BOOLEAN                  "SDL.renderer.create.reorder_commands"
 #define SDL_PROP_RENDERER_CREATE_GPU_DEVICE_POINTER                         "SDL.renderer.create.gpu.device"
 #define SDL_PROP_RENDERER_CREATE_GPU_SHADERS_SPIRV_BOOLEAN                  "SDL.renderer.create.gpu.shaders_spirv"
 #define SDL_PROP_RENDERER_CREATE_GPU_SHADERS_DXIL_BOOLEAN                   "SDL.renderer.create.gpu.shaders_dxil"
@@ -496,6 +501,14 @@ extern SDL_DECLSPEC const char * SDLCALL SDL_GetRendererName(SDL_Renderer *rende
  *   that can be displayed, in terms of the SDR white point. When HDR is not
  *   enabled, this will be 1.0. This property can change dynamically when
  *   SDL_EVENT_WINDOW_HDR_STATE_CHANGED is sent.
+ * - `SDL_PROP_RENDERER_QUEUED_DRAW_CALLS_NUMBER`: if the renderer was created
+ *   with `SDL_PROP_RENDERER_CREATE_REORDER_COMMANDS_BOOLEAN`, the number of
+ *   draw calls the last presented frame would have needed in the order it
+ *   was drawn. (Since SDL 3.6.0)
+ * - `SDL_PROP_RENDERER_SUBMITTED_DRAW_CALLS_NUMBER`: if the renderer was
+ *   created with `SDL_PROP_RENDERER_CREATE_REORDER_COMMANDS_BOOLEAN`, the
+ *   number of draw calls the last presented frame needed after reordering.
+ *   (Since SDL 3.6.0)
  *
  * With the direct3d renderer:
  *
@@ -540,6 +553,9 @@ extern SDL_DECLSPEC const char * SDLCALL SDL_GetRendererName(SDL_Renderer *rende
  *
  * - `SDL_PROP_RENDERER_GPU_DEVICE_POINTER`: the SDL_GPUDevice associated with
  *   the renderer
+ * - `SDL_PROP_RENDERER_GPU_VERTEX_BYTES_NUMBER`: the number of bytes of
+ *   vertex data that were streamed to the GPU for the last presented frame.
+ *   Since SDL 3.6.0.
  *
  * \param renderer the rendering context.
  * \returns a valid property ID on success or 0 on failure; call
@@ -562,6 +578,8 @@ extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetRendererProperties(SDL_Rende
 #define SDL_PROP_RENDERER_HDR_ENABLED_BOOLEAN                       "SDL.renderer.HDR_enabled"
 #define SDL_PROP_RENDERER_SDR_WHITE_POINT_FLOAT                     "SDL.renderer.SDR_white_point"
 #define SDL_PROP_RENDERER_HDR_HEADROOM_FLOAT                        "SDL.renderer.HDR_headroom"
+#define SDL_PROP_RENDERER_QUEUED_DRAW_CALLS_NUMBER                  "SDL.renderer.queued_draw_calls"
+#define SDL_PROP_RENDERER_SUBMITTED_DRAW_CALLS_NUMBER               "SDL.renderer.submitted_draw_calls"
 #define SDL_PROP_RENDERER_D3D9_DEVICE_POINTER                       "SDL.renderer.d3d9.device"
 #define SDL_PROP_RENDERER_D3D11_DEVICE_POINTER                      "SDL.renderer.d3d11.device"
 #define SDL_PROP_RENDERER_D3D11_SWAPCHAIN_POINTER                   "SDL.renderer.d3d11.swap_chain"
@@ -576,6 +594,7 @@ extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetRendererProperties(SDL_Rende
 #define SDL_PROP_RENDERER_VULKAN_PRESENT_QUEUE_FAMILY_INDEX_NUMBER  "SDL.renderer.vulkan.present_queue_family_index"
 #define SDL_PROP_RENDERER_VULKAN_SWAPCHAIN_IMAGE_COUNT_NUMBER       "SDL.renderer.vulkan.swapchain_image_count"
 #define SDL_PROP_RENDERER_GPU_DEVICE_POINTER                        "SDL.renderer.gpu.device"
+#define SDL_PROP_RENDERER_GPU_VERTEX_BYTES_NUMBER                   "SDL.renderer.gpu.vertex_bytes"
 
 /**
  * Get the output size in pixels of a rendering context.
@@ -2152,6 +2152,146 @@ extern SDL_DECLSPEC void SDLCALL SDL_qsort_r(void *base, size_t nmemb, size_t si
  */
 extern SDL_DECLSPEC void * SDLCALL SDL_bsearch_r(const void *key, const void *base, size_t nmemb, size_t size, SDL_CompareCallback_r compare, void *userdata);
 
+/**
+ * Sort an array, keeping equal elements in their original order.
+ *
+ * This is a merge sort. Unlike SDL_qsort(), elements that compare as equal
+ * stay in the order they had before sorting, but it needs temporary memory
+ * the size of the array.
+ *
+ * \param base a pointer to the start of the array.
+ * \param nmemb the number of elements in the array.
+ * \param size the size of the elements in the array.
+ * \param compare a function used to compare elements in the array.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_mergesort_r
+ * \sa SDL_qsort
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_mergesort(void *base, size_t nmemb, size_t size, SDL_CompareCallback compare);
+
+/**
+ * Sort an array, keeping equal elements in their original order, passing a
+ * userdata pointer to the compare function.
+ *
+ * This is a merge sort. Unlike SDL_qsort_r(), elements that compare as equal
+ * stay in the order they had before sorting, but it needs temporary memory
+ * the size of the array.
+ *
+ * \param base a pointer to the start of the array.
+ * \param nmemb the number of elements in the array.
+ * \param size the size of the elements in the array.
+ * \param compare a function used to compare elements in the array.
+ * \param userdata a pointer to pass to the compare function.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_mergesort
+ * \sa SDL_parallel_mergesort_r
+ * \sa SDL_qsort_r
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_mergesort_r(void *base, size_t nmemb, size_t size, SDL_CompareCallback_r compare, void *userdata);
+
+/**
+ * Sort an array on several threads, keeping equal elements in their original
+ * order.
+ *
+ * This sorts the same way as SDL_mergesort_r(), but large arrays are split
+ * into pieces that are sorted and merged on the job system's worker threads
+ * and the calling thread. Small arrays, or any array when the job system has
+ * no worker threads, are sorted on the calling thread.
+ *
+ * `compare` is called from several threads at once and must be safe to use
+ * that way.
+ *
+ * \param base a pointer to the start of the array.
+ * \param nmemb the number of elements in the array.
+ * \param size the size of the elements in the array.
+ * \param compare a function used to compare elements in the array.
+ * \param userdata a pointer to pass to the compare function.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_mergesort_r
+ * \sa SDL_ParallelFor
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_parallel_mergesort_r(void *base, size_t nmemb, size_t size, SDL_CompareCallback_r compare, void *userdata);
+
+/**
+ * The type of key that SDL_radixsort() sorts by.
+ *
+ * \since This enum is available since SDL 3.6.0.
+ *
+ * \sa SDL_radixsort
+ */
+typedef enum SDL_SortKeyType
+{
+    SDL_SORT_KEY_UINT32,    /**< Uint32 */
+    SDL_SORT_KEY_SINT32,    /**< Sint32 */
+    SDL_SORT_KEY_UINT64,    /**< Uint64 */
+    SDL_SORT_KEY_SINT64,    /**< Sint64 */
+    SDL_SORT_KEY_FLOAT,     /**< float */
+    SDL_SORT_KEY_DOUBLE     /**< double */
+} SDL_SortKeyType;
+
+/**
+ * Sort an array of elements by a numeric key stored in each element.
+ *
+ * This is a radix sort. It doesn't call a compare function. It reads the key
+ * at `key_offset` bytes into each element, so it is much faster than
+ * SDL_qsort() on large arrays. Elements with equal keys stay in their
+ * original order. It needs temporary memory of about the size of the array,
+ * plus 24 bytes per element.
+ *
+ * Keys are sorted in increasing order. Negative zero sorts before positive
+ * zero, and NaNs sort before or after every other value depending on their
+ * sign bit.
+ *
+ * For example:
+ *
+ * ```c
+ * typedef struct {
+ *     const char *string;
+ *     float depth;
+ * } data;
+ *
+ * data values[] = {
+ *     { "third", 3.0f }, { "first", 1.0f }, { "second", 2.0f }
+ * };
+ *
+ * SDL_radixsort(values, SDL_arraysize(values), sizeof(values[0]), offsetof(data, depth), SDL_SORT_KEY_FLOAT);
+ * ```
+ *
+ * \param base a pointer to the start of the array.
+ * \param nmemb the number of elements in the array.
+ * \param size the size of the elements in the array.
+ * \param key_offset the offset of the key from the start of each element.
+ * \param key_type the type of the key.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_mergesort_r
+ * \sa SDL_qsort
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_radixsort(void *base, size_t nmemb, size_t size, size_t key_offset, SDL_SortKeyType key_type);
+
 /**
  * Compute the absolute value of `x`.
  *
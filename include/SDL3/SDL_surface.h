@@ -89,7 +89,8 @@ typedef enum SDL_ScaleMode
     SDL_SCALEMODE_INVALID = -1,
     SDL_SCALEMODE_NEAREST,  /**< nearest pixel sampling */
     SDL_SCALEMODE_LINEAR,   /**< linear filtering */
-    SDL_SCALEMODE_PIXELART  /**< nearest pixel sampling with improved scaling for pixel art, available since SDL 3.4.0 */
+    SDL_SCALEMODE_PIXELART, /**< nearest pixel sampling with improved scaling for pixel art, available since SDL 3.4.0 */
+    SDL_SCALEMODE_BICUBIC   /**< separable bicubic (Catmull-Rom) filtering for surfaces and the software renderer, other renderers use linear filtering, available since SDL 3.6.0 */
 } SDL_ScaleMode;
 
 /**
@@ -247,6 +248,18 @@ extern SDL_DECLSPEC void SDLCALL SDL_DestroySurface(SDL_Surface *surface);
  *   differently than what its camera provides (i.e. - the camera always
  *   provides portrait images but the phone is being held in landscape
  *   orientation). Since SDL 3.4.0.
+ * - `SDL_PROP_SURFACE_DITHER_STRING`: the dithering used when this surface
+ *   is converted or blitted to an 8-bit palettized surface. Currently this
+ *   supports "ordered", which adds an 8x8 Bayer pattern scaled to the size
+ *   of the palette, "floyd-steinberg", which diffuses the color error of
+ *   each pixel to its neighbors, and "none", which maps every pixel to its
+ *   nearest palette color. This defaults to "none". Since SDL 3.6.0.
+ * - `SDL_PROP_SURFACE_PNG_COMPRESSION_LEVEL_NUMBER`: the compression level
+ *   used when this surface is saved as a PNG image, trading file size for
+ *   speed. 0 stores the image data uncompressed, 1 only compresses runs of
+ *   repeated bytes, which is very fast and works well for screenshots, and 2
+ *   to 9 search harder for repeated data, with 9 being the slowest and
+ *   smallest. This defaults to 6. Since SDL 3.6.0.
  *
  * \param surface the SDL_Surface structure to query.
  * \returns a valid property ID on success or 0 on failure; call
@@ -264,6 +277,8 @@ extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetSurfaceProperties(SDL_Surfac
 #define SDL_PROP_SURFACE_HOTSPOT_X_NUMBER                   "SDL.surface.hotspot.x"
 #define SDL_PROP_SURFACE_HOTSPOT_Y_NUMBER                   "SDL.surface.hotspot.y"
 #define SDL_PROP_SURFACE_ROTATION_FLOAT                     "SDL.surface.rotation"
+#define SDL_PROP_SURFACE_DITHER_STRING                     "SDL.surface.dither"
+#define SDL_PROP_SURFACE_PNG_COMPRESSION_LEVEL_NUMBER      "SDL.surface.png.compression_level"
 
 /**
  * Set the colorspace used by a surface.
@@ -692,7 +707,12 @@ extern SDL_DECLSPEC SDL_Surface * SDLCALL SDL_LoadPNG_IO(SDL_IOStream *src, bool
 extern SDL_DECLSPEC SDL_Surface * SDLCALL SDL_LoadPNG(const char *file);
 
 /**
- * Save a surface to a seekable SDL data stream in PNG format.
+ * Save a surface to an SDL data stream in PNG format.
+ *
+ * The image data is written as it's compressed, so `dst` doesn't actually
+ * need to be seekable, and large images are compressed on several threads.
+ * The `SDL_PROP_SURFACE_PNG_COMPRESSION_LEVEL_NUMBER` property of `surface`
+ * can be used to trade file size for speed.
  *
  * \param surface the SDL_Surface structure containing the image to be saved.
  * \param dst a data stream to save to.
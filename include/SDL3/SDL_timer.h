@@ -444,6 +444,32 @@ extern SDL_DECLSPEC SDL_TimerID SDLCALL SDL_AddTimerNS(Uint64 interval, SDL_NSTi
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_RemoveTimer(SDL_TimerID id);
 
+/**
+ * Get statistics on how promptly timer callbacks have been called.
+ *
+ * Lateness is how long after its scheduled time each callback was actually
+ * called. The statistics cover every callback since the timer subsystem was
+ * started, and are updated after each batch of callbacks that are due at the
+ * same time.
+ *
+ * \param callbacks a pointer filled in with the number of callbacks that have
+ *                  been called, may be NULL.
+ * \param average_lateness_ns a pointer filled in with the average lateness of
+ *                            the callbacks, in nanoseconds, may be NULL.
+ * \param max_lateness_ns a pointer filled in with the lateness of the latest
+ *                        callback, in nanoseconds, may be NULL.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_AddTimer
+ * \sa SDL_AddTimerNS
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GetTimerStatistics(Uint64 *callbacks, Uint64 *average_lateness_ns, Uint64 *max_lateness_ns);
+
 
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
@@ -1688,6 +1688,15 @@ extern SDL_DECLSPEC SDL_Window * SDLCALL SDL_GetWindowParent(SDL_Window *window)
  *   window in JSON format, or NULL if the window has standard UIKit behavior.
  *   SDL_EVENT_WINDOW_SETTINGS_CHANGED is sent when this value changes.
  *
+ * On the offscreen video driver:
+ *
+ * - `SDL_PROP_WINDOW_OFFSCREEN_FRAME_STREAM_POINTER`: an SDL_IOStream that
+ *   captured frames are written to when SDL_HINT_VIDEO_OFFSCREEN_SAVE_FRAMES
+ *   is "raw" or "hash". This is set by the application, before the window
+ *   surface is first updated, and can be a pipe such as the one returned by
+ *   SDL_GetProcessInput(). SDL does not close this stream, and may write to
+ *   it from another thread until the window surface is destroyed.
+ *
  * \param window the window to query.
  * \returns a valid property ID on success or 0 on failure; call
  *          SDL_GetError() for more information.
@@ -1739,6 +1748,7 @@ extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetWindowProperties(SDL_Window
 #define SDL_PROP_WINDOW_EMSCRIPTEN_CANVAS_ID_STRING                 "SDL.window.emscripten.canvas_id"
 #define SDL_PROP_WINDOW_EMSCRIPTEN_KEYBOARD_ELEMENT_STRING          "SDL.window.emscripten.keyboard_element"
 #define SDL_PROP_WINDOW_VISIONOS_SETTINGS_STRING                    "SDL.window.visionos.settings"
+#define SDL_PROP_WINDOW_OFFSCREEN_FRAME_STREAM_POINTER              "SDL.window.offscreen.frame_stream"
 
 /**
  * Get the window flags.
@@ -181,6 +181,10 @@
 #cmakedefine HAVE_FSEEKO64 1
 #cmakedefine HAVE_MEMFD_CREATE 1
 #cmakedefine HAVE_POSIX_FALLOCATE 1
+#cmakedefine HAVE_COPY_FILE_RANGE 1
+#cmakedefine HAVE_SENDFILE 1
+#cmakedefine HAVE_FICLONE 1
+#cmakedefine HAVE_PREADV 1
 #cmakedefine HAVE_SIGACTION 1
 #cmakedefine HAVE_SIGTIMEDWAIT 1
 #cmakedefine HAVE_SA_SIGACTION 1
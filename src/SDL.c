@@ -53,6 +53,7 @@
 #include "render/SDL_sysrender.h"
 #include "sensor/SDL_sensor_c.h"
 #include "stdlib/SDL_getenv_c.h"
+#include "thread/SDL_jobs_c.h"
 #include "thread/SDL_thread_c.h"
 #include "tray/SDL_tray_utils.h"
 #include "video/SDL_pixels_c.h"
@@ -738,7 +739,10 @@ void SDL_Quit(void)
     SDL_SetObjectsInvalid();
     SDL_AssertionsQuit();
 
+    SDL_QuitParallelBlit();
+    SDL_QuitJobs();
     SDL_QuitPixelFormatDetails();
+    SDL_QuitAudioConversion();
 
     SDL_QuitCPUInfo();
 
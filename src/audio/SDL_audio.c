@@ -1199,6 +1199,7 @@ bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
     }
 
     bool failed = false;
+    const Uint64 allocated_bytes = device->stream_work_buffer.allocated_bytes;
     int buffer_size = device->buffer_size;
     Uint8 *device_buffer = device->GetDeviceBuf(device, &buffer_size);
     if (buffer_size == 0) {
@@ -1218,7 +1219,7 @@ bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
             SDL_assert(SDL_AudioSpecsEqual(&stream->dst_spec, &device->spec, NULL, NULL));
             SDL_assert(stream->src_spec.format != SDL_AUDIO_UNKNOWN);
 
-            const int br = SDL_GetAtomicInt(&logdev->paused) ? 0 : SDL_GetAudioStreamDataAdjustGain(stream, device_buffer, buffer_size, logdev->gain);
+            const int br = SDL_GetAtomicInt(&logdev->paused) ? 0 : SDL_GetAudioStreamDataAdjustGain(stream, device_buffer, buffer_size, logdev->gain, &device->stream_work_buffer);
             if (br < 0) {  // Probably OOM. Kill the audio device; the whole thing is likely dying soon anyhow.
                 failed = true;
                 SDL_memset(device_buffer, device->silence_value, buffer_size);  // just supply silence to the device before we die.
@@ -1256,30 +1257,48 @@ bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
                     SDL_memset(mix_buffer, '\0', work_buffer_size);  // start with silence.
                 }
 
+                /* Streams are pulled into separate slots of mix_batch_buffer and then summed together, so we only
+                   walk the mix buffer once per SDL_AUDIO_MIX_BATCH_STREAMS streams instead of once per stream. */
+                const float *batch[SDL_AUDIO_MIX_BATCH_STREAMS];
+                int num_batched = 0;
+
                 for (SDL_AudioStream *stream = logdev->bound_streams; stream; stream = stream->next_binding) {
                     // We should have updated this elsewhere if the format changed!
                     SDL_assert(SDL_AudioSpecsEqual(&stream->dst_spec, &outspec, NULL, NULL));
 
                     SDL_assert(stream->src_spec.format != SDL_AUDIO_UNKNOWN);
 
+                    float *slot = device->mix_batch_buffer + (num_batched * needed_samples);
+
                     /* this will hold a lock on `stream` while getting. We don't explicitly lock the streams
                        for iterating here because the binding linked list can only change while the device lock is held.
                        (we _do_ lock the stream during binding/unbinding to make sure that two threads can't try to bind
                        the same stream to different devices at the same time, though.) */
-                    const int br = SDL_GetAudioStreamDataAdjustGain(stream, device->work_buffer, work_buffer_size, logdev->gain);
+                    const int br = SDL_GetAudioStreamDataAdjustGain(stream, slot, work_buffer_size, logdev->gain, &device->stream_work_buffer);
                     if (br < 0) {  // Probably OOM. Kill the audio device; the whole thing is likely dying soon anyhow.
                         failed = true;
                         break;
                     } else if (br > 0) {  // it's okay if we get less than requested, we mix what we have.
                         // generally channel maps will line up, but if the audio stream's chmap has been explicitly changed, do a final swizzle to device layout.
                         if (!SDL_AudioChannelMapsEqual(device->spec.channels, stream->dst_chmap, device->chmap)) {
-                            ConvertAudio(br / SDL_AUDIO_FRAMESIZE(device->spec), device->work_buffer, device->spec.format, device->spec.channels, NULL,
-                                         device->work_buffer, device->spec.format, device->spec.channels, device->chmap, NULL, 1.0f);
+                            ConvertAudio(br / SDL_AUDIO_FRAMESIZE(device->spec), slot, device->spec.format, device->spec.channels, NULL,
+                                         slot, device->spec.format, device->spec.channels, device->chmap, NULL, 1.0f);
+                        }
+                        if (br < work_buffer_size) {
+                            SDL_memset(((Uint8 *) slot) + br, '\0', work_buffer_size - br);  // mixing in silence is a no-op.
+                        }
+                        batch[num_batched++] = slot;
+                        if (num_batched == SDL_AUDIO_MIX_BATCH_STREAMS) {
+                            MixFloat32AudioBatch(mix_buffer, batch, num_batched, needed_samples);
+                            num_batched = 0;
                         }
-                        MixFloat32Audio(mix_buffer, (float *) device->work_buffer, br);
                     }
                 }
 
+                if (num_batched > 0) {
+                    MixFloat32AudioBatch(mix_buffer, batch, num_batched, needed_samples);
+                }
+
                 if (postmix) {
                     SDL_assert(mix_buffer == device->postmix_buffer);
                     postmix(logdev->postmix_userdata, &outspec, mix_buffer, work_buffer_size);
@@ -1295,6 +1314,12 @@ bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
             }
         }
 
+        // Streams converting on this thread share the device's scratch space, so this should settle down to zero quickly.
+        if (device->stream_work_buffer.allocated_bytes != allocated_bytes) {
+            SDL_LogDebug(SDL_LOG_CATEGORY_AUDIO, "AUDIO: Device '%s' allocated %" SDL_PRIu64 " bytes of conversion scratch space this iteration (%" SDL_PRIu64 " total)",
+                         device->name, device->stream_work_buffer.allocated_bytes - allocated_bytes, device->stream_work_buffer.allocated_bytes);
+        }
+
         // PlayDevice SHOULD NOT BLOCK, as we are holding a lock right now. Block in WaitDevice instead!
         if (!device->PlayDevice(device, device_buffer, buffer_size)) {
             failed = true;
@@ -1708,12 +1733,17 @@ static void ClosePhysicalAudioDevice(SDL_AudioDevice *device)
     SDL_aligned_free(device->work_buffer);
     device->work_buffer = NULL;
 
+    SDL_FreeAudioWorkBuffer(&device->stream_work_buffer);
+
     SDL_aligned_free(device->mix_buffer);
     device->mix_buffer = NULL;
 
     SDL_aligned_free(device->postmix_buffer);
     device->postmix_buffer = NULL;
 
+    SDL_aligned_free(device->mix_batch_buffer);
+    device->mix_batch_buffer = NULL;
+
     SDL_copyp(&device->spec, &device->default_spec);
     device->sample_frames = 0;
     device->silence_value = SDL_GetSilenceValueForFormat(device->spec.format);
@@ -1869,6 +1899,14 @@ static bool OpenPhysicalAudioDevice(SDL_AudioDevice *device, const SDL_AudioSpec
         }
     }
 
+    if (!device->recording) {
+        device->mix_batch_buffer = (float *)SDL_aligned_alloc(SDL_GetSIMDAlignment(), (size_t)device->work_buffer_size * SDL_AUDIO_MIX_BATCH_STREAMS);
+        if (!device->mix_batch_buffer) {
+            ClosePhysicalAudioDevice(device);
+            return false;
+        }
+    }
+
     // Start the audio thread if necessary
     if (!current_audio.impl.ProvidesOwnCallbackThread) {
         char threadname[64];
@@ -2567,6 +2605,14 @@ bool SDL_AudioDeviceFormatChangedAlreadyLocked(SDL_AudioDevice *device, const SD
                 kill_device = true;
             }
         }
+
+        if (device->mix_batch_buffer) {
+            SDL_aligned_free(device->mix_batch_buffer);
+            device->mix_batch_buffer = (float *)SDL_aligned_alloc(SDL_GetSIMDAlignment(), (size_t)device->work_buffer_size * SDL_AUDIO_MIX_BATCH_STREAMS);
+            if (!device->mix_batch_buffer) {
+                kill_device = true;
+            }
+        }
     }
 
     // Post an event for the physical device, and each logical device on this physical device.
@@ -399,9 +399,14 @@ static int CalculateMaxFrameSize(SDL_AudioFormat src_format, int src_channels, S
     return max_format_size * max_channels;
 }
 
+static int GetAudioStreamResampleFrequency(SDL_AudioStream *stream, int src_freq)
+{
+    return (int)((float)src_freq * stream->freq_ratio);
+}
+
 static Sint64 GetAudioStreamResampleRate(SDL_AudioStream *stream, int src_freq, Sint64 resample_offset)
 {
-    src_freq = (int)((float)src_freq * stream->freq_ratio);
+    src_freq = GetAudioStreamResampleFrequency(stream, src_freq);
 
     Sint64 resample_rate = SDL_GetResampleRate(src_freq, stream->dst_spec.freq);
 
@@ -413,6 +418,20 @@ static Sint64 GetAudioStreamResampleRate(SDL_AudioStream *stream, int src_freq,
     return resample_rate;
 }
 
+// Rebuild the resampler filter after the quality or the conversion ratio changed. Call with the stream lock held.
+static void UpdateAudioStreamResampler(SDL_AudioStream *stream)
+{
+    const int src_freq = GetAudioStreamResampleFrequency(stream, stream->input_spec.freq);
+    const int dst_freq = stream->dst_spec.freq;
+
+    // No track is being processed yet; this runs again once one is.
+    if ((src_freq <= 0) || (dst_freq <= 0)) {
+        return;
+    }
+
+    SDL_UpdateAudioResampler(&stream->resampler, stream->resample_quality, src_freq, dst_freq);
+}
+
 static bool UpdateAudioStreamInputSpec(SDL_AudioStream *stream, const SDL_AudioSpec *spec, const int *chmap)
 {
     if (SDL_AudioSpecsEqual(&stream->input_spec, spec, stream->input_chmap, chmap)) {
@@ -432,6 +451,7 @@ static bool UpdateAudioStreamInputSpec(SDL_AudioStream *stream, const SDL_AudioS
     }
 
     SDL_copyp(&stream->input_spec, spec);
+    UpdateAudioStreamResampler(stream);
 
     return true;
 }
@@ -448,6 +468,7 @@ SDL_AudioStream *SDL_CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_
 
     result->freq_ratio = 1.0f;
     result->gain = 1.0f;
+    result->resample_quality = SDL_AUDIO_RESAMPLE_QUALITY_HIGH;
     result->queue = SDL_CreateAudioQueue(8192);
 
     if (!result->queue) {
@@ -462,6 +483,16 @@ SDL_AudioStream *SDL_CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_
         return NULL;
     }
 
+    // Publish the scratch space total up front, so it reads as zero rather than missing until the stream first converts
+    result->props = SDL_CreateProperties();
+    if (!result->props || !SDL_SetNumberProperty(result->props, SDL_PROP_AUDIOSTREAM_SCRATCH_ALLOCATED_NUMBER, 0)) {
+        SDL_DestroyProperties(result->props);
+        SDL_DestroyMutex(result->lock);
+        SDL_DestroyAudioQueue(result->queue);
+        SDL_free(result);
+        return NULL;
+    }
+
     OnAudioStreamCreated(result);
 
     if (!SDL_SetAudioStreamFormat(result, src_spec, dst_spec)) {
@@ -622,6 +653,7 @@ bool SDL_SetAudioStreamFormat(SDL_AudioStream *stream, const SDL_AudioSpec *src_
             stream->dst_chmap = NULL;
         }
         SDL_copyp(&stream->dst_spec, dst_spec);
+        UpdateAudioStreamResampler(stream);
     }
 
     SDL_UnlockMutex(stream->lock);
@@ -747,6 +779,7 @@ bool SDL_SetAudioStreamFrequencyRatio(SDL_AudioStream *stream, float freq_ratio)
 
     SDL_LockMutex(stream->lock);
     stream->freq_ratio = freq_ratio;
+    UpdateAudioStreamResampler(stream);
     SDL_UnlockMutex(stream->lock);
 
     return true;
@@ -1090,25 +1123,36 @@ bool SDL_FlushAudioStream(SDL_AudioStream *stream)
     return true;
 }
 
-/* this does not save the previous contents of stream->work_buffer. It's a work buffer!!
+/* this does not save the previous contents of the work buffer. It's a work buffer!!
    The returned buffer is aligned/padded for use with SIMD instructions. */
-static Uint8 *EnsureAudioStreamWorkBufferSize(SDL_AudioStream *stream, size_t newlen)
+Uint8 *SDL_EnsureAudioWorkBufferSize(SDL_AudioWorkBuffer *work_buffer, size_t newlen)
 {
-    if (stream->work_buffer_allocation >= newlen) {
-        return stream->work_buffer;
+    if (work_buffer->allocation >= newlen) {
+        return work_buffer->data;
     }
 
+    // Resampling needs a frame more or less from one chunk to the next, so leave room for that instead of growing every time.
+    newlen += newlen / 4;
+
     Uint8 *ptr = (Uint8 *) SDL_aligned_alloc(SDL_GetSIMDAlignment(), newlen);
     if (!ptr) {
         return NULL;  // previous work buffer is still valid!
     }
 
-    SDL_aligned_free(stream->work_buffer);
-    stream->work_buffer = ptr;
-    stream->work_buffer_allocation = newlen;
+    SDL_aligned_free(work_buffer->data);
+    work_buffer->data = ptr;
+    work_buffer->allocation = newlen;
+    work_buffer->allocated_bytes += newlen;
     return ptr;
 }
 
+void SDL_FreeAudioWorkBuffer(SDL_AudioWorkBuffer *work_buffer)
+{
+    SDL_aligned_free(work_buffer->data);
+    work_buffer->data = NULL;
+    work_buffer->allocation = 0;
+}
+
 static Sint64 NextAudioStreamIter(SDL_AudioStream *stream, void **inout_iter,
     Sint64 *inout_resample_offset, SDL_AudioSpec *out_spec, int **out_chmap, bool *out_flushed)
 {
@@ -1204,7 +1248,7 @@ static Sint64 GetAudioStreamHead(SDL_AudioStream *stream, SDL_AudioSpec *out_spe
 
 // You must hold stream->lock and validate your parameters before calling this!
 // Enough input data MUST be available!
-static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int output_frames, float gain)
+static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int output_frames, float gain, SDL_AudioWorkBuffer *scratch)
 {
     const SDL_AudioSpec *src_spec = &stream->input_spec;
     const SDL_AudioSpec *dst_spec = &stream->dst_spec;
@@ -1231,7 +1275,7 @@ static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int o
 
         // Ensure we have enough scratch space for any conversions
         if ((src_format != dst_format) || (src_channels != dst_channels) || (gain != 1.0f)) {
-            work_buffer = EnsureAudioStreamWorkBufferSize(stream, output_frames * max_frame_size);
+            work_buffer = SDL_EnsureAudioWorkBufferSize(scratch, output_frames * max_frame_size);
 
             if (!work_buffer) {
                 return false;
@@ -1297,7 +1341,7 @@ static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int o
         work_buffer_capacity += resample_bytes;
     }
 
-    Uint8 *work_buffer = EnsureAudioStreamWorkBufferSize(stream, work_buffer_capacity);
+    Uint8 *work_buffer = SDL_EnsureAudioWorkBufferSize(scratch, work_buffer_capacity);
 
     if (!work_buffer) {
         return false;
@@ -1322,7 +1366,7 @@ static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int o
     // Decide where the resampled output goes
     void *resample_buffer = (resample_buffer_offset != -1) ? (work_buffer + resample_buffer_offset) : buf;
 
-    SDL_ResampleAudio(resample_channels,
+    SDL_ResampleAudio(&stream->resampler, resample_channels,
                   (const float *)input_buffer, input_frames,
                   (float *)resample_buffer, output_frames,
                   resample_rate, &stream->resample_offset);
@@ -1334,7 +1378,7 @@ static bool GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int o
 }
 
 // get converted/resampled data from the stream
-int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int len, float extra_gain)
+int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int len, float extra_gain, SDL_AudioWorkBuffer *work_buffer)
 {
     Uint8 *buf = (Uint8 *) voidbuf;
 
@@ -1366,9 +1410,24 @@ int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int
         return -1;
     }
 
+    // Properties can't notify us when they change, so pick up a new quality once per call instead of per chunk.
+    if (stream->props) {
+        const SDL_AudioResampleQuality quality = (SDL_AudioResampleQuality)SDL_GetNumberProperty(stream->props, SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER, SDL_AUDIO_RESAMPLE_QUALITY_HIGH);
+        if (quality != stream->resample_quality) {
+            stream->resample_quality = quality;
+            UpdateAudioStreamResampler(stream);
+        }
+    }
+
     const float gain = stream->gain * extra_gain;
     const int dst_frame_size = SDL_AUDIO_FRAMESIZE(stream->dst_spec);
 
+    if (!work_buffer) {
+        work_buffer = &stream->work_buffer;
+    }
+
+    const Uint64 allocated_bytes = work_buffer->allocated_bytes;
+
     len -= len % dst_frame_size;  // chop off any fractional sample frame.
 
     // give the callback a chance to fill in more stream data if it wants.
@@ -1428,7 +1487,7 @@ int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int
         output_frames = SDL_min(output_frames, chunk_size);
         output_frames = (int) SDL_min(output_frames, available_frames);
 
-        if (!GetAudioStreamDataInternal(stream, &buf[total], output_frames, gain)) {
+        if (!GetAudioStreamDataInternal(stream, &buf[total], output_frames, gain, work_buffer)) {
             total = total ? total : -1;
             break;
         }
@@ -1436,6 +1495,12 @@ int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int
         total += output_frames * dst_frame_size;
     }
 
+    // Only touch the properties when scratch space actually grew, which should stop once the stream is running steadily.
+    if (work_buffer->allocated_bytes != allocated_bytes) {
+        stream->scratch_allocated_bytes += work_buffer->allocated_bytes - allocated_bytes;
+        SDL_SetNumberProperty(stream->props, SDL_PROP_AUDIOSTREAM_SCRATCH_ALLOCATED_NUMBER, (Sint64)stream->scratch_allocated_bytes);
+    }
+
     SDL_UnlockMutex(stream->lock);
 
 #if DEBUG_AUDIOSTREAM
@@ -1447,7 +1512,7 @@ int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int
 
 int SDL_GetAudioStreamData(SDL_AudioStream *stream, void *voidbuf, int len)
 {
-    return SDL_GetAudioStreamDataAdjustGain(stream, voidbuf, len, 1.0f);
+    return SDL_GetAudioStreamDataAdjustGain(stream, voidbuf, len, 1.0f, NULL);
 }
 
 // number of converted/resampled bytes available for output
@@ -1531,13 +1596,170 @@ void SDL_DestroyAudioStream(SDL_AudioStream *stream)
         SDL_UnbindAudioStream(stream);
     }
 
-    SDL_aligned_free(stream->work_buffer);
+    SDL_CleanupAudioResampler(&stream->resampler);
+    SDL_FreeAudioWorkBuffer(&stream->work_buffer);
     SDL_DestroyAudioQueue(stream->queue);
     SDL_DestroyMutex(stream->lock);
 
     SDL_free(stream);
 }
 
+// Scratch space kept between SDL_ConvertAudioSamples calls, so converting lots of little buffers doesn't allocate every time.
+typedef struct SDL_AudioConversionPool
+{
+    SDL_AudioWorkBuffer work_buffer;
+    SDL_AudioResampler resampler;
+} SDL_AudioConversionPool;
+
+/* A converting thread takes the pool out of this pointer and puts it back when it's done, so
+   nobody ever waits on a conversion, including SDL_QuitAudioConversion(). */
+static void *conversion_pool;
+
+static void FreeAudioConversionPool(SDL_AudioConversionPool *pool)
+{
+    SDL_FreeAudioWorkBuffer(&pool->work_buffer);
+    SDL_CleanupAudioResampler(&pool->resampler);
+}
+
+static SDL_AudioConversionPool *AcquireAudioConversionPool(void)
+{
+    SDL_AudioConversionPool *pool = (SDL_AudioConversionPool *)SDL_SetAtomicPointer(&conversion_pool, NULL);
+    if (!pool) {
+        pool = (SDL_AudioConversionPool *)SDL_calloc(1, sizeof(*pool));
+    }
+    return pool;
+}
+
+static void ReleaseAudioConversionPool(SDL_AudioConversionPool *pool)
+{
+    // If another thread already put its pool back, keep that one.
+    if (!SDL_CompareAndSwapAtomicPointer(&conversion_pool, NULL, pool)) {
+        FreeAudioConversionPool(pool);
+        SDL_free(pool);
+    }
+}
+
+void SDL_QuitAudioConversion(void)
+{
+    // A conversion still running keeps its pool, and puts it back when it finishes.
+    SDL_AudioConversionPool *pool = (SDL_AudioConversionPool *)SDL_SetAtomicPointer(&conversion_pool, NULL);
+    if (pool) {
+        FreeAudioConversionPool(pool);
+        SDL_free(pool);
+    }
+}
+
+/* This produces exactly what pushing all of src through a flushed SDL_AudioStream would, but it
+   reads straight from the caller's buffer instead of copying it into an audio queue first, and
+   only needs scratch space for one chunk at a time. */
+static bool ConvertAudioSamplesInternal(SDL_AudioConversionPool *pool, const SDL_AudioSpec *src_spec, const Uint8 *src, int src_frames,
+                                        const SDL_AudioSpec *dst_spec, Uint8 *dst, int dst_frames, Sint64 resample_rate)
+{
+    const SDL_AudioFormat src_format = src_spec->format;
+    const int src_channels = src_spec->channels;
+    const int src_frame_size = SDL_AUDIO_FRAMESIZE(*src_spec);
+
+    const SDL_AudioFormat dst_format = dst_spec->format;
+    const int dst_channels = dst_spec->channels;
+    const int dst_frame_size = SDL_AUDIO_FRAMESIZE(*dst_spec);
+
+    const int max_frame_size = CalculateMaxFrameSize(src_format, src_channels, dst_format, dst_channels);
+
+    // Same chunk size as SDL_GetAudioStreamData, to keep the scratch space small.
+    const int chunk_size = 4096;
+
+    if (dst_frames == 0) {
+        return true;  // nothing to do.
+    }
+
+    if (resample_rate == 0) {
+        SDL_assert(src_frames == dst_frames);
+
+        if ((src_format == dst_format) && (src_channels == dst_channels)) {
+            SDL_memcpy(dst, src, (size_t)src_frames * src_frame_size);
+            return true;
+        }
+
+        Uint8 *work_buffer = SDL_EnsureAudioWorkBufferSize(&pool->work_buffer, (size_t)SDL_min(src_frames, chunk_size) * max_frame_size);
+        if (!work_buffer) {
+            return false;
+        }
+
+        for (int pos = 0; pos < src_frames; pos += chunk_size) {
+            const int frames = SDL_min(src_frames - pos, chunk_size);
+            ConvertAudio(frames, src + ((size_t)pos * src_frame_size), src_format, src_channels, NULL,
+                         dst + ((size_t)pos * dst_frame_size), dst_format, dst_channels, NULL, work_buffer, 1.0f);
+        }
+
+        return true;
+    }
+
+    const int padding_frames = SDL_GetResamplerPaddingFrames(resample_rate);
+    const SDL_AudioFormat resample_format = SDL_AUDIO_F32;
+    const int resample_channels = SDL_min(src_channels, dst_channels);
+    const int resample_frame_size = SDL_AUDIO_BYTESIZE(resample_format) * resample_channels;
+
+    SDL_UpdateAudioResampler(&pool->resampler, SDL_AUDIO_RESAMPLE_QUALITY_HIGH, src_spec->freq, dst_spec->freq);
+
+    Sint64 resample_offset = 0;
+    int input_pos = 0;
+
+    for (int output_pos = 0; output_pos < dst_frames; output_pos += chunk_size) {
+        const int output_frames = SDL_min(dst_frames - output_pos, chunk_size);
+        const int input_frames = (int) SDL_GetResamplerInputFrames(output_frames, resample_rate, resample_offset);
+        Uint8 *output = dst + ((size_t)output_pos * dst_frame_size);
+
+        // This lays out the scratch space the same way GetAudioStreamDataInternal does.
+        const int work_buffer_frames = input_frames + (padding_frames * 2);
+        int work_buffer_capacity = work_buffer_frames * max_frame_size;
+        int resample_buffer_offset = -1;
+
+        if ((dst_format != resample_format) || (dst_channels != resample_channels)) {
+            work_buffer_capacity = SDL_max(work_buffer_capacity, output_frames * max_frame_size);
+
+            int simd_alignment = (int) SDL_GetSIMDAlignment();
+            work_buffer_capacity += simd_alignment - 1;
+            work_buffer_capacity -= work_buffer_capacity % simd_alignment;
+
+            resample_buffer_offset = work_buffer_capacity;
+            work_buffer_capacity += output_frames * resample_frame_size;
+        }
+
+        Uint8 *work_buffer = SDL_EnsureAudioWorkBufferSize(&pool->work_buffer, work_buffer_capacity);
+        if (!work_buffer) {
+            return false;
+        }
+
+        /* Convert the frames around the current position to float. Anything before the start or past
+           the end of the input is silence, just like the stream's history and flushed padding. */
+        const int window_start = input_pos - padding_frames;
+        const int window_end = input_pos + input_frames + padding_frames;
+        const int first_frame = SDL_max(window_start, 0);
+        const int last_frame = SDL_max(SDL_min(window_end, src_frames), first_frame);
+        const size_t leading_bytes = (size_t)(first_frame - window_start) * resample_frame_size;
+        const size_t converted_bytes = (size_t)(last_frame - first_frame) * resample_frame_size;
+
+        // (ConvertAudio uses the destination as scratch space, which is why the silence is written afterwards.)
+        ConvertAudio(last_frame - first_frame, src + ((size_t)first_frame * src_frame_size), src_format, src_channels, NULL,
+                     work_buffer + leading_bytes, resample_format, resample_channels, NULL, NULL, 1.0f);
+        SDL_memset(work_buffer, '\0', leading_bytes);
+        SDL_memset(work_buffer + leading_bytes + converted_bytes, '\0', ((size_t)work_buffer_frames * resample_frame_size) - leading_bytes - converted_bytes);
+
+        void *resample_buffer = (resample_buffer_offset != -1) ? (work_buffer + resample_buffer_offset) : output;
+
+        SDL_ResampleAudio(&pool->resampler, resample_channels,
+                          (const float *)(work_buffer + ((size_t)padding_frames * resample_frame_size)), input_frames,
+                          (float *)resample_buffer, output_frames,
+                          resample_rate, &resample_offset);
+
+        ConvertAudio(output_frames, resample_buffer, resample_format, resample_channels, NULL, output, dst_format, dst_channels, NULL, work_buffer, 1.0f);
+
+        input_pos += input_frames;
+    }
+
+    return true;
+}
+
 bool SDL_ConvertAudioSamples(const SDL_AudioSpec *src_spec, const Uint8 *src_data, int src_len, const SDL_AudioSpec *dst_spec, Uint8 **dst_data, int *dst_len)
 {
     if (dst_data) {
@@ -1548,6 +1770,30 @@ bool SDL_ConvertAudioSamples(const SDL_AudioSpec *src_spec, const Uint8 *src_dat
         *dst_len = 0;
     }
 
+    CHECK_PARAM(!src_spec) {
+        return SDL_InvalidParamError("src_spec");
+    }
+    CHECK_PARAM(!SDL_IsSupportedAudioFormat(src_spec->format)) {
+        return SDL_InvalidParamError("src_spec->format");
+    }
+    CHECK_PARAM(!SDL_IsSupportedChannelCount(src_spec->channels)) {
+        return SDL_InvalidParamError("src_spec->channels");
+    }
+    CHECK_PARAM(src_spec->freq <= 0) {
+        return SDL_InvalidParamError("src_spec->freq");
+    }
+    CHECK_PARAM(!dst_spec) {
+        return SDL_InvalidParamError("dst_spec");
+    }
+    CHECK_PARAM(!SDL_IsSupportedAudioFormat(dst_spec->format)) {
+        return SDL_InvalidParamError("dst_spec->format");
+    }
+    CHECK_PARAM(!SDL_IsSupportedChannelCount(dst_spec->channels)) {
+        return SDL_InvalidParamError("dst_spec->channels");
+    }
+    CHECK_PARAM(dst_spec->freq <= 0) {
+        return SDL_InvalidParamError("dst_spec->freq");
+    }
     CHECK_PARAM(!src_data) {
         return SDL_InvalidParamError("src_data");
     }
@@ -1561,22 +1807,45 @@ bool SDL_ConvertAudioSamples(const SDL_AudioSpec *src_spec, const Uint8 *src_dat
         return SDL_InvalidParamError("dst_len");
     }
 
-    bool result = false;
-    Uint8 *dst = NULL;
-    int dstlen = 0;
+    const int src_frame_size = SDL_AUDIO_FRAMESIZE(*src_spec);
+    const int dst_frame_size = SDL_AUDIO_FRAMESIZE(*dst_spec);
 
-    SDL_AudioStream *stream = SDL_CreateAudioStream(src_spec, dst_spec);
-    if (stream) {
-        if (SDL_PutAudioStreamDataNoCopy(stream, src_data, src_len, NULL, NULL) && SDL_FlushAudioStream(stream)) {
-            dstlen = SDL_GetAudioStreamAvailable(stream);
-            if (dstlen >= 0) {
-                dst = (Uint8 *)SDL_malloc(dstlen);
-                if (dst) {
-                    result = (SDL_GetAudioStreamData(stream, dst, dstlen) == dstlen);
-                }
-            }
-        }
+    if ((src_len % src_frame_size) != 0) {
+        return SDL_SetError("Can't add partial sample frames");
+    }
+
+    const int src_frames = src_len / src_frame_size;
+
+    Sint64 resample_rate = SDL_GetResampleRate(src_spec->freq, dst_spec->freq);
+    if (resample_rate == 0x100000000) {
+        resample_rate = 0;
+    }
+
+    Sint64 dst_frames = src_frames;
+    if (resample_rate) {
+        Sint64 resample_offset = 0;
+        dst_frames = SDL_GetResamplerOutputFrames(src_frames, resample_rate, &resample_offset);
+    }
+
+    if (dst_frames > (SDL_INT_MAX / dst_frame_size)) {
+        return SDL_SetError("Converted audio is too large");
+    }
+
+    const int dstlen = (int)dst_frames * dst_frame_size;
+    Uint8 *dst = (Uint8 *)SDL_malloc(dstlen);
+    if (!dst) {
+        return false;
+    }
+
+    /* Reuse the shared scratch space if nobody else is converting right now. Otherwise, rather
+       than wait, start a new pool, which is what every call did before there was one. */
+    SDL_AudioConversionPool *pool = AcquireAudioConversionPool();
+    if (!pool) {
+        SDL_free(dst);
+        return false;
     }
+    const bool result = ConvertAudioSamplesInternal(pool, src_spec, src_data, src_frames, dst_spec, dst, (int)dst_frames, resample_rate);
+    ReleaseAudioConversionPool(pool);
 
     if (result) {
         *dst_data = dst;
@@ -1585,6 +1854,5 @@ bool SDL_ConvertAudioSamples(const SDL_AudioSpec *src_spec, const Uint8 *src_dat
         SDL_free(dst);
     }
 
-    SDL_DestroyAudioStream(stream);
     return result;
 }
@@ -48,6 +48,14 @@
 #define RESAMPLER_FILTER_INTERP_BITS        (32 - RESAMPLER_BITS_PER_ZERO_CROSSING)
 #define RESAMPLER_FILTER_INTERP_RANGE       (1 << RESAMPLER_FILTER_INTERP_BITS)
 
+// if dB > 50, beta=(0.1102 * (dB - 8.7)), according to Matlab.
+#define RESAMPLER_FILTER_DB   80.0f
+#define RESAMPLER_KAISER_BETA (0.1102f * (RESAMPLER_FILTER_DB - 8.7f))
+
+// Rates with a small ratio, such as 44100:48000, only ever sample the filter at `dst_rate / gcd` phases.
+// Up to this many phases, the exact taps are calculated once, instead of interpolating the filter for every frame.
+#define RESAMPLER_MAX_POLYPHASE_PHASES 512
+
 // ResampleFrame is just a vector/matrix/matrix multiplication.
 // It performs cubic interpolation of the filter, then multiplies that with the input.
 // dst = [1, frac, frac^2, frac^3] * filter * src
@@ -68,6 +76,33 @@ typedef union Cubic
 
 } Cubic;
 
+static Cubic ResamplerFilter[RESAMPLER_SAMPLES_PER_ZERO_CROSSING][RESAMPLER_SAMPLES_PER_FRAME];
+
+// Find the input frame and the filter to use for the output frame at `srcpos`.
+// With a polyphase filter, this picks the nearest phase. `srcpos` advances at the same rate as
+// the phases, so any rounding is a constant sub-sample delay rather than noise.
+// Otherwise, this picks the cubic filter and the fraction to interpolate it at.
+SDL_FORCE_INLINE int GetResampleFilter(Sint64 srcpos, const float *polyphase, Uint32 phases,
+                                       const float **taps, const Cubic **filter, float *frac)
+{
+    int srcindex = (int)(Sint32)(srcpos >> 32);
+    Uint32 srcfraction = (Uint32)(srcpos & 0xFFFFFFFF);
+
+    if (polyphase) {
+        Uint32 phase = (Uint32)((((Uint64)srcfraction * phases) + 0x80000000) >> 32);
+        if (phase == phases) {
+            phase = 0;
+            ++srcindex;
+        }
+        *taps = &polyphase[phase * RESAMPLER_SAMPLES_PER_FRAME];
+    } else {
+        *filter = ResamplerFilter[srcfraction >> RESAMPLER_FILTER_INTERP_BITS];
+        *frac = (float)(srcfraction & (RESAMPLER_FILTER_INTERP_RANGE - 1)) * (1.0f / RESAMPLER_FILTER_INTERP_RANGE);
+    }
+
+    return srcindex;
+}
+
 static void ResampleFrame_Generic(const float *src, float *dst, const Cubic *filter, float frac, int chans)
 {
     const float frac2 = frac * frac;
@@ -130,21 +165,41 @@ static void ResampleFrame_Stereo(const float *src, float *dst, const Cubic *filt
     dst[1] = out1;
 }
 
+static void ResampleTaps_Generic(const float *src, float *dst, const float *taps, int chans)
+{
+    int i, chan;
+
+    for (chan = 0; chan < chans; ++chan) {
+        float out = 0.0f;
+
+        for (i = 0; i < RESAMPLER_SAMPLES_PER_FRAME; ++i) {
+            out += src[i * chans + chan] * taps[i];
+        }
+
+        dst[chan] = out;
+    }
+}
+
 #ifdef SDL_SSE_INTRINSICS
 #define sdl_madd_ps(a, b, c) _mm_add_ps(a, _mm_mul_ps(b, c)) // Not-so-fused multiply-add
 
-static void SDL_TARGETING("sse") ResampleFrame_Generic_SSE(const float *src, float *dst, const Cubic *filter, float frac, int chans)
+// Get the filter for one output frame, either from a polyphase filter or by interpolating the cubic filter
+static SDL_INLINE void SDL_TARGETING("sse") LoadFilter_SSE(const float *taps, const Cubic *filter, float frac, __m128 *f)
 {
 #if RESAMPLER_SAMPLES_PER_FRAME != 12
 #error Invalid samples per frame
 #endif
 
-    __m128 f0, f1, f2;
+    if (taps) {
+        f[0] = _mm_load_ps(taps + 0);
+        f[1] = _mm_load_ps(taps + 4);
+        f[2] = _mm_load_ps(taps + 8);
+        return;
+    }
 
-    {
-        const __m128 frac1 = _mm_set1_ps(frac);
-        const __m128 frac2 = _mm_mul_ps(frac1, frac1);
-        const __m128 frac3 = _mm_mul_ps(frac1, frac2);
+    const __m128 frac1 = _mm_set1_ps(frac);
+    const __m128 frac2 = _mm_mul_ps(frac1, frac1);
+    const __m128 frac3 = _mm_mul_ps(frac1, frac2);
 
 // Transposed in SetupAudioResampler
 // Explicitly use _mm_load_ps to workaround ICE in GCC 4.9.4 accessing Cubic.v128
@@ -155,25 +210,42 @@ static void SDL_TARGETING("sse") ResampleFrame_Generic_SSE(const float *src, flo
     out = sdl_madd_ps(out, frac3, _mm_load_ps(filter[3].v)); \
     filter += 4
 
-        X(f0);
-        X(f1);
-        X(f2);
+    X(f[0]);
+    X(f[1]);
+    X(f[2]);
 
 #undef X
-    }
+}
 
-    if (chans == 2) {
-        // Duplicate each of the filter elements and multiply by the input
-        // Use two accumulators to improve throughput
-        __m128 out0 = _mm_mul_ps(_mm_loadu_ps(src + 0), _mm_unpacklo_ps(f0, f0));
-        __m128 out1 = _mm_mul_ps(_mm_loadu_ps(src + 4), _mm_unpackhi_ps(f0, f0));
-        out0 = sdl_madd_ps(out0, _mm_loadu_ps(src + 8), _mm_unpacklo_ps(f1, f1));
-        out1 = sdl_madd_ps(out1, _mm_loadu_ps(src + 12), _mm_unpackhi_ps(f1, f1));
-        out0 = sdl_madd_ps(out0, _mm_loadu_ps(src + 16), _mm_unpacklo_ps(f2, f2));
-        out1 = sdl_madd_ps(out1, _mm_loadu_ps(src + 20), _mm_unpackhi_ps(f2, f2));
+// Multiply the filter by one mono frame, leaving 4 partial sums
+static SDL_INLINE __m128 SDL_TARGETING("sse") FilterMono_SSE(const float *src, const __m128 *f)
+{
+    __m128 out = _mm_mul_ps(f[0], _mm_loadu_ps(src + 0));
+    out = sdl_madd_ps(out, f[1], _mm_loadu_ps(src + 4));
+    out = sdl_madd_ps(out, f[2], _mm_loadu_ps(src + 8));
+    return out;
+}
 
-        // Add the accumulators together
-        __m128 out = _mm_add_ps(out0, out1);
+// Multiply the filter by one stereo frame, leaving 2 partial sums per channel
+static SDL_INLINE __m128 SDL_TARGETING("sse") FilterStereo_SSE(const float *src, const __m128 *f)
+{
+    // Duplicate each of the filter elements and multiply by the input
+    // Use two accumulators to improve throughput
+    __m128 out0 = _mm_mul_ps(_mm_loadu_ps(src + 0), _mm_unpacklo_ps(f[0], f[0]));
+    __m128 out1 = _mm_mul_ps(_mm_loadu_ps(src + 4), _mm_unpackhi_ps(f[0], f[0]));
+    out0 = sdl_madd_ps(out0, _mm_loadu_ps(src + 8), _mm_unpacklo_ps(f[1], f[1]));
+    out1 = sdl_madd_ps(out1, _mm_loadu_ps(src + 12), _mm_unpackhi_ps(f[1], f[1]));
+    out0 = sdl_madd_ps(out0, _mm_loadu_ps(src + 16), _mm_unpacklo_ps(f[2], f[2]));
+    out1 = sdl_madd_ps(out1, _mm_loadu_ps(src + 20), _mm_unpackhi_ps(f[2], f[2]));
+
+    // Add the accumulators together
+    return _mm_add_ps(out0, out1);
+}
+
+static void SDL_TARGETING("sse") ApplyFilter_SSE(const float *src, float *dst, const __m128 *f, int chans)
+{
+    if (chans == 2) {
+        __m128 out = FilterStereo_SSE(src, f);
 
         // Add the lower and upper pairs together
         out = _mm_add_ps(out, _mm_movehl_ps(out, out));
@@ -184,10 +256,7 @@ static void SDL_TARGETING("sse") ResampleFrame_Generic_SSE(const float *src, flo
     }
 
     if (chans == 1) {
-        // Multiply the filter by the input
-        __m128 out = _mm_mul_ps(f0, _mm_loadu_ps(src + 0));
-        out = sdl_madd_ps(out, f1, _mm_loadu_ps(src + 4));
-        out = sdl_madd_ps(out, f2, _mm_loadu_ps(src + 8));
+        __m128 out = FilterMono_SSE(src, f);
 
         // Horizontal sum
         __m128 shuf = _mm_shuffle_ps(out, out, _MM_SHUFFLE(2, 3, 0, 1));
@@ -198,6 +267,9 @@ static void SDL_TARGETING("sse") ResampleFrame_Generic_SSE(const float *src, flo
         return;
     }
 
+    const __m128 f0 = f[0];
+    const __m128 f1 = f[1];
+    const __m128 f2 = f[2];
     int chan = 0;
 
     // Process 4 channels at once
@@ -261,74 +333,167 @@ static void SDL_TARGETING("sse") ResampleFrame_Generic_SSE(const float *src, flo
     }
 }
 
+static void SDL_TARGETING("sse") ResampleFrame_Generic_SSE(const float *src, float *dst, const Cubic *filter, float frac, int chans)
+{
+    __m128 f[3];
+    LoadFilter_SSE(NULL, filter, frac, f);
+    ApplyFilter_SSE(src, dst, f, chans);
+}
+
+static void SDL_TARGETING("sse") ResampleTaps_SSE(const float *src, float *dst, const float *taps, int chans)
+{
+    __m128 f[3];
+    LoadFilter_SSE(taps, NULL, 0.0f, f);
+    ApplyFilter_SSE(src, dst, f, chans);
+}
+
+// Resample 4 mono frames at a time, so the horizontal sums can be done together with a transpose.
+// This gives exactly the same results as ApplyFilter_SSE.
+static int SDL_TARGETING("sse") ResampleBlock_Mono_SSE(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate,
+                                                      const float *polyphase, Uint32 phases)
+{
+    int i;
+
+    for (i = 0; i + 4 <= outframes; i += 4) {
+        __m128 out[4];
+        int j;
+
+        for (j = 0; j < 4; ++j) {
+            const float *taps = NULL;
+            const Cubic *filter = NULL;
+            float frac = 0.0f;
+            __m128 f[3];
+
+            const int srcindex = GetResampleFilter(srcpos, polyphase, phases, &taps, &filter, &frac);
+            srcpos += resample_rate;
+
+            LoadFilter_SSE(taps, filter, frac, f);
+            out[j] = FilterMono_SSE(&src[srcindex], f);
+        }
+
+        _MM_TRANSPOSE4_PS(out[0], out[1], out[2], out[3]);
+        _mm_storeu_ps(&dst[i], _mm_add_ps(_mm_add_ps(out[0], out[1]), _mm_add_ps(out[2], out[3])));
+    }
+
+    return i;
+}
+
+// Resample 2 stereo frames at a time, finishing both with a single add and store.
+static int SDL_TARGETING("sse") ResampleBlock_Stereo_SSE(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate,
+                                                        const float *polyphase, Uint32 phases)
+{
+    int i;
+
+    for (i = 0; i + 2 <= outframes; i += 2) {
+        __m128 out[2];
+        int j;
+
+        for (j = 0; j < 2; ++j) {
+            const float *taps = NULL;
+            const Cubic *filter = NULL;
+            float frac = 0.0f;
+            __m128 f[3];
+
+            const int srcindex = GetResampleFilter(srcpos, polyphase, phases, &taps, &filter, &frac);
+            srcpos += resample_rate;
+
+            LoadFilter_SSE(taps, filter, frac, f);
+            out[j] = FilterStereo_SSE(&src[srcindex * 2], f);
+        }
+
+        // Add the lower and upper pairs of each frame together
+        _mm_storeu_ps(&dst[i * 2], _mm_add_ps(_mm_movelh_ps(out[0], out[1]), _mm_movehl_ps(out[1], out[0])));
+    }
+
+    return i;
+}
+
 #undef sdl_madd_ps
 #endif
 
 #ifdef SDL_NEON_INTRINSICS
-static void ResampleFrame_Generic_NEON(const float *src, float *dst, const Cubic *filter, float frac, int chans)
+// Get the filter for one output frame, either from a polyphase filter or by interpolating the cubic filter
+static SDL_INLINE void LoadFilter_NEON(const float *taps, const Cubic *filter, float frac, float32x4_t *f)
 {
 #if RESAMPLER_SAMPLES_PER_FRAME != 12
 #error Invalid samples per frame
 #endif
 
-    float32x4_t f0, f1, f2;
+    if (taps) {
+        f[0] = vld1q_f32(taps + 0);
+        f[1] = vld1q_f32(taps + 4);
+        f[2] = vld1q_f32(taps + 8);
+        return;
+    }
 
-    {
-        const float32x4_t frac1 = vdupq_n_f32(frac);
-        const float32x4_t frac2 = vmulq_f32(frac1, frac1);
-        const float32x4_t frac3 = vmulq_f32(frac1, frac2);
+    const float32x4_t frac1 = vdupq_n_f32(frac);
+    const float32x4_t frac2 = vmulq_f32(frac1, frac1);
+    const float32x4_t frac3 = vmulq_f32(frac1, frac2);
 
 // Transposed in SetupAudioResampler
 #define X(out)                                                                                                                  \
     out = vmlaq_f32(vmlaq_f32(vmlaq_f32(filter[0].v128, filter[1].v128, frac1), filter[2].v128, frac2), filter[3].v128, frac3); \
     filter += 4
 
-        X(f0);
-        X(f1);
-        X(f2);
+    X(f[0]);
+    X(f[1]);
+    X(f[2]);
 
 #undef X
-    }
+}
 
-    if (chans == 2) {
-        float32x4x2_t g0 = vzipq_f32(f0, f0);
-        float32x4x2_t g1 = vzipq_f32(f1, f1);
-        float32x4x2_t g2 = vzipq_f32(f2, f2);
-
-        // Duplicate each of the filter elements and multiply by the input
-        // Use two accumulators to improve throughput
-        float32x4_t out0 = vmulq_f32(vld1q_f32(src + 0), g0.val[0]);
-        float32x4_t out1 = vmulq_f32(vld1q_f32(src + 4), g0.val[1]);
-        out0 = vmlaq_f32(out0, vld1q_f32(src + 8), g1.val[0]);
-        out1 = vmlaq_f32(out1, vld1q_f32(src + 12), g1.val[1]);
-        out0 = vmlaq_f32(out0, vld1q_f32(src + 16), g2.val[0]);
-        out1 = vmlaq_f32(out1, vld1q_f32(src + 20), g2.val[1]);
+// Multiply the filter by one mono frame, and add the lower and upper halves together
+static SDL_INLINE float32x2_t FilterMono_NEON(const float *src, const float32x4_t *f)
+{
+    float32x4_t out = vmulq_f32(f[0], vld1q_f32(src + 0));
+    out = vmlaq_f32(out, f[1], vld1q_f32(src + 4));
+    out = vmlaq_f32(out, f[2], vld1q_f32(src + 8));
 
-        // Add the accumulators together
-        out0 = vaddq_f32(out0, out1);
+    return vadd_f32(vget_low_f32(out), vget_high_f32(out));
+}
 
-        // Add the lower and upper pairs together
-        float32x2_t out = vadd_f32(vget_low_f32(out0), vget_high_f32(out0));
+// Multiply the filter by one stereo frame, returning the result for both channels
+static SDL_INLINE float32x2_t FilterStereo_NEON(const float *src, const float32x4_t *f)
+{
+    float32x4x2_t g0 = vzipq_f32(f[0], f[0]);
+    float32x4x2_t g1 = vzipq_f32(f[1], f[1]);
+    float32x4x2_t g2 = vzipq_f32(f[2], f[2]);
+
+    // Duplicate each of the filter elements and multiply by the input
+    // Use two accumulators to improve throughput
+    float32x4_t out0 = vmulq_f32(vld1q_f32(src + 0), g0.val[0]);
+    float32x4_t out1 = vmulq_f32(vld1q_f32(src + 4), g0.val[1]);
+    out0 = vmlaq_f32(out0, vld1q_f32(src + 8), g1.val[0]);
+    out1 = vmlaq_f32(out1, vld1q_f32(src + 12), g1.val[1]);
+    out0 = vmlaq_f32(out0, vld1q_f32(src + 16), g2.val[0]);
+    out1 = vmlaq_f32(out1, vld1q_f32(src + 20), g2.val[1]);
+
+    // Add the accumulators together
+    out0 = vaddq_f32(out0, out1);
+
+    // Add the lower and upper pairs together
+    return vadd_f32(vget_low_f32(out0), vget_high_f32(out0));
+}
 
-        // Store the result
-        vst1_f32(dst, out);
+static void ApplyFilter_NEON(const float *src, float *dst, const float32x4_t *f, int chans)
+{
+    if (chans == 2) {
+        vst1_f32(dst, FilterStereo_NEON(src, f));
         return;
     }
 
     if (chans == 1) {
-        // Multiply the filter by the input
-        float32x4_t out = vmulq_f32(f0, vld1q_f32(src + 0));
-        out = vmlaq_f32(out, f1, vld1q_f32(src + 4));
-        out = vmlaq_f32(out, f2, vld1q_f32(src + 8));
-
         // Horizontal sum
-        float32x2_t sum = vadd_f32(vget_low_f32(out), vget_high_f32(out));
+        float32x2_t sum = FilterMono_NEON(src, f);
         sum = vpadd_f32(sum, sum);
 
         vst1_lane_f32(dst, sum, 0);
         return;
     }
 
+    const float32x4_t f0 = f[0];
+    const float32x4_t f1 = f[1];
+    const float32x4_t f2 = f[2];
     int chan = 0;
 
     // Process 4 channels at once
@@ -393,6 +558,79 @@ static void ResampleFrame_Generic_NEON(const float *src, float *dst, const Cubic
         vst1_lane_f32(&dst[chan], sum, 0);
     }
 }
+
+static void ResampleFrame_Generic_NEON(const float *src, float *dst, const Cubic *filter, float frac, int chans)
+{
+    float32x4_t f[3];
+    LoadFilter_NEON(NULL, filter, frac, f);
+    ApplyFilter_NEON(src, dst, f, chans);
+}
+
+static void ResampleTaps_NEON(const float *src, float *dst, const float *taps, int chans)
+{
+    float32x4_t f[3];
+    LoadFilter_NEON(taps, NULL, 0.0f, f);
+    ApplyFilter_NEON(src, dst, f, chans);
+}
+
+// Resample 4 mono frames at a time, sharing the final pairwise adds between frames.
+// This gives exactly the same results as ApplyFilter_NEON.
+static int ResampleBlock_Mono_NEON(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate,
+                                   const float *polyphase, Uint32 phases)
+{
+    int i;
+
+    for (i = 0; i + 4 <= outframes; i += 4) {
+        float32x2_t out[4];
+        int j;
+
+        for (j = 0; j < 4; ++j) {
+            const float *taps = NULL;
+            const Cubic *filter = NULL;
+            float frac = 0.0f;
+            float32x4_t f[3];
+
+            const int srcindex = GetResampleFilter(srcpos, polyphase, phases, &taps, &filter, &frac);
+            srcpos += resample_rate;
+
+            LoadFilter_NEON(taps, filter, frac, f);
+            out[j] = FilterMono_NEON(&src[srcindex], f);
+        }
+
+        vst1q_f32(&dst[i], vcombine_f32(vpadd_f32(out[0], out[1]), vpadd_f32(out[2], out[3])));
+    }
+
+    return i;
+}
+
+// Resample 2 stereo frames at a time, storing both with a single write.
+static int ResampleBlock_Stereo_NEON(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate,
+                                     const float *polyphase, Uint32 phases)
+{
+    int i;
+
+    for (i = 0; i + 2 <= outframes; i += 2) {
+        float32x2_t out[2];
+        int j;
+
+        for (j = 0; j < 2; ++j) {
+            const float *taps = NULL;
+            const Cubic *filter = NULL;
+            float frac = 0.0f;
+            float32x4_t f[3];
+
+            const int srcindex = GetResampleFilter(srcpos, polyphase, phases, &taps, &filter, &frac);
+            srcpos += resample_rate;
+
+            LoadFilter_NEON(taps, filter, frac, f);
+            out[j] = FilterStereo_NEON(&src[srcindex * 2], f);
+        }
+
+        vst1q_f32(&dst[i * 2], vcombine_f32(out[0], out[1]));
+    }
+
+    return i;
+}
 #endif
 
 // Calculate the cubic equation which passes through all four points.
@@ -451,8 +689,6 @@ static float Sinc(const float *table, int x, int y)
     return (s * y) / x;
 }
 
-static Cubic ResamplerFilter[RESAMPLER_SAMPLES_PER_ZERO_CROSSING][RESAMPLER_SAMPLES_PER_FRAME];
-
 static void GenerateResamplerFilter(void)
 {
     enum
@@ -462,9 +698,7 @@ static void GenerateResamplerFilter(void)
         TABLE_SIZE = RESAMPLER_ZERO_CROSSINGS * TABLE_SAMPLES_PER_ZERO_CROSSING,
     };
 
-    // if dB > 50, beta=(0.1102 * (dB - 8.7)), according to Matlab.
-    const float dB = 80.0f;
-    const float beta = 0.1102f * (dB - 8.7f);
+    const float beta = RESAMPLER_KAISER_BETA;
     const float bessel_beta = BesselI0(beta);
     const float lensqr = TABLE_SIZE * TABLE_SIZE;
 
@@ -513,9 +747,62 @@ static void GenerateResamplerFilter(void)
     }
 }
 
+// Evaluate the same windowed sinc as GenerateResamplerFilter, at `frac` before input frame `n`
+// sin(pi * (n - frac)) is reduced to +/-sin(pi * frac), so the zero crossings are exact.
+static float ResamplerKernel(int n, float frac, float bessel_beta)
+{
+    const float x = (float)n - frac;
+    const float t = x / RESAMPLER_ZERO_CROSSINGS;
+
+    if (x == 0.0f) {
+        return 1.0f;
+    }
+
+    if ((t * t) >= 1.0f) {
+        return 0.0f;
+    }
+
+    const float b = BesselI0(RESAMPLER_KAISER_BETA * SDL_sqrtf(1.0f - (t * t))) / bessel_beta;
+    const float s = SDL_sinf(SDL_PI_F * frac) / (SDL_PI_F * x);
+    return (n & 1) ? (b * s) : -(b * s);
+}
+
+// Calculate the taps of each phase `i / phases` between two input frames.
+// The taps are stored in order, which matches the transposed layout used by the SIMD code.
+static float *CreatePolyphaseFilter(Uint32 phases)
+{
+    const float bessel_beta = BesselI0(RESAMPLER_KAISER_BETA);
+    Uint32 i;
+    int j;
+
+    float *polyphase = (float *)SDL_aligned_alloc(SDL_GetSIMDAlignment(), phases * RESAMPLER_SAMPLES_PER_FRAME * sizeof(float));
+    if (!polyphase) {
+        return NULL;
+    }
+
+    for (i = 0; i < phases; ++i) {
+        const float frac = (float)i / (float)phases;
+        float *taps = &polyphase[i * RESAMPLER_SAMPLES_PER_FRAME];
+
+        for (j = 0; j < RESAMPLER_SAMPLES_PER_FRAME; ++j) {
+            taps[j] = ResamplerKernel(j - (RESAMPLER_ZERO_CROSSINGS - 1), frac, bessel_beta);
+        }
+    }
+
+    return polyphase;
+}
+
 typedef void (*ResampleFrameFunc)(const float *src, float *dst, const Cubic *filter, float frac, int chans);
 static ResampleFrameFunc ResampleFrame[8];
 
+typedef void (*ResampleTapsFunc)(const float *src, float *dst, const float *taps, int chans);
+static ResampleTapsFunc ResampleTaps;
+
+// Resamples as many whole blocks of frames as possible, returning the number of frames written
+typedef int (*ResampleBlockFunc)(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate,
+                                 const float *polyphase, Uint32 phases);
+static ResampleBlockFunc ResampleBlock[2];
+
 // Transpose 4x4 floats
 static void Transpose4x4(Cubic *data)
 {
@@ -542,6 +829,9 @@ static void SetupAudioResampler(void)
         for (i = 0; i < 8; ++i) {
             ResampleFrame[i] = ResampleFrame_Generic_SSE;
         }
+        ResampleTaps = ResampleTaps_SSE;
+        ResampleBlock[0] = ResampleBlock_Mono_SSE;
+        ResampleBlock[1] = ResampleBlock_Stereo_SSE;
         transpose = true;
     } else
 #endif
@@ -550,6 +840,9 @@ static void SetupAudioResampler(void)
         for (i = 0; i < 8; ++i) {
             ResampleFrame[i] = ResampleFrame_Generic_NEON;
         }
+        ResampleTaps = ResampleTaps_NEON;
+        ResampleBlock[0] = ResampleBlock_Mono_NEON;
+        ResampleBlock[1] = ResampleBlock_Stereo_NEON;
         transpose = true;
     } else
 #endif
@@ -560,6 +853,7 @@ static void SetupAudioResampler(void)
 
         ResampleFrame[0] = ResampleFrame_Mono;
         ResampleFrame[1] = ResampleFrame_Stereo;
+        ResampleTaps = ResampleTaps_Generic;
     }
 
     if (transpose) {
@@ -675,16 +969,83 @@ Sint64 SDL_GetResamplerOutputFrames(Sint64 input_frames, Sint64 resample_rate, S
     return output_frames;
 }
 
-void SDL_ResampleAudio(int chans, const float *src, int inframes, float *dst, int outframes,
-                       Sint64 resample_rate, Sint64 *inout_resample_offset)
+void SDL_UpdateAudioResampler(SDL_AudioResampler *resampler, SDL_AudioResampleQuality quality, int src_rate, int dst_rate)
 {
-    int i;
-    Sint64 srcpos = *inout_resample_offset;
-    ResampleFrameFunc resample_frame = ResampleFrame[chans - 1];
+    Uint32 phases = 0;
 
-    SDL_assert(resample_rate > 0);
+    SDL_assert(src_rate > 0);
+    SDL_assert(dst_rate > 0);
 
-    src -= (RESAMPLER_ZERO_CROSSINGS - 1) * chans;
+    if ((quality != SDL_AUDIO_RESAMPLE_QUALITY_LINEAR) && (quality != SDL_AUDIO_RESAMPLE_QUALITY_CUBIC)) {
+        quality = SDL_AUDIO_RESAMPLE_QUALITY_HIGH;
+    }
+
+    if ((quality == resampler->quality) && (src_rate == resampler->src_rate) && (dst_rate == resampler->dst_rate)) {
+        return;
+    }
+
+    resampler->quality = quality;
+    resampler->src_rate = src_rate;
+    resampler->dst_rate = dst_rate;
+
+    if (quality == SDL_AUDIO_RESAMPLE_QUALITY_HIGH) {
+        phases = (Uint32)dst_rate / SDL_CalculateGCD((Uint32)src_rate, (Uint32)dst_rate);
+
+        if (phases > RESAMPLER_MAX_POLYPHASE_PHASES) {
+            phases = 0;
+        }
+    }
+
+    // The taps only depend on the number of phases, so the table can be kept if that is unchanged.
+    if (phases == resampler->polyphase_phases) {
+        return;
+    }
+
+    SDL_aligned_free(resampler->polyphase_filter);
+    resampler->polyphase_filter = phases ? CreatePolyphaseFilter(phases) : NULL;
+    resampler->polyphase_phases = resampler->polyphase_filter ? phases : 0;
+}
+
+void SDL_CleanupAudioResampler(SDL_AudioResampler *resampler)
+{
+    SDL_aligned_free(resampler->polyphase_filter);
+    resampler->polyphase_filter = NULL;
+    resampler->polyphase_phases = 0;
+    resampler->src_rate = 0;
+    resampler->dst_rate = 0;
+}
+
+// Linear interpolation between the two nearest frames
+SDL_FORCE_INLINE Sint64 ResampleLinear(int chans, const float *src, int inframes, float *dst, int outframes,
+                                       Sint64 resample_rate, Sint64 srcpos)
+{
+    int i, chan;
+
+    for (i = 0; i < outframes; ++i) {
+        int srcindex = (int)(Sint32)(srcpos >> 32);
+        Uint32 srcfraction = (Uint32)(srcpos & 0xFFFFFFFF);
+        srcpos += resample_rate;
+
+        SDL_assert(srcindex >= -1 && srcindex < inframes);
+
+        const float frac = (float)(srcfraction >> 8) * (1.0f / (1 << 24));
+        const float *in = &src[srcindex * chans];
+
+        for (chan = 0; chan < chans; ++chan) {
+            dst[chan] = in[chan] + ((in[chan + chans] - in[chan]) * frac);
+        }
+
+        dst += chans;
+    }
+
+    return srcpos;
+}
+
+// Catmull-Rom spline through the two frames on either side of the output frame
+SDL_FORCE_INLINE Sint64 ResampleCubic(int chans, const float *src, int inframes, float *dst, int outframes,
+                                      Sint64 resample_rate, Sint64 srcpos)
+{
+    int i, chan;
 
     for (i = 0; i < outframes; ++i) {
         int srcindex = (int)(Sint32)(srcpos >> 32);
@@ -693,14 +1054,101 @@ void SDL_ResampleAudio(int chans, const float *src, int inframes, float *dst, in
 
         SDL_assert(srcindex >= -1 && srcindex < inframes);
 
-        const Cubic *filter = ResamplerFilter[srcfraction >> RESAMPLER_FILTER_INTERP_BITS];
-        const float frac = (float)(srcfraction & (RESAMPLER_FILTER_INTERP_RANGE - 1)) * (1.0f / RESAMPLER_FILTER_INTERP_RANGE);
+        const float frac = (float)(srcfraction >> 8) * (1.0f / (1 << 24));
+        const float *in = &src[(srcindex - 1) * chans];
+
+        const float frac2 = frac * frac;
+        const float w0 = frac * (-0.5f + frac * (1.0f - 0.5f * frac));
+        const float w1 = 1.0f + frac2 * (-2.5f + 1.5f * frac);
+        const float w2 = frac * (0.5f + frac * (2.0f - 1.5f * frac));
+        const float w3 = frac2 * (-0.5f + 0.5f * frac);
+
+        for (chan = 0; chan < chans; ++chan) {
+            dst[chan] = (in[chan] * w0) + (in[chan + chans] * w1) + (in[chan + (chans * 2)] * w2) + (in[chan + (chans * 3)] * w3);
+        }
+
+        dst += chans;
+    }
+
+    return srcpos;
+}
+
+// Let the compiler unroll the channel loops for mono and stereo
+static Sint64 ResampleInterpolated(SDL_AudioResampleQuality quality, int chans, const float *src, int inframes, float *dst, int outframes,
+                                   Sint64 resample_rate, Sint64 srcpos)
+{
+    if (quality == SDL_AUDIO_RESAMPLE_QUALITY_LINEAR) {
+        switch (chans) {
+        case 1:
+            return ResampleLinear(1, src, inframes, dst, outframes, resample_rate, srcpos);
+        case 2:
+            return ResampleLinear(2, src, inframes, dst, outframes, resample_rate, srcpos);
+        default:
+            return ResampleLinear(chans, src, inframes, dst, outframes, resample_rate, srcpos);
+        }
+    }
+
+    switch (chans) {
+    case 1:
+        return ResampleCubic(1, src, inframes, dst, outframes, resample_rate, srcpos);
+    case 2:
+        return ResampleCubic(2, src, inframes, dst, outframes, resample_rate, srcpos);
+    default:
+        return ResampleCubic(chans, src, inframes, dst, outframes, resample_rate, srcpos);
+    }
+}
+
+static Sint64 ResampleSinc(const SDL_AudioResampler *resampler, int chans, const float *src, int inframes, float *dst, int outframes,
+                           Sint64 resample_rate, Sint64 srcpos)
+{
+    int i = 0;
+    const float *polyphase = resampler->polyphase_filter;
+    const Uint32 phases = resampler->polyphase_phases;
+    ResampleFrameFunc resample_frame = ResampleFrame[chans - 1];
+
+    src -= (RESAMPLER_ZERO_CROSSINGS - 1) * chans;
+
+    if ((chans <= 2) && ResampleBlock[chans - 1]) {
+        i = ResampleBlock[chans - 1](src, dst, outframes, srcpos, resample_rate, polyphase, phases);
+        srcpos += i * resample_rate;
+        dst += i * chans;
+    }
+
+    for (; i < outframes; ++i) {
+        const float *taps = NULL;
+        const Cubic *filter = NULL;
+        float frac = 0.0f;
+
+        SDL_assert((srcpos >> 32) >= -1 && (srcpos >> 32) < inframes);
+
+        const int srcindex = GetResampleFilter(srcpos, polyphase, phases, &taps, &filter, &frac);
+        srcpos += resample_rate;
 
         const float *frame = &src[srcindex * chans];
-        resample_frame(frame, dst, filter, frac, chans);
+        if (taps) {
+            ResampleTaps(frame, dst, taps, chans);
+        } else {
+            resample_frame(frame, dst, filter, frac, chans);
+        }
 
         dst += chans;
     }
 
+    return srcpos;
+}
+
+void SDL_ResampleAudio(const SDL_AudioResampler *resampler, int chans, const float *src, int inframes, float *dst, int outframes,
+                       Sint64 resample_rate, Sint64 *inout_resample_offset)
+{
+    Sint64 srcpos = *inout_resample_offset;
+
+    SDL_assert(resample_rate > 0);
+
+    if (resampler->quality == SDL_AUDIO_RESAMPLE_QUALITY_HIGH) {
+        srcpos = ResampleSinc(resampler, chans, src, inframes, dst, outframes, resample_rate, srcpos);
+    } else {
+        srcpos = ResampleInterpolated(resampler->quality, chans, src, inframes, dst, outframes, resample_rate, srcpos);
+    }
+
     *inout_resample_offset = srcpos - ((Sint64)inframes << 32);
 }
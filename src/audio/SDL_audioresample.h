@@ -26,6 +26,20 @@
 // Internal functions used by SDL_AudioStream for resampling audio.
 // The resampler uses 32:32 fixed-point arithmetic to track its position.
 
+// Per-stream resampler state
+typedef struct SDL_AudioResampler
+{
+    SDL_AudioResampleQuality quality;
+    int src_rate;
+    int dst_rate;
+    Uint32 polyphase_phases;  // 0 if the ratio has too many phases for a table
+    float *polyphase_filter;  // polyphase_phases sets of taps
+} SDL_AudioResampler;
+
+// Pick the filter for a quality preset and conversion. Does nothing if neither changed, and reuses the previous polyphase table if possible.
+void SDL_UpdateAudioResampler(SDL_AudioResampler *resampler, SDL_AudioResampleQuality quality, int src_rate, int dst_rate);
+void SDL_CleanupAudioResampler(SDL_AudioResampler *resampler);
+
 Sint64 SDL_GetResampleRate(int src_rate, int dst_rate);
 
 int SDL_GetResamplerHistoryFrames(void);
@@ -37,7 +51,7 @@ Sint64 SDL_GetResamplerOutputFrames(Sint64 input_frames, Sint64 resample_rate, S
 // Resample some audio.
 // REQUIRES: `inframes >= SDL_GetResamplerInputFrames(outframes)`
 // REQUIRES: At least `SDL_GetResamplerPaddingFrames(...)` extra frames to the left of src, and right of src+inframes
-void SDL_ResampleAudio(int chans, const float *src, int inframes, float *dst, int outframes,
+void SDL_ResampleAudio(const SDL_AudioResampler *resampler, int chans, const float *src, int inframes, float *dst, int outframes,
                        Sint64 resample_rate, Sint64 *inout_resample_offset);
 
 #endif // SDL_audioresample_h_
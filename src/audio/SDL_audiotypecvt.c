@@ -837,6 +837,115 @@ static void SDL_Convert_Swap32_NEON(Uint32 *dst, const Uint32 *src, int num_samp
 #undef CONVERT_16_FWD
 #undef CONVERT_16_REV
 
+/* Batched mixers: add several float32 sources into dst in a single pass, clamping after
+   each addition so the result is bit-identical to calling SDL_MixAudio() once per source. */
+
+static void SDL_MixFloat32Batch_Scalar(float *dst, const float *const *srcs, int num_srcs, int num_samples)
+{
+    for (int i = 0; i < num_samples; ++i) {
+        float sample = dst[i];
+        for (int j = 0; j < num_srcs; ++j) {
+            sample += srcs[j][i];
+            if (sample > 1.0f) {
+                sample = 1.0f;
+            } else if (sample < -1.0f) {
+                sample = -1.0f;
+            }
+        }
+        dst[i] = sample;
+    }
+}
+
+#ifdef SDL_SSE_INTRINSICS
+static void SDL_TARGETING("sse") SDL_MixFloat32Batch_SSE(float *dst, const float *const *srcs, int num_srcs, int num_samples)
+{
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 minus_one = _mm_set1_ps(-1.0f);
+    int i = 0;
+
+    for (; (i + 8) <= num_samples; i += 8) {
+        __m128 sample0 = _mm_loadu_ps(&dst[i]);
+        __m128 sample1 = _mm_loadu_ps(&dst[i + 4]);
+        for (int j = 0; j < num_srcs; ++j) {
+            const float *src = srcs[j];
+            sample0 = _mm_max_ps(_mm_min_ps(_mm_add_ps(sample0, _mm_loadu_ps(&src[i])), one), minus_one);
+            sample1 = _mm_max_ps(_mm_min_ps(_mm_add_ps(sample1, _mm_loadu_ps(&src[i + 4])), one), minus_one);
+        }
+        _mm_storeu_ps(&dst[i], sample0);
+        _mm_storeu_ps(&dst[i + 4], sample1);
+    }
+
+    if (i < num_samples) {
+        const float *tails[SDL_AUDIO_MIX_BATCH_STREAMS];
+        SDL_assert(num_srcs <= SDL_AUDIO_MIX_BATCH_STREAMS);
+        for (int j = 0; j < num_srcs; ++j) {
+            tails[j] = srcs[j] + i;
+        }
+        SDL_MixFloat32Batch_Scalar(dst + i, tails, num_srcs, num_samples - i);
+    }
+}
+#endif
+
+#ifdef SDL_AVX2_INTRINSICS
+static void SDL_TARGETING("avx2") SDL_MixFloat32Batch_AVX2(float *dst, const float *const *srcs, int num_srcs, int num_samples)
+{
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 minus_one = _mm256_set1_ps(-1.0f);
+    int i = 0;
+
+    for (; (i + 16) <= num_samples; i += 16) {
+        __m256 sample0 = _mm256_loadu_ps(&dst[i]);
+        __m256 sample1 = _mm256_loadu_ps(&dst[i + 8]);
+        for (int j = 0; j < num_srcs; ++j) {
+            const float *src = srcs[j];
+            sample0 = _mm256_max_ps(_mm256_min_ps(_mm256_add_ps(sample0, _mm256_loadu_ps(&src[i])), one), minus_one);
+            sample1 = _mm256_max_ps(_mm256_min_ps(_mm256_add_ps(sample1, _mm256_loadu_ps(&src[i + 8])), one), minus_one);
+        }
+        _mm256_storeu_ps(&dst[i], sample0);
+        _mm256_storeu_ps(&dst[i + 8], sample1);
+    }
+
+    if (i < num_samples) {
+        const float *tails[SDL_AUDIO_MIX_BATCH_STREAMS];
+        SDL_assert(num_srcs <= SDL_AUDIO_MIX_BATCH_STREAMS);
+        for (int j = 0; j < num_srcs; ++j) {
+            tails[j] = srcs[j] + i;
+        }
+        SDL_MixFloat32Batch_Scalar(dst + i, tails, num_srcs, num_samples - i);
+    }
+}
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+static void SDL_MixFloat32Batch_NEON(float *dst, const float *const *srcs, int num_srcs, int num_samples)
+{
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t minus_one = vdupq_n_f32(-1.0f);
+    int i = 0;
+
+    for (; (i + 8) <= num_samples; i += 8) {
+        float32x4_t sample0 = vld1q_f32(&dst[i]);
+        float32x4_t sample1 = vld1q_f32(&dst[i + 4]);
+        for (int j = 0; j < num_srcs; ++j) {
+            const float *src = srcs[j];
+            sample0 = vmaxq_f32(vminq_f32(vaddq_f32(sample0, vld1q_f32(&src[i])), one), minus_one);
+            sample1 = vmaxq_f32(vminq_f32(vaddq_f32(sample1, vld1q_f32(&src[i + 4])), one), minus_one);
+        }
+        vst1q_f32(&dst[i], sample0);
+        vst1q_f32(&dst[i + 4], sample1);
+    }
+
+    if (i < num_samples) {
+        const float *tails[SDL_AUDIO_MIX_BATCH_STREAMS];
+        SDL_assert(num_srcs <= SDL_AUDIO_MIX_BATCH_STREAMS);
+        for (int j = 0; j < num_srcs; ++j) {
+            tails[j] = srcs[j] + i;
+        }
+        SDL_MixFloat32Batch_Scalar(dst + i, tails, num_srcs, num_samples - i);
+    }
+}
+#endif
+
 // Function pointers set to a CPU-specific implementation.
 static void (*SDL_Convert_S8_to_F32)(float *dst, const Sint8 *src, int num_samples) = NULL;
 static void (*SDL_Convert_U8_to_F32)(float *dst, const Uint8 *src, int num_samples) = NULL;
@@ -850,6 +959,8 @@ static void (*SDL_Convert_F32_to_S32)(Sint32 *dst, const float *src, int num_sam
 static void (*SDL_Convert_Swap16)(Uint16 *dst, const Uint16 *src, int num_samples) = NULL;
 static void (*SDL_Convert_Swap32)(Uint32 *dst, const Uint32 *src, int num_samples) = NULL;
 
+static void (*SDL_MixFloat32Batch)(float *dst, const float *const *srcs, int num_srcs, int num_samples) = NULL;
+
 void ConvertAudioToFloat(float *dst, const void *src, int num_samples, SDL_AudioFormat src_fmt)
 {
     switch (src_fmt) {
@@ -933,6 +1044,12 @@ void ConvertAudioSwapEndian(void *dst, const void *src, int num_samples, int bit
     }
 }
 
+void MixFloat32AudioBatch(float *dst, const float *const *srcs, int num_srcs, int num_samples)
+{
+    SDL_assert(num_srcs <= SDL_AUDIO_MIX_BATCH_STREAMS);
+    SDL_MixFloat32Batch(dst, srcs, num_srcs, num_samples);
+}
+
 void SDL_ChooseAudioConverters(void)
 {
     static bool converters_chosen = false;
@@ -986,5 +1103,24 @@ void SDL_ChooseAudioConverters(void)
 
 #undef SET_CONVERTER_FUNCS
 
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        SDL_MixFloat32Batch = SDL_MixFloat32Batch_AVX2;
+    } else
+#endif
+#ifdef SDL_SSE_INTRINSICS
+    if (SDL_HasSSE()) {
+        SDL_MixFloat32Batch = SDL_MixFloat32Batch_SSE;
+    } else
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        SDL_MixFloat32Batch = SDL_MixFloat32Batch_NEON;
+    } else
+#endif
+    {
+        SDL_MixFloat32Batch = SDL_MixFloat32Batch_Scalar;
+    }
+
     converters_chosen = true;
 }
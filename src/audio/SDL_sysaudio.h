@@ -24,6 +24,8 @@
 #ifndef SDL_sysaudio_h_
 #define SDL_sysaudio_h_
 
+#include "SDL_audioresample.h"
+
 #define DEBUG_AUDIOSTREAM 0
 #define DEBUG_AUDIO_CONVERT 0
 
@@ -114,6 +116,12 @@ extern void ConvertAudioToFloat(float *dst, const void *src, int num_samples, SD
 extern void ConvertAudioFromFloat(void *dst, const float *src, int num_samples, SDL_AudioFormat dst_fmt);
 extern void ConvertAudioSwapEndian(void *dst, const void *src, int num_samples, int bitsize);
 
+// The most streams the playback thread will convert into scratch space before mixing them all in one pass.
+#define SDL_AUDIO_MIX_BATCH_STREAMS 8
+
+// Adds num_srcs float32 buffers into dst, clamping to [-1, 1] after each one, like repeated SDL_MixAudio() calls would.
+extern void MixFloat32AudioBatch(float *dst, const float *const *srcs, int num_srcs, int num_samples);
+
 extern bool SDL_ChannelMapIsDefault(const int *map, int channels);
 extern bool SDL_ChannelMapIsBogus(const int *map, int channels);
 
@@ -139,8 +147,24 @@ extern int *SDL_ChannelMapDup(const int *origchmap, int channels);
 extern void OnAudioStreamCreated(SDL_AudioStream *stream);
 extern void OnAudioStreamDestroy(SDL_AudioStream *stream);
 
+// Scratch space for conversions. It only grows, so once it's big enough it can be reused without allocating.
+typedef struct SDL_AudioWorkBuffer
+{
+    Uint8 *data;
+    size_t allocation;
+    Uint64 allocated_bytes;  // total bytes ever allocated for this buffer, for reporting allocations on the audio thread.
+} SDL_AudioWorkBuffer;
+
+// Returns NULL if the buffer needed to grow and couldn't; the previous contents are still valid in that case.
+extern Uint8 *SDL_EnsureAudioWorkBufferSize(SDL_AudioWorkBuffer *work_buffer, size_t len);
+extern void SDL_FreeAudioWorkBuffer(SDL_AudioWorkBuffer *work_buffer);
+
 // This just lets audio playback apply logical device gain at the same time as audiostream gain, so it's one multiplication instead of thousands.
-extern int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int len, float extra_gain);
+// It also lets the device thread supply its own scratch space, so bound streams don't each need one. If work_buffer is NULL, the stream's own is used.
+extern int SDL_GetAudioStreamDataAdjustGain(SDL_AudioStream *stream, void *voidbuf, int len, float extra_gain, SDL_AudioWorkBuffer *work_buffer);
+
+// Frees the scratch space kept between SDL_ConvertAudioSamples calls.
+extern void SDL_QuitAudioConversion(void);
 
 // This is the bulk of `SDL_SetAudioStream*putChannelMap`'s work, but it lets you skip the check about changing the device end of a stream if isinput==-1.
 extern bool SetAudioStreamChannelMap(SDL_AudioStream *stream, const SDL_AudioSpec *spec, int **stream_chmap, const int *chmap, int channels, int isinput);
@@ -224,9 +248,11 @@ struct SDL_AudioStream
     int *input_chmap;
     int input_chmap_storage[SDL_MAX_CHANNELMAP_CHANNELS];  // !!! FIXME: this needs to grow if SDL ever supports more channels. But if it grows, we should probably be more clever about allocations.
     Sint64 resample_offset;
+    SDL_AudioResampleQuality resample_quality;  // cached from SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER
+    SDL_AudioResampler resampler;
 
-    Uint8 *work_buffer;    // used for scratch space during data conversion/resampling.
-    size_t work_buffer_allocation;
+    SDL_AudioWorkBuffer work_buffer;  // used for scratch space during data conversion/resampling, unless the caller has its own.
+    Uint64 scratch_allocated_bytes;  // published as SDL_PROP_AUDIOSTREAM_SCRATCH_ALLOCATED_NUMBER
 
     bool simplified;  // true if created via SDL_OpenAudioDeviceStream
 
@@ -338,10 +364,14 @@ struct SDL_AudioDevice
     Uint8 *work_buffer;
     Uint8 *mix_buffer;
     float *postmix_buffer;
+    float *mix_batch_buffer;  // SDL_AUDIO_MIX_BATCH_STREAMS slots of work_buffer_size bytes each; playback only.
 
     // Size of work_buffer (and mix_buffer) in bytes.
     int work_buffer_size;
 
+    // Scratch space lent to every stream the device thread pulls data from, instead of each stream growing its own.
+    SDL_AudioWorkBuffer stream_work_buffer;
+
     // A thread to feed the audio device
     SDL_Thread *thread;
 
@@ -270,6 +270,9 @@ static void ClosePhysicalCamera(SDL_Camera *device)
     device->acquire_surface = NULL;
     SDL_DestroySurface(device->conversion_surface);
     device->conversion_surface = NULL;
+    SDL_aligned_free(device->scaling_bands);
+    device->scaling_bands = NULL;
+    device->num_scaling_bands = 0;
 
     for (int i = 0; i < SDL_arraysize(device->output_surfaces); i++) {
         SDL_DestroySurface(device->output_surfaces[i].surface);
@@ -795,6 +798,208 @@ SDL_CameraSpec **SDL_GetCameraSupportedFormats(SDL_CameraID instance_id, int *co
 
 // Camera device thread. This is split into chunks, so drivers that need to control this directly can use the pieces they need without duplicating effort.
 
+// Fused scaling and conversion...
+
+// Frames in 8-bit YUV formats are scaled one component plane at a time, reading straight from the camera's buffer.
+//  Samples in a plane are `step` bytes apart, so this covers packed formats like YUY2 as well as planar ones.
+typedef struct CameraPlane
+{
+    Uint8 *pixels;
+    int pitch;
+    int step;
+    int w;
+    int h;
+} CameraPlane;
+
+// Output is scaled in bands of this many rows, which can run on separate threads. This must be even, to keep 4:2:0 chroma rows in one band.
+#define CAMERA_SCALE_BAND_ROWS 16
+
+typedef struct CameraScaleJob
+{
+    SDL_Camera *device;
+    CameraPlane src[3];
+    CameraPlane dst[3];  // the planes of the output frame, if it's in a YUV format we can scale into directly.
+    SDL_Surface *output;
+    int grain;  // bands per chunk of the parallel loop. Each chunk has its own band buffer.
+} CameraScaleJob;
+
+static bool IsFusedScalingFormat(SDL_PixelFormat format)
+{
+    switch (format) {
+    case SDL_PIXELFORMAT_YUY2:
+    case SDL_PIXELFORMAT_UYVY:
+    case SDL_PIXELFORMAT_YVYU:
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
+    case SDL_PIXELFORMAT_IYUV:
+    case SDL_PIXELFORMAT_YV12:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static void SetCameraPlane(CameraPlane *plane, Uint8 *pixels, int pitch, int step, int w, int h)
+{
+    plane->pixels = pixels;
+    plane->pitch = pitch;
+    plane->step = step;
+    plane->w = w;
+    plane->h = h;
+}
+
+// Find the Y, U and V planes of a frame, laid out the way SDL_ConvertPixels() expects.
+static void GetCameraPlanes(SDL_PixelFormat format, int w, int h, void *pixels, int pitch, CameraPlane planes[3])
+{
+    Uint8 *base = (Uint8 *)pixels;
+    Uint8 *chroma = base + (size_t)pitch * h;
+    const int cw = (w + 1) / 2;
+    const int ch = (h + 1) / 2;
+
+    switch (format) {
+    case SDL_PIXELFORMAT_YUY2:  // Y0 U Y1 V
+        SetCameraPlane(&planes[0], base + 0, pitch, 2, w, h);
+        SetCameraPlane(&planes[1], base + 1, pitch, 4, cw, h);
+        SetCameraPlane(&planes[2], base + 3, pitch, 4, cw, h);
+        break;
+    case SDL_PIXELFORMAT_UYVY:  // U Y0 V Y1
+        SetCameraPlane(&planes[0], base + 1, pitch, 2, w, h);
+        SetCameraPlane(&planes[1], base + 0, pitch, 4, cw, h);
+        SetCameraPlane(&planes[2], base + 2, pitch, 4, cw, h);
+        break;
+    case SDL_PIXELFORMAT_YVYU:  // Y0 V Y1 U
+        SetCameraPlane(&planes[0], base + 0, pitch, 2, w, h);
+        SetCameraPlane(&planes[1], base + 3, pitch, 4, cw, h);
+        SetCameraPlane(&planes[2], base + 1, pitch, 4, cw, h);
+        break;
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21: {
+        const int uvpitch = 2 * ((pitch + 1) / 2);
+        const int u = (format == SDL_PIXELFORMAT_NV12) ? 0 : 1;
+        SetCameraPlane(&planes[0], base, pitch, 1, w, h);
+        SetCameraPlane(&planes[1], chroma + u, uvpitch, 2, cw, ch);
+        SetCameraPlane(&planes[2], chroma + (1 - u), uvpitch, 2, cw, ch);
+        break;
+    }
+    case SDL_PIXELFORMAT_IYUV:
+    case SDL_PIXELFORMAT_YV12: {
+        const int uvpitch = (pitch + 1) / 2;
+        Uint8 *first = chroma;
+        Uint8 *second = chroma + (size_t)uvpitch * ch;
+        SetCameraPlane(&planes[0], base, pitch, 1, w, h);
+        SetCameraPlane(&planes[1], (format == SDL_PIXELFORMAT_IYUV) ? first : second, uvpitch, 1, cw, ch);
+        SetCameraPlane(&planes[2], (format == SDL_PIXELFORMAT_IYUV) ? second : first, uvpitch, 1, cw, ch);
+        break;
+    }
+    default:
+        SDL_assert(!"Unexpected format for fused camera scaling");
+        SDL_memset(planes, 0, 3 * sizeof(*planes));
+        break;
+    }
+}
+
+// Scale one row of a plane with bilinear filtering. Sample positions are 16.16 fixed point, aligned on pixel centers.
+static void ScaleCameraPlaneRow(const CameraPlane *src, int dst_y, int dst_h, Uint8 *dst, int dst_step, int dst_w)
+{
+    const int maxx = (src->w - 1) << 16;
+    const int maxy = (src->h - 1) << 16;
+    const int dx = (int)(((Sint64)src->w << 16) / dst_w);
+    const int dy = (int)(((Sint64)src->h << 16) / dst_h);
+    const int sy = SDL_clamp(dst_y * dy + dy / 2 - 0x8000, 0, maxy);
+    const int y0 = sy >> 16;
+    const int fy = (sy >> 8) & 0xFF;
+    const int step = src->step;
+    const Uint8 *row0 = src->pixels + (size_t)y0 * src->pitch;
+    const Uint8 *row1 = (y0 < (src->h - 1)) ? (row0 + src->pitch) : row0;
+    int sx = dx / 2 - 0x8000;
+
+    for (int x = 0; x < dst_w; ++x, sx += dx, dst += dst_step) {
+        const int cx = SDL_clamp(sx, 0, maxx);
+        const int x0 = (cx >> 16) * step;
+        const int x1 = (cx < maxx) ? (x0 + step) : x0;
+        const int fx = (cx >> 8) & 0xFF;
+        const int top = (row0[x0] << 8) + (row0[x1] - row0[x0]) * fx;
+        const int bottom = (row1[x0] << 8) + (row1[x1] - row1[x0]) * fx;
+        *dst = (Uint8)(((top << 8) + (bottom - top) * fy + 0x8000) >> 16);
+    }
+}
+
+// Scale output rows [y, y+h) of each plane into `dst`. If `banded`, `dst` holds just those rows, otherwise the whole frame.
+static void ScaleCameraPlanes(const CameraPlane src[3], const CameraPlane dst[3], SDL_PixelFormat dst_format, int frame_h, int y, int h, bool banded)
+{
+    // only the chroma planes of 4:2:0 formats have fewer rows than the frame.
+    const bool subsampled = (dst_format == SDL_PIXELFORMAT_NV12 || dst_format == SDL_PIXELFORMAT_NV21 ||
+                             dst_format == SDL_PIXELFORMAT_IYUV || dst_format == SDL_PIXELFORMAT_YV12);
+
+    for (int i = 0; i < 3; i++) {
+        const int vs = (i > 0 && subsampled) ? 2 : 1;
+        const int plane_h = (frame_h + vs - 1) / vs;
+        const int first = y / vs;
+        const int last = SDL_min((y + h + vs - 1) / vs, plane_h);
+        const CameraPlane *plane = &dst[i];
+
+        for (int row = first; row < last; row++) {
+            Uint8 *dstrow = plane->pixels + (size_t)(banded ? (row - first) : row) * plane->pitch;
+            ScaleCameraPlaneRow(&src[i], row, plane_h, dstrow, plane->step, plane->w);
+        }
+    }
+}
+
+static void SDLCALL ScaleCameraFrameBands(void *userdata, int start, int end)
+{
+    const CameraScaleJob *job = (const CameraScaleJob *)userdata;
+    SDL_Camera *device = job->device;
+    SDL_Surface *output = job->output;
+    const SDL_PixelFormat src_format = device->acquire_surface->format;
+
+    for (int band = start; band < end; band++) {
+        const int y = band * CAMERA_SCALE_BAND_ROWS;
+        const int h = SDL_min(CAMERA_SCALE_BAND_ROWS, output->h - y);
+
+        if (device->scaling_bands) {
+            // Scale this band into a small frame in the camera's format, and convert it while it's still in cache.
+            Uint8 *band_pixels = device->scaling_bands + device->scaling_band_size * (start / job->grain);
+            CameraPlane planes[3];
+            GetCameraPlanes(src_format, output->w, h, band_pixels, device->scaling_band_pitch, planes);
+            ScaleCameraPlanes(job->src, planes, src_format, output->h, y, h, true);
+            SDL_ConvertPixels(output->w, h, src_format, band_pixels, device->scaling_band_pitch,
+                              output->format, (Uint8 *)output->pixels + (size_t)y * output->pitch, output->pitch);
+        } else {
+            ScaleCameraPlanes(job->src, job->dst, output->format, output->h, y, h, false);
+        }
+    }
+}
+
+// Scale a YUV camera frame and convert it to the app's format, reading the camera's buffer once and spreading bands of rows across the job system.
+static void ScaleCameraFrame(SDL_Camera *device, SDL_Surface *acquired, SDL_Surface *output)
+{
+    const int num_bands = (output->h + CAMERA_SCALE_BAND_ROWS - 1) / CAMERA_SCALE_BAND_ROWS;
+    CameraScaleJob job;
+
+    job.device = device;
+    job.output = output;
+    GetCameraPlanes(acquired->format, acquired->w, acquired->h, acquired->pixels, acquired->pitch, job.src);
+    if (device->scaling_bands) {
+        // split the loop into one chunk per band buffer, so no two threads ever share one.
+        SDL_zeroa(job.dst);
+        job.grain = (num_bands + device->num_scaling_bands - 1) / device->num_scaling_bands;
+    } else {
+        GetCameraPlanes(output->format, output->w, output->h, output->pixels, output->pitch, job.dst);
+        job.grain = 0;
+    }
+
+    SDL_ParallelFor(num_bands, job.grain, ScaleCameraFrameBands, &job);
+}
+
+static SDL_ScaleMode GetCameraScaleMode(SDL_PixelFormat format)
+{
+    // SDL_StretchSurface() only filters 32-bit pixels, and goes through XRGB8888 for YUV formats.
+    if (SDL_ISPIXELFORMAT_FOURCC(format) || (SDL_BYTESPERPIXEL(format) == 4 && format != SDL_PIXELFORMAT_ARGB2101010)) {
+        return SDL_SCALEMODE_LINEAR;
+    }
+    return SDL_SCALEMODE_NEAREST;
+}
+
 void SDL_CameraThreadSetup(SDL_Camera *device)
 {
     //camera_driver.impl.ThreadInit(device);
@@ -905,20 +1110,24 @@ bool SDL_CameraThreadIterate(SDL_Camera *device)
             SDL_Log("CAMERA: Frame is getting converted!");
             #endif
             SDL_Surface *srcsurf = acquired;
-            if (device->needs_scaling == -1) {  // downscaling? Do it first.  -1: downscale, 0: no scaling, 1: upscale
-                SDL_Surface *dstsurf = device->needs_conversion ? device->conversion_surface : output_surface;
-                SDL_StretchSurface(srcsurf, NULL, dstsurf, NULL, SDL_SCALEMODE_NEAREST);  // !!! FIXME: linear scale? letterboxing?
-                srcsurf = dstsurf;
-            }
-            if (device->needs_conversion) {
-                SDL_Surface *dstsurf = (device->needs_scaling == 1) ? device->conversion_surface : output_surface;
-                SDL_ConvertPixels(srcsurf->w, srcsurf->h,
-                                  srcsurf->format, srcsurf->pixels, srcsurf->pitch,
-                                  dstsurf->format, dstsurf->pixels, dstsurf->pitch);
-                srcsurf = dstsurf;
-            }
-            if (device->needs_scaling == 1) {  // upscaling? Do it last.  -1: downscale, 0: no scaling, 1: upscale
-                SDL_StretchSurface(srcsurf, NULL, output_surface, NULL, SDL_SCALEMODE_NEAREST);  // !!! FIXME: linear scale? letterboxing?
+            if (device->fused_scaling) {  // YUV camera frame? Scale and convert in one pass.
+                ScaleCameraFrame(device, acquired, output_surface);
+            } else {
+                if (device->needs_scaling == -1) {  // downscaling? Do it first.  -1: downscale, 0: no scaling, 1: upscale
+                    SDL_Surface *dstsurf = device->needs_conversion ? device->conversion_surface : output_surface;
+                    SDL_StretchSurface(srcsurf, NULL, dstsurf, NULL, GetCameraScaleMode(srcsurf->format));  // !!! FIXME: letterboxing?
+                    srcsurf = dstsurf;
+                }
+                if (device->needs_conversion) {
+                    SDL_Surface *dstsurf = (device->needs_scaling == 1) ? device->conversion_surface : output_surface;
+                    SDL_ConvertPixels(srcsurf->w, srcsurf->h,
+                                      srcsurf->format, srcsurf->pixels, srcsurf->pitch,
+                                      dstsurf->format, dstsurf->pixels, dstsurf->pitch);
+                    srcsurf = dstsurf;
+                }
+                if (device->needs_scaling == 1) {  // upscaling? Do it last.  -1: downscale, 0: no scaling, 1: upscale
+                    SDL_StretchSurface(srcsurf, NULL, output_surface, NULL, GetCameraScaleMode(srcsurf->format));  // !!! FIXME: letterboxing?
+                }
             }
 
             // we made a copy, so we can give the driver back its resources.
@@ -1017,14 +1226,33 @@ bool SDL_PrepareCameraSurfaces(SDL_Camera *device)
 
     device->needs_conversion = (devspec->format != appspec->format);
 
+    // YUV frames can be scaled straight into a YUV output, or into bands that are converted to any other format as they're finished.
+    device->fused_scaling = device->needs_scaling && IsFusedScalingFormat(devspec->format) &&
+                            (IsFusedScalingFormat(appspec->format) || !SDL_ISPIXELFORMAT_FOURCC(appspec->format));
+
     device->acquire_surface = SDL_CreateSurfaceFrom(devspec->width, devspec->height, devspec->format, NULL, 0);
     if (!device->acquire_surface) {
         goto failed;
     }
     SDL_SetSurfaceColorspace(device->acquire_surface, devspec->colorspace);
 
-    // if we have to scale _and_ convert, we need a middleman surface, since we can't do both changes at once.
-    if (device->needs_scaling && device->needs_conversion) {
+    if (device->fused_scaling && !IsFusedScalingFormat(appspec->format)) {
+        const int num_bands = (appspec->height + CAMERA_SCALE_BAND_ROWS - 1) / CAMERA_SCALE_BAND_ROWS;
+        size_t size, pitch;
+        if (!SDL_CalculateSurfaceSize(devspec->format, appspec->width, CAMERA_SCALE_BAND_ROWS, &size, &pitch, false)) {
+            goto failed;
+        }
+        device->scaling_band_size = size;
+        device->scaling_band_pitch = (int)pitch;
+        device->num_scaling_bands = SDL_min(num_bands, SDL_GetNumJobThreads() + 1);  // the workers, plus the camera thread.
+        device->scaling_bands = (Uint8 *)SDL_aligned_alloc(SDL_GetSIMDAlignment(), size * device->num_scaling_bands);
+        if (!device->scaling_bands) {
+            goto failed;
+        }
+    }
+
+    // if we have to scale _and_ convert the slow way, we need a middleman surface, since we can't do both changes at once.
+    if (device->needs_scaling && device->needs_conversion && !device->fused_scaling) {
         const bool downscaling_first = (device->needs_scaling < 0);
         const SDL_CameraSpec *s = downscaling_first ? appspec : devspec;
         const SDL_PixelFormat fmt = downscaling_first ? devspec->format : appspec->format;
@@ -1067,6 +1295,10 @@ failed:
         device->acquire_surface = NULL;
     }
 
+    SDL_aligned_free(device->scaling_bands);
+    device->scaling_bands = NULL;
+    device->num_scaling_bands = 0;
+
     if (device->conversion_surface) {
         SDL_DestroySurface(device->conversion_surface);
         device->conversion_surface = NULL;
@@ -150,6 +150,16 @@ struct SDL_Camera
     // true if acquire_surface needs to be converted for final output.
     bool needs_conversion;
 
+    // true if acquire_surface is scaled and converted in a single pass, without conversion_surface.
+    bool fused_scaling;
+
+    // Fused scaling to a non-YUV format goes through these: one small frame in the camera's format for each thread
+    //  that scales bands of output rows, reused for every band that thread converts.
+    Uint8 *scaling_bands;
+    size_t scaling_band_size;
+    int scaling_band_pitch;
+    int num_scaling_bands;
+
     // Current state flags
     SDL_AtomicInt shutdown;
     SDL_AtomicInt zombie;
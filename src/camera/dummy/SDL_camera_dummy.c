@@ -23,25 +23,89 @@
 #ifdef SDL_CAMERA_DRIVER_DUMMY
 
 #include "../SDL_syscamera.h"
+#include "../../video/SDL_pixels_c.h"
+
+// With SDL_HINT_CAMERA_DUMMY_TEST_PATTERN set, this driver offers one camera that shows a still test pattern,
+//  so SDL's frame conversion and scaling can be tested without camera hardware.
+
+struct SDL_PrivateCameraData
+{
+    SDL_Surface *frame;  // the test pattern, in the camera's format.
+};
+
+// Fine detail that's the same in every channel only touches luma, so it shows up scaling mistakes without
+//  running into what subsampled chroma can't represent. Chroma just gets gentle ramps.
+static void FillTestPattern(SDL_Surface *surface)
+{
+    const int w = surface->w;
+    const int h = surface->h;
+
+    for (int y = 0; y < h; y++) {
+        Uint32 *row = (Uint32 *)((Uint8 *)surface->pixels + (size_t)y * surface->pitch);
+        for (int x = 0; x < w; x++) {
+            const int detail = (int)(60.0f * SDL_sinf(x * 0.3f) * SDL_cosf(y * 0.23f));
+            const Uint8 r = (Uint8)(64 + (x * 127) / SDL_max(w - 1, 1) + detail);
+            const Uint8 g = (Uint8)(96 + detail);
+            const Uint8 b = (Uint8)(64 + (y * 127) / SDL_max(h - 1, 1) + detail);
+            row[x] = SDL_MapSurfaceRGB(surface, r, g, b);
+        }
+    }
+}
 
 static bool DUMMYCAMERA_OpenDevice(SDL_Camera *device, const SDL_CameraSpec *spec)
 {
-    return SDL_Unsupported();
+    device->hidden = (struct SDL_PrivateCameraData *)SDL_calloc(1, sizeof(*device->hidden));
+    if (!device->hidden) {
+        return false;
+    }
+
+    SDL_Surface *pattern = SDL_CreateSurface(spec->width, spec->height, SDL_PIXELFORMAT_XRGB8888);
+    if (!pattern) {
+        return false;
+    }
+    FillTestPattern(pattern);
+
+    device->hidden->frame = SDL_CreateSurface(spec->width, spec->height, spec->format);
+    bool result = false;
+    if (device->hidden->frame) {
+        SDL_SetSurfaceColorspace(device->hidden->frame, spec->colorspace);
+        result = SDL_ConvertPixelsAndColorspace(spec->width, spec->height,
+                    pattern->format, SDL_COLORSPACE_SRGB, 0, pattern->pixels, pattern->pitch,
+                    spec->format, spec->colorspace, 0, device->hidden->frame->pixels, device->hidden->frame->pitch);
+    }
+    SDL_DestroySurface(pattern);
+
+    if (result) {
+        SDL_CameraPermissionOutcome(device, true);  // there's nothing to ask permission for.
+    }
+    return result;
 }
 
 static void DUMMYCAMERA_CloseDevice(SDL_Camera *device)
 {
+    if (device->hidden) {
+        SDL_DestroySurface(device->hidden->frame);
+        SDL_free(device->hidden);
+        device->hidden = NULL;
+    }
 }
 
 static bool DUMMYCAMERA_WaitDevice(SDL_Camera *device)
 {
-    return SDL_Unsupported();
+    if (!SDL_GetAtomicInt(&device->shutdown)) {
+        const SDL_CameraSpec *spec = &device->actual_spec;
+        SDL_DelayNS(SDL_NS_PER_SECOND * (Uint64)spec->framerate_denominator / SDL_max(spec->framerate_numerator, 1));
+    }
+    return true;
 }
 
 static SDL_CameraFrameResult DUMMYCAMERA_AcquireFrame(SDL_Camera *device, SDL_Surface *frame, Uint64 *timestampNS, float *rotation)
 {
-    SDL_Unsupported();
-    return SDL_CAMERA_FRAME_ERROR;
+    // the pattern never changes, so hand out the same pixels every time.
+    frame->pixels = device->hidden->frame->pixels;
+    frame->pitch = device->hidden->frame->pitch;
+    *timestampNS = SDL_GetTicksNS();
+    return SDL_CAMERA_FRAME_READY;
 }
 
 static void DUMMYCAMERA_ReleaseFrame(SDL_Camera *device, SDL_Surface *frame)
@@ -50,6 +114,22 @@ static void DUMMYCAMERA_ReleaseFrame(SDL_Camera *device, SDL_Surface *frame)
 
 static void DUMMYCAMERA_DetectDevices(void)
 {
+    // the hint looks like "NV12 640x480": a FOURCC code and the size of the frames.
+    const char *hint = SDL_GetHint(SDL_HINT_CAMERA_DUMMY_TEST_PATTERN);
+    char fourcc[5];
+    int w = 0, h = 0;
+    if (!hint || SDL_sscanf(hint, "%4s %dx%d", fourcc, &w, &h) != 3 || SDL_strlen(fourcc) != 4 || w <= 0 || h <= 0) {
+        return;
+    }
+
+    SDL_CameraSpec spec;
+    spec.format = (SDL_PixelFormat)SDL_DEFINE_PIXELFOURCC(fourcc[0], fourcc[1], fourcc[2], fourcc[3]);
+    spec.colorspace = SDL_GetDefaultColorspaceForFormat(spec.format);
+    spec.width = w;
+    spec.height = h;
+    spec.framerate_numerator = 100;
+    spec.framerate_denominator = 1;
+    SDL_AddCamera("Test pattern", SDL_CAMERA_POSITION_UNKNOWN, 1, &spec, (void *)(size_t)0x1);  // the handle just has to be non-NULL.
 }
 
 static void DUMMYCAMERA_FreeDeviceHandle(SDL_Camera *device)
@@ -110,6 +110,8 @@
 #define CPU_HAS_LSX      (1 << 12)
 #define CPU_HAS_LASX     (1 << 13)
 #define CPU_HAS_SVE2     (1 << 14)
+#define CPU_HAS_PCLMUL   (1 << 15)
+#define CPU_HAS_ARM_CRC32 (1 << 16)
 
 #define CPU_CFG2      0x2
 #define CPU_CFG2_LSX  (1 << 6)
@@ -536,6 +538,39 @@ static int CPU_haveSVE2(void)
 #endif
 }
 
+#ifndef HWCAP_CRC32
+#define HWCAP_CRC32 (1 << 7)
+#endif
+
+static int CPU_haveARMCRC32(void)
+{
+#if defined(__ARM_FEATURE_CRC32)
+    return 1;
+#elif defined(SDL_PLATFORM_WINDOWS) && defined(_M_ARM64)
+#ifndef PF_ARM_V8_CRC32_INSTRUCTIONS_AVAILABLE
+#define PF_ARM_V8_CRC32_INSTRUCTIONS_AVAILABLE 31
+#endif
+    return IsProcessorFeaturePresent(PF_ARM_V8_CRC32_INSTRUCTIONS_AVAILABLE) != 0;
+#elif defined(SDL_PLATFORM_APPLE) && defined(__aarch64__) && defined(HAVE_SYSCTLBYNAME)
+    int hascrc32 = 0;
+    size_t size = sizeof(hascrc32);
+    if (sysctlbyname("hw.optional.armv8_crc32", &hascrc32, &size, NULL, 0) != 0) {
+        return 0;
+    }
+    return hascrc32;
+#elif defined(__aarch64__) && defined(HAVE_ELF_AUX_INFO)
+    unsigned long hwcap = 0;
+    if (elf_aux_info(AT_HWCAP, (void *)&hwcap, (int)sizeof(hwcap)) != 0) {
+        return 0;
+    }
+    return (hwcap & HWCAP_CRC32) == HWCAP_CRC32;
+#elif defined(__aarch64__) && ((defined(SDL_PLATFORM_LINUX) && defined(HAVE_GETAUXVAL)) || defined(SDL_PLATFORM_ANDROID))
+    return (getauxval(AT_HWCAP) & HWCAP_CRC32) == HWCAP_CRC32;
+#else
+    return 0;
+#endif
+}
+
 static int CPU_readCPUCFG(void)
 {
     uint32_t cfg2 = 0;
@@ -587,6 +622,11 @@ static int CPU_readCPUCFG(void)
 #else
 #define CPU_haveAVX() (0)
 #endif
+#ifdef __PCLMUL__
+#define CPU_havePCLMUL() (1)
+#else
+#define CPU_havePCLMUL() (0)
+#endif
 #else
 #define CPU_haveMMX()   (CPU_CPUIDFeatures[3] & 0x00800000)
 #define CPU_haveSSE()   (CPU_CPUIDFeatures[3] & 0x02000000)
@@ -595,6 +635,7 @@ static int CPU_readCPUCFG(void)
 #define CPU_haveSSE41() (CPU_CPUIDFeatures[2] & 0x00080000)
 #define CPU_haveSSE42() (CPU_CPUIDFeatures[2] & 0x00100000)
 #define CPU_haveAVX()   (CPU_OSSavesYMM && (CPU_CPUIDFeatures[2] & 0x10000000))
+#define CPU_havePCLMUL() (CPU_CPUIDFeatures[2] & 0x00000002)
 #endif
 
 #ifdef __e2k__
@@ -984,6 +1025,10 @@ static Uint32 SDLCALL SDL_CPUFeatureMaskFromHint(void)
                 spot_mask = CPU_HAS_LASX;
             } else if (ref_string_equals("sve2", spot, end)) {
                 spot_mask = CPU_HAS_SVE2;
+            } else if (ref_string_equals("pclmul", spot, end)) {
+                spot_mask = CPU_HAS_PCLMUL;
+            } else if (ref_string_equals("arm-crc32", spot, end)) {
+                spot_mask = CPU_HAS_ARM_CRC32;
             } else {
                 // Ignore unknown/incorrect cpu feature(s)
                 continue;
@@ -1064,6 +1109,12 @@ static Uint32 SDL_GetCPUFeatures(void)
             SDL_CPUFeatures |= CPU_HAS_SVE2;
             SDL_SIMDAlignment = SDL_max(SDL_SIMDAlignment, 16);
         }
+        if (CPU_havePCLMUL()) {
+            SDL_CPUFeatures |= CPU_HAS_PCLMUL;
+        }
+        if (CPU_haveARMCRC32()) {
+            SDL_CPUFeatures |= CPU_HAS_ARM_CRC32;
+        }
         SDL_CPUFeatures &= SDL_CPUFeatureMaskFromHint();
     }
     return SDL_CPUFeatures;
@@ -1150,6 +1201,16 @@ bool SDL_HasSVE2(void)
     return CPU_FEATURE_AVAILABLE(CPU_HAS_SVE2);
 }
 
+bool SDL_HasPCLMUL(void)
+{
+    return CPU_FEATURE_AVAILABLE(CPU_HAS_PCLMUL);
+}
+
+bool SDL_HasARMCRC32(void)
+{
+    return CPU_FEATURE_AVAILABLE(CPU_HAS_ARM_CRC32);
+}
+
 static int SDL_SystemRAM = 0;
 
 int SDL_GetSystemRAM(void)
@@ -24,4 +24,8 @@
 
 extern void SDL_QuitCPUInfo(void);
 
+// CPU features that are only used internally
+extern bool SDL_HasPCLMUL(void);
+extern bool SDL_HasARMCRC32(void);
+
 #endif // SDL_cpuinfo_c_h_
@@ -1328,3 +1328,21 @@
 #define SDL_GetDeviceFormFactor SDL_GetDeviceFormFactor_REAL
 #define SDL_GetDeviceFormFactorName SDL_GetDeviceFormFactorName_REAL
 #define SDL_IsUbuntuTouch SDL_IsUbuntuTouch_REAL
+#define SDL_LoadGPUPipelineCache SDL_LoadGPUPipelineCache_REAL
+#define SDL_SaveGPUPipelineCache SDL_SaveGPUPipelineCache_REAL
+#define SDL_CopyFileAsync SDL_CopyFileAsync_REAL
+#define SDL_IOFromMappedFile SDL_IOFromMappedFile_REAL
+#define SDL_GetIOMappedPointer SDL_GetIOMappedPointer_REAL
+#define SDL_ReadAsyncIOBatch SDL_ReadAsyncIOBatch_REAL
+#define SDL_CreateJobCounter SDL_CreateJobCounter_REAL
+#define SDL_SubmitJob SDL_SubmitJob_REAL
+#define SDL_IsJobCounterDone SDL_IsJobCounterDone_REAL
+#define SDL_WaitJobCounter SDL_WaitJobCounter_REAL
+#define SDL_DestroyJobCounter SDL_DestroyJobCounter_REAL
+#define SDL_ParallelFor SDL_ParallelFor_REAL
+#define SDL_GetNumJobThreads SDL_GetNumJobThreads_REAL
+#define SDL_mergesort SDL_mergesort_REAL
+#define SDL_mergesort_r SDL_mergesort_r_REAL
+#define SDL_parallel_mergesort_r SDL_parallel_mergesort_r_REAL
+#define SDL_radixsort SDL_radixsort_REAL
+#define SDL_GetTimerStatistics SDL_GetTimerStatistics_REAL
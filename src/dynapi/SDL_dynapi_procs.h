@@ -1336,3 +1336,21 @@ SDL_DYNAPI_PROC(bool,SDL_RemoveNotification,(SDL_NotificationID a),(a),return)
 SDL_DYNAPI_PROC(SDL_FormFactor,SDL_GetDeviceFormFactor,(void),(),return)
 SDL_DYNAPI_PROC(const char*,SDL_GetDeviceFormFactorName,(SDL_FormFactor a),(a),return)
 SDL_DYNAPI_PROC(bool,SDL_IsUbuntuTouch,(void),(),return)
+SDL_DYNAPI_PROC(bool,SDL_LoadGPUPipelineCache,(SDL_GPUDevice *a,SDL_IOStream *b,bool c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_SaveGPUPipelineCache,(SDL_GPUDevice *a,SDL_IOStream *b,bool c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_CopyFileAsync,(const char *a,const char *b,SDL_AsyncIOQueue *c,void *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(SDL_IOStream*,SDL_IOFromMappedFile,(const char *a,SDL_IOMapFlags b),(a,b),return)
+SDL_DYNAPI_PROC(const void*,SDL_GetIOMappedPointer,(SDL_IOStream *a,size_t *b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_ReadAsyncIOBatch,(const SDL_AsyncIOReadRequest *a,int b,SDL_AsyncIOQueue *c),(a,b,c),return)
+SDL_DYNAPI_PROC(SDL_JobCounter*,SDL_CreateJobCounter,(void),(),return)
+SDL_DYNAPI_PROC(bool,SDL_SubmitJob,(SDL_JobFunction a,void *b,SDL_JobCounter *c,SDL_JobCounter *d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(bool,SDL_IsJobCounterDone,(SDL_JobCounter *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_WaitJobCounter,(SDL_JobCounter *a),(a),)
+SDL_DYNAPI_PROC(void,SDL_DestroyJobCounter,(SDL_JobCounter *a),(a),)
+SDL_DYNAPI_PROC(void,SDL_ParallelFor,(int a,int b,SDL_ParallelForFunction c,void *d),(a,b,c,d),)
+SDL_DYNAPI_PROC(int,SDL_GetNumJobThreads,(void),(),return)
+SDL_DYNAPI_PROC(bool,SDL_mergesort,(void *a,size_t b,size_t c,SDL_CompareCallback d),(a,b,c,d),return)
+SDL_DYNAPI_PROC(bool,SDL_mergesort_r,(void *a,size_t b,size_t c,SDL_CompareCallback_r d,void *e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(bool,SDL_parallel_mergesort_r,(void *a,size_t b,size_t c,SDL_CompareCallback_r d,void *e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(bool,SDL_radixsort,(void *a,size_t b,size_t c,size_t d,SDL_SortKeyType e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(bool,SDL_GetTimerStatistics,(Uint64 *a,Uint64 *b,Uint64 *c),(a,b,c),return)
@@ -53,6 +53,9 @@
 // An arbitrary limit so we don't have unbounded growth
 #define SDL_MAX_QUEUED_EVENTS 65535
 
+// How many events can be added without taking the event queue lock (must be a power of two)
+#define SDL_EVENT_RING_SIZE 1024
+
 // Determines how often we pump events if joystick or sensor subsystems are active
 #define ENUMERATION_POLL_INTERVAL_NS (3 * SDL_NS_PER_SECOND)
 
@@ -116,7 +119,7 @@ typedef struct SDL2_SysWMmsg
 
 static SDL_EventWatchList SDL_event_watchers;
 static SDL_AtomicInt SDL_sentinel_pending;
-static Uint32 SDL_last_event_id = 0;
+static SDL_AtomicU32 SDL_last_event_id;
 
 typedef struct
 {
@@ -149,16 +152,29 @@ typedef struct SDL_EventEntry
     struct SDL_EventEntry *next;
 } SDL_EventEntry;
 
+/* Events are added to a bounded multi-producer ring without taking the queue lock, and
+   moved into the linked list (in order) by whoever next looks at the queue with the lock held.
+   A slot's sequence equals its position when it's free, and position + 1 once it holds an event. */
+typedef struct SDL_EventRingSlot
+{
+    SDL_AtomicU32 sequence;
+    SDL_EventEntry entry;
+} SDL_EventRingSlot;
+
 static struct
 {
     SDL_Mutex *lock;
-    bool active;
+    SDL_AtomicInt active;
     SDL_AtomicInt count;
-    int max_events_seen;
+    SDL_AtomicInt max_events_seen;
     SDL_EventEntry *head;
     SDL_EventEntry *tail;
     SDL_EventEntry *free;
-} SDL_EventQ = { NULL, false, { 0 }, 0, NULL, NULL, NULL };
+    SDL_EventRingSlot *ring;
+    SDL_AtomicU32 ring_tail;   // next position to add at, claimed by producers
+    Uint32 ring_head;          // next position to drain, only touched with the lock held
+    SDL_AtomicInt producers;   // threads currently adding events without the lock
+} SDL_EventQ;
 
 
 SDL_Mutex *SDL_event_lock = NULL; // This needs to support recursive locks
@@ -989,16 +1005,32 @@ void SDL_StopEventLoop(void)
     SDL_EventEntry *entry;
     SDL_Mutex *lock = SDL_EventQ.lock;
 
-    SDL_LockMutex(lock);
+    /* Stop accepting new events, and wait for any that are being added without the lock.
+       This has to happen before we lock, since they may need the lock if the ring is full. */
+    SDL_SetAtomicInt(&SDL_EventQ.active, 0);
+    while (SDL_GetAtomicInt(&SDL_EventQ.producers) > 0) {
+        SDL_CPUPauseInstruction();
+    }
 
-    SDL_EventQ.active = false;
+    SDL_LockMutex(lock);
 
     if (report && SDL_atoi(report)) {
         SDL_Log("SDL EVENT QUEUE: Maximum events in-flight: %d",
-                SDL_EventQ.max_events_seen);
+                SDL_GetAtomicInt(&SDL_EventQ.max_events_seen));
     }
 
     // Clean out EventQ
+    if (SDL_EventQ.ring) {
+        for (;; ++SDL_EventQ.ring_head) {
+            SDL_EventRingSlot *slot = &SDL_EventQ.ring[SDL_EventQ.ring_head & (SDL_EVENT_RING_SIZE - 1)];
+            if (SDL_GetAtomicU32(&slot->sequence) != SDL_EventQ.ring_head + 1) {
+                break;
+            }
+            SDL_TransferTemporaryMemoryFromEvent(&slot->entry);
+        }
+        SDL_free(SDL_EventQ.ring);
+        SDL_EventQ.ring = NULL;
+    }
     for (entry = SDL_EventQ.head; entry;) {
         SDL_EventEntry *next = entry->next;
         SDL_TransferTemporaryMemoryFromEvent(entry);
@@ -1012,7 +1044,7 @@ void SDL_StopEventLoop(void)
     }
 
     SDL_SetAtomicInt(&SDL_EventQ.count, 0);
-    SDL_EventQ.max_events_seen = 0;
+    SDL_SetAtomicInt(&SDL_EventQ.max_events_seen, 0);
     SDL_EventQ.head = NULL;
     SDL_EventQ.tail = NULL;
     SDL_EventQ.free = NULL;
@@ -1060,7 +1092,19 @@ bool SDL_StartEventLoop(void)
 
     SDL_InitWindowEventWatch();
 
-    SDL_EventQ.active = true;
+    if (!SDL_EventQ.ring) {
+        // If this fails, events just always go through the locked list.
+        SDL_EventQ.ring = (SDL_EventRingSlot *)SDL_malloc(SDL_EVENT_RING_SIZE * sizeof(*SDL_EventQ.ring));
+        if (SDL_EventQ.ring) {
+            for (Uint32 i = 0; i < SDL_EVENT_RING_SIZE; ++i) {
+                SDL_SetAtomicU32(&SDL_EventQ.ring[i].sequence, i);
+            }
+            SDL_SetAtomicU32(&SDL_EventQ.ring_tail, 0);
+            SDL_EventQ.ring_head = 0;
+        }
+    }
+
+    SDL_SetAtomicInt(&SDL_EventQ.active, 1);
 
 #ifndef SDL_THREADS_DISABLED
     SDL_UnlockMutex(SDL_EventQ.lock);
@@ -1068,28 +1112,28 @@ bool SDL_StartEventLoop(void)
     return true;
 }
 
-// Add an event to the event queue -- called with the queue locked
-static int SDL_AddEvent(SDL_Event *event)
+// Count an event against the queue limit -- safe to call without the queue locked
+static bool SDL_ReserveQueuedEvent(void)
 {
-    SDL_EventEntry *entry;
-    const int initial_count = SDL_GetAtomicInt(&SDL_EventQ.count);
-    int final_count;
+    const int count = SDL_AddAtomicInt(&SDL_EventQ.count, 1) + 1;
+    int max_events_seen;
 
-    if (initial_count >= SDL_MAX_QUEUED_EVENTS) {
-        SDL_SetError("Event queue is full (%d events)", initial_count);
-        return 0;
+    if (count > SDL_MAX_QUEUED_EVENTS) {
+        SDL_AddAtomicInt(&SDL_EventQ.count, -1);
+        SDL_SetError("Event queue is full (%d events)", count - 1);
+        return false;
     }
 
-    if (SDL_EventQ.free == NULL) {
-        entry = (SDL_EventEntry *)SDL_malloc(sizeof(*entry));
-        if (entry == NULL) {
-            return 0;
-        }
-    } else {
-        entry = SDL_EventQ.free;
-        SDL_EventQ.free = entry->next;
+    max_events_seen = SDL_GetAtomicInt(&SDL_EventQ.max_events_seen);
+    while (count > max_events_seen && !SDL_CompareAndSwapAtomicInt(&SDL_EventQ.max_events_seen, max_events_seen, count)) {
+        max_events_seen = SDL_GetAtomicInt(&SDL_EventQ.max_events_seen);
     }
+    return true;
+}
 
+// Fill in a queue entry for a new event -- safe to call without the queue locked
+static void SDL_PrepareEventEntry(SDL_EventEntry *entry, const SDL_Event *event)
+{
     if (SDL_EventLoggingVerbosity > 0) {
         SDL_LogEvent(event);
     }
@@ -1101,6 +1145,26 @@ static int SDL_AddEvent(SDL_Event *event)
     entry->memory = NULL;
     SDL_TransferTemporaryMemoryToEvent(entry);
 
+    SDL_AddAtomicU32(&SDL_last_event_id, 1);
+}
+
+// Get an unused list entry -- called with the queue locked
+static SDL_EventEntry *SDL_AllocEventEntry(void)
+{
+    SDL_EventEntry *entry;
+
+    if (SDL_EventQ.free == NULL) {
+        entry = (SDL_EventEntry *)SDL_malloc(sizeof(*entry));
+    } else {
+        entry = SDL_EventQ.free;
+        SDL_EventQ.free = entry->next;
+    }
+    return entry;
+}
+
+// Append an entry to the end of the list -- called with the queue locked
+static void SDL_LinkEvent(SDL_EventEntry *entry)
+{
     if (SDL_EventQ.tail) {
         SDL_EventQ.tail->next = entry;
         entry->prev = SDL_EventQ.tail;
@@ -1113,15 +1177,116 @@ static int SDL_AddEvent(SDL_Event *event)
         entry->prev = NULL;
         entry->next = NULL;
     }
+}
+
+// Move events from the ring to the end of the list, oldest first -- called with the queue locked
+static void SDL_DrainEventRing(void)
+{
+    if (!SDL_EventQ.ring) {
+        return;
+    }
+
+    for (;;) {
+        SDL_EventRingSlot *slot = &SDL_EventQ.ring[SDL_EventQ.ring_head & (SDL_EVENT_RING_SIZE - 1)];
+        if (SDL_GetAtomicU32(&slot->sequence) != SDL_EventQ.ring_head + 1) {
+            break;  // empty, or the next event is still being written.
+        }
+
+        SDL_EventEntry *entry = SDL_AllocEventEntry();
+        if (!entry) {
+            break;  // leave the rest in the ring, we'll try again next time.
+        }
+        SDL_copyp(&entry->event, &slot->entry.event);
+        entry->memory = slot->entry.memory;
+        SDL_LinkEvent(entry);
+
+        SDL_SetAtomicU32(&slot->sequence, SDL_EventQ.ring_head + SDL_EVENT_RING_SIZE);
+        ++SDL_EventQ.ring_head;
+    }
+}
+
+// Add an event to the ring -- called without the queue locked, returns false if the ring is full
+static bool SDL_AddEventToRing(const SDL_Event *event)
+{
+    SDL_EventRingSlot *slot;
+    Uint32 pos;
+
+    if (!SDL_EventQ.ring) {
+        return false;
+    }
+
+    pos = SDL_GetAtomicU32(&SDL_EventQ.ring_tail);
+    for (;;) {
+        slot = &SDL_EventQ.ring[pos & (SDL_EVENT_RING_SIZE - 1)];
+        const Sint32 diff = (Sint32)(SDL_GetAtomicU32(&slot->sequence) - pos);
+        if (diff == 0) {
+            if (SDL_CompareAndSwapAtomicU32(&SDL_EventQ.ring_tail, pos, pos + 1)) {
+                break;  // this slot is ours.
+            }
+        } else if (diff < 0) {
+            return false;  // the consumer hasn't drained this slot yet, we're full.
+        }
+        pos = SDL_GetAtomicU32(&SDL_EventQ.ring_tail);
+    }
+
+    SDL_PrepareEventEntry(&slot->entry, event);
+    SDL_SetAtomicU32(&slot->sequence, pos + 1);  // publish it.
+    return true;
+}
+
+// Add an event to the event queue -- called without the queue locked
+static int SDL_AddEvent(SDL_Event *event)
+{
+    SDL_EventEntry *entry;
+
+    if (!SDL_ReserveQueuedEvent()) {
+        return 0;
+    }
 
-    final_count = SDL_AddAtomicInt(&SDL_EventQ.count, 1) + 1;
-    if (final_count > SDL_EventQ.max_events_seen) {
-        SDL_EventQ.max_events_seen = final_count;
+    if (SDL_AddEventToRing(event)) {
+        return 1;
     }
 
-    ++SDL_last_event_id;
+    SDL_LockMutex(SDL_EventQ.lock);
+    if (!SDL_EventQ.ring) {
+        entry = SDL_AllocEventEntry();
+        if (entry) {
+            SDL_PrepareEventEntry(entry, event);
+            SDL_LinkEvent(entry);
+        }
+        SDL_UnlockMutex(SDL_EventQ.lock);
+
+        if (!entry) {
+            SDL_AddAtomicInt(&SDL_EventQ.count, -1);
+            return 0;
+        }
+        return 1;
+    }
+
+    /* The ring is full. Drain it and add the event to the ring rather than linking it into the list,
+       since draining stops at a slot another thread has claimed but not written yet, and an earlier
+       event from this thread could still be waiting behind it. */
+    for (;;) {
+        const Uint32 head = SDL_EventQ.ring_head;
+
+        SDL_DrainEventRing();
+        if (SDL_AddEventToRing(event)) {
+            SDL_UnlockMutex(SDL_EventQ.lock);
+            return 1;
+        }
+
+        if (SDL_EventQ.ring_head == head) {
+            SDL_EventRingSlot *slot = &SDL_EventQ.ring[head & (SDL_EVENT_RING_SIZE - 1)];
+            if (SDL_GetAtomicU32(&slot->sequence) == head + 1) {
+                break;  // the next event is ready but we couldn't allocate a list entry for it.
+            }
+        }
+        SDL_CPUPauseInstruction();  // wait for the other thread to finish writing its event.
+    }
+    SDL_UnlockMutex(SDL_EventQ.lock);
 
-    return 1;
+    SDL_AddAtomicInt(&SDL_EventQ.count, -1);
+    return 0;
 }
 
 // Remove an event from the queue -- called with the queue locked
@@ -1177,15 +1342,40 @@ static void SDL_SendWakeupEvent(void)
 static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_EventAction action,
                                   Uint32 minType, Uint32 maxType, bool include_sentinel)
 {
+    SDL_EventEntry *entry, *next;
+    Uint32 type;
     int i, used, sentinels_expected = 0;
 
-    // Lock the event queue
     used = 0;
 
+    // Adding events doesn't need the lock unless the ring fills up
+    if (action == SDL_ADDEVENT) {
+        SDL_AddAtomicInt(&SDL_EventQ.producers, 1);
+        if (!SDL_GetAtomicInt(&SDL_EventQ.active)) {
+            SDL_AddAtomicInt(&SDL_EventQ.producers, -1);
+            return -1;
+        }
+        CHECK_PARAM(!events) {
+            SDL_AddAtomicInt(&SDL_EventQ.producers, -1);
+            SDL_InvalidParamError("events");
+            return -1;
+        }
+        for (i = 0; i < numevents; ++i) {
+            used += SDL_AddEvent(&events[i]);
+        }
+        SDL_AddAtomicInt(&SDL_EventQ.producers, -1);
+
+        if (used > 0) {
+            SDL_SendWakeupEvent();
+        }
+        return used;
+    }
+
+    // Lock the event queue
     SDL_LockMutex(SDL_EventQ.lock);
     {
         // Don't look after we've quit
-        if (!SDL_EventQ.active) {
+        if (!SDL_GetAtomicInt(&SDL_EventQ.active)) {
             // We get a few spurious events at shutdown, so don't warn then
             if (action == SDL_GETEVENT) {
                 SDL_SetError("The event system has been shut down");
@@ -1193,55 +1383,39 @@ static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_EventAct
             SDL_UnlockMutex(SDL_EventQ.lock);
             return -1;
         }
-        if (action == SDL_ADDEVENT) {
-            CHECK_PARAM(!events) {
-                SDL_UnlockMutex(SDL_EventQ.lock);
-                SDL_InvalidParamError("events");
-                return -1;
-            }
-            for (i = 0; i < numevents; ++i) {
-                used += SDL_AddEvent(&events[i]);
-            }
-        } else {
-            SDL_EventEntry *entry, *next;
-            Uint32 type;
+        SDL_DrainEventRing();
 
-            for (entry = SDL_EventQ.head; entry && (events == NULL || used < numevents); entry = next) {
-                next = entry->next;
-                type = entry->event.type;
-                if (minType <= type && type <= maxType) {
-                    if (events) {
-                        SDL_copyp(&events[used], &entry->event);
+        for (entry = SDL_EventQ.head; entry && (events == NULL || used < numevents); entry = next) {
+            next = entry->next;
+            type = entry->event.type;
+            if (minType <= type && type <= maxType) {
+                if (events) {
+                    SDL_copyp(&events[used], &entry->event);
 
-                        if (action == SDL_GETEVENT) {
-                            SDL_CutEvent(entry);
-                        }
+                    if (action == SDL_GETEVENT) {
+                        SDL_CutEvent(entry);
+                    }
+                }
+                if (type == SDL_EVENT_POLL_SENTINEL) {
+                    // Special handling for the sentinel event
+                    if (!include_sentinel) {
+                        // Skip it, we don't want to include it
+                        continue;
                     }
-                    if (type == SDL_EVENT_POLL_SENTINEL) {
-                        // Special handling for the sentinel event
-                        if (!include_sentinel) {
-                            // Skip it, we don't want to include it
-                            continue;
-                        }
-                        if (events == NULL || action != SDL_GETEVENT) {
-                            ++sentinels_expected;
-                        }
-                        if (SDL_GetAtomicInt(&SDL_sentinel_pending) > sentinels_expected) {
-                            // Skip it, there's another one pending
-                            continue;
-                        }
+                    if (events == NULL || action != SDL_GETEVENT) {
+                        ++sentinels_expected;
+                    }
+                    if (SDL_GetAtomicInt(&SDL_sentinel_pending) > sentinels_expected) {
+                        // Skip it, there's another one pending
+                        continue;
                     }
-                    ++used;
                 }
+                ++used;
             }
         }
     }
     SDL_UnlockMutex(SDL_EventQ.lock);
 
-    if (used > 0 && action == SDL_ADDEVENT) {
-        SDL_SendWakeupEvent();
-    }
-
     return used;
 }
 int SDL_PeepEvents(SDL_Event *events, int numevents, SDL_EventAction action,
@@ -1261,7 +1435,8 @@ bool SDL_HasEvents(Uint32 minType, Uint32 maxType)
 
     SDL_LockMutex(SDL_EventQ.lock);
     {
-        if (SDL_EventQ.active) {
+        if (SDL_GetAtomicInt(&SDL_EventQ.active)) {
+            SDL_DrainEventRing();
             for (SDL_EventEntry *entry = SDL_EventQ.head; entry; entry = entry->next) {
                 const Uint32 type = entry->event.type;
                 if (minType <= type && type <= maxType) {
@@ -1298,10 +1473,11 @@ void SDL_FlushEvents(Uint32 minType, Uint32 maxType)
     SDL_LockMutex(SDL_EventQ.lock);
     {
         // Don't look after we've quit
-        if (!SDL_EventQ.active) {
+        if (!SDL_GetAtomicInt(&SDL_EventQ.active)) {
             SDL_UnlockMutex(SDL_EventQ.lock);
             return;
         }
+        SDL_DrainEventRing();
         for (entry = SDL_EventQ.head; entry; entry = next) {
             next = entry->next;
             type = entry->event.type;
@@ -1860,6 +2036,7 @@ void SDL_SetEventFilter(SDL_EventFilter filter, void *userdata)
             // Cut all events not accepted by the filter
             SDL_LockMutex(SDL_EventQ.lock);
             {
+                SDL_DrainEventRing();
                 for (event = SDL_EventQ.head; event; event = next) {
                     next = event->next;
                     if (!filter(userdata, &event->event)) {
@@ -1907,6 +2084,7 @@ void SDL_FilterEvents(SDL_EventFilter filter, void *userdata)
     SDL_LockMutex(SDL_EventQ.lock);
     {
         SDL_EventEntry *entry, *next;
+        SDL_DrainEventRing();
         for (entry = SDL_EventQ.head; entry; entry = next) {
             next = entry->next;
             if (!filter(userdata, &entry->event)) {
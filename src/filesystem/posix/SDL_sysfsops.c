@@ -33,8 +33,21 @@
 #include <errno.h>
 #include <dirent.h>
 #include <sys/stat.h>
+#include <fcntl.h>
 #include <unistd.h>
 
+#ifdef HAVE_SENDFILE
+#include <sys/sendfile.h>
+#endif
+#ifdef HAVE_FICLONE
+#include <sys/ioctl.h>
+#include <linux/fs.h>
+#endif
+
+#ifndef O_CLOEXEC
+#define O_CLOEXEC 0
+#endif
+
 #ifdef SDL_PLATFORM_ANDROID
 #include "../../core/android/SDL_android.h"
 #endif
@@ -239,12 +252,16 @@ bool SDL_SYS_RenamePath(const char *oldpath, const char *newpath)
     return true;
 }
 
-bool SDL_SYS_CopyFile(const char *oldpath, const char *newpath)
+// Used by the read/write fallback; large enough that syscall overhead doesn't dominate.
+#define COPY_BUFFER_SIZE (1024 * 1024)
+
+#ifdef SDL_PLATFORM_ANDROID
+static bool CopyFileWithIOStreams(const char *oldpath, const char *newpath)
 {
     char *buffer = NULL;
     SDL_IOStream *input = NULL;
     SDL_IOStream *output = NULL;
-    const size_t maxlen = 4096;
+    const size_t maxlen = COPY_BUFFER_SIZE;
     size_t len;
     bool result = false;
 
@@ -293,6 +310,164 @@ done:
 
     return result;
 }
+#endif
+
+// Each of these moves data starting at the current file offsets of both
+// descriptors and leaves them advanced past whatever was copied, so when one
+// of them gives up partway through, the next one picks up where it stopped.
+// They return the number of bytes copied, or -1 if the kernel can't do it.
+
+static Sint64 CopyFileRange(int infd, int outfd, Sint64 size)
+{
+#ifdef HAVE_COPY_FILE_RANGE
+    Sint64 copied = 0;
+    while (copied < size) {
+        const ssize_t rc = copy_file_range(infd, NULL, outfd, NULL, (size_t)SDL_min(size - copied, SDL_MAX_SINT32), 0);
+        if (rc < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return (copied > 0) ? copied : -1;  // EXDEV, ENOSYS, EINVAL, etc: let the next method try.
+        } else if (rc == 0) {
+            break;  // EOF, or a filesystem that reports a size but can't do this (procfs, etc).
+        }
+        copied += rc;
+    }
+    return copied;
+#else
+    return -1;
+#endif
+}
+
+static bool CloneFile(int infd, int outfd)
+{
+#ifdef HAVE_FICLONE
+    return (ioctl(outfd, FICLONE, infd) == 0);
+#else
+    return false;
+#endif
+}
+
+static Sint64 SendFile(int infd, int outfd, Sint64 size)
+{
+#ifdef HAVE_SENDFILE
+    Sint64 copied = 0;
+    while (copied < size) {
+        const ssize_t rc = sendfile(outfd, infd, NULL, (size_t)SDL_min(size - copied, SDL_MAX_SINT32));
+        if (rc < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return (copied > 0) ? copied : -1;
+        } else if (rc == 0) {
+            break;
+        }
+        copied += rc;
+    }
+    return copied;
+#else
+    return -1;
+#endif
+}
+
+static bool CopyWithBuffer(int infd, int outfd)
+{
+    char *buffer = (char *)SDL_malloc(COPY_BUFFER_SIZE);
+    if (!buffer) {
+        return false;
+    }
+
+    bool result = true;
+    for (;;) {
+        const ssize_t br = read(infd, buffer, COPY_BUFFER_SIZE);
+        if (br < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            result = SDL_SetError("Can't read file: %s", strerror(errno));
+            break;
+        } else if (br == 0) {
+            break;  // EOF, we're done.
+        }
+
+        ssize_t written = 0;
+        while (written < br) {
+            const ssize_t bw = write(outfd, buffer + written, (size_t)(br - written));
+            if (bw < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                result = SDL_SetError("Can't write file: %s", strerror(errno));
+                break;
+            }
+            written += bw;
+        }
+        if (!result) {
+            break;
+        }
+    }
+
+    SDL_free(buffer);
+    return result;
+}
+
+bool SDL_SYS_CopyFile(const char *oldpath, const char *newpath)
+{
+#ifdef SDL_PLATFORM_ANDROID
+    // relative paths might be in the APK, which only SDL_IOFromFile knows how to reach.
+    if ((*oldpath != '/') || (*newpath != '/')) {
+        return CopyFileWithIOStreams(oldpath, newpath);
+    }
+#endif
+
+    const int infd = open(oldpath, O_RDONLY | O_CLOEXEC);
+    if (infd < 0) {
+        return SDL_SetError("Can't open %s: %s", oldpath, strerror(errno));
+    }
+
+    struct stat statbuf;
+    if (fstat(infd, &statbuf) < 0) {
+        const int err = errno;
+        close(infd);
+        return SDL_SetError("Can't stat %s: %s", oldpath, strerror(err));
+    }
+
+    const int outfd = open(newpath, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+    if (outfd < 0) {
+        const int err = errno;
+        close(infd);
+        return SDL_SetError("Can't open %s: %s", newpath, strerror(err));
+    }
+
+    // Try to keep the data from ever passing through userspace: first ask the
+    //  kernel to copy the range (which can also reflink or do a server-side copy),
+    //  then try cloning the extents outright, then sendfile(). Whatever is left
+    //  over (or everything, for non-regular files) goes through a plain read/write loop.
+    bool result = true;
+    bool finished = false;
+    if (S_ISREG(statbuf.st_mode) && (statbuf.st_size > 0)) {
+        const Sint64 size = (Sint64)statbuf.st_size;
+        Sint64 copied = CopyFileRange(infd, outfd, size);
+        if ((copied < 0) && CloneFile(infd, outfd)) {
+            finished = true;
+        } else {
+            copied = SDL_max(copied, 0);
+            if (copied < size) {
+                SendFile(infd, outfd, size - copied);
+            }
+        }
+    }
+
+    if (!finished) {
+        result = CopyWithBuffer(infd, outfd);
+    }
+
+    close(infd);
+    if ((close(outfd) < 0) && result) {
+        result = SDL_SetError("Can't close %s: %s", newpath, strerror(errno));
+    }
+    return result;
+}
 
 bool SDL_SYS_CreateDirectory(const char *path)
 {
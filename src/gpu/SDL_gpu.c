@@ -811,6 +811,63 @@ SDL_PropertiesID SDL_GetGPUDeviceProperties(SDL_GPUDevice *device)
     return device->GetDeviceProperties(device);
 }
 
+bool SDL_LoadGPUPipelineCache(
+    SDL_GPUDevice *device,
+    SDL_IOStream *src,
+    bool closeio)
+{
+    void *data;
+    size_t size;
+    bool result;
+
+    CHECK_PARAM(device == NULL) {
+        SDL_SetError("Invalid GPU device");
+        if (src && closeio) {
+            SDL_CloseIO(src);
+        }
+        return false;
+    }
+
+    data = SDL_LoadFile_IO(src, &size, closeio);
+    if (!data) {
+        return false;
+    }
+
+    result = device->LoadPipelineCache(device->driverData, data, size);
+    SDL_free(data);
+    return result;
+}
+
+bool SDL_SaveGPUPipelineCache(
+    SDL_GPUDevice *device,
+    SDL_IOStream *dst,
+    bool closeio)
+{
+    void *data = NULL;
+    size_t size = 0;
+    bool result = false;
+
+    CHECK_PARAM(!dst) {
+        SDL_InvalidParamError("dst");
+        return false;
+    }
+
+    CHECK_PARAM(device == NULL) {
+        SDL_SetError("Invalid GPU device");
+    } else {
+        data = device->SavePipelineCache(device->driverData, &size);
+        if (data) {
+            result = (SDL_WriteIO(dst, data, size) == size);
+            SDL_free(data);
+        }
+    }
+
+    if (closeio) {
+        result &= SDL_CloseIO(dst);
+    }
+    return result;
+}
+
 Uint32 SDL_GPUTextureFormatTexelBlockSize(
     SDL_GPUTextureFormat format)
 {
@@ -678,6 +678,18 @@ struct SDL_GPUDevice
 
     SDL_PropertiesID (*GetDeviceProperties)(SDL_GPUDevice *device);
 
+    // Pipeline Cache
+
+    bool (*LoadPipelineCache)(
+        SDL_GPURenderer *driverData,
+        const void *data,
+        size_t size);
+
+    // Returns cache data allocated with SDL_malloc()
+    void *(*SavePipelineCache)(
+        SDL_GPURenderer *driverData,
+        size_t *size);
+
     // State Creation
 
     SDL_GPUComputePipeline *(*CreateComputePipeline)(
@@ -1132,6 +1144,8 @@ struct SDL_GPUDevice
     ASSIGN_DRIVER_FUNC(DestroyDevice, name)                 \
     ASSIGN_DRIVER_FUNC(DestroyXRSwapchain, name)            \
     ASSIGN_DRIVER_FUNC(GetDeviceProperties, name)      \
+    ASSIGN_DRIVER_FUNC(LoadPipelineCache, name)             \
+    ASSIGN_DRIVER_FUNC(SavePipelineCache, name)             \
     ASSIGN_DRIVER_FUNC(CreateComputePipeline, name)         \
     ASSIGN_DRIVER_FUNC(CreateGraphicsPipeline, name)        \
     ASSIGN_DRIVER_FUNC(CreateSampler, name)                 \
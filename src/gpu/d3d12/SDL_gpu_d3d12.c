@@ -1830,6 +1830,22 @@ static SDL_PropertiesID D3D12_GetDeviceProperties(SDL_GPUDevice *device)
     return renderer->props;
 }
 
+static bool D3D12_LoadPipelineCache(
+    SDL_GPURenderer *driverData,
+    const void *data,
+    size_t size)
+{
+    return SDL_SetError("The D3D12 backend does not currently support pipeline caches");
+}
+
+static void *D3D12_SavePipelineCache(
+    SDL_GPURenderer *driverData,
+    size_t *size)
+{
+    SDL_SetError("The D3D12 backend does not currently support pipeline caches");
+    return NULL;
+}
+
 // Barriers
 
 static inline Uint32 D3D12_INTERNAL_CalcSubresource(
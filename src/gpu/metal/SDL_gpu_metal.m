@@ -777,6 +777,22 @@ static SDL_PropertiesID METAL_GetDeviceProperties(SDL_GPUDevice *device)
     return renderer->props;
 }
 
+static bool METAL_LoadPipelineCache(
+    SDL_GPURenderer *driverData,
+    const void *data,
+    size_t size)
+{
+    return SDL_SetError("The metal backend does not currently support pipeline caches");
+}
+
+static void *METAL_SavePipelineCache(
+    SDL_GPURenderer *driverData,
+    size_t *size)
+{
+    SDL_SetError("The metal backend does not currently support pipeline caches");
+    return NULL;
+}
+
 // Resource tracking
 
 static void METAL_INTERNAL_TrackBuffer(
@@ -68,6 +68,8 @@ typedef struct VulkanExtensions
     Uint8 MSFT_layered_driver;
     // Only required for decoding HDR ASTC textures
     Uint8 EXT_texture_compression_astc_hdr;
+    // Only required for reporting pipeline cache hits and misses
+    Uint8 EXT_pipeline_creation_feedback;
 } VulkanExtensions;
 
 // Defines
@@ -1213,6 +1215,12 @@ struct VulkanRenderer
     SDL_HashTable *computePipelineResourceLayoutHashTable;
     SDL_HashTable *descriptorSetLayoutHashTable;
 
+    // Merging into the cache needs exclusive access, creating pipelines doesn't
+    VkPipelineCache pipelineCache;
+    SDL_RWLock *pipelineCacheLock;
+    SDL_AtomicInt pipelineCacheHits;
+    SDL_AtomicInt pipelineCacheMisses;
+
     VulkanUniformBuffer **uniformBufferPool;
     Uint32 uniformBufferPoolCount;
     Uint32 uniformBufferPoolCapacity;
@@ -5066,6 +5074,13 @@ static void VULKAN_DestroyDevice(
     SDL_DestroyHashTable(renderer->computePipelineResourceLayoutHashTable);
     SDL_DestroyHashTable(renderer->descriptorSetLayoutHashTable);
 
+    if (renderer->pipelineCache != VK_NULL_HANDLE) {
+        renderer->vkDestroyPipelineCache(
+            renderer->logicalDevice,
+            renderer->pipelineCache,
+            NULL);
+    }
+
     for (Uint32 i = 0; i < VK_MAX_MEMORY_TYPES; i += 1) {
         allocator = &renderer->memoryAllocator->subAllocators[i];
 
@@ -5109,6 +5124,7 @@ static void VULKAN_DestroyDevice(
     SDL_DestroyMutex(renderer->computePipelineLayoutFetchLock);
     SDL_DestroyMutex(renderer->descriptorSetLayoutFetchLock);
     SDL_DestroyMutex(renderer->windowLock);
+    SDL_DestroyRWLock(renderer->pipelineCacheLock);
 
     renderer->vkDestroyDevice(renderer->logicalDevice, NULL);
     renderer->vkDestroyInstance(renderer->instance, NULL);
@@ -5124,6 +5140,11 @@ static SDL_PropertiesID VULKAN_GetDeviceProperties(
     SDL_GPUDevice *device)
 {
     VulkanRenderer *renderer = (VulkanRenderer *)device->driverData;
+
+    if (renderer->supports.EXT_pipeline_creation_feedback) {
+        SDL_SetNumberProperty(renderer->props, SDL_PROP_GPU_DEVICE_PIPELINE_CACHE_HITS_NUMBER, SDL_GetAtomicInt(&renderer->pipelineCacheHits));
+        SDL_SetNumberProperty(renderer->props, SDL_PROP_GPU_DEVICE_PIPELINE_CACHE_MISSES_NUMBER, SDL_GetAtomicInt(&renderer->pipelineCacheMisses));
+    }
     return renderer->props;
 }
 
@@ -6373,6 +6394,195 @@ static VkRenderPass VULKAN_INTERNAL_CreateTransientRenderPass(
     return renderPass;
 }
 
+// Pipeline Cache
+
+#define PIPELINE_CACHE_MAGIC   0x43505653 // "SVPC"
+#define PIPELINE_CACHE_VERSION 1
+
+/* Saved in front of the driver's cache data. Drivers are supposed to ignore
+ * data from other devices and versions, but not all of them do, so we only
+ * hand it over if everything matches.
+ */
+typedef struct VulkanPipelineCacheHeader
+{
+    Uint32 magic;
+    Uint32 version;
+    Uint32 vendorID;
+    Uint32 deviceID;
+    Uint32 driverVersion;
+    Uint8 pipelineCacheUUID[VK_UUID_SIZE];
+    Uint32 dataSize;
+    Uint32 dataCRC;
+} VulkanPipelineCacheHeader;
+
+static void VULKAN_INTERNAL_GetPipelineCacheHeader(
+    VulkanRenderer *renderer,
+    VulkanPipelineCacheHeader *header)
+{
+    const VkPhysicalDeviceProperties *properties = &renderer->physicalDeviceProperties.properties;
+
+    SDL_zerop(header);
+    header->magic = PIPELINE_CACHE_MAGIC;
+    header->version = PIPELINE_CACHE_VERSION;
+    header->vendorID = properties->vendorID;
+    header->deviceID = properties->deviceID;
+    header->driverVersion = properties->driverVersion;
+    SDL_memcpy(header->pipelineCacheUUID, properties->pipelineCacheUUID, VK_UUID_SIZE);
+}
+
+static bool VULKAN_LoadPipelineCache(
+    SDL_GPURenderer *driverData,
+    const void *data,
+    size_t size)
+{
+    VulkanRenderer *renderer = (VulkanRenderer *)driverData;
+    VulkanPipelineCacheHeader header;
+    VulkanPipelineCacheHeader expected;
+    const Uint8 *cacheData = (const Uint8 *)data + sizeof(header);
+    VkPipelineCacheCreateInfo pipelineCacheCreateInfo;
+    VkPipelineCache loadedCache;
+    VkResult vulkanResult;
+
+    if (renderer->pipelineCache == VK_NULL_HANDLE) {
+        SET_STRING_ERROR_AND_RETURN("Pipeline cache is not available", false);
+    }
+
+    if (size < sizeof(header)) {
+        SET_STRING_ERROR_AND_RETURN("Pipeline cache data is truncated", false);
+    }
+    SDL_memcpy(&header, data, sizeof(header));
+    VULKAN_INTERNAL_GetPipelineCacheHeader(renderer, &expected);
+
+    if (header.magic != expected.magic || header.version != expected.version) {
+        SET_STRING_ERROR_AND_RETURN("Not a Vulkan pipeline cache", false);
+    }
+    if (header.vendorID != expected.vendorID ||
+        header.deviceID != expected.deviceID ||
+        header.driverVersion != expected.driverVersion ||
+        SDL_memcmp(header.pipelineCacheUUID, expected.pipelineCacheUUID, VK_UUID_SIZE) != 0) {
+        SET_STRING_ERROR_AND_RETURN("Pipeline cache was saved with a different device or driver version", false);
+    }
+    if (header.dataSize != size - sizeof(header) ||
+        header.dataCRC != SDL_crc32(0, cacheData, header.dataSize)) {
+        SET_STRING_ERROR_AND_RETURN("Pipeline cache data is corrupt", false);
+    }
+
+    pipelineCacheCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    pipelineCacheCreateInfo.pNext = NULL;
+    pipelineCacheCreateInfo.flags = 0;
+    pipelineCacheCreateInfo.initialDataSize = header.dataSize;
+    pipelineCacheCreateInfo.pInitialData = cacheData;
+
+    vulkanResult = renderer->vkCreatePipelineCache(
+        renderer->logicalDevice,
+        &pipelineCacheCreateInfo,
+        NULL,
+        &loadedCache);
+    CHECK_VULKAN_ERROR_AND_RETURN(vulkanResult, vkCreatePipelineCache, false);
+
+    SDL_LockRWLockForWriting(renderer->pipelineCacheLock);
+    vulkanResult = renderer->vkMergePipelineCaches(
+        renderer->logicalDevice,
+        renderer->pipelineCache,
+        1,
+        &loadedCache);
+    SDL_UnlockRWLock(renderer->pipelineCacheLock);
+
+    renderer->vkDestroyPipelineCache(
+        renderer->logicalDevice,
+        loadedCache,
+        NULL);
+    CHECK_VULKAN_ERROR_AND_RETURN(vulkanResult, vkMergePipelineCaches, false);
+
+    return true;
+}
+
+static void *VULKAN_SavePipelineCache(
+    SDL_GPURenderer *driverData,
+    size_t *size)
+{
+    VulkanRenderer *renderer = (VulkanRenderer *)driverData;
+    VulkanPipelineCacheHeader header;
+    Uint8 *result = NULL;
+    size_t dataSize = 0;
+    VkResult vulkanResult;
+
+    if (renderer->pipelineCache == VK_NULL_HANDLE) {
+        SET_STRING_ERROR_AND_RETURN("Pipeline cache is not available", NULL);
+    }
+
+    SDL_LockRWLockForReading(renderer->pipelineCacheLock);
+    vulkanResult = renderer->vkGetPipelineCacheData(
+        renderer->logicalDevice,
+        renderer->pipelineCache,
+        &dataSize,
+        NULL);
+    if (vulkanResult == VK_SUCCESS) {
+        result = (Uint8 *)SDL_malloc(sizeof(header) + dataSize);
+        if (result) {
+            // Pipelines created in the meantime are left out, but what we get is still a valid cache
+            vulkanResult = renderer->vkGetPipelineCacheData(
+                renderer->logicalDevice,
+                renderer->pipelineCache,
+                &dataSize,
+                result + sizeof(header));
+            if (vulkanResult == VK_INCOMPLETE) {
+                vulkanResult = VK_SUCCESS;
+            }
+        }
+    }
+    SDL_UnlockRWLock(renderer->pipelineCacheLock);
+
+    if (vulkanResult != VK_SUCCESS) {
+        SDL_free(result);
+        CHECK_VULKAN_ERROR_AND_RETURN(vulkanResult, vkGetPipelineCacheData, NULL);
+    }
+    if (!result) {
+        return NULL;
+    }
+
+    VULKAN_INTERNAL_GetPipelineCacheHeader(renderer, &header);
+    header.dataSize = (Uint32)dataSize;
+    header.dataCRC = SDL_crc32(0, result + sizeof(header), dataSize);
+    SDL_memcpy(result, &header, sizeof(header));
+
+    *size = sizeof(header) + dataSize;
+    return result;
+}
+
+static void VULKAN_INTERNAL_PreparePipelineCreationFeedback(
+    VulkanRenderer *renderer,
+    VkPipelineCreationFeedbackCreateInfoEXT *feedbackCreateInfo,
+    VkPipelineCreationFeedbackEXT *pipelineFeedback,
+    VkPipelineCreationFeedbackEXT *stageFeedbacks,
+    Uint32 stageCount,
+    const void **pNext)
+{
+    if (renderer->supports.EXT_pipeline_creation_feedback) {
+        SDL_zerop(pipelineFeedback);
+        feedbackCreateInfo->sType = VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO_EXT;
+        feedbackCreateInfo->pNext = *pNext;
+        feedbackCreateInfo->pPipelineCreationFeedback = pipelineFeedback;
+        feedbackCreateInfo->pipelineStageCreationFeedbackCount = stageCount;
+        feedbackCreateInfo->pPipelineStageCreationFeedbacks = stageFeedbacks;
+        *pNext = feedbackCreateInfo;
+    }
+}
+
+static void VULKAN_INTERNAL_RecordPipelineCreationFeedback(
+    VulkanRenderer *renderer,
+    const VkPipelineCreationFeedbackEXT *pipelineFeedback)
+{
+    if (renderer->supports.EXT_pipeline_creation_feedback &&
+        (pipelineFeedback->flags & VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT_EXT)) {
+        if (pipelineFeedback->flags & VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT_EXT) {
+            SDL_AddAtomicInt(&renderer->pipelineCacheHits, 1);
+        } else {
+            SDL_AddAtomicInt(&renderer->pipelineCacheMisses, 1);
+        }
+    }
+}
+
 static SDL_GPUGraphicsPipeline *VULKAN_CreateGraphicsPipeline(
     SDL_GPURenderer *driverData,
     const SDL_GPUGraphicsPipelineCreateInfo *createinfo)
@@ -6414,6 +6624,10 @@ static SDL_GPUGraphicsPipeline *VULKAN_CreateGraphicsPipeline(
     };
     VkPipelineDynamicStateCreateInfo dynamicStateCreateInfo;
 
+    VkPipelineCreationFeedbackCreateInfoEXT feedbackCreateInfo;
+    VkPipelineCreationFeedbackEXT pipelineFeedback;
+    VkPipelineCreationFeedbackEXT stageFeedbacks[2];
+
     VulkanRenderer *renderer = (VulkanRenderer *)driverData;
 
     // Create a "compatible" render pass
@@ -6657,14 +6871,23 @@ static SDL_GPUGraphicsPipeline *VULKAN_CreateGraphicsPipeline(
     vkPipelineCreateInfo.basePipelineHandle = VK_NULL_HANDLE;
     vkPipelineCreateInfo.basePipelineIndex = 0;
 
-    // TODO: enable pipeline caching
+    VULKAN_INTERNAL_PreparePipelineCreationFeedback(
+        renderer,
+        &feedbackCreateInfo,
+        &pipelineFeedback,
+        stageFeedbacks,
+        vkPipelineCreateInfo.stageCount,
+        &vkPipelineCreateInfo.pNext);
+
+    SDL_LockRWLockForReading(renderer->pipelineCacheLock);
     vulkanResult = renderer->vkCreateGraphicsPipelines(
         renderer->logicalDevice,
-        VK_NULL_HANDLE,
+        renderer->pipelineCache,
         1,
         &vkPipelineCreateInfo,
         NULL,
         &graphicsPipeline->pipeline);
+    SDL_UnlockRWLock(renderer->pipelineCacheLock);
 
     SDL_stack_free(vertexInputBindingDescriptions);
     SDL_stack_free(vertexInputAttributeDescriptions);
@@ -6680,6 +6903,8 @@ static SDL_GPUGraphicsPipeline *VULKAN_CreateGraphicsPipeline(
         CHECK_VULKAN_ERROR_AND_RETURN(vulkanResult, vkCreateGraphicsPipelines, NULL);
     }
 
+    VULKAN_INTERNAL_RecordPipelineCreationFeedback(renderer, &pipelineFeedback);
+
     SDL_SetAtomicInt(&graphicsPipeline->referenceCount, 0);
 
     if (renderer->debugMode && renderer->supportsDebugUtils && SDL_HasProperty(createinfo->props, SDL_PROP_GPU_GRAPHICSPIPELINE_CREATE_NAME_STRING)) {
@@ -6734,6 +6959,9 @@ static SDL_GPUComputePipeline *VULKAN_CreateComputePipeline(
     VkShaderModuleCreateInfo shaderModuleCreateInfo;
     VkComputePipelineCreateInfo vkShaderCreateInfo;
     VkPipelineShaderStageCreateInfo pipelineShaderStageCreateInfo;
+    VkPipelineCreationFeedbackCreateInfoEXT feedbackCreateInfo;
+    VkPipelineCreationFeedbackEXT pipelineFeedback;
+    VkPipelineCreationFeedbackEXT stageFeedback;
     VkResult vulkanResult;
     VulkanRenderer *renderer = (VulkanRenderer *)driverData;
     VulkanComputePipeline *vulkanComputePipeline;
@@ -6793,13 +7021,23 @@ static SDL_GPUComputePipeline *VULKAN_CreateComputePipeline(
     vkShaderCreateInfo.basePipelineHandle = (VkPipeline)VK_NULL_HANDLE;
     vkShaderCreateInfo.basePipelineIndex = 0;
 
+    VULKAN_INTERNAL_PreparePipelineCreationFeedback(
+        renderer,
+        &feedbackCreateInfo,
+        &pipelineFeedback,
+        &stageFeedback,
+        1,
+        &vkShaderCreateInfo.pNext);
+
+    SDL_LockRWLockForReading(renderer->pipelineCacheLock);
     vulkanResult = renderer->vkCreateComputePipelines(
         renderer->logicalDevice,
-        (VkPipelineCache)VK_NULL_HANDLE,
+        renderer->pipelineCache,
         1,
         &vkShaderCreateInfo,
         NULL,
         &vulkanComputePipeline->pipeline);
+    SDL_UnlockRWLock(renderer->pipelineCacheLock);
 
     if (vulkanResult != VK_SUCCESS) {
         VULKAN_INTERNAL_DestroyComputePipeline(renderer, vulkanComputePipeline);
@@ -6807,6 +7045,8 @@ static SDL_GPUComputePipeline *VULKAN_CreateComputePipeline(
         return NULL;
     }
 
+    VULKAN_INTERNAL_RecordPipelineCreationFeedback(renderer, &pipelineFeedback);
+
     SDL_SetAtomicInt(&vulkanComputePipeline->referenceCount, 0);
 
     if (renderer->debugMode && renderer->supportsDebugUtils && SDL_HasProperty(createinfo->props, SDL_PROP_GPU_COMPUTEPIPELINE_CREATE_NAME_STRING)) {
@@ -11311,7 +11551,7 @@ static inline Uint8 CheckDeviceExtensions(
         supports->ext = 1;                   \
     }
         CHECK(KHR_swapchain)
-        else CHECK(KHR_maintenance1) else CHECK(KHR_driver_properties) else CHECK(KHR_portability_subset) else CHECK(MSFT_layered_driver) else CHECK(EXT_texture_compression_astc_hdr)
+        else CHECK(KHR_maintenance1) else CHECK(KHR_driver_properties) else CHECK(KHR_portability_subset) else CHECK(MSFT_layered_driver) else CHECK(EXT_texture_compression_astc_hdr) else CHECK(EXT_pipeline_creation_feedback)
 #undef CHECK
     }
 
@@ -11327,7 +11567,8 @@ static inline Uint32 GetDeviceExtensionCount(VulkanExtensions *supports)
         supports->KHR_driver_properties +
         supports->KHR_portability_subset +
         supports->MSFT_layered_driver +
-        supports->EXT_texture_compression_astc_hdr);
+        supports->EXT_texture_compression_astc_hdr +
+        supports->EXT_pipeline_creation_feedback);
 }
 
 static inline void CreateDeviceExtensionArray(
@@ -11345,6 +11586,7 @@ static inline void CreateDeviceExtensionArray(
     CHECK(KHR_portability_subset)
     CHECK(MSFT_layered_driver)
     CHECK(EXT_texture_compression_astc_hdr)
+    CHECK(EXT_pipeline_creation_feedback)
 #undef CHECK
 }
 
@@ -13348,6 +13590,7 @@ static SDL_GPUDevice *VULKAN_CreateDevice(bool debugMode, bool preferLowPower, S
 {
     VulkanRenderer *renderer;
     VulkanFeatures features;
+    VkPipelineCacheCreateInfo pipelineCacheCreateInfo;
 
     SDL_GPUDevice *result;
     Uint32 i;
@@ -13589,6 +13832,7 @@ static SDL_GPUDevice *VULKAN_CreateDevice(bool debugMode, bool preferLowPower, S
     renderer->computePipelineLayoutFetchLock = SDL_CreateMutex();
     renderer->descriptorSetLayoutFetchLock = SDL_CreateMutex();
     renderer->windowLock = SDL_CreateMutex();
+    renderer->pipelineCacheLock = SDL_CreateRWLock();
 
     /*
      * Create submitted command buffer list
@@ -13686,6 +13930,25 @@ static SDL_GPUDevice *VULKAN_CreateDevice(bool debugMode, bool preferLowPower, S
         VULKAN_INTERNAL_DescriptorSetLayoutHashDestroy,
         (void *)renderer);
 
+    // Pipelines are compiled through this, so they can be saved with SDL_SaveGPUPipelineCache()
+
+    pipelineCacheCreateInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    pipelineCacheCreateInfo.pNext = NULL;
+    pipelineCacheCreateInfo.flags = 0;
+    pipelineCacheCreateInfo.initialDataSize = 0;
+    pipelineCacheCreateInfo.pInitialData = NULL;
+
+    if (renderer->vkCreatePipelineCache(
+            renderer->logicalDevice,
+            &pipelineCacheCreateInfo,
+            NULL,
+            &renderer->pipelineCache) != VK_SUCCESS) {
+        // Pipelines can still be created, they just can't be cached
+        renderer->pipelineCache = VK_NULL_HANDLE;
+    }
+    SDL_SetAtomicInt(&renderer->pipelineCacheHits, 0);
+    SDL_SetAtomicInt(&renderer->pipelineCacheMisses, 0);
+
     // Initialize fence pool
 
     renderer->fencePool.lock = SDL_CreateMutex();
@@ -154,6 +154,7 @@ VULKAN_DEVICE_FUNCTION(vkGetFenceStatus)
 VULKAN_DEVICE_FUNCTION(vkGetBufferMemoryRequirements)
 VULKAN_DEVICE_FUNCTION(vkGetImageMemoryRequirements)
 VULKAN_DEVICE_FUNCTION(vkMapMemory)
+VULKAN_DEVICE_FUNCTION(vkMergePipelineCaches)
 VULKAN_DEVICE_FUNCTION(vkQueueSubmit)
 VULKAN_DEVICE_FUNCTION(vkQueueWaitIdle)
 VULKAN_DEVICE_FUNCTION(vkResetCommandBuffer)
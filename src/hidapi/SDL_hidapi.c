@@ -1576,6 +1576,19 @@ SDL_PropertiesID SDL_hid_get_properties(SDL_hid_device *device)
     return device->props;
 }
 
+int SDL_HIDAPI_GetDeviceFD(SDL_hid_device *device)
+{
+    CHECK_DEVICE_MAGIC(device, -1);
+
+#if defined(HAVE_PLATFORM_BACKEND) && defined(SDL_PLATFORM_LINUX)
+    // The hidraw backend reads directly from the device node, other backends use their own threads
+    if (device->backend == &PLATFORM_Backend) {
+        return ((PLATFORM_hid_device *)device->device)->device_handle;
+    }
+#endif
+    return -1;
+}
+
 int SDL_hid_write(SDL_hid_device *device, const unsigned char *data, size_t length)
 {
     CHECK_DEVICE_MAGIC(device, -1);
@@ -24,3 +24,5 @@
 /* Return true if the HIDAPI should ignore a device during enumeration */
 extern bool SDL_HIDAPI_ShouldIgnoreDevice(int bus_type, Uint16 vendor_id, Uint16 product_id, Uint16 usage_page, Uint16 usage, bool libusb, bool is_xbox);
 
+/* Return a file descriptor that becomes readable when the device has input, or -1 if the backend doesn't have one */
+extern int SDL_HIDAPI_GetDeviceFD(SDL_hid_device *device);
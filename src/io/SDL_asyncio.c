@@ -92,21 +92,12 @@ Sint64 SDL_GetAsyncIOSize(SDL_AsyncIO *asyncio)
     return asyncio->iface.size(asyncio->userdata);
 }
 
-static bool RequestAsyncIO(bool reading, SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size, SDL_AsyncIOQueue *queue, void *userdata)
+// Make a new read/write task and attach it to its SDL_AsyncIO. The caller still has to hand it to the backend.
+static SDL_AsyncIOTask *CreateAsyncIOTask(bool reading, SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size, SDL_AsyncIOQueue *queue, void *userdata)
 {
-    CHECK_PARAM(!asyncio) {
-        return SDL_InvalidParamError("asyncio");
-    }
-    CHECK_PARAM(!ptr) {
-        return SDL_InvalidParamError("ptr");
-    }
-    CHECK_PARAM(!queue) {
-        return SDL_InvalidParamError("queue");
-    }
-
     SDL_AsyncIOTask *task = (SDL_AsyncIOTask *) SDL_calloc(1, sizeof (*task));
     if (!task) {
-        return false;
+        return NULL;
     }
 
     task->asyncio = asyncio;
@@ -121,19 +112,47 @@ static bool RequestAsyncIO(bool reading, SDL_AsyncIO *asyncio, void *ptr, Uint64
     if (asyncio->closing) {
         SDL_free(task);
         SDL_UnlockMutex(asyncio->lock);
-        return SDL_SetError("SDL_AsyncIO is closing, can't start new tasks");
+        SDL_SetError("SDL_AsyncIO is closing, can't start new tasks");
+        return NULL;
     }
     LINKED_LIST_PREPEND(task, asyncio->tasks, asyncio);
     SDL_AddAtomicInt(&queue->tasks_inflight, 1);
     SDL_UnlockMutex(asyncio->lock);
 
+    return task;
+}
+
+// Undo CreateAsyncIOTask for a task that the backend refused.
+static void DestroyUnqueuedAsyncIOTask(SDL_AsyncIOTask *task)
+{
+    SDL_AsyncIO *asyncio = task->asyncio;
+    SDL_AddAtomicInt(&task->queue->tasks_inflight, -1);
+    SDL_LockMutex(asyncio->lock);
+    LINKED_LIST_UNLINK(task, asyncio);
+    SDL_UnlockMutex(asyncio->lock);
+    SDL_free(task);
+}
+
+static bool RequestAsyncIO(bool reading, SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size, SDL_AsyncIOQueue *queue, void *userdata)
+{
+    CHECK_PARAM(!asyncio) {
+        return SDL_InvalidParamError("asyncio");
+    }
+    CHECK_PARAM(!ptr) {
+        return SDL_InvalidParamError("ptr");
+    }
+    CHECK_PARAM(!queue) {
+        return SDL_InvalidParamError("queue");
+    }
+
+    SDL_AsyncIOTask *task = CreateAsyncIOTask(reading, asyncio, ptr, offset, size, queue, userdata);
+    if (!task) {
+        return false;
+    }
+
     const bool queued = reading ? asyncio->iface.read(asyncio->userdata, task) : asyncio->iface.write(asyncio->userdata, task);
     if (!queued) {
-        SDL_AddAtomicInt(&queue->tasks_inflight, -1);
-        SDL_LockMutex(asyncio->lock);
-        LINKED_LIST_UNLINK(task, asyncio);
-        SDL_UnlockMutex(asyncio->lock);
-        SDL_free(task);
+        DestroyUnqueuedAsyncIOTask(task);
         task = NULL;
     }
 
@@ -145,6 +164,68 @@ bool SDL_ReadAsyncIO(SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size
     return RequestAsyncIO(true, asyncio, ptr, offset, size, queue, userdata);
 }
 
+int SDL_ReadAsyncIOBatch(const SDL_AsyncIOReadRequest *requests, int num_requests, SDL_AsyncIOQueue *queue)
+{
+    CHECK_PARAM(num_requests < 0) {
+        SDL_InvalidParamError("num_requests");
+        return 0;
+    }
+    CHECK_PARAM(!requests && (num_requests > 0)) {
+        SDL_InvalidParamError("requests");
+        return 0;
+    }
+    CHECK_PARAM(!queue) {
+        SDL_InvalidParamError("queue");
+        return 0;
+    }
+
+    if (num_requests == 0) {
+        return 0;
+    }
+
+    bool isstack;
+    SDL_AsyncIOTask **tasks = SDL_small_alloc(SDL_AsyncIOTask *, num_requests, &isstack);
+    if (!tasks) {
+        return 0;
+    }
+
+    // build every task first, then hand them to the backend together, so it can submit them in one go.
+    int num_tasks = 0;
+    for (int i = 0; i < num_requests; i++) {
+        const SDL_AsyncIOReadRequest *request = &requests[i];
+        if (!request->asyncio) {
+            SDL_InvalidParamError("requests[i].asyncio");
+            break;
+        } else if (!request->ptr) {
+            SDL_InvalidParamError("requests[i].ptr");
+            break;
+        }
+
+        SDL_AsyncIOTask *task = CreateAsyncIOTask(true, request->asyncio, request->ptr, request->offset, request->size, queue, request->userdata);
+        if (!task) {
+            break;
+        }
+        tasks[num_tasks++] = task;
+    }
+
+    int num_queued = 0;
+    if (queue->iface.read_batch) {
+        num_queued = queue->iface.read_batch(queue->userdata, tasks, num_tasks);
+    } else {
+        while ((num_queued < num_tasks) && tasks[num_queued]->asyncio->iface.read(tasks[num_queued]->asyncio->userdata, tasks[num_queued])) {
+            num_queued++;
+        }
+    }
+
+    for (int i = num_queued; i < num_tasks; i++) {
+        DestroyUnqueuedAsyncIOTask(tasks[i]);
+    }
+
+    SDL_small_free(tasks, isstack);
+
+    return num_queued;
+}
+
 bool SDL_WriteAsyncIO(SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size, SDL_AsyncIOQueue *queue, void *userdata)
 {
     return RequestAsyncIO(false, asyncio, ptr, offset, size, queue, userdata);
@@ -206,6 +287,86 @@ SDL_AsyncIOQueue *SDL_CreateAsyncIOQueue(void)
     return queue;
 }
 
+// SDL_CopyFileAsync moves one chunk at a time through this buffer: each
+// completed read queues a write of the same bytes, and each completed write
+// queues the next read, until a read hits EOF and both files are closed.
+#define ASYNC_COPY_CHUNK_SIZE (1024 * 1024)
+
+struct SDL_AsyncIOCopy
+{
+    SDL_AsyncIO *input;
+    SDL_AsyncIO *output;
+    SDL_AsyncIOQueue *queue;
+    void *userdata;
+    Uint8 *buffer;
+    Uint64 chunk_size;
+    Uint64 size;    // size of the input when the copy started, for progress reports.
+    Uint64 copied;
+    SDL_AtomicInt failed;
+    SDL_AtomicInt closes_pending;
+};
+
+static void FinishAsyncCopy(SDL_AsyncIOCopy *copy, bool failed)
+{
+    if (failed) {
+        SDL_SetAtomicInt(&copy->failed, 1);
+    }
+
+    SDL_SetAtomicInt(&copy->closes_pending, 2);
+    SDL_CloseAsyncIO(copy->input, false, copy->queue, copy->userdata);  // if these fail, we'll have a resource leak, but this would already be a dramatic system failure.
+    SDL_CloseAsyncIO(copy->output, true, copy->queue, copy->userdata);
+}
+
+// Called with the outcome of a finished task that belongs to a copy. Returns true if the outcome should be reported to the app.
+static bool ContinueAsyncCopy(SDL_AsyncIOCopy *copy, SDL_AsyncIOOutcome *outcome)
+{
+    outcome->buffer = NULL;  // the copy buffer is internal, don't hand it out.
+
+    switch (outcome->type) {
+    case SDL_ASYNCIO_TASK_READ:
+        if (outcome->result != SDL_ASYNCIO_COMPLETE) {
+            FinishAsyncCopy(copy, true);
+        } else if (outcome->bytes_transferred == 0) {
+            FinishAsyncCopy(copy, false);  // EOF, we're done.
+        } else if (!SDL_WriteAsyncIO(copy->output, copy->buffer, outcome->offset, outcome->bytes_transferred, copy->queue, copy->userdata)) {
+            FinishAsyncCopy(copy, true);
+        }
+        return false;
+
+    case SDL_ASYNCIO_TASK_WRITE:
+        if (outcome->result != SDL_ASYNCIO_COMPLETE) {
+            FinishAsyncCopy(copy, true);
+            return false;
+        }
+        // fill in the progress report first; once the next task is queued, another thread might finish the copy and free it.
+        outcome->offset += outcome->bytes_transferred;
+        copy->copied += outcome->bytes_transferred;
+        outcome->bytes_requested = copy->size;
+        outcome->bytes_transferred = copy->copied;
+        if (!SDL_ReadAsyncIO(copy->input, copy->buffer, outcome->offset, copy->chunk_size, copy->queue, copy->userdata)) {
+            FinishAsyncCopy(copy, true);
+        }
+        return true;
+
+    case SDL_ASYNCIO_TASK_CLOSE:
+        if (outcome->result != SDL_ASYNCIO_COMPLETE) {
+            SDL_SetAtomicInt(&copy->failed, 1);
+        }
+        if (SDL_AddAtomicInt(&copy->closes_pending, -1) != 1) {
+            return false;  // wait for the other file to close, too.
+        }
+        outcome->result = SDL_GetAtomicInt(&copy->failed) ? SDL_ASYNCIO_FAILURE : SDL_ASYNCIO_COMPLETE;
+        outcome->offset = 0;
+        outcome->bytes_requested = copy->size;
+        outcome->bytes_transferred = copy->copied;
+        SDL_free(copy->buffer);
+        SDL_free(copy);
+        return true;
+    }
+
+    return false;
+}
+
 static bool GetAsyncIOTaskOutcome(SDL_AsyncIOTask *task, SDL_AsyncIOOutcome *outcome)
 {
     if (!task || !outcome) {
@@ -213,9 +374,10 @@ static bool GetAsyncIOTaskOutcome(SDL_AsyncIOTask *task, SDL_AsyncIOOutcome *out
     }
 
     SDL_AsyncIO *asyncio = task->asyncio;
+    SDL_AsyncIOCopy *copy = asyncio->copy;
 
     SDL_zerop(outcome);
-    outcome->asyncio = asyncio->oneshot ? NULL : asyncio;
+    outcome->asyncio = (asyncio->oneshot || copy) ? NULL : asyncio;
     outcome->result = task->result;
     outcome->type = task->type;
     outcome->buffer = task->buffer;
@@ -255,6 +417,10 @@ static bool GetAsyncIOTaskOutcome(SDL_AsyncIOTask *task, SDL_AsyncIOOutcome *out
     SDL_AddAtomicInt(&task->queue->tasks_inflight, -1);
     SDL_free(task);
 
+    if (copy) {
+        retval = ContinueAsyncCopy(copy, outcome);
+    }
+
     return retval;
 }
 
@@ -341,3 +507,73 @@ bool SDL_LoadFileAsync(const char *file, SDL_AsyncIOQueue *queue, void *userdata
     return retval;
 }
 
+
+// Close a file that the app never saw, without reporting the result.
+static void DiscardAsyncIO(SDL_AsyncIO *asyncio, SDL_AsyncIOQueue *queue)
+{
+    asyncio->oneshot = true;
+    SDL_CloseAsyncIO(asyncio, false, queue, NULL);
+}
+
+bool SDL_CopyFileAsync(const char *oldpath, const char *newpath, SDL_AsyncIOQueue *queue, void *userdata)
+{
+    CHECK_PARAM(!oldpath) {
+        return SDL_InvalidParamError("oldpath");
+    }
+    CHECK_PARAM(!newpath) {
+        return SDL_InvalidParamError("newpath");
+    }
+    CHECK_PARAM(!queue) {
+        return SDL_InvalidParamError("queue");
+    }
+
+    Sint64 flen;
+    SDL_AsyncIOCopy *copy = (SDL_AsyncIOCopy *) SDL_calloc(1, sizeof (*copy));
+    if (!copy) {
+        return false;
+    }
+    copy->queue = queue;
+    copy->userdata = userdata;
+
+    copy->input = SDL_AsyncIOFromFile(oldpath, "r");
+    if (!copy->input) {
+        goto failed;
+    }
+
+    flen = SDL_GetAsyncIOSize(copy->input);
+    if (flen < 0) {
+        goto failed;
+    }
+    copy->size = (Uint64) flen;
+    copy->chunk_size = ((flen > 0) && (flen < ASYNC_COPY_CHUNK_SIZE)) ? (Uint64) flen : ASYNC_COPY_CHUNK_SIZE;
+
+    copy->buffer = (Uint8 *) SDL_malloc((size_t) copy->chunk_size);
+    if (!copy->buffer) {
+        goto failed;
+    }
+
+    copy->output = SDL_AsyncIOFromFile(newpath, "w");
+    if (!copy->output) {
+        goto failed;
+    }
+
+    // hook these up before the first task is queued, since it might complete on another thread right away.
+    copy->input->copy = copy;
+    copy->output->copy = copy;
+    if (SDL_ReadAsyncIO(copy->input, copy->buffer, 0, copy->chunk_size, queue, userdata)) {
+        return true;
+    }
+    copy->input->copy = NULL;
+    copy->output->copy = NULL;
+
+failed:
+    if (copy->output) {
+        DiscardAsyncIO(copy->output, queue);
+    }
+    if (copy->input) {
+        DiscardAsyncIO(copy->input, queue);
+    }
+    SDL_free(copy->buffer);
+    SDL_free(copy);
+    return false;
+}
@@ -39,6 +39,22 @@
 #include <fcntl.h>
 #endif
 
+// Platforms that can map files for SDL_IOFromMappedFile; everything else loads the file into memory instead.
+#if defined(SDL_PLATFORM_WINDOWS) && !defined(SDL_PLATFORM_CYGWIN)
+#if !defined(SDL_PLATFORM_XBOXONE) && !defined(SDL_PLATFORM_XBOXSERIES)
+#define SDL_IOSTREAM_MMAP_WINDOWS 1
+#endif
+#elif (defined(SDL_PLATFORM_UNIX) || defined(SDL_PLATFORM_APPLE)) && !defined(SDL_PLATFORM_EMSCRIPTEN)
+#define SDL_IOSTREAM_MMAP_POSIX 1
+#include <fcntl.h>
+#include <errno.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#ifndef O_CLOEXEC
+#define O_CLOEXEC 0
+#endif
+#endif
+
 #include "SDL_iostream_c.h"
 
 /* This file provides a general interface for SDL to read and write
@@ -1206,6 +1222,207 @@ SDL_IOStream *SDL_IOFromConstMem(const void *mem, size_t size)
     return iostr;
 }
 
+// Functions to read from memory-mapped files
+
+typedef struct IOStreamMappedData
+{
+    IOStreamMemData mem;  // must be first, so the mem_* functions can use this directly.
+    size_t length;
+#ifdef SDL_IOSTREAM_MMAP_WINDOWS
+    HANDLE mapping;
+#endif
+} IOStreamMappedData;
+
+#if defined(SDL_IOSTREAM_MMAP_WINDOWS) || defined(SDL_IOSTREAM_MMAP_POSIX)
+static bool SDLCALL mapped_close(void *userdata)
+{
+    IOStreamMappedData *iodata = (IOStreamMappedData *) userdata;
+    bool result = true;
+    if (iodata->length > 0) {
+#ifdef SDL_IOSTREAM_MMAP_WINDOWS
+        if (!UnmapViewOfFile(iodata->mem.base)) {
+            result = WIN_SetError("Couldn't unmap file");
+        }
+        CloseHandle(iodata->mapping);
+#else
+        if (munmap(iodata->mem.base, iodata->length) < 0) {
+            result = SDL_SetError("Couldn't unmap file: %s", strerror(errno));
+        }
+#endif
+    }
+    SDL_free(iodata);
+    return result;
+}
+
+static bool MapFile(const char *file, SDL_IOMapFlags flags, IOStreamMappedData *iodata)
+{
+#ifdef SDL_IOSTREAM_MMAP_WINDOWS
+    HANDLE handle = windows_file_open(file, "rb");
+    if (handle == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    if (GetFileType(handle) != FILE_TYPE_DISK) {
+        // Pipes and devices can't be mapped, so they're read instead.
+        CloseHandle(handle);
+        return true;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(handle, &size)) {
+        CloseHandle(handle);
+        return WIN_SetError("Couldn't get file size");
+    } else if ((Uint64)size.QuadPart > SDL_SIZE_MAX) {
+        CloseHandle(handle);
+        return SDL_SetError("%s is too large to map", file);
+    }
+
+    iodata->length = (size_t)size.QuadPart;
+    if (iodata->length > 0) {  // Windows refuses to map empty files.
+        iodata->mapping = CreateFileMapping(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (iodata->mapping) {
+            iodata->mem.base = (Uint8 *)MapViewOfFile(iodata->mapping, FILE_MAP_READ, 0, 0, 0);
+        }
+        if (!iodata->mem.base) {
+            WIN_SetError("Couldn't map file");
+            if (iodata->mapping) {
+                CloseHandle(iodata->mapping);
+            }
+            CloseHandle(handle);
+            return false;
+        }
+    }
+    CloseHandle(handle);  // the mapping keeps the file open.
+    (void)flags;  // !!! FIXME: PrefetchVirtualMemory() could help SDL_IO_MAP_SEQUENTIAL.
+
+#else
+    const int fd = open(file, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return SDL_SetError("Couldn't open %s: %s", file, strerror(errno));
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+        const int err = errno;
+        close(fd);
+        return SDL_SetError("Couldn't stat %s: %s", file, strerror(err));
+    } else if (S_ISDIR(st.st_mode)) {
+        close(fd);
+        return SDL_SetError("%s is a directory", file);
+    } else if (!S_ISREG(st.st_mode) || st.st_size == 0) {
+        // FIFOs, devices and files like the ones in /proc report no size, so they're read instead.
+        close(fd);
+        return true;
+    } else if ((Uint64)st.st_size > SDL_SIZE_MAX) {
+        close(fd);
+        return SDL_SetError("%s is too large to map", file);
+    }
+
+    iodata->length = (size_t)st.st_size;
+    if (iodata->length > 0) {  // mmap() refuses zero-length mappings.
+        void *mapped = mmap(NULL, iodata->length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped == MAP_FAILED) {
+            const int err = errno;
+            close(fd);
+            return SDL_SetError("Couldn't map %s: %s", file, strerror(err));
+        }
+        iodata->mem.base = (Uint8 *)mapped;
+
+        if (flags & SDL_IO_MAP_SEQUENTIAL) {
+            madvise(mapped, iodata->length, MADV_SEQUENTIAL);
+            madvise(mapped, iodata->length, MADV_WILLNEED);
+        } else if (flags & SDL_IO_MAP_RANDOM) {
+            madvise(mapped, iodata->length, MADV_RANDOM);
+        }
+#ifdef MADV_HUGEPAGE
+        if (flags & SDL_IO_MAP_HUGEPAGES) {
+            madvise(mapped, iodata->length, MADV_HUGEPAGE);  // only takes effect on kernels with file-backed THP.
+        }
+#endif
+    }
+    close(fd);  // the mapping keeps the file open.
+#endif
+
+    return true;
+}
+#endif // SDL_IOSTREAM_MMAP_WINDOWS || SDL_IOSTREAM_MMAP_POSIX
+
+// Fallback for platforms or files that can't be mapped: load it all and serve it from memory.
+static SDL_IOStream *LoadMappedFile(const char *file)
+{
+    size_t size = 0;
+    void *data = SDL_LoadFile(file, &size);
+    if (!data) {
+        return NULL;
+    }
+
+    SDL_IOStream *iostr = SDL_IOFromConstMem(data, size);
+    if (!iostr) {
+        SDL_free(data);
+        return NULL;
+    }
+    SDL_SetPointerProperty(SDL_GetIOProperties(iostr), SDL_PROP_IOSTREAM_MEMORY_FREE_FUNC_POINTER, SDL_free);
+    return iostr;
+}
+
+SDL_IOStream *SDL_IOFromMappedFile(const char *file, SDL_IOMapFlags flags)
+{
+    CHECK_PARAM(!file || !*file) {
+        SDL_InvalidParamError("file");
+        return NULL;
+    }
+
+#if defined(SDL_IOSTREAM_MMAP_WINDOWS) || defined(SDL_IOSTREAM_MMAP_POSIX)
+#if defined(SDL_PLATFORM_ANDROID) || defined(SDL_PLATFORM_IOS)
+    // relative paths are resolved against app-specific locations (or the APK) by SDL_IOFromFile.
+    if (*file != '/') {
+        return LoadMappedFile(file);
+    }
+#endif
+
+    IOStreamMappedData *iodata = (IOStreamMappedData *) SDL_calloc(1, sizeof (*iodata));
+    if (!iodata) {
+        return NULL;
+    }
+
+    if (!MapFile(file, flags, iodata)) {
+        SDL_free(iodata);
+        return NULL;
+    } else if (iodata->length == 0) {
+        // Nothing was mapped, either the file is empty or its size isn't known until it's read.
+        SDL_free(iodata);
+        return LoadMappedFile(file);
+    }
+
+    SDL_IOStreamInterface iface;
+    SDL_INIT_INTERFACE(&iface);
+    iface.size = mem_size;
+    iface.seek = mem_seek;
+    iface.read = mem_read;
+    // leave iface.write as NULL.
+    iface.close = mapped_close;
+
+    iodata->mem.here = iodata->mem.base;
+    iodata->mem.stop = iodata->mem.base + iodata->length;
+
+    SDL_IOStream *iostr = SDL_OpenIO(&iface, iodata);
+    if (!iostr) {
+        mapped_close(iodata);
+    } else {
+        const SDL_PropertiesID props = SDL_GetIOProperties(iostr);
+        if (props) {
+            iodata->mem.props = props;
+            SDL_SetPointerProperty(props, SDL_PROP_IOSTREAM_MEMORY_POINTER, iodata->mem.base);
+            SDL_SetNumberProperty(props, SDL_PROP_IOSTREAM_MEMORY_SIZE_NUMBER, iodata->length);
+        }
+    }
+    return iostr;
+#else
+    (void)flags;
+    return LoadMappedFile(file);
+#endif
+}
+
 typedef struct IOStreamDynamicMemData
 {
     SDL_IOStream *stream;
@@ -1366,7 +1583,8 @@ void *SDL_LoadFile_IO(SDL_IOStream *src, size_t *datasize, bool closeio)
     }
 
     size = SDL_GetIOSize(src);
-    if (size < 0) {
+    if (size <= 0) {
+        // Files like the ones in /proc report no size, so read until the end to be sure.
         size = FILE_CHUNK_SIZE;
         loading_chunks = true;
     }
@@ -1541,6 +1759,33 @@ Sint64 SDL_TellIO(SDL_IOStream *context)
     return SDL_SeekIO(context, 0, SDL_IO_SEEK_CUR);
 }
 
+const void *SDL_GetIOMappedPointer(SDL_IOStream *context, size_t *size)
+{
+    if (size) {
+        *size = 0;
+    }
+
+    CHECK_PARAM(!context) {
+        SDL_InvalidParamError("context");
+        return NULL;
+    }
+    CHECK_PARAM(!size) {
+        SDL_InvalidParamError("size");
+        return NULL;
+    }
+
+    /* Only the memory-backed streams use mem_size(), and their data never moves for the life of the stream.
+       Check the interface instead of the memory properties, which the app is free to change. */
+    if (context->iface.size != mem_size) {
+        SDL_SetError("SDL_IOStream is not backed by memory");
+        return NULL;
+    }
+
+    const IOStreamMemData *iodata = (const IOStreamMemData *)context->userdata;
+    *size = (size_t)(iodata->stop - iodata->here);
+    return iodata->here;
+}
+
 size_t SDL_ReadIO(SDL_IOStream *context, void *ptr, size_t size)
 {
     CHECK_PARAM(!context) {
@@ -67,6 +67,7 @@
 #define LINKED_LIST_PREV(item, prefix) (item->prefix##prev)
 
 typedef struct SDL_AsyncIOTask SDL_AsyncIOTask;
+typedef struct SDL_AsyncIOCopy SDL_AsyncIOCopy;
 
 struct SDL_AsyncIOTask
 {
@@ -81,6 +82,7 @@ struct SDL_AsyncIOTask
     Uint64 requested_size;
     Uint64 result_size;
     void *app_userdata;
+    SDL_AsyncIOTask *batch_next;  // the generic backend chains back-to-back reads from SDL_ReadAsyncIOBatch here, to do them all at once.
     LINKED_LIST_DECLARE_FIELDS(struct SDL_AsyncIOTask, asyncio);
     LINKED_LIST_DECLARE_FIELDS(struct SDL_AsyncIOTask, queue);      // the generic backend uses this, so I've added it here to avoid the extra allocation.
     LINKED_LIST_DECLARE_FIELDS(struct SDL_AsyncIOTask, threadpool); // the generic backend uses this, so I've added it here to avoid the extra allocation.
@@ -94,6 +96,7 @@ typedef struct SDL_AsyncIOQueueInterface
     SDL_AsyncIOTask * (*wait_results)(void *userdata, Sint32 timeoutMS);
     void (*signal)(void *userdata);
     void (*destroy)(void *userdata);
+    int (*read_batch)(void *userdata, SDL_AsyncIOTask **tasks, int num_tasks);  // optional; queue already-prepared reads in one go, returns number queued from the front of the array.
 } SDL_AsyncIOQueueInterface;
 
 struct SDL_AsyncIOQueue
@@ -124,6 +127,7 @@ struct SDL_AsyncIO
     SDL_AsyncIOTask tasks;
     SDL_AsyncIOTask *closing;  // The close task, which isn't queued until all pending work for this file is done.
     bool oneshot;  // true if this is a SDL_LoadFileAsync open.
+    SDL_AsyncIOCopy *copy;  // non-NULL if this is one end of a SDL_CopyFileAsync.
     bool readonly;  // true if this file is opened read-only.
 };
 
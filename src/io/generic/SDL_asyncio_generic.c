@@ -26,6 +26,12 @@
 #include "SDL_internal.h"
 #include "../SDL_sysasyncio.h"
 
+#ifdef HAVE_PREADV
+#include <stdio.h>
+#include <errno.h>
+#include <sys/uio.h>
+#endif
+
 // on Emscripten without threads, async i/o is synchronous. Sorry. Almost
 // everything is MEMFS, so it's just a memcpy anyhow, and the Emscripten
 // filesystem APIs don't offer async. In theory, directly accessing
@@ -48,6 +54,7 @@ typedef struct GenericAsyncIOData
 {
     SDL_Mutex *lock;  // !!! FIXME: we can skip this lock if we have an equivalent of pread/pwrite
     SDL_IOStream *io;
+    int fd;  // the file descriptor under `io` for batched preadv() calls, or -1. Only set for read-only files.
 } GenericAsyncIOData;
 
 static void AsyncIOTaskComplete(SDL_AsyncIOTask *task)
@@ -60,12 +67,121 @@ static void AsyncIOTaskComplete(SDL_AsyncIOTask *task)
     SDL_UnlockMutex(data->lock);
 }
 
+// complete a task along with everything chained to it by SDL_ReadAsyncIOBatch.
+static void AsyncIOTaskChainComplete(SDL_AsyncIOTask *task)
+{
+    while (task) {
+        SDL_AsyncIOTask *next = task->batch_next;  // once it's complete, the app can free it out from under us.
+        AsyncIOTaskComplete(task);
+        task = next;
+    }
+}
+
+static void AsyncIOTaskChainCanceled(SDL_AsyncIOTask *task)
+{
+    for (SDL_AsyncIOTask *i = task; i; i = i->batch_next) {
+        i->result = SDL_ASYNCIO_CANCELED;
+    }
+    AsyncIOTaskChainComplete(task);
+}
+
+#ifdef HAVE_PREADV
+// Fill a chain of back-to-back reads with as few preadv() calls as possible.
+static void PreadvIO(int fd, SDL_AsyncIOTask *task)
+{
+    struct iovec iov[64];
+    SDL_AsyncIOTask *current = task;  // the first task that isn't full yet.
+    Uint64 filled = 0;  // bytes already read into `current`.
+    Uint64 offset = task->offset;
+    bool failed = false;
+
+    while (current) {
+        int iovcnt = 0;
+        for (SDL_AsyncIOTask *i = current; i && (iovcnt < SDL_arraysize(iov)); i = i->batch_next) {
+            const Uint64 skip = (i == current) ? filled : 0;
+            iov[iovcnt].iov_base = ((Uint8 *) i->buffer) + skip;
+            iov[iovcnt].iov_len = (size_t) (i->requested_size - skip);
+            iovcnt++;
+        }
+
+        const ssize_t br = preadv(fd, iov, iovcnt, (off_t) offset);
+        if (br < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            failed = true;
+            break;
+        } else if (br == 0) {
+            break;  // EOF
+        }
+
+        offset += (Uint64) br;
+        Uint64 remaining = (Uint64) br;
+        while (current && remaining) {
+            const Uint64 wanted = current->requested_size - filled;
+            if (remaining >= wanted) {
+                current->result_size = current->requested_size;
+                remaining -= wanted;
+                current = current->batch_next;
+                filled = 0;
+            } else {
+                filled += remaining;
+                current->result_size = filled;
+                remaining = 0;
+            }
+        }
+    }
+
+    // anything left was cut short. At EOF that's still a complete (short) read, same as SynchronousIO.
+    for (; current; current = current->batch_next) {
+        current->result = failed ? SDL_ASYNCIO_FAILURE : SDL_ASYNCIO_COMPLETE;
+    }
+}
+#endif
+
+// Do a chain of back-to-back reads from SDL_ReadAsyncIOBatch in one pass over the file.
+static void BatchedReadIO(SDL_AsyncIOTask *task)
+{
+    GenericAsyncIOData *data = (GenericAsyncIOData *) task->asyncio->userdata;
+
+#ifdef HAVE_PREADV
+    if (data->fd >= 0) {
+        PreadvIO(data->fd, task);  // this doesn't touch the stream's file position, so it doesn't need the lock.
+        AsyncIOTaskChainComplete(task);
+        return;
+    }
+#endif
+
+    SDL_LockMutex(data->lock);
+    bool okay = (SDL_SeekIO(data->io, (Sint64) task->offset, SDL_IO_SEEK_SET) >= 0);
+    bool eof = false;
+    for (SDL_AsyncIOTask *i = task; i; i = i->batch_next) {
+        if (okay && !eof) {
+            i->result_size = (Uint64) SDL_ReadIO(data->io, i->buffer, (size_t) i->requested_size);
+            if (i->result_size < i->requested_size) {
+                const SDL_IOStatus status = SDL_GetIOStatus(data->io);
+                eof = (status == SDL_IO_STATUS_EOF);
+                okay = eof;
+            }
+        }
+        i->result = okay ? SDL_ASYNCIO_COMPLETE : SDL_ASYNCIO_FAILURE;
+    }
+    SDL_UnlockMutex(data->lock);
+
+    AsyncIOTaskChainComplete(task);
+}
+
 // synchronous i/o is offloaded onto the threadpool. This function does the threaded work.
 // This is called directly, without a threadpool, if !SDL_ASYNCIO_USE_THREADPOOL.
 static void SynchronousIO(SDL_AsyncIOTask *task)
 {
     SDL_assert(task->result != SDL_ASYNCIO_CANCELED);  // shouldn't have gotten in here if canceled!
 
+    if (task->batch_next) {
+        BatchedReadIO(task);
+        return;
+    }
+
     GenericAsyncIOData *data = (GenericAsyncIOData *) task->asyncio->userdata;
     SDL_IOStream *io = data->io;
     const size_t size = (size_t) task->requested_size;
@@ -184,8 +300,7 @@ static void QueueAsyncIOTask(SDL_AsyncIOTask *task)
     SDL_LockMutex(threadpool_lock);
 
     if (stop_threadpool) {  // just in case.
-        task->result = SDL_ASYNCIO_CANCELED;
-        AsyncIOTaskComplete(task);
+        AsyncIOTaskChainCanceled(task);
     } else {
         LINKED_LIST_PREPEND(task, threadpool_tasks, threadpool);
         MaybeSpinNewWorkerThread();  // okay if this fails or the thread pool is maxed out. Something will get there eventually.
@@ -200,6 +315,31 @@ static void QueueAsyncIOTask(SDL_AsyncIOTask *task)
     SDL_UnlockMutex(threadpool_lock);
 }
 
+// Queue a batch of tasks while only waking the threadpool once. Tasks that are chained behind
+// the previous one in the array ride along with it instead of being queued on their own.
+static void QueueAsyncIOTasks(SDL_AsyncIOTask **tasks, int num_tasks)
+{
+    SDL_LockMutex(threadpool_lock);
+
+    // the threadpool takes tasks from the front of the list, so push these backwards to start them in order.
+    for (int i = num_tasks - 1; i >= 0; i--) {
+        if ((i > 0) && (tasks[i - 1]->batch_next == tasks[i])) {
+            continue;
+        } else if (stop_threadpool) {  // just in case.
+            AsyncIOTaskChainCanceled(tasks[i]);
+        } else {
+            LINKED_LIST_PREPEND(tasks[i], threadpool_tasks, threadpool);
+        }
+    }
+
+    if (!stop_threadpool) {
+        MaybeSpinNewWorkerThread();  // okay if this fails or the thread pool is maxed out. Something will get there eventually.
+        SDL_BroadcastCondition(threadpool_condition);
+    }
+
+    SDL_UnlockMutex(threadpool_lock);
+}
+
 // We don't initialize async i/o at all until it's used, so
 //  JUST IN CASE two things try to start at the same time,
 //  this will make sure everything gets the same mutex.
@@ -239,8 +379,7 @@ static void ShutdownThreadpool(void)
         SDL_AsyncIOTask *task;
         while ((task = LINKED_LIST_START(threadpool_tasks, threadpool)) != NULL) {
             LINKED_LIST_UNLINK(task, threadpool);
-            task->result = SDL_ASYNCIO_CANCELED;
-            AsyncIOTaskComplete(task);
+            AsyncIOTaskChainCanceled(task);
         }
 
         stop_threadpool = true;
@@ -297,6 +436,31 @@ static bool generic_asyncioqueue_queue_task(void *userdata, SDL_AsyncIOTask *tas
     return true;
 }
 
+static int generic_asyncioqueue_read_batch(void *userdata, SDL_AsyncIOTask **tasks, int num_tasks)
+{
+    // chain each run of back-to-back reads from the same file behind its first task, so one thread does the whole run in one pass.
+    for (int i = 0; i < num_tasks; i++) {
+        tasks[i]->batch_next = NULL;
+        if (i > 0) {
+            SDL_AsyncIOTask *prev = tasks[i - 1];
+            if ((prev->asyncio == tasks[i]->asyncio) && ((prev->offset + prev->requested_size) == tasks[i]->offset)) {
+                prev->batch_next = tasks[i];
+            }
+        }
+    }
+
+    #if SDL_ASYNCIO_USE_THREADPOOL
+    QueueAsyncIOTasks(tasks, num_tasks);
+    #else
+    for (int i = 0; i < num_tasks; i++) {
+        if ((i == 0) || (tasks[i - 1]->batch_next != tasks[i])) {
+            SynchronousIO(tasks[i]);  // oh well. Get a better platform.
+        }
+    }
+    #endif
+    return num_tasks;
+}
+
 static void generic_asyncioqueue_cancel_task(void *userdata, SDL_AsyncIOTask *task)
 {
     #if !SDL_ASYNCIO_USE_THREADPOOL  // in theory, this was all synchronous and should never call this, but just in case.
@@ -304,11 +468,11 @@ static void generic_asyncioqueue_cancel_task(void *userdata, SDL_AsyncIOTask *ta
     AsyncIOTaskComplete(task);
     #else
     // we can't stop i/o that's in-flight, but we _can_ just refuse to start it if the threadpool hadn't picked it up yet.
+    // (reads chained behind this one by SDL_ReadAsyncIOBatch aren't in the queue on their own, so they get canceled with it.)
     SDL_LockMutex(threadpool_lock);
     if (LINKED_LIST_PREV(task, threadpool) != NULL) {  // still in the queue waiting to be run? Take it out.
         LINKED_LIST_UNLINK(task, threadpool);
-        task->result = SDL_ASYNCIO_CANCELED;
-        AsyncIOTaskComplete(task);
+        AsyncIOTaskChainCanceled(task);
     }
     SDL_UnlockMutex(threadpool_lock);
     #endif
@@ -390,7 +554,8 @@ bool SDL_SYS_CreateAsyncIOQueue_Generic(SDL_AsyncIOQueue *queue)
         generic_asyncioqueue_get_results,
         generic_asyncioqueue_wait_results,
         generic_asyncioqueue_signal,
-        generic_asyncioqueue_destroy
+        generic_asyncioqueue_destroy,
+        generic_asyncioqueue_read_batch
     };
 
     SDL_copyp(&queue->iface, &SDL_AsyncIOQueue_Generic);
@@ -425,6 +590,15 @@ bool SDL_SYS_AsyncIOFromFile_Generic(const char *file, const char *mode, SDL_Asy
         return false;
     }
 
+    data->fd = -1;
+    #ifdef HAVE_PREADV
+    if (SDL_strcmp(mode, "rb") == 0) {  // nothing else writes through `io`, so reading the descriptor directly can't miss buffered data.
+        const SDL_PropertiesID props = SDL_GetIOProperties(data->io);
+        FILE *fp = (FILE *) SDL_GetPointerProperty(props, SDL_PROP_IOSTREAM_STDIO_FILE_POINTER, NULL);
+        data->fd = fp ? fileno(fp) : (int) SDL_GetNumberProperty(props, SDL_PROP_IOSTREAM_FILE_DESCRIPTOR_NUMBER, -1);
+    }
+    #endif
+
     static const SDL_AsyncIOInterface SDL_AsyncIOFile_Generic = {
         generic_asyncio_size,
         generic_asyncio_io,
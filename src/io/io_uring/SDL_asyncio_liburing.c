@@ -65,6 +65,9 @@ static bool (*AsyncIOFromFile)(const char *file, const char *mode, SDL_AsyncIO *
 static const char *liburing_library = SDL_DRIVER_LIBURING_DYNAMIC;
 static void *liburing_handle = NULL;
 
+// number of entries in each queue's submission ring.
+#define LIBURING_QUEUE_ENTRIES 128
+
 SDL_ELF_NOTE_DLOPEN(
     "io-io_uring",
     "Support for async IO through liburing",
@@ -213,6 +216,86 @@ static bool liburing_asyncioqueue_queue_task(void *userdata, SDL_AsyncIOTask *ta
     return (rc < 0) ? liburing_SetError("io_uring_submit", rc) : true;
 }
 
+// Hand pending SQEs to the kernel. Returns how many of `sqes` it took (the rest stay at the front of the array), or -1 on error.
+static int liburing_submit_pending(LibUringAsyncIOQueueData *queuedata, struct io_uring_sqe **sqes, int *num_sqes)
+{
+    int rc = liburing.io_uring_submit(&queuedata->ring);
+    if (rc < 0) {
+        liburing_SetError("io_uring_submit", rc);
+        return -1;
+    }
+    rc = SDL_min(rc, *num_sqes);  // the kernel can take fewer than we asked for, and can't tell us about any left over by other paths.
+    *num_sqes -= rc;
+    if (*num_sqes > 0) {
+        SDL_memmove(sqes, sqes + rc, *num_sqes * sizeof (*sqes));
+    }
+    return rc;
+}
+
+// Prepare SQEs for a whole batch of reads and submit them with as few io_uring_submit() calls as possible.
+static int liburing_asyncioqueue_read_batch(void *userdata, SDL_AsyncIOTask **tasks, int num_tasks)
+{
+    LibUringAsyncIOQueueData *queuedata = (LibUringAsyncIOQueueData *) userdata;
+    struct io_uring_sqe *pending[LIBURING_QUEUE_ENTRIES];  // prepared, but not taken by the kernel yet. Can't exceed the ring size.
+    int num_pending = 0;
+    int num_submitted = 0;
+
+    // have to hold a lock because otherwise two threads could get_sqe and submit while one request isn't fully set up.
+    SDL_LockMutex(queuedata->sqe_lock);
+    for (int i = 0; i < num_tasks; i++) {
+        SDL_AsyncIOTask *task = tasks[i];
+
+        // !!! FIXME: `unsigned` is likely smaller than requested_size's Uint64. If we overflow it, we could try submitting multiple SQEs
+        // !!! FIXME:  and make a note in the task that there are several in sequence.
+        if (task->requested_size > ((Uint64) ~((unsigned) 0))) {
+            SDL_SetError("io_uring: i/o task is too large");
+            break;
+        }
+
+        struct io_uring_sqe *sqe = liburing.io_uring_get_sqe(&queuedata->ring);
+        if (!sqe) {  // submission queue is full? Push what we have to the kernel to make room and try again.
+            const int rc = liburing_submit_pending(queuedata, pending, &num_pending);
+            if (rc < 0) {
+                break;
+            }
+            num_submitted += rc;
+            if (num_pending > 0) {
+                SDL_SetError("io_uring: kernel didn't accept the whole batch");
+                break;
+            }
+            sqe = liburing.io_uring_get_sqe(&queuedata->ring);
+            if (!sqe) {
+                SDL_SetError("io_uring: submission queue is full");
+                break;
+            }
+        }
+
+        const int fd = (int) (intptr_t) task->asyncio->userdata;
+        liburing.io_uring_prep_read(sqe, fd, task->buffer, (unsigned) task->requested_size, task->offset);
+        liburing.io_uring_sqe_set_data(sqe, task);
+        TsanRelease(task);  // ThreadSanitizer doesn't know that io_uring is serializing access to `task`, so let it know this thread is done with it.
+        SDL_assert(num_pending < (int) SDL_arraysize(pending));
+        pending[num_pending++] = sqe;
+    }
+
+    if (num_pending > 0) {
+        const int rc = liburing_submit_pending(queuedata, pending, &num_pending);
+        if (rc >= 0) {
+            num_submitted += rc;
+        }
+    }
+
+    // Anything still pending is sitting in the ring pointing at a task the caller will free when we report it unqueued.
+    //  Turn those into NOPs with no task attached, so they complete harmlessly whenever the kernel does pick them up.
+    for (int i = 0; i < num_pending; i++) {
+        liburing.io_uring_prep_nop(pending[i]);
+        liburing.io_uring_sqe_set_data(pending[i], NULL);
+    }
+    SDL_UnlockMutex(queuedata->sqe_lock);
+
+    return num_submitted;
+}
+
 static void liburing_asyncioqueue_cancel_task(void *userdata, SDL_AsyncIOTask *task)
 {
     SDL_AsyncIOTask *cancel_task = (SDL_AsyncIOTask *) SDL_calloc(1, sizeof (*cancel_task));
@@ -375,7 +458,7 @@ static bool SDL_SYS_CreateAsyncIOQueue_liburing(SDL_AsyncIOQueue *queue)
     }
 
     // !!! FIXME: no idea how large the queue should be. Is 128 overkill or too small?
-    const int rc = liburing.io_uring_queue_init(128, &queuedata->ring, 0);
+    const int rc = liburing.io_uring_queue_init(LIBURING_QUEUE_ENTRIES, &queuedata->ring, 0);
     if (rc != 0) {
         SDL_DestroyMutex(queuedata->sqe_lock);
         SDL_DestroyMutex(queuedata->cqe_lock);
@@ -389,7 +472,8 @@ static bool SDL_SYS_CreateAsyncIOQueue_liburing(SDL_AsyncIOQueue *queue)
         liburing_asyncioqueue_get_results,
         liburing_asyncioqueue_wait_results,
         liburing_asyncioqueue_signal,
-        liburing_asyncioqueue_destroy
+        liburing_asyncioqueue_destroy,
+        liburing_asyncioqueue_read_batch
     };
 
     SDL_copyp(&queue->iface, &SDL_AsyncIOQueue_liburing);
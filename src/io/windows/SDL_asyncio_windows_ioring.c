@@ -353,7 +353,8 @@ static bool SDL_SYS_CreateAsyncIOQueue_ioring(SDL_AsyncIOQueue *queue)
         ioring_asyncioqueue_get_results,
         ioring_asyncioqueue_wait_results,
         ioring_asyncioqueue_signal,
-        ioring_asyncioqueue_destroy
+        ioring_asyncioqueue_destroy,
+        NULL  // !!! FIXME: batch these into one SubmitIoRing() call, like the liburing backend does.
     };
 
     SDL_copyp(&queue->iface, &SDL_AsyncIOQueue_ioring);
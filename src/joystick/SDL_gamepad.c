@@ -105,6 +105,7 @@ typedef struct GamepadMapping_t
     char *mapping _guarded;
     SDL_GamepadMappingPriority priority _guarded;
     struct GamepadMapping_t *next _guarded;
+    struct GamepadMapping_t *next_for_guid _guarded;  // the next mapping with the same GUID, ignoring version and CRC
 } GamepadMapping_t;
 
 typedef struct
@@ -122,6 +123,8 @@ typedef struct
 
 static SDL_GUID s_zeroGUID;
 static GamepadMapping_t *s_pSupportedGamepads SDL_GUARDED_BY(SDL_event_lock) = NULL;
+static GamepadMapping_t *s_pLastSupportedGamepad SDL_GUARDED_BY(SDL_event_lock) = NULL;
+static SDL_HashTable *s_gamepadMappingsByGUID SDL_GUARDED_BY(SDL_event_lock) = NULL;
 static GamepadMapping_t *s_pDefaultMapping SDL_GUARDED_BY(SDL_event_lock) = NULL;
 static GamepadMapping_t *s_pXInputMapping SDL_GUARDED_BY(SDL_event_lock) = NULL;
 static MappingChangeTracker *s_mappingChangeTracker SDL_GUARDED_BY(SDL_event_lock) = NULL;
@@ -1376,6 +1379,72 @@ static GamepadMapping_t *SDL_CreateMappingForWGIGamepad(SDL_GUID guid)
     return SDL_PrivateAddMappingForGUID(guid, mapping_string, &existing, SDL_GAMEPAD_MAPPING_PRIORITY_DEFAULT);
 }
 
+/*
+ * The mappings are indexed by GUID with the version and CRC cleared, so every
+ * mapping that could match a gamepad is found with one lookup.
+ */
+static SDL_GUID SDL_PrivateGetGamepadMappingKey(const void *guid)
+{
+    SDL_GUID key;
+
+    SDL_memcpy(&key, guid, sizeof(key));
+    SDL_SetJoystickGUIDVersion(&key, 0);
+    SDL_SetJoystickGUIDCRC(&key, 0);
+    return key;
+}
+
+static Uint32 SDLCALL SDL_HashGamepadMappingGUID(void *unused, const void *key)
+{
+    const SDL_GUID guid = SDL_PrivateGetGamepadMappingKey(key);
+    return SDL_murmur3_32(&guid, sizeof(guid), 0);
+}
+
+static bool SDLCALL SDL_KeyMatchGamepadMappingGUID(void *unused, const void *a, const void *b)
+{
+    const SDL_GUID guid_a = SDL_PrivateGetGamepadMappingKey(a);
+    const SDL_GUID guid_b = SDL_PrivateGetGamepadMappingKey(b);
+    return SDL_memcmp(&guid_a, &guid_b, sizeof(guid_a)) == 0;
+}
+
+/*
+ * Helper function to add a new mapping to the end of the mappings database
+ */
+static bool SDL_PrivateAppendGamepadMapping(GamepadMapping_t *pGamepadMapping)
+{
+    SDL_AssertJoysticksLocked();
+
+    // Mappings without a GUID are never matched by GUID, so they aren't indexed
+    if (SDL_memcmp(&pGamepadMapping->guid, &s_zeroGUID, sizeof(pGamepadMapping->guid)) != 0) {
+        GamepadMapping_t *first = NULL;
+
+        if (!s_gamepadMappingsByGUID) {
+            s_gamepadMappingsByGUID = SDL_CreateHashTable(0, false, SDL_HashGamepadMappingGUID, SDL_KeyMatchGamepadMappingGUID, NULL, NULL);
+            if (!s_gamepadMappingsByGUID) {
+                return false;
+            }
+        }
+
+        if (SDL_FindInHashTable(s_gamepadMappingsByGUID, &pGamepadMapping->guid, (const void **)&first)) {
+            // Keep mappings that share a GUID in the order they were added, the first match wins
+            GamepadMapping_t *last = first;
+            while (last->next_for_guid) {
+                last = last->next_for_guid;
+            }
+            last->next_for_guid = pGamepadMapping;
+        } else if (!SDL_InsertIntoHashTable(s_gamepadMappingsByGUID, &pGamepadMapping->guid, pGamepadMapping, false)) {
+            return false;
+        }
+    }
+
+    if (s_pLastSupportedGamepad) {
+        s_pLastSupportedGamepad->next = pGamepadMapping;
+    } else {
+        s_pSupportedGamepads = pGamepadMapping;
+    }
+    s_pLastSupportedGamepad = pGamepadMapping;
+    return true;
+}
+
 /*
  * Helper function to scan the mappings database for a gamepad with the specified GUID
  */
@@ -1386,6 +1455,11 @@ static GamepadMapping_t *SDL_PrivateMatchGamepadMappingForGUID(SDL_GUID guid, bo
 
     SDL_AssertJoysticksLocked();
 
+    if (!s_gamepadMappingsByGUID ||
+        !SDL_FindInHashTable(s_gamepadMappingsByGUID, &guid, (const void **)&mapping)) {
+        return NULL;
+    }
+
     SDL_GetJoystickGUIDInfo(guid, NULL, NULL, NULL, &crc);
 
     // Clear the CRC from the GUID for matching, the mappings never include it in the GUID
@@ -1395,13 +1469,9 @@ static GamepadMapping_t *SDL_PrivateMatchGamepadMappingForGUID(SDL_GUID guid, bo
         SDL_SetJoystickGUIDVersion(&guid, 0);
     }
 
-    for (mapping = s_pSupportedGamepads; mapping; mapping = mapping->next) {
+    for (; mapping; mapping = mapping->next_for_guid) {
         SDL_GUID mapping_guid;
 
-        if (SDL_memcmp(&mapping->guid, &s_zeroGUID, sizeof(mapping->guid)) == 0) {
-            continue;
-        }
-
         SDL_memcpy(&mapping_guid, &mapping->guid, sizeof(mapping_guid));
         if (!match_version) {
             SDL_SetJoystickGUIDVersion(&mapping_guid, 0);
@@ -2240,20 +2310,15 @@ static GamepadMapping_t *SDL_PrivateAddMappingForGUID(SDL_GUID jGUID, const char
         pGamepadMapping->name = pchName;
         pGamepadMapping->mapping = pchMapping;
         pGamepadMapping->next = NULL;
+        pGamepadMapping->next_for_guid = NULL;
         pGamepadMapping->priority = priority;
 
-        if (s_pSupportedGamepads) {
-            // Add the mapping to the end of the list
-            GamepadMapping_t *pCurrMapping, *pPrevMapping;
-
-            for (pPrevMapping = s_pSupportedGamepads, pCurrMapping = pPrevMapping->next;
-                 pCurrMapping;
-                 pPrevMapping = pCurrMapping, pCurrMapping = pCurrMapping->next) {
-                // continue;
-            }
-            pPrevMapping->next = pGamepadMapping;
-        } else {
-            s_pSupportedGamepads = pGamepadMapping;
+        if (!SDL_PrivateAppendGamepadMapping(pGamepadMapping)) {
+            PopMappingChangeTracking();
+            SDL_free(pchName);
+            SDL_free(pchMapping);
+            SDL_free(pGamepadMapping);
+            return NULL;
         }
         if (existing) {
             *existing = false;
@@ -4427,6 +4492,11 @@ void SDL_QuitGamepadMappings(void)
 
     SDL_AssertJoysticksLocked();
 
+    if (s_gamepadMappingsByGUID) {
+        SDL_DestroyHashTable(s_gamepadMappingsByGUID);
+        s_gamepadMappingsByGUID = NULL;
+    }
+
     while (s_pSupportedGamepads) {
         pGamepadMap = s_pSupportedGamepads;
         s_pSupportedGamepads = s_pSupportedGamepads->next;
@@ -4434,6 +4504,7 @@ void SDL_QuitGamepadMappings(void)
         SDL_free(pGamepadMap->mapping);
         SDL_free(pGamepadMap);
     }
+    s_pLastSupportedGamepad = NULL;
 
     SDL_FreeVIDPIDList(&SDL_allowed_gamepads);
     SDL_FreeVIDPIDList(&SDL_ignored_gamepads);
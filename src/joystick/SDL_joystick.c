@@ -47,6 +47,9 @@
 #ifdef SDL_JOYSTICK_VIRTUAL
 #include "./virtual/SDL_virtualjoystick_c.h"
 #endif
+#ifdef SDL_JOYSTICK_LINUX
+#include "./linux/SDL_inputthread_c.h"
+#endif
 
 static SDL_JoystickDriver *SDL_joystick_drivers[] = {
 #ifdef SDL_JOYSTICK_HIDAPI // Highest priority driver for supported devices
@@ -863,6 +866,11 @@ bool SDL_InitJoysticks(void)
         return false;
     }
 
+#ifdef SDL_JOYSTICK_INPUT_THREAD
+    // Start this before the drivers, so they can watch devices as they're opened
+    SDL_StartJoystickInputThread();
+#endif
+
     SDL_LockJoysticks();
 
     SDL_joysticks_initialized = true;
@@ -2270,6 +2278,11 @@ void SDL_QuitJoysticks(void)
     int i;
     SDL_JoystickID *joysticks;
 
+#ifdef SDL_JOYSTICK_INPUT_THREAD
+    // This has to stop without the joysticks locked, since the thread locks them to deliver input
+    SDL_StopJoystickInputThread();
+#endif
+
     SDL_LockJoysticks();
 
     SDL_joysticks_quitting = true;
@@ -31,6 +31,11 @@
 #include "../windows/SDL_rawinputjoystick_c.h"
 #endif
 
+#ifdef SDL_JOYSTICK_LINUX
+#include "../../hidapi/SDL_hidapi_c.h"
+#include "../linux/SDL_inputthread_c.h"
+#endif
+
 
 struct joystick_hwdata
 {
@@ -248,6 +253,8 @@ float HIDAPI_RemapVal(float val, float val_min, float val_max, float output_min,
 
 static void HIDAPI_UpdateDeviceList(void);
 static void HIDAPI_JoystickClose(SDL_Joystick *joystick);
+static bool HIDAPI_StartUpdatingDevices(void);
+static void HIDAPI_FinishUpdatingDevices(void);
 
 static SDL_GamepadType SDL_GetJoystickGameControllerProtocol(const char *name, Uint16 vendor, Uint16 product, int interface_number, int interface_class, int interface_subclass, int interface_protocol)
 {
@@ -433,12 +440,31 @@ static SDL_HIDAPI_Device *HIDAPI_GetJoystickByInfo(const char *path, Uint16 vend
     return device;
 }
 
+#ifdef SDL_JOYSTICK_INPUT_THREAD
+static void HIDAPI_DeviceInputReady(void *userdata)
+{
+    SDL_HIDAPI_Device *device = (SDL_HIDAPI_Device *)userdata;
+
+    if (HIDAPI_StartUpdatingDevices()) {
+        if (device->driver) {
+            device->driver->UpdateDevice(device);
+        }
+        HIDAPI_FinishUpdatingDevices();
+    }
+}
+#endif // SDL_JOYSTICK_INPUT_THREAD
+
 static void HIDAPI_CleanupDeviceDriver(SDL_HIDAPI_Device *device)
 {
     if (!device->driver) {
         return; // Already cleaned up
     }
 
+#ifdef SDL_JOYSTICK_INPUT_THREAD
+    SDL_RemoveJoystickInputFD(device->input_thread_id);
+    device->input_thread_id = 0;
+#endif
+
     // Disconnect any joysticks
     while (device->num_joysticks && device->joysticks) {
         HIDAPI_JoystickDisconnected(device, device->joysticks[0]);
@@ -517,6 +543,12 @@ static void HIDAPI_SetupDeviceDriver(SDL_HIDAPI_Device *device, bool *removed) S
             HIDAPI_CleanupDeviceDriver(device);
         }
 
+#ifdef SDL_JOYSTICK_INPUT_THREAD
+        if (device->driver && device->dev) {
+            device->input_thread_id = SDL_AddJoystickInputFD(SDL_HIDAPI_GetDeviceFD(device->dev), HIDAPI_DeviceInputReady, device);
+        }
+#endif
+
         if (!device->driver && device->dev) {
             // No driver claimed this device, go ahead and close it
             SDL_hid_close(device->dev);
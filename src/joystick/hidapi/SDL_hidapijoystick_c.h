@@ -101,6 +101,7 @@ typedef struct SDL_HIDAPI_Device
     struct SDL_HIDAPI_DeviceDriver *driver;
     void *context;
     SDL_hid_device *dev;
+    Uint32 input_thread_id; // Registration with the joystick input thread, if any
     SDL_AtomicInt rumble_pending;
     int num_joysticks;
     SDL_JoystickID *joysticks;
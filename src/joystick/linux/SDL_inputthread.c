@@ -0,0 +1,230 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#include "SDL_inputthread_c.h"
+
+#ifdef SDL_JOYSTICK_INPUT_THREAD
+
+/* This thread waits for input on open joystick devices and processes it as soon as it arrives,
+   instead of waiting for the application to call SDL_UpdateJoysticks(). The wait itself happens
+   without the joystick lock, which is only taken to run the driver's update for a ready device.
+
+   Devices are watched edge triggered, so a device that wasn't fully drained by the callback
+   won't wake the thread again until new input arrives. Anything left over is picked up by the
+   regular SDL_UpdateJoysticks() polling, which continues to run as a fallback.
+ */
+
+#include "../SDL_joystick_c.h"
+
+#include <errno.h>
+#include <string.h> // strerror
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#define MAX_INPUT_EVENTS 16
+
+typedef struct SDL_JoystickInputFD
+{
+    Uint32 id;
+    int fd;
+    SDL_JoystickInputCallback callback;
+    void *userdata;
+} SDL_JoystickInputFD;
+
+static SDL_Thread *SDL_joystick_input_thread;
+static SDL_AtomicInt SDL_joystick_input_quit;
+static int SDL_joystick_input_epoll = -1;
+static int SDL_joystick_input_wakeup = -1;
+static SDL_JoystickInputFD *SDL_joystick_input_fds;
+static int SDL_joystick_input_num_fds;
+static Uint32 SDL_joystick_input_next_id;
+
+static SDL_JoystickInputFD *GetJoystickInputFD(Uint32 id)
+{
+    int i;
+
+    SDL_AssertJoysticksLocked();
+
+    for (i = 0; i < SDL_joystick_input_num_fds; ++i) {
+        if (SDL_joystick_input_fds[i].id == id) {
+            return &SDL_joystick_input_fds[i];
+        }
+    }
+    return NULL;
+}
+
+static int SDLCALL SDL_JoystickInputThread(void *data)
+{
+    struct epoll_event events[MAX_INPUT_EVENTS];
+
+    SDL_SetCurrentThreadPriority(SDL_THREAD_PRIORITY_HIGH);
+
+    while (!SDL_GetAtomicInt(&SDL_joystick_input_quit)) {
+        int i, count;
+
+        count = epoll_wait(SDL_joystick_input_epoll, events, SDL_arraysize(events), -1);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            SDL_LogError(SDL_LOG_CATEGORY_INPUT, "Joystick input thread couldn't wait for input: %s", strerror(errno));
+            break;
+        }
+
+        SDL_LockJoysticks();
+        for (i = 0; i < count; ++i) {
+            // The wakeup eventfd has ID 0 and is only used to check the quit flag
+            SDL_JoystickInputFD *entry = events[i].data.u32 ? GetJoystickInputFD(events[i].data.u32) : NULL;
+
+            // The entry may have been removed while we were waiting for the lock
+            if (entry) {
+                entry->callback(entry->userdata);
+            }
+        }
+        SDL_UnlockJoysticks();
+    }
+    return 0;
+}
+
+void SDL_StartJoystickInputThread(void)
+{
+    struct epoll_event event;
+
+    if (SDL_joystick_input_thread || !SDL_GetHintBoolean(SDL_HINT_JOYSTICK_INPUT_THREAD, false)) {
+        return;
+    }
+
+    SDL_joystick_input_epoll = epoll_create1(EPOLL_CLOEXEC);
+    SDL_joystick_input_wakeup = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (SDL_joystick_input_epoll < 0 || SDL_joystick_input_wakeup < 0) {
+        goto error;
+    }
+
+    SDL_zero(event);
+    event.events = EPOLLIN;
+    event.data.u32 = 0;
+    if (epoll_ctl(SDL_joystick_input_epoll, EPOLL_CTL_ADD, SDL_joystick_input_wakeup, &event) < 0) {
+        goto error;
+    }
+
+    SDL_SetAtomicInt(&SDL_joystick_input_quit, false);
+    SDL_joystick_input_thread = SDL_CreateThread(SDL_JoystickInputThread, "SDLJoystickInput", NULL);
+    if (!SDL_joystick_input_thread) {
+        goto error;
+    }
+    return;
+
+error:
+    SDL_LogDebug(SDL_LOG_CATEGORY_INPUT, "Couldn't start joystick input thread, falling back to polling");
+    SDL_StopJoystickInputThread();
+}
+
+void SDL_StopJoystickInputThread(void)
+{
+    if (SDL_joystick_input_thread) {
+        const Uint64 value = 1;
+
+        SDL_SetAtomicInt(&SDL_joystick_input_quit, true);
+        if (write(SDL_joystick_input_wakeup, &value, sizeof(value)) != sizeof(value)) {
+            SDL_LogError(SDL_LOG_CATEGORY_INPUT, "Couldn't wake joystick input thread: %s", strerror(errno));
+        }
+        SDL_WaitThread(SDL_joystick_input_thread, NULL);
+        SDL_joystick_input_thread = NULL;
+    }
+
+    if (SDL_joystick_input_wakeup >= 0) {
+        close(SDL_joystick_input_wakeup);
+        SDL_joystick_input_wakeup = -1;
+    }
+    if (SDL_joystick_input_epoll >= 0) {
+        close(SDL_joystick_input_epoll);
+        SDL_joystick_input_epoll = -1;
+    }
+
+    SDL_LockJoysticks();
+    SDL_free(SDL_joystick_input_fds);
+    SDL_joystick_input_fds = NULL;
+    SDL_joystick_input_num_fds = 0;
+    SDL_UnlockJoysticks();
+}
+
+Uint32 SDL_AddJoystickInputFD(int fd, SDL_JoystickInputCallback callback, void *userdata)
+{
+    SDL_JoystickInputFD *fds;
+    SDL_JoystickInputFD *entry;
+    struct epoll_event event;
+
+    SDL_AssertJoysticksLocked();
+
+    if (!SDL_joystick_input_thread || fd < 0) {
+        return 0;
+    }
+
+    fds = (SDL_JoystickInputFD *)SDL_realloc(SDL_joystick_input_fds, (SDL_joystick_input_num_fds + 1) * sizeof(*fds));
+    if (!fds) {
+        return 0;
+    }
+    SDL_joystick_input_fds = fds;
+
+    entry = &SDL_joystick_input_fds[SDL_joystick_input_num_fds];
+    entry->id = ++SDL_joystick_input_next_id;
+    if (entry->id == 0) {
+        entry->id = ++SDL_joystick_input_next_id;
+    }
+    entry->fd = fd;
+    entry->callback = callback;
+    entry->userdata = userdata;
+
+    SDL_zero(event);
+    event.events = EPOLLIN | EPOLLET;
+    event.data.u32 = entry->id;
+    if (epoll_ctl(SDL_joystick_input_epoll, EPOLL_CTL_ADD, fd, &event) < 0) {
+        SDL_LogDebug(SDL_LOG_CATEGORY_INPUT, "Couldn't watch joystick fd %d: %s", fd, strerror(errno));
+        return 0;
+    }
+    ++SDL_joystick_input_num_fds;
+
+    return entry->id;
+}
+
+void SDL_RemoveJoystickInputFD(Uint32 id)
+{
+    SDL_JoystickInputFD *entry;
+
+    SDL_AssertJoysticksLocked();
+
+    if (id == 0) {
+        return;
+    }
+
+    entry = GetJoystickInputFD(id);
+    if (entry) {
+        if (SDL_joystick_input_epoll >= 0) {
+            epoll_ctl(SDL_joystick_input_epoll, EPOLL_CTL_DEL, entry->fd, NULL);
+        }
+        --SDL_joystick_input_num_fds;
+        *entry = SDL_joystick_input_fds[SDL_joystick_input_num_fds];
+    }
+}
+
+#endif // SDL_JOYSTICK_INPUT_THREAD
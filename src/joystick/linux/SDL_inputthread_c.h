@@ -0,0 +1,51 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#ifndef SDL_inputthread_c_h_
+#define SDL_inputthread_c_h_
+
+#if defined(SDL_JOYSTICK_LINUX) && defined(SDL_PLATFORM_LINUX)
+#define SDL_JOYSTICK_INPUT_THREAD
+#endif
+
+#ifdef SDL_JOYSTICK_INPUT_THREAD
+
+/* Called on the input thread with the joysticks locked when a watched file descriptor becomes readable */
+typedef void (*SDL_JoystickInputCallback)(void *userdata);
+
+/* Start and stop the input thread, if SDL_HINT_JOYSTICK_INPUT_THREAD is enabled.
+   These must be called without the joysticks locked, since the thread locks them to deliver input.
+ */
+extern void SDL_StartJoystickInputThread(void);
+extern void SDL_StopJoystickInputThread(void);
+
+/* Watch a non-blocking device file descriptor for input, returning an ID for SDL_RemoveJoystickInputFD(),
+   or 0 if the input thread isn't running. The joysticks must be locked.
+ */
+extern Uint32 SDL_AddJoystickInputFD(int fd, SDL_JoystickInputCallback callback, void *userdata);
+
+/* Stop watching a file descriptor. This must be called before it is closed, with the joysticks locked. */
+extern void SDL_RemoveJoystickInputFD(Uint32 id);
+
+#endif // SDL_JOYSTICK_INPUT_THREAD
+
+#endif // SDL_inputthread_c_h_
@@ -48,6 +48,7 @@
 #include "../usb_ids.h"
 #include "SDL_sysjoystick_c.h"
 #include "../hidapi/SDL_hidapijoystick_c.h"
+#include "SDL_inputthread_c.h"
 
 // This isn't defined in older Linux kernel headers
 #ifndef MSC_TIMESTAMP
@@ -1582,6 +1583,19 @@ static SDL_sensorlist_item *GetSensor(SDL_joylist_item *item)
     return NULL;
 }
 
+#ifdef SDL_JOYSTICK_INPUT_THREAD
+static void LINUX_JoystickUpdate(SDL_Joystick *joystick);
+
+static void LINUX_JoystickInputReady(void *userdata)
+{
+    SDL_Joystick *joystick = (SDL_Joystick *)userdata;
+
+    if (joystick->attached) {
+        LINUX_JoystickUpdate(joystick);
+    }
+}
+#endif // SDL_JOYSTICK_INPUT_THREAD
+
 static bool LINUX_JoystickOpen(SDL_Joystick *joystick, int device_index)
 {
     SDL_joylist_item *item;
@@ -1636,6 +1650,10 @@ static bool LINUX_JoystickOpen(SDL_Joystick *joystick, int device_index)
     if (joystick->hwdata->ff_rumble || joystick->hwdata->ff_sine) {
         SDL_SetBooleanProperty(SDL_GetJoystickProperties(joystick), SDL_PROP_JOYSTICK_CAP_RUMBLE_BOOLEAN, true);
     }
+
+#ifdef SDL_JOYSTICK_INPUT_THREAD
+    joystick->hwdata->input_thread_id = SDL_AddJoystickInputFD(joystick->hwdata->fd, LINUX_JoystickInputReady, joystick);
+#endif
     return true;
 }
 
@@ -1717,8 +1735,15 @@ static bool LINUX_JoystickSetSensorsEnabled(SDL_Joystick *joystick, bool enabled
             return SDL_SetError("Couldn't open sensor file %s.", joystick->hwdata->item_sensor->path);
         }
         fcntl(joystick->hwdata->fd_sensor, F_SETFL, O_NONBLOCK);
+#ifdef SDL_JOYSTICK_INPUT_THREAD
+        joystick->hwdata->input_thread_sensor_id = SDL_AddJoystickInputFD(joystick->hwdata->fd_sensor, LINUX_JoystickInputReady, joystick);
+#endif
     } else {
         SDL_assert(joystick->hwdata->fd_sensor >= 0);
+#ifdef SDL_JOYSTICK_INPUT_THREAD
+        SDL_RemoveJoystickInputFD(joystick->hwdata->input_thread_sensor_id);
+        joystick->hwdata->input_thread_sensor_id = 0;
+#endif
         close(joystick->hwdata->fd_sensor);
         joystick->hwdata->fd_sensor = -1;
     }
@@ -2216,6 +2241,10 @@ static void LINUX_JoystickClose(SDL_Joystick *joystick)
     SDL_AssertJoysticksLocked();
 
     if (joystick->hwdata) {
+#ifdef SDL_JOYSTICK_INPUT_THREAD
+        SDL_RemoveJoystickInputFD(joystick->hwdata->input_thread_id);
+        SDL_RemoveJoystickInputFD(joystick->hwdata->input_thread_sensor_id);
+#endif
         if (joystick->hwdata->effect.id >= 0) {
             ioctl(joystick->hwdata->fd, EVIOCRMFF, joystick->hwdata->effect.id);
             joystick->hwdata->effect.id = -1;
@@ -91,6 +91,10 @@ struct joystick_hwdata
     Uint64 sensor_tick;
     Sint32 last_tick;
 
+    // Registrations with the joystick input thread, or 0 if not watched
+    Uint32 input_thread_id;
+    Uint32 input_thread_sensor_id;
+
     bool report_sensor;
     bool fresh;
     bool recovering_from_dropped;
@@ -315,6 +315,244 @@ static SDL_INLINE void DebugLogRenderCommands(const SDL_RenderCommand *cmd)
 #endif
 }
 
+/* When enabled, draws are reordered before they are sent to the backend so that draws with
+   the same state end up next to each other and can be batched into fewer draw calls. A draw
+   is only moved ahead of draws that it doesn't overlap, so the result is the same as drawing
+   in submission order. Only runs of copy and geometry commands are reordered, any other
+   command stays where it is and is never moved past. */
+#define MAX_REORDERED_COMMANDS 128
+#define UNBOUNDED_COORDINATE   3.402823466e+38f // FLT_MAX, for draws that aren't bounded yet
+
+static bool IsReorderableCommand(const SDL_RenderCommand *cmd)
+{
+    return cmd->command == SDL_RENDERCMD_COPY || cmd->command == SDL_RENDERCMD_GEOMETRY;
+}
+
+static bool CanBatchCommands(const SDL_RenderCommand *a, const SDL_RenderCommand *b)
+{
+    if (a->command != b->command ||
+        a->data.draw.texture != b->data.draw.texture ||
+        a->data.draw.texture_address_mode_u != b->data.draw.texture_address_mode_u ||
+        a->data.draw.texture_address_mode_v != b->data.draw.texture_address_mode_v ||
+        a->data.draw.blend != b->data.draw.blend ||
+        a->data.draw.color_scale != b->data.draw.color_scale ||
+        a->data.draw.gpu_render_state != b->data.draw.gpu_render_state) {
+        return false;
+    }
+    if (a->data.draw.texture && a->data.draw.texture_scale_mode != b->data.draw.texture_scale_mode) {
+        return false;
+    }
+    if (a->command != SDL_RENDERCMD_GEOMETRY) {
+        // Geometry has the color built into the vertices
+        if (SDL_memcmp(&a->data.draw.color, &b->data.draw.color, sizeof(a->data.draw.color)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool CommandsOverlap(const SDL_RenderCommand *a, const SDL_RenderCommand *b)
+{
+    return a->data.draw.bounds_min.x < b->data.draw.bounds_max.x &&
+           b->data.draw.bounds_min.x < a->data.draw.bounds_max.x &&
+           a->data.draw.bounds_min.y < b->data.draw.bounds_max.y &&
+           b->data.draw.bounds_min.y < a->data.draw.bounds_max.y;
+}
+
+// Returns the number of draw calls a backend needs for these commands if it batches adjacent draws with the same state
+static Uint64 CountDrawCalls(const SDL_RenderCommand *cmd)
+{
+    const SDL_RenderCommand *batch = NULL;
+    Uint64 count = 0;
+
+    for (; cmd; cmd = cmd->next) {
+        switch (cmd->command) {
+        case SDL_RENDERCMD_NO_OP:
+        case SDL_RENDERCMD_SETDRAWCOLOR:
+            break;
+
+        case SDL_RENDERCMD_SETVIEWPORT:
+        case SDL_RENDERCMD_SETCLIPRECT:
+        case SDL_RENDERCMD_CLEAR:
+            batch = NULL;
+            break;
+
+        default:
+            if (!batch || !CanBatchCommands(batch, cmd)) {
+                batch = cmd;
+                ++count;
+            }
+            break;
+        }
+    }
+    return count;
+}
+
+// Moves the vertex data of the commands so it's in the same order as the commands
+static bool ReorderRenderVertices(SDL_Renderer *renderer, SDL_RenderCommand **order, int count)
+{
+    Uint8 *vertices = (Uint8 *)renderer->vertex_data;
+    size_t start = order[0]->data.draw.vertex_start;
+    size_t end = order[0]->data.draw.vertex_end;
+    size_t dest;
+    int i;
+
+    for (i = 1; i < count; ++i) {
+        start = SDL_min(start, order[i]->data.draw.vertex_start);
+        end = SDL_max(end, order[i]->data.draw.vertex_end);
+    }
+    if (start == end) {
+        return true;
+    }
+
+    // Keep the alignment the vertices were queued with, and make sure they still fit
+    dest = start;
+    for (i = 0; i < count; ++i) {
+        dest += (order[i]->data.draw.vertex_start - dest) & 3;
+        dest += order[i]->data.draw.vertex_end - order[i]->data.draw.vertex_start;
+    }
+    if (dest > end) {
+        return false;
+    }
+
+    if (renderer->reorder_vertex_data_allocation < (end - start)) {
+        void *ptr = SDL_realloc(renderer->reorder_vertex_data, end - start);
+        if (!ptr) {
+            return false;
+        }
+        renderer->reorder_vertex_data = ptr;
+        renderer->reorder_vertex_data_allocation = end - start;
+    }
+    SDL_memcpy(renderer->reorder_vertex_data, vertices + start, end - start);
+
+    dest = start;
+    for (i = 0; i < count; ++i) {
+        SDL_RenderCommand *cmd = order[i];
+        const size_t size = cmd->data.draw.vertex_end - cmd->data.draw.vertex_start;
+
+        dest += (cmd->data.draw.vertex_start - dest) & 3;
+        SDL_memcpy(vertices + dest, (Uint8 *)renderer->reorder_vertex_data + (cmd->data.draw.vertex_start - start), size);
+        cmd->data.draw.first = dest + (cmd->data.draw.first - cmd->data.draw.vertex_start);
+        cmd->data.draw.vertex_start = dest;
+        cmd->data.draw.vertex_end = dest + size;
+        dest += size;
+    }
+    return true;
+}
+
+/* Reorders a run of reorderable commands, linking them in after `link` and before `after`,
+   and returns the last one. Adjacent geometry commands that can be batched are merged. */
+static SDL_RenderCommand *ReorderRenderCommandRun(SDL_Renderer *renderer, SDL_RenderCommand **cmds, int count, SDL_RenderCommand **link, SDL_RenderCommand *after)
+{
+    SDL_RenderCommand *order[MAX_REORDERED_COMMANDS];
+    bool placed[MAX_REORDERED_COMMANDS];
+    SDL_RenderCommand *last = NULL;
+    int i, j, k, n = 0;
+
+    SDL_zeroa(placed);
+
+    /* Each command that hasn't been drawn yet starts a batch, and any later command that can
+       join it is pulled forward, as long as it doesn't overlap a command it would skip over. */
+    for (i = 0; i < count; ++i) {
+        if (placed[i]) {
+            continue;
+        }
+        order[n++] = cmds[i];
+        placed[i] = true;
+
+        for (j = i + 1; j < count; ++j) {
+            if (placed[j] || !CanBatchCommands(cmds[i], cmds[j])) {
+                continue;
+            }
+            for (k = i + 1; k < j; ++k) {
+                if (!placed[k] && CommandsOverlap(cmds[k], cmds[j])) {
+                    break;
+                }
+            }
+            if (k == j) {
+                order[n++] = cmds[j];
+                placed[j] = true;
+            }
+        }
+    }
+    SDL_assert(n == count);
+
+    /* Moving the vertices only lets adjacent geometry merge into one draw, so leave them where they
+       are if the backend queues them straight into mapped device memory, which is slow to read back. */
+    if (!renderer->AllocateVertexStorage && SDL_memcmp(order, cmds, count * sizeof(*order)) != 0) {
+        if (!ReorderRenderVertices(renderer, order, count)) {
+            SDL_memcpy(order, cmds, count * sizeof(*order));
+        }
+    }
+
+    for (i = 0; i < count; ++i) {
+        SDL_RenderCommand *cmd = order[i];
+
+        if (last && cmd->command == SDL_RENDERCMD_GEOMETRY && CanBatchCommands(last, cmd) &&
+            last->data.draw.vertex_end == cmd->data.draw.vertex_start &&
+            cmd->data.draw.first == cmd->data.draw.vertex_start) {
+            // The vertices follow on from the last command, so draw them all at once
+            last->data.draw.count += cmd->data.draw.count;
+            last->data.draw.vertex_end = cmd->data.draw.vertex_end;
+            cmd->next = renderer->render_commands_pool;
+            renderer->render_commands_pool = cmd;
+            continue;
+        }
+
+        *link = cmd;
+        link = &cmd->next;
+        last = cmd;
+    }
+    *link = after;
+
+    return last;
+}
+
+static void ReorderRenderCommands(SDL_Renderer *renderer)
+{
+    SDL_RenderCommand *run[MAX_REORDERED_COMMANDS];
+    SDL_RenderCommand **link = &renderer->render_commands;
+    SDL_RenderCommand *last = NULL;
+
+    renderer->queued_draw_calls += CountDrawCalls(renderer->render_commands);
+
+    while (*link) {
+        SDL_RenderCommand *cmd = *link;
+        int count = 0;
+
+        while (cmd && count < (int)SDL_arraysize(run) && IsReorderableCommand(cmd)) {
+            run[count++] = cmd;
+            cmd = cmd->next;
+        }
+
+        if (count > 1) {
+            last = ReorderRenderCommandRun(renderer, run, count, link, cmd);
+        } else {
+            last = *link;
+        }
+        link = &last->next;
+    }
+    renderer->render_commands_tail = last;
+
+    renderer->submitted_draw_calls += CountDrawCalls(renderer->render_commands);
+}
+
+// Publishes the draw calls counted since the last present, so they cover every target the frame drew to
+static void PublishDrawCallCounts(SDL_Renderer *renderer)
+{
+    SDL_PropertiesID props;
+
+    if (!renderer->reorder_commands) {
+        return;
+    }
+
+    props = SDL_GetRendererProperties(renderer);
+    SDL_SetNumberProperty(props, SDL_PROP_RENDERER_QUEUED_DRAW_CALLS_NUMBER, (Sint64)renderer->queued_draw_calls);
+    SDL_SetNumberProperty(props, SDL_PROP_RENDERER_SUBMITTED_DRAW_CALLS_NUMBER, (Sint64)renderer->submitted_draw_calls);
+    renderer->queued_draw_calls = 0;
+    renderer->submitted_draw_calls = 0;
+}
+
 static bool FlushRenderCommands(SDL_Renderer *renderer)
 {
     bool result;
@@ -326,6 +564,10 @@ static bool FlushRenderCommands(SDL_Renderer *renderer)
         return true;
     }
 
+    if (renderer->reorder_commands) {
+        ReorderRenderCommands(renderer);
+    }
+
     DebugLogRenderCommands(renderer->render_commands);
 
 #if DONT_DRAW_WHILE_HIDDEN
@@ -344,6 +586,11 @@ static bool FlushRenderCommands(SDL_Renderer *renderer)
         renderer->render_commands = NULL;
     }
     renderer->vertex_data_used = 0;
+    if (renderer->AllocateVertexStorage) {
+        // The backend decides where the next batch of vertices goes
+        renderer->vertex_data = NULL;
+        renderer->vertex_data_allocation = 0;
+    }
     renderer->render_command_generation++;
     renderer->color_queued = false;
     renderer->viewport_queued = false;
@@ -398,14 +645,20 @@ void *SDL_AllocateRenderVertices(SDL_Renderer *renderer, size_t numbytes, size_t
     const size_t aligned = current_offset + aligner;
 
     if (renderer->vertex_data_allocation < needed) {
-        const size_t current_allocation = renderer->vertex_data ? renderer->vertex_data_allocation : 1024;
-        size_t newsize = current_allocation * 2;
+        size_t newsize;
         void *ptr;
-        while (newsize < needed) {
-            newsize *= 2;
-        }
 
-        ptr = SDL_realloc(renderer->vertex_data, newsize);
+        if (renderer->AllocateVertexStorage) {
+            ptr = renderer->AllocateVertexStorage(renderer, needed, &newsize);
+        } else {
+            const size_t current_allocation = renderer->vertex_data ? renderer->vertex_data_allocation : 1024;
+            newsize = current_allocation * 2;
+            while (newsize < needed) {
+                newsize *= 2;
+            }
+
+            ptr = SDL_realloc(renderer->vertex_data, newsize);
+        }
 
         if (!ptr) {
             return NULL;
@@ -613,6 +866,10 @@ static SDL_RenderCommand *PrepQueueCmdDraw(SDL_Renderer *renderer, const SDL_Ren
             cmd->data.draw.texture_address_mode_u = SDL_TEXTURE_ADDRESS_CLAMP;
             cmd->data.draw.texture_address_mode_v = SDL_TEXTURE_ADDRESS_CLAMP;
             cmd->data.draw.gpu_render_state = renderer->gpu_render_state;
+            cmd->data.draw.vertex_start = renderer->vertex_data_used;
+            cmd->data.draw.vertex_end = renderer->vertex_data_used;
+            cmd->data.draw.bounds_min.x = cmd->data.draw.bounds_min.y = -UNBOUNDED_COORDINATE;
+            cmd->data.draw.bounds_max.x = cmd->data.draw.bounds_max.y = UNBOUNDED_COORDINATE;
             if (renderer->gpu_render_state) {
                 renderer->gpu_render_state->last_command_generation = renderer->render_command_generation;
             }
@@ -782,6 +1039,12 @@ static bool QueueCmdCopy(SDL_Renderer *renderer, SDL_Texture *texture, const SDL
         result = renderer->QueueCopy(renderer, cmd, texture, srcrect, dstrect);
         if (!result) {
             cmd->command = SDL_RENDERCMD_NO_OP;
+        } else if (renderer->reorder_commands) {
+            cmd->data.draw.vertex_end = renderer->vertex_data_used;
+            cmd->data.draw.bounds_min.x = SDL_min(dstrect->x, dstrect->x + dstrect->w);
+            cmd->data.draw.bounds_min.y = SDL_min(dstrect->y, dstrect->y + dstrect->h);
+            cmd->data.draw.bounds_max.x = SDL_max(dstrect->x, dstrect->x + dstrect->w);
+            cmd->data.draw.bounds_max.y = SDL_max(dstrect->y, dstrect->y + dstrect->h);
         }
     }
     return result;
@@ -824,6 +1087,26 @@ static bool QueueCmdGeometry(SDL_Renderer *renderer, SDL_Texture *texture,
                                          scale_x, scale_y);
         if (!result) {
             cmd->command = SDL_RENDERCMD_NO_OP;
+        } else if (renderer->reorder_commands) {
+            cmd->data.draw.vertex_end = renderer->vertex_data_used;
+        }
+        if (result && renderer->reorder_commands && num_vertices > 0) {
+            SDL_FPoint min, max;
+            int i;
+
+            min.x = max.x = xy[0];
+            min.y = max.y = xy[1];
+            for (i = 1; i < num_vertices; ++i) {
+                const float *pos = (const float *)((const Uint8 *)xy + i * xy_stride);
+                min.x = SDL_min(min.x, pos[0]);
+                min.y = SDL_min(min.y, pos[1]);
+                max.x = SDL_max(max.x, pos[0]);
+                max.y = SDL_max(max.y, pos[1]);
+            }
+            cmd->data.draw.bounds_min.x = SDL_min(min.x * scale_x, max.x * scale_x);
+            cmd->data.draw.bounds_min.y = SDL_min(min.y * scale_y, max.y * scale_y);
+            cmd->data.draw.bounds_max.x = SDL_max(min.x * scale_x, max.x * scale_x);
+            cmd->data.draw.bounds_max.y = SDL_max(min.y * scale_y, max.y * scale_y);
         }
     }
     return result;
@@ -1176,6 +1459,8 @@ SDL_Renderer *SDL_CreateRendererWithProperties(SDL_PropertiesID props)
 
     VerifyDrawQueueFunctions(renderer);
 
+    renderer->reorder_commands = SDL_GetBooleanProperty(props, SDL_PROP_RENDERER_CREATE_REORDER_COMMANDS_BOOLEAN, false);
+
     renderer->window = window;
     renderer->target_mutex = SDL_CreateMutex();
     if (surface) {
@@ -2213,6 +2498,12 @@ bool SDL_SetTextureScaleMode(SDL_Texture *texture, SDL_ScaleMode scaleMode)
     case SDL_SCALEMODE_PIXELART:
     case SDL_SCALEMODE_LINEAR:
         break;
+    case SDL_SCALEMODE_BICUBIC:
+        // Only the software renderer can filter with a bicubic kernel
+        if (!texture->renderer->software) {
+            scaleMode = SDL_SCALEMODE_LINEAR;
+        }
+        break;
     default:
         return SDL_InvalidParamError("scaleMode");
     }
@@ -5553,6 +5844,7 @@ bool SDL_RenderPresent(SDL_Renderer *renderer)
     }
 
     FlushRenderCommands(renderer); // time to send everything to the GPU!
+    PublishDrawCallCounts(renderer);
 
 #if DONT_DRAW_WHILE_HIDDEN
     // Don't present while we're hidden
@@ -5653,6 +5945,10 @@ static void SDL_DiscardAllCommands(SDL_Renderer *renderer)
     renderer->render_commands_tail = NULL;
     renderer->render_commands = NULL;
     renderer->vertex_data_used = 0;
+    if (renderer->AllocateVertexStorage) {
+        renderer->vertex_data = NULL;
+        renderer->vertex_data_allocation = 0;
+    }
 
     while (cmd) {
         SDL_RenderCommand *next = cmd->next;
@@ -5712,9 +6008,13 @@ void SDL_DestroyRendererWithoutFreeing(SDL_Renderer *renderer)
         SDL_DestroyMutex(renderer->target_mutex);
         renderer->target_mutex = NULL;
     }
-    if (renderer->vertex_data) {
+    if (renderer->vertex_data && !renderer->AllocateVertexStorage) {
         SDL_free(renderer->vertex_data);
-        renderer->vertex_data = NULL;
+    }
+    renderer->vertex_data = NULL;
+    if (renderer->reorder_vertex_data) {
+        SDL_free(renderer->reorder_vertex_data);
+        renderer->reorder_vertex_data = NULL;
     }
     if (renderer->texture_formats) {
         SDL_free(renderer->texture_formats);
@@ -6098,6 +6398,9 @@ bool SDL_SetDefaultTextureScaleMode(SDL_Renderer *renderer, SDL_ScaleMode scale_
 {
     CHECK_RENDERER_MAGIC(renderer, false);
 
+    if (scale_mode == SDL_SCALEMODE_BICUBIC && !renderer->software) {
+        scale_mode = SDL_SCALEMODE_LINEAR;
+    }
     renderer->scale_mode = scale_mode;
 
     return true;
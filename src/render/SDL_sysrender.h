@@ -194,6 +194,10 @@ typedef struct SDL_RenderCommand
             SDL_TextureAddressMode texture_address_mode_u;
             SDL_TextureAddressMode texture_address_mode_v;
             SDL_GPURenderState *gpu_render_state;
+            size_t vertex_start;    // the vertex data queued by this command, used when reordering
+            size_t vertex_end;
+            SDL_FPoint bounds_min;  // the area this command draws to, used when reordering
+            SDL_FPoint bounds_max;
         } draw;
         struct
         {
@@ -245,6 +249,10 @@ struct SDL_Renderer
 
     void (*InvalidateCachedState)(SDL_Renderer *renderer);
     bool (*RunCommandQueue)(SDL_Renderer *renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize);
+    /* Optional: provide the memory that Queue*() methods write vertices to, so RunCommandQueue() doesn't
+       have to copy them again. This returns space for at least `needed` bytes, starting with the
+       `vertex_data_used` bytes that are already queued, and sets `allocation` to the size available. */
+    void *(*AllocateVertexStorage)(SDL_Renderer *renderer, size_t needed, size_t *allocation);
     bool (*CreatePalette)(SDL_Renderer *renderer, SDL_TexturePalette *palette);
     bool (*UpdatePalette)(SDL_Renderer *renderer, SDL_TexturePalette *palette, int ncolors, SDL_Color *colors);
     void (*DestroyPalette)(SDL_Renderer *renderer, SDL_TexturePalette *palette);
@@ -351,6 +359,13 @@ struct SDL_Renderer
     size_t vertex_data_used;
     size_t vertex_data_allocation;
 
+    // Command reordering support
+    bool reorder_commands;
+    void *reorder_vertex_data;
+    size_t reorder_vertex_data_allocation;
+    Uint64 queued_draw_calls;
+    Uint64 submitted_draw_calls;
+
     // Shaped window support
     bool transparent_window;
     SDL_Surface *shape_surface;
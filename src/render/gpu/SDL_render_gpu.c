@@ -31,6 +31,9 @@
 #include "SDL_pipeline_gpu.h"
 #include "SDL_shaders_gpu.h"
 
+// The initial size of the vertex ring, which grows when a single command queue needs more
+#define GPU_MIN_VERTEX_BUFFER_SIZE (1 << 16)
+
 typedef struct GPU_VertexShaderUniformData
 {
     Float4X4 mvp;
@@ -104,11 +107,20 @@ typedef struct GPU_RenderData
         SDL_GPUPresentMode present_mode;
     } swapchain;
 
+    /* Vertices are queued straight into the mapped transfer buffer. Each command queue
+       uploads the part it used and the next one continues after it. At the start of a
+       frame, or when the end is reached, it goes back to the start and the buffers are
+       cycled, so the GPU can keep using the old contents. */
     struct
     {
         SDL_GPUTransferBuffer *transfer_buf;
         SDL_GPUBuffer *buffer;
         Uint32 buffer_size;
+        Uint8 *mapped;        // the transfer buffer, while vertices are being queued
+        Uint32 head;          // where the vertices of the next command queue start
+        Uint32 batch_offset;  // where the vertices of the current command queue start
+        bool cycle;           // the next map and upload start over at the beginning
+        Uint64 frame_bytes;   // vertex data streamed this frame
     } vertices;
 
     struct
@@ -1142,7 +1154,7 @@ static void Draw(
     SDL_GPUBufferBinding buffer_bind;
     SDL_zero(buffer_bind);
     buffer_bind.buffer = data->vertices.buffer;
-    buffer_bind.offset = offset;
+    buffer_bind.offset = data->vertices.batch_offset + offset;
     SDL_BindGPUVertexBuffers(pass, 0, &buffer_bind, 1);
     PushVertexUniforms(data, cmd);
 
@@ -1153,15 +1165,23 @@ static void Draw(
 
 static void ReleaseVertexBuffer(GPU_RenderData *data)
 {
+    if (data->vertices.mapped) {
+        SDL_UnmapGPUTransferBuffer(data->device, data->vertices.transfer_buf);
+        data->vertices.mapped = NULL;
+    }
+
     if (data->vertices.buffer) {
         SDL_ReleaseGPUBuffer(data->device, data->vertices.buffer);
+        data->vertices.buffer = NULL;
     }
 
     if (data->vertices.transfer_buf) {
         SDL_ReleaseGPUTransferBuffer(data->device, data->vertices.transfer_buf);
+        data->vertices.transfer_buf = NULL;
     }
 
     data->vertices.buffer_size = 0;
+    data->vertices.head = 0;
 }
 
 static bool InitVertexBuffer(GPU_RenderData *data, Uint32 size)
@@ -1185,6 +1205,8 @@ static bool InitVertexBuffer(GPU_RenderData *data, Uint32 size)
     data->vertices.transfer_buf = SDL_CreateGPUTransferBuffer(data->device, &tbci);
 
     if (!data->vertices.transfer_buf) {
+        // Don't leave the ring half built
+        ReleaseVertexBuffer(data);
         return false;
     }
 
@@ -1193,22 +1215,76 @@ static bool InitVertexBuffer(GPU_RenderData *data, Uint32 size)
     return true;
 }
 
+static void *GPU_AllocateVertexStorage(SDL_Renderer *renderer, size_t needed, size_t *allocation)
+{
+    GPU_RenderData *data = (GPU_RenderData *)renderer->internal;
+
+    if (needed > data->vertices.buffer_size - data->vertices.head) {
+        /* Out of room, so carry what has been queued over to the start of the buffers and cycle them,
+           or replace them if they're too small. Command queues that were already uploaded keep
+           drawing from the old ones. */
+        const size_t queued = renderer->vertex_data_used;
+        void *saved = NULL;
+
+        if (queued > 0) {
+            saved = SDL_malloc(queued);
+            if (!saved) {
+                return NULL;
+            }
+            SDL_memcpy(saved, data->vertices.mapped + data->vertices.head, queued);
+        }
+
+        if (needed > data->vertices.buffer_size) {
+            // The buffers are released if growing them fails, so start from the minimum size again
+            Uint32 size = SDL_max(data->vertices.buffer_size, GPU_MIN_VERTEX_BUFFER_SIZE);
+
+            if (needed > SDL_MAX_UINT32 / 2) {
+                SDL_free(saved);
+                SDL_OutOfMemory();
+                return NULL;
+            }
+            while (size < needed) {
+                size *= 2;
+            }
+
+            ReleaseVertexBuffer(data);
+            if (!InitVertexBuffer(data, size)) {
+                SDL_free(saved);
+                return NULL;
+            }
+        } else if (data->vertices.mapped) {
+            SDL_UnmapGPUTransferBuffer(data->device, data->vertices.transfer_buf);
+            data->vertices.mapped = NULL;
+        }
+        data->vertices.head = 0;
+        data->vertices.cycle = true;
+
+        data->vertices.mapped = (Uint8 *)SDL_MapGPUTransferBuffer(data->device, data->vertices.transfer_buf, true);
+        if (data->vertices.mapped && saved) {
+            SDL_memcpy(data->vertices.mapped, saved, queued);
+        }
+        SDL_free(saved);
+    } else if (!data->vertices.mapped) {
+        data->vertices.mapped = (Uint8 *)SDL_MapGPUTransferBuffer(data->device, data->vertices.transfer_buf, data->vertices.cycle);
+    }
+
+    if (!data->vertices.mapped) {
+        return NULL;
+    }
+
+    *allocation = data->vertices.buffer_size - data->vertices.head;
+    return data->vertices.mapped + data->vertices.head;
+}
+
 static bool UploadVertices(GPU_RenderData *data, void *vertices, size_t vertsize)
 {
     if (vertsize == 0) {
         return true;
     }
 
-    if (vertsize > data->vertices.buffer_size) {
-        ReleaseVertexBuffer(data);
-        if (!InitVertexBuffer(data, (Uint32)vertsize)) {
-            return false;
-        }
-    }
-
-    void *staging_buf = SDL_MapGPUTransferBuffer(data->device, data->vertices.transfer_buf, true);
-    SDL_memcpy(staging_buf, vertices, vertsize);
+    SDL_assert(vertices == data->vertices.mapped + data->vertices.head);
     SDL_UnmapGPUTransferBuffer(data->device, data->vertices.transfer_buf);
+    data->vertices.mapped = NULL;
 
     SDL_GPUCopyPass *pass = SDL_BeginGPUCopyPass(data->state.command_buffer);
 
@@ -1219,15 +1295,23 @@ static bool UploadVertices(GPU_RenderData *data, void *vertices, size_t vertsize
     SDL_GPUTransferBufferLocation src;
     SDL_zero(src);
     src.transfer_buffer = data->vertices.transfer_buf;
+    src.offset = data->vertices.head;
 
     SDL_GPUBufferRegion dst;
     SDL_zero(dst);
     dst.buffer = data->vertices.buffer;
+    dst.offset = data->vertices.head;
     dst.size = (Uint32)vertsize;
 
-    SDL_UploadToGPUBuffer(pass, &src, &dst, true);
+    // Only cycle when starting over, later uploads add to what has already been drawn from these buffers
+    SDL_UploadToGPUBuffer(pass, &src, &dst, data->vertices.cycle);
     SDL_EndGPUCopyPass(pass);
 
+    data->vertices.cycle = false;
+    data->vertices.batch_offset = data->vertices.head;
+    data->vertices.head = SDL_min(data->vertices.head + (((Uint32)vertsize + 15) & ~15), data->vertices.buffer_size);
+    data->vertices.frame_bytes += vertsize;
+
     return true;
 }
 
@@ -1590,6 +1674,17 @@ static bool GPU_RenderPresent(SDL_Renderer *renderer)
 
     data->state.command_buffer = SDL_AcquireGPUCommandBuffer(data->device);
 
+    // Start the vertex buffers over, they'll be cycled if the GPU is still drawing from them
+    if (data->vertices.mapped) {
+        SDL_UnmapGPUTransferBuffer(data->device, data->vertices.transfer_buf);
+        data->vertices.mapped = NULL;
+    }
+    data->vertices.head = 0;
+    data->vertices.cycle = true;
+
+    SDL_SetNumberProperty(SDL_GetRendererProperties(renderer), SDL_PROP_RENDERER_GPU_VERTEX_BYTES_NUMBER, (Sint64)data->vertices.frame_bytes);
+    data->vertices.frame_bytes = 0;
+
     return true;
 }
 
@@ -1786,6 +1881,7 @@ static bool GPU_CreateRenderer(SDL_Renderer *renderer, SDL_Window *window, SDL_P
     renderer->QueueGeometry = GPU_QueueGeometry;
     renderer->InvalidateCachedState = GPU_InvalidateCachedState;
     renderer->RunCommandQueue = GPU_RunCommandQueue;
+    renderer->AllocateVertexStorage = GPU_AllocateVertexStorage;
     renderer->RenderReadPixels = GPU_RenderReadPixels;
     renderer->RenderPresent = GPU_RenderPresent;
     renderer->DestroyTexture = GPU_DestroyTexture;
@@ -1859,7 +1955,7 @@ static bool GPU_CreateRenderer(SDL_Renderer *renderer, SDL_Window *window, SDL_P
     }
 
     // FIXME: What's a good initial size?
-    if (!InitVertexBuffer(data, 1 << 16)) {
+    if (!InitVertexBuffer(data, GPU_MIN_VERTEX_BUFFER_SIZE)) {
         return false;
     }
 
@@ -41,12 +41,57 @@ static Uint16 crc16_for_byte(Uint8 r)
     return crc;
 }
 
+/* Slice-by-8 tables: crc16_table[k][n] is the CRC of byte n followed by k zero bytes,
+   so eight bytes can be folded in at once with eight independent lookups. */
+static SDL_InitState crc16_table_init;
+static Uint16 crc16_table[8][256];
+
+static void InitCRC16Table(void)
+{
+    if (SDL_ShouldInit(&crc16_table_init)) {
+        int i, k;
+        for (i = 0; i < 256; ++i) {
+            crc16_table[0][i] = crc16_for_byte((Uint8)i);
+        }
+        for (i = 0; i < 256; ++i) {
+            for (k = 1; k < 8; ++k) {
+                const Uint16 r = crc16_table[k - 1][i];
+                crc16_table[k][i] = (r >> 8) ^ crc16_table[0][r & 0xFF];
+            }
+        }
+        SDL_SetInitialized(&crc16_table_init, true);
+    }
+}
+
 Uint16 SDL_crc16(Uint16 crc, const void *data, size_t len)
 {
-    // As an optimization we can precalculate a 256 entry table for each byte
-    size_t i;
-    for (i = 0; i < len; ++i) {
-        crc = crc16_for_byte((Uint8)crc ^ ((const Uint8 *)data)[i]) ^ crc >> 8;
+    const Uint8 *bytes = (const Uint8 *)data;
+
+    InitCRC16Table();
+
+    while (len > 0 && ((uintptr_t)bytes & 3) != 0) {
+        crc = crc16_table[0][(crc ^ *bytes++) & 0xFF] ^ (crc >> 8);
+        --len;
+    }
+
+    while (len >= 8) {
+        const Uint32 one = SDL_Swap32LE(*(const Uint32 *)bytes) ^ crc;
+        const Uint32 two = SDL_Swap32LE(*(const Uint32 *)(bytes + 4));
+        crc = crc16_table[7][one & 0xFF] ^
+              crc16_table[6][(one >> 8) & 0xFF] ^
+              crc16_table[5][(one >> 16) & 0xFF] ^
+              crc16_table[4][one >> 24] ^
+              crc16_table[3][two & 0xFF] ^
+              crc16_table[2][(two >> 8) & 0xFF] ^
+              crc16_table[1][(two >> 16) & 0xFF] ^
+              crc16_table[0][two >> 24];
+        bytes += 8;
+        len -= 8;
+    }
+
+    while (len > 0) {
+        crc = crc16_table[0][(crc ^ *bytes++) & 0xFF] ^ (crc >> 8);
+        --len;
     }
     return crc;
 }
@@ -29,12 +29,35 @@
 /* NOTE: DO NOT CHANGE THIS ALGORITHM
    There is code that relies on this in the joystick code
 */
-/* If you're looking for a faster CRC32 implementation,
-   the crc32() in zlib is a convenient option.
+#include "../cpuinfo/SDL_cpuinfo_c.h"
 
-   This is also Zlib licensed and extremely fast:
-       https://github.com/corsix/fast-crc32
-*/
+/* This is the standard reflected CRC-32 (the one zlib uses), with the pre and post
+   inversion built into each step, so the running value is always the final CRC.
+   The faster implementations below work on the inverted value and are equivalent. */
+
+#if defined(SDL_SSE2_INTRINSICS) && (defined(_MSC_VER) || defined(SDL_AVX_INTRINSICS))
+#define SDL_CRC32_PCLMUL    // <intrin.h> or <immintrin.h> provide _mm_clmulepi64_si128()
+#endif
+
+#if (defined(__aarch64__) || defined(_M_ARM64)) && !defined(SDL_DISABLE_ARM_CRC32)
+#if defined(_MSC_VER) && !defined(__clang__)
+#define SDL_CRC32_ARMV8
+#define CRC32_ARMV8_TARGET
+#define crc32_armv8_u8(crc, v)  __crc32b(crc, v)
+#define crc32_armv8_u64(crc, v) __crc32d(crc, v)
+#elif defined(__clang__)
+#define SDL_CRC32_ARMV8
+#define CRC32_ARMV8_TARGET      SDL_TARGETING("crc")
+#define crc32_armv8_u8(crc, v)  __builtin_arm_crc32b(crc, v)
+#define crc32_armv8_u64(crc, v) __builtin_arm_crc32d(crc, v)
+#elif defined(__GNUC__)
+#include <arm_acle.h>
+#define SDL_CRC32_ARMV8
+#define CRC32_ARMV8_TARGET      SDL_TARGETING("+crc")
+#define crc32_armv8_u8(crc, v)  __crc32b(crc, v)
+#define crc32_armv8_u64(crc, v) __crc32d(crc, v)
+#endif
+#endif
 
 static Uint32 crc32_for_byte(Uint32 r)
 {
@@ -45,12 +68,179 @@ static Uint32 crc32_for_byte(Uint32 r)
     return r ^ (Uint32)0xFF000000L;
 }
 
-Uint32 SDL_crc32(Uint32 crc, const void *data, size_t len)
+/* Slice-by-8 tables: crc32_table[k][n] is the CRC of byte n followed by k zero bytes,
+   so eight bytes can be folded in at once with eight independent lookups. */
+static SDL_InitState crc32_table_init;
+static Uint32 crc32_table[8][256];
+
+static void InitCRC32Table(void)
 {
-    // As an optimization we can precalculate a 256 entry table for each byte
-    size_t i;
-    for (i = 0; i < len; ++i) {
-        crc = crc32_for_byte((Uint8)crc ^ ((const Uint8 *)data)[i]) ^ crc >> 8;
+    if (SDL_ShouldInit(&crc32_table_init)) {
+        int i, k;
+        for (i = 0; i < 256; ++i) {
+            // This is the same table as crc32_for_byte(), but for the inverted CRC
+            crc32_table[0][i] = crc32_for_byte((Uint32)i ^ 0xFF) ^ 0xFF000000;
+        }
+        for (i = 0; i < 256; ++i) {
+            for (k = 1; k < 8; ++k) {
+                const Uint32 r = crc32_table[k - 1][i];
+                crc32_table[k][i] = (r >> 8) ^ crc32_table[0][r & 0xFF];
+            }
+        }
+        SDL_SetInitialized(&crc32_table_init, true);
+    }
+}
+
+static Uint32 crc32_slice8(Uint32 crc, const Uint8 *data, size_t len)
+{
+    InitCRC32Table();
+
+    while (len > 0 && ((uintptr_t)data & 3) != 0) {
+        crc = crc32_table[0][(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+        --len;
+    }
+
+    while (len >= 8) {
+        const Uint32 one = SDL_Swap32LE(*(const Uint32 *)data) ^ crc;
+        const Uint32 two = SDL_Swap32LE(*(const Uint32 *)(data + 4));
+        crc = crc32_table[7][one & 0xFF] ^
+              crc32_table[6][(one >> 8) & 0xFF] ^
+              crc32_table[5][(one >> 16) & 0xFF] ^
+              crc32_table[4][one >> 24] ^
+              crc32_table[3][two & 0xFF] ^
+              crc32_table[2][(two >> 8) & 0xFF] ^
+              crc32_table[1][(two >> 16) & 0xFF] ^
+              crc32_table[0][two >> 24];
+        data += 8;
+        len -= 8;
+    }
+
+    while (len > 0) {
+        crc = crc32_table[0][(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+        --len;
     }
     return crc;
 }
+
+#ifdef SDL_CRC32_PCLMUL
+/* Folds 64 bytes at a time with carry-less multiplication, then reduces to 32 bits, from
+   "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction" by Gopal et al.
+   The constants are for the reflected CRC-32 polynomial. `len` must be a multiple of 16, at least 64. */
+static Uint32 SDL_TARGETING("sse2,pclmul") crc32_pclmul(Uint32 crc, const Uint8 *data, size_t len)
+{
+    const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596, 0x0154442bd4);
+    const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009e, 0x01751997d0);
+    const __m128i k5k0 = _mm_set_epi64x(0x0000000000, 0x0163cd6124);
+    const __m128i poly = _mm_set_epi64x(0x01f7011641, 0x01db710641);
+    const __m128i mask32 = _mm_setr_epi32(-1, 0, -1, 0);
+    __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8;
+
+    x1 = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(data + 0x00)), _mm_cvtsi32_si128((int)crc));
+    x2 = _mm_loadu_si128((const __m128i *)(data + 0x10));
+    x3 = _mm_loadu_si128((const __m128i *)(data + 0x20));
+    x4 = _mm_loadu_si128((const __m128i *)(data + 0x30));
+    data += 64;
+    len -= 64;
+
+    // Fold four blocks in parallel
+    x0 = k1k2;
+    while (len >= 64) {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128((const __m128i *)(data + 0x00)));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128((const __m128i *)(data + 0x10)));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128((const __m128i *)(data + 0x20)));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128((const __m128i *)(data + 0x30)));
+        data += 64;
+        len -= 64;
+    }
+
+    // Fold the four blocks into one
+    x0 = k3k4;
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    // Fold in what's left, one block at a time
+    while (len >= 16) {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, _mm_loadu_si128((const __m128i *)data)), x5);
+        data += 16;
+        len -= 16;
+    }
+
+    // Fold 128 bits down to 64
+    x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, mask32);
+    x1 = _mm_clmulepi64_si128(x1, k5k0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    // Barrett reduction down to 32 bits
+    x2 = _mm_and_si128(x1, mask32);
+    x2 = _mm_clmulepi64_si128(x2, poly, 0x10);
+    x2 = _mm_and_si128(x2, mask32);
+    x2 = _mm_clmulepi64_si128(x2, poly, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    return (Uint32)_mm_cvtsi128_si32(_mm_srli_si128(x1, 4));
+}
+#endif // SDL_CRC32_PCLMUL
+
+#ifdef SDL_CRC32_ARMV8
+static Uint32 CRC32_ARMV8_TARGET crc32_armv8(Uint32 crc, const Uint8 *data, size_t len)
+{
+    while (len > 0 && ((uintptr_t)data & 7) != 0) {
+        crc = crc32_armv8_u8(crc, *data++);
+        --len;
+    }
+    while (len >= 8) {
+        crc = crc32_armv8_u64(crc, SDL_Swap64LE(*(const Uint64 *)data));
+        data += 8;
+        len -= 8;
+    }
+    while (len > 0) {
+        crc = crc32_armv8_u8(crc, *data++);
+        --len;
+    }
+    return crc;
+}
+#endif // SDL_CRC32_ARMV8
+
+Uint32 SDL_crc32(Uint32 crc, const void *data, size_t len)
+{
+    const Uint8 *bytes = (const Uint8 *)data;
+
+    crc = ~crc;
+
+#ifdef SDL_CRC32_ARMV8
+    if (SDL_HasARMCRC32()) {
+        return ~crc32_armv8(crc, bytes, len);
+    }
+#endif
+
+#ifdef SDL_CRC32_PCLMUL
+    if (len >= 64 && SDL_HasPCLMUL()) {
+        const size_t blocks = (len & ~(size_t)15);
+        crc = crc32_pclmul(crc, bytes, blocks);
+        bytes += blocks;
+        len -= blocks;
+    }
+#endif
+
+    return ~crc32_slice8(crc, bytes, len);
+}
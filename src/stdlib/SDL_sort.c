@@ -0,0 +1,444 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+// Stable sorts to go with SDL_qsort(): a merge sort that can spread its work
+// across the job system, and an LSD radix sort for numeric keys.
+
+#define SDL_MERGESORT_RUN           16          // runs this short are sorted by insertion before merging
+#define SDL_PARALLEL_SORT_MIN       (16 * 1024) // arrays shorter than this are sorted on the calling thread
+#define SDL_PARALLEL_MERGE_MIN      4096        // the fewest output elements a thread merges at once
+
+typedef struct SDL_SortContext
+{
+    size_t size;
+    SDL_CompareCallback_r compare;
+    void *userdata;
+} SDL_SortContext;
+
+typedef struct SDL_ParallelSort
+{
+    SDL_SortContext ctx;
+    char *src;
+    char *dst;
+    size_t nmemb;
+    size_t width; // the chunk size for the first pass, then the length of the runs being merged
+} SDL_ParallelSort;
+
+// Constant sizes let the compiler inline the copy for the most common element sizes
+static SDL_INLINE void CopyElement(char *dst, const char *src, size_t size)
+{
+    switch (size) {
+    case 4:
+        SDL_memcpy(dst, src, 4);
+        break;
+    case 8:
+        SDL_memcpy(dst, src, 8);
+        break;
+    case 16:
+        SDL_memcpy(dst, src, 16);
+        break;
+    default:
+        SDL_memcpy(dst, src, size);
+        break;
+    }
+}
+
+// Sorts a short run in place, using `tmp` to hold one element
+static void InsertionSortRun(const SDL_SortContext *ctx, char *base, size_t n, char *tmp)
+{
+    const size_t size = ctx->size;
+    size_t i;
+
+    for (i = 1; i < n; ++i) {
+        char *item = base + i * size;
+        size_t j = i;
+
+        if (ctx->compare(ctx->userdata, item - size, item) <= 0) {
+            continue;
+        }
+
+        CopyElement(tmp, item, size);
+        do {
+            --j;
+        } while (j > 0 && ctx->compare(ctx->userdata, base + (j - 1) * size, tmp) > 0);
+        SDL_memmove(base + (j + 1) * size, base + j * size, (i - j) * size);
+        CopyElement(base + j * size, tmp, size);
+    }
+}
+
+// Merges two sorted runs into `dst`, taking from `a` first when elements are equal
+static void MergeRuns(const SDL_SortContext *ctx, const char *a, size_t na, const char *b, size_t nb, char *dst)
+{
+    const size_t size = ctx->size;
+    const char *a_end = a + na * size;
+    const char *b_end = b + nb * size;
+
+    if (na > 0 && nb > 0 && ctx->compare(ctx->userdata, a_end - size, b) <= 0) {
+        // Already in order, which is common with partly sorted input
+        SDL_memcpy(dst, a, na * size);
+        SDL_memcpy(dst + na * size, b, nb * size);
+        return;
+    }
+
+    while (a < a_end && b < b_end) {
+        if (ctx->compare(ctx->userdata, b, a) < 0) {
+            CopyElement(dst, b, size);
+            b += size;
+        } else {
+            CopyElement(dst, a, size);
+            a += size;
+        }
+        dst += size;
+    }
+    SDL_memcpy(dst, a, a_end - a);
+    dst += a_end - a;
+    SDL_memcpy(dst, b, b_end - b);
+}
+
+// Sorts `base`, using `scratch` which has room for the same number of elements
+static void MergeSortRange(const SDL_SortContext *ctx, char *base, char *scratch, size_t nmemb)
+{
+    const size_t size = ctx->size;
+    char *src = base;
+    char *dst = scratch;
+    size_t width, i;
+
+    for (i = 0; i < nmemb; i += SDL_MERGESORT_RUN) {
+        InsertionSortRun(ctx, base + i * size, SDL_min(SDL_MERGESORT_RUN, nmemb - i), scratch);
+    }
+
+    for (width = SDL_MERGESORT_RUN; width < nmemb; width *= 2) {
+        for (i = 0; i < nmemb; i += 2 * width) {
+            const size_t na = SDL_min(width, nmemb - i);
+            const size_t nb = SDL_min(width, nmemb - i - na);
+            MergeRuns(ctx, src + i * size, na, src + (i + na) * size, nb, dst + i * size);
+        }
+        char *swap = src;
+        src = dst;
+        dst = swap;
+    }
+
+    if (src != base) {
+        SDL_memcpy(base, src, nmemb * size);
+    }
+}
+
+static char *AllocSortScratch(size_t nmemb, size_t size)
+{
+    size_t bytes;
+
+    if (!SDL_size_mul_check_overflow(nmemb, size, &bytes)) {
+        SDL_SetError("Array is too large to sort");
+        return NULL;
+    }
+    return (char *)SDL_malloc(bytes);
+}
+
+bool SDL_mergesort_r(void *base, size_t nmemb, size_t size, SDL_CompareCallback_r compare, void *userdata)
+{
+    CHECK_PARAM(!compare) {
+        return SDL_InvalidParamError("compare");
+    }
+
+    if (nmemb <= 1 || size == 0) {
+        return true;
+    }
+
+    char *scratch = AllocSortScratch(nmemb, size);
+    if (!scratch) {
+        return false;
+    }
+
+    SDL_SortContext ctx;
+    ctx.size = size;
+    ctx.compare = compare;
+    ctx.userdata = userdata;
+    MergeSortRange(&ctx, (char *)base, scratch, nmemb);
+
+    SDL_free(scratch);
+    return true;
+}
+
+static int SDLCALL mergesort_non_r_bridge(void *userdata, const void *a, const void *b)
+{
+    SDL_CompareCallback compare = (SDL_CompareCallback)userdata;
+    return compare(a, b);
+}
+
+bool SDL_mergesort(void *base, size_t nmemb, size_t size, SDL_CompareCallback compare)
+{
+    CHECK_PARAM(!compare) {
+        return SDL_InvalidParamError("compare");
+    }
+
+    return SDL_mergesort_r(base, nmemb, size, mergesort_non_r_bridge, (void *)compare);
+}
+
+// Finds how many elements of `a` are among the first `d` elements of the merge of `a` and `b`
+static size_t FindMergeSplit(const SDL_SortContext *ctx, const char *a, size_t na, const char *b, size_t nb, size_t d)
+{
+    const size_t size = ctx->size;
+    size_t lo = (d > nb) ? d - nb : 0;
+    size_t hi = SDL_min(d, na);
+
+    while (lo < hi) {
+        const size_t i = lo + (hi - lo) / 2;
+        const size_t j = d - i;
+
+        // If a[i] would be merged ahead of b[j - 1], more of `a` belongs in front
+        if (ctx->compare(ctx->userdata, a + i * size, b + (j - 1) * size) <= 0) {
+            lo = i + 1;
+        } else {
+            hi = i;
+        }
+    }
+    return lo;
+}
+
+static void SDLCALL SDL_SortChunks(void *userdata, int start, int end)
+{
+    SDL_ParallelSort *sort = (SDL_ParallelSort *)userdata;
+    const size_t size = sort->ctx.size;
+    int chunk;
+
+    for (chunk = start; chunk < end; ++chunk) {
+        const size_t offset = (size_t)chunk * sort->width;
+        const size_t count = SDL_min(sort->width, sort->nmemb - offset);
+        MergeSortRange(&sort->ctx, sort->src + offset * size, sort->dst + offset * size, count);
+    }
+}
+
+// Writes elements [start, end) of the merged output. The range may cover the end of one pair of runs and the start of the next.
+static void SDLCALL SDL_MergeChunks(void *userdata, int start, int end)
+{
+    SDL_ParallelSort *sort = (SDL_ParallelSort *)userdata;
+    const size_t size = sort->ctx.size;
+    const size_t width = sort->width;
+    size_t first = (size_t)start;
+    const size_t last = (size_t)end;
+
+    while (first < last) {
+        const size_t pair = (first / (2 * width)) * (2 * width);
+        const size_t mid = SDL_min(pair + width, sort->nmemb);
+        const size_t pair_end = SDL_min(pair + 2 * width, sort->nmemb);
+        const size_t stop = SDL_min(last, pair_end);
+        const char *a = sort->src + pair * size;
+        const char *b = sort->src + mid * size;
+        const size_t na = mid - pair;
+        const size_t nb = pair_end - mid;
+        const size_t d0 = first - pair;
+        const size_t d1 = stop - pair;
+        const size_t i0 = FindMergeSplit(&sort->ctx, a, na, b, nb, d0);
+        const size_t i1 = FindMergeSplit(&sort->ctx, a, na, b, nb, d1);
+
+        MergeRuns(&sort->ctx, a + i0 * size, i1 - i0, b + (d0 - i0) * size, (d1 - i1) - (d0 - i0), sort->dst + first * size);
+        first = stop;
+    }
+}
+
+bool SDL_parallel_mergesort_r(void *base, size_t nmemb, size_t size, SDL_CompareCallback_r compare, void *userdata)
+{
+    CHECK_PARAM(!compare) {
+        return SDL_InvalidParamError("compare");
+    }
+
+    if (nmemb < SDL_PARALLEL_SORT_MIN || nmemb > SDL_MAX_SINT32 || size == 0) {
+        return SDL_mergesort_r(base, nmemb, size, compare, userdata);
+    }
+
+    const int threads = SDL_GetNumJobThreads();
+    if (threads == 0) {
+        return SDL_mergesort_r(base, nmemb, size, compare, userdata);
+    }
+
+    char *scratch = AllocSortScratch(nmemb, size);
+    if (!scratch) {
+        return false;
+    }
+
+    SDL_ParallelSort sort;
+    sort.ctx.size = size;
+    sort.ctx.compare = compare;
+    sort.ctx.userdata = userdata;
+    sort.nmemb = nmemb;
+
+    // Sort a couple of chunks per thread so a slow thread doesn't hold up the rest
+    const size_t chunks = (size_t)(threads + 1) * 2;
+    sort.width = (nmemb + chunks - 1) / chunks;
+    sort.src = (char *)base;
+    sort.dst = scratch;
+    SDL_ParallelFor((int)((nmemb + sort.width - 1) / sort.width), 1, SDL_SortChunks, &sort);
+
+    // Then merge pairs of runs, splitting each merge so every pass spreads across all threads
+    const int grain = (int)SDL_max(nmemb / ((size_t)(threads + 1) * 4), SDL_PARALLEL_MERGE_MIN);
+    for (; sort.width < nmemb; sort.width *= 2) {
+        SDL_ParallelFor((int)nmemb, grain, SDL_MergeChunks, &sort);
+        char *swap = sort.src;
+        sort.src = sort.dst;
+        sort.dst = swap;
+    }
+
+    if (sort.src != (char *)base) {
+        SDL_memcpy(base, sort.src, nmemb * size);
+    }
+
+    SDL_free(scratch);
+    return true;
+}
+
+// Maps a key to an unsigned integer with the same ordering
+static Uint64 GetSortKey(const char *element, SDL_SortKeyType key_type)
+{
+    Uint32 value32;
+    Uint64 value64;
+
+    switch (key_type) {
+    case SDL_SORT_KEY_UINT32:
+        SDL_memcpy(&value32, element, sizeof(value32));
+        return value32;
+    case SDL_SORT_KEY_SINT32:
+        SDL_memcpy(&value32, element, sizeof(value32));
+        return value32 ^ 0x80000000u;
+    case SDL_SORT_KEY_FLOAT:
+        SDL_memcpy(&value32, element, sizeof(value32));
+        return (value32 & 0x80000000u) ? ~value32 : (value32 | 0x80000000u);
+    case SDL_SORT_KEY_UINT64:
+        SDL_memcpy(&value64, element, sizeof(value64));
+        return value64;
+    case SDL_SORT_KEY_SINT64:
+        SDL_memcpy(&value64, element, sizeof(value64));
+        return value64 ^ SDL_UINT64_C(0x8000000000000000);
+    case SDL_SORT_KEY_DOUBLE:
+        SDL_memcpy(&value64, element, sizeof(value64));
+        return (value64 & SDL_UINT64_C(0x8000000000000000)) ? ~value64 : (value64 | SDL_UINT64_C(0x8000000000000000));
+    default:
+        SDL_assert(!"Unknown sort key type");
+        return 0;
+    }
+}
+
+bool SDL_radixsort(void *base, size_t nmemb, size_t size, size_t key_offset, SDL_SortKeyType key_type)
+{
+    size_t key_size;
+
+    switch (key_type) {
+    case SDL_SORT_KEY_UINT32:
+    case SDL_SORT_KEY_SINT32:
+    case SDL_SORT_KEY_FLOAT:
+        key_size = 4;
+        break;
+    case SDL_SORT_KEY_UINT64:
+    case SDL_SORT_KEY_SINT64:
+    case SDL_SORT_KEY_DOUBLE:
+        key_size = 8;
+        break;
+    default:
+        return SDL_InvalidParamError("key_type");
+    }
+
+    CHECK_PARAM(key_offset > size || size - key_offset < key_size) {
+        return SDL_InvalidParamError("key_offset");
+    }
+    if ((Uint64)nmemb > SDL_MAX_UINT32) {
+        return SDL_SetError("Array is too large to sort");
+    }
+
+    if (nmemb <= 1) {
+        return true;
+    }
+
+    // Sort the keys along with the index of their element, then move each element once at the end
+    Uint64 *keys = (Uint64 *)AllocSortScratch(nmemb, 2 * sizeof(Uint64));
+    Uint32 *indices = (Uint32 *)AllocSortScratch(nmemb, 2 * sizeof(Uint32));
+    char *scratch = AllocSortScratch(nmemb, size);
+    Uint32 (*counts)[256] = (Uint32 (*)[256])SDL_calloc(key_size, sizeof(*counts));
+    if (!keys || !indices || !scratch || !counts) {
+        SDL_free(keys);
+        SDL_free(indices);
+        SDL_free(scratch);
+        SDL_free(counts);
+        return false;
+    }
+
+    const char *element = (const char *)base + key_offset;
+    size_t i, pass;
+    for (i = 0; i < nmemb; ++i, element += size) {
+        const Uint64 key = GetSortKey(element, key_type);
+        keys[i] = key;
+        indices[i] = (Uint32)i;
+        for (pass = 0; pass < key_size; ++pass) {
+            ++counts[pass][(key >> (pass * 8)) & 0xFF];
+        }
+    }
+
+    Uint64 *src_keys = keys;
+    Uint64 *dst_keys = keys + nmemb;
+    Uint32 *src_indices = indices;
+    Uint32 *dst_indices = indices + nmemb;
+    bool moved = false;
+
+    for (pass = 0; pass < key_size; ++pass) {
+        const int shift = (int)pass * 8;
+        Uint32 *count = counts[pass];
+
+        // Skip digits that are the same in every key, like the high bytes of small integers
+        if (count[(src_keys[0] >> shift) & 0xFF] == nmemb) {
+            continue;
+        }
+
+        Uint32 offset = 0;
+        int digit;
+        for (digit = 0; digit < 256; ++digit) {
+            const Uint32 n = count[digit];
+            count[digit] = offset;
+            offset += n;
+        }
+
+        for (i = 0; i < nmemb; ++i) {
+            const Uint64 key = src_keys[i];
+            const Uint32 slot = count[(key >> shift) & 0xFF]++;
+            dst_keys[slot] = key;
+            dst_indices[slot] = src_indices[i];
+        }
+
+        Uint64 *swap_keys = src_keys;
+        src_keys = dst_keys;
+        dst_keys = swap_keys;
+        Uint32 *swap_indices = src_indices;
+        src_indices = dst_indices;
+        dst_indices = swap_indices;
+        moved = true;
+    }
+
+    if (moved) {
+        for (i = 0; i < nmemb; ++i) {
+            CopyElement(scratch + i * size, (const char *)base + (size_t)src_indices[i] * size, size);
+        }
+        SDL_memcpy(base, scratch, nmemb * size);
+    }
+
+    SDL_free(keys);
+    SDL_free(indices);
+    SDL_free(scratch);
+    SDL_free(counts);
+    return true;
+}
@@ -32,6 +32,12 @@
 
 #include "SDL_casefolding.h"
 
+#if !defined(HAVE_STRLEN) || (!defined(HAVE_STRCHR) && !defined(HAVE_INDEX))
+// Word-at-a-time helpers for the fallbacks used when there's no C runtime
+#define SDL_ONES_BYTES          ((size_t)-1 / 0xFF)
+#define SDL_HasZeroByte(word)   ((((word) - SDL_ONES_BYTES) & ~(word) & (SDL_ONES_BYTES * 0x80)) != 0)
+#endif
+
 #if defined(__SIZEOF_WCHAR_T__)
 #define SDL_SIZEOF_WCHAR_T __SIZEOF_WCHAR_T__
 #elif defined(SDL_PLATFORM_NGAGE)
@@ -788,11 +794,26 @@ size_t SDL_strlen(const char *string)
 #ifdef HAVE_STRLEN
     return strlen(string);
 #else
-    size_t len = 0;
-    while (*string++) {
-        ++len;
+    const char *end = string;
+
+    // Check a word at a time once aligned, an aligned read can't cross into an unmapped page
+    while (((uintptr_t)end & (sizeof(size_t) - 1)) != 0) {
+        if (!*end) {
+            return (size_t)(end - string);
+        }
+        ++end;
     }
-    return len;
+    for (;; end += sizeof(size_t)) {
+        size_t word;
+        SDL_memcpy(&word, end, sizeof(word));
+        if (SDL_HasZeroByte(word)) {
+            break;
+        }
+    }
+    while (*end) {
+        ++end;
+    }
+    return (size_t)(end - string);
 #endif // HAVE_STRLEN
 }
 
@@ -1077,19 +1098,129 @@ size_t SDL_utf8strlcpy(SDL_OUT_Z_CAP(dst_bytes) char *dst, const char *src, size
     return bytes;
 }
 
-size_t SDL_utf8strlen(const char *str)
+/* Most UTF-8 text is largely ASCII, and each ASCII byte is one codepoint, so runs of
+   it are counted in bulk instead of being decoded a byte at a time. These return how
+   many bytes at the start of `str` are ASCII, stopping at the end or a null terminator. */
+static size_t CountASCII_Scalar(const Uint8 *str, size_t len)
 {
-    size_t result = 0;
-    while (SDL_StepUTF8(&str, NULL)) {
-        result++;
+    size_t i = 0;
+
+    for (; (i + 8) <= len; i += 8) {
+        Uint64 word;
+        SDL_memcpy(&word, str + i, sizeof(word));
+        // Non-ASCII bytes have the high bit set, and zero bytes set it when 1 is subtracted
+        if ((word | (word - SDL_UINT64_C(0x0101010101010101))) & SDL_UINT64_C(0x8080808080808080)) {
+            break;
+        }
     }
-    return result;
+    while (i < len && str[i] && str[i] < 0x80) {
+        ++i;
+    }
+    return i;
+}
+
+#ifdef SDL_SSE2_INTRINSICS
+static size_t SDL_TARGETING("sse2") CountASCII_SSE2(const Uint8 *str, size_t len)
+{
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+
+    for (; (i + 16) <= len; i += 16) {
+        const __m128i bytes = _mm_loadu_si128((const __m128i *)(str + i));
+        if (_mm_movemask_epi8(_mm_or_si128(bytes, _mm_cmpeq_epi8(bytes, zero)))) {
+            break;
+        }
+    }
+    return i + CountASCII_Scalar(str + i, len - i);
+}
+#endif
+
+#ifdef SDL_AVX2_INTRINSICS
+static size_t SDL_TARGETING("avx2") CountASCII_AVX2(const Uint8 *str, size_t len)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    size_t i = 0;
+
+    for (; (i + 32) <= len; i += 32) {
+        const __m256i bytes = _mm256_loadu_si256((const __m256i *)(str + i));
+        if (_mm256_movemask_epi8(_mm256_or_si256(bytes, _mm256_cmpeq_epi8(bytes, zero)))) {
+            break;
+        }
+    }
+    return i + CountASCII_Scalar(str + i, len - i);
+}
+#endif
+
+#if defined(SDL_NEON_INTRINSICS) && (defined(__aarch64__) || defined(_M_ARM64))
+#define SDL_UTF8_NEON
+static size_t CountASCII_NEON(const Uint8 *str, size_t len)
+{
+    const uint8x16_t one = vdupq_n_u8(1);
+    size_t i = 0;
+
+    for (; (i + 16) <= len; i += 16) {
+        // Subtracting 1 wraps zero to 0xFF, so zero and non-ASCII bytes are both >= 0x7F afterwards
+        if (vmaxvq_u8(vsubq_u8(vld1q_u8(str + i), one)) >= 0x7F) {
+            break;
+        }
+    }
+    return i + CountASCII_Scalar(str + i, len - i);
+}
+#endif
+
+#define ASCII_PROBE_LENGTH 16
+
+static size_t CountASCII(const Uint8 *str, size_t len)
+{
+    /* Check a few bytes one at a time first. In mostly non-ASCII text the run
+       ends right away, and a wide load that bails would be wasted work. */
+    const size_t probe = SDL_min(len, ASCII_PROBE_LENGTH);
+    size_t i = 0;
+    while (i < probe && str[i] && str[i] < 0x80) {
+        ++i;
+    }
+    if (i < probe || i == len) {
+        return i;
+    }
+
+    // The CPU features are cached, so this follows SDL_HINT_CPU_FEATURE_MASK without a lookup per byte
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        return i + CountASCII_AVX2(str + i, len - i);
+    }
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        return i + CountASCII_SSE2(str + i, len - i);
+    }
+#endif
+#ifdef SDL_UTF8_NEON
+    if (SDL_HasNEON()) {
+        return i + CountASCII_NEON(str + i, len - i);
+    }
+#endif
+    return i + CountASCII_Scalar(str + i, len - i);
+}
+
+size_t SDL_utf8strlen(const char *str)
+{
+    /* A multibyte sequence is only accepted if none of its bytes are zero,
+       so stopping at the terminator counts the same characters. */
+    return SDL_utf8strnlen(str, SDL_strlen(str));
 }
 
 size_t SDL_utf8strnlen(const char *str, size_t bytes)
 {
     size_t result = 0;
-    while (SDL_StepUTF8(&str, &bytes)) {
+    while (bytes) {
+        const size_t ascii = CountASCII((const Uint8 *)str, bytes);
+        result += ascii;
+        str += ascii;
+        bytes -= ascii;
+
+        if (!SDL_StepUTF8(&str, &bytes)) {
+            break;
+        }
         result++;
     }
     return result;
@@ -1175,13 +1306,31 @@ char *SDL_strchr(const char *string, int c)
 #elif defined(HAVE_INDEX)
     return SDL_const_cast(char *, index(string, c));
 #else
+    const size_t pattern = SDL_ONES_BYTES * (unsigned char)c;
+
+    // Check a word at a time once aligned, stopping at a word with the character or the terminator
+    while (((uintptr_t)string & (sizeof(size_t) - 1)) != 0) {
+        if (*string == (char)c) {
+            return (char *)string;
+        } else if (!*string) {
+            return NULL;
+        }
+        ++string;
+    }
+    for (;; string += sizeof(size_t)) {
+        size_t word;
+        SDL_memcpy(&word, string, sizeof(word));
+        if (SDL_HasZeroByte(word) || SDL_HasZeroByte(word ^ pattern)) {
+            break;
+        }
+    }
     while (*string) {
-        if (*string == c) {
+        if (*string == (char)c) {
             return (char *)string;
         }
         ++string;
     }
-    if (c == '\0') {
+    if ((char)c == '\0') {
         return (char *)string;
     }
     return NULL;
@@ -1489,13 +1638,60 @@ int SDL_strncmp(const char *str1, const char *str2, size_t maxlen)
 #endif // HAVE_STRNCMP
 }
 
+/* Compares the ASCII characters at the start of two strings without looking them up in the
+   case folding tables. Returns true if that decided the comparison, or false when a non-ASCII
+   character is reached and the rest needs the full Unicode comparison. */
+static bool CompareASCIICaseless(const char **pstr1, const char **pstr2, size_t *pmaxlen, int *presult)
+{
+    const Uint8 *str1 = (const Uint8 *)*pstr1;
+    const Uint8 *str2 = (const Uint8 *)*pstr2;
+    size_t maxlen = *pmaxlen;
+    bool done = true;
+
+    *presult = 0;
+    for (; maxlen; --maxlen, ++str1, ++str2) {
+        Uint32 a = *str1;
+        Uint32 b = *str2;
+        if ((a | b) & 0x80) {
+            done = false;
+            break;
+        }
+        if ((a - 'A') < 26) {
+            a += 'a' - 'A';
+        }
+        if ((b - 'A') < 26) {
+            b += 'a' - 'A';
+        }
+        if (a != b) {
+            *presult = (a < b) ? -1 : 1;
+            break;
+        } else if (a == 0) {
+            break;
+        }
+    }
+
+    *pstr1 = (const char *)str1;
+    *pstr2 = (const char *)str2;
+    *pmaxlen = maxlen;
+    return done;
+}
+
 int SDL_strcasecmp(const char *str1, const char *str2)
 {
+    size_t maxlen = SDL_SIZE_MAX;
+    int result;
+    if (CompareASCIICaseless(&str1, &str2, &maxlen, &result)) {
+        return result;
+    }
     UNICODE_STRCASECMP(8, 4, 4, (void) str1start, (void) str2start);  // always NULL-terminated, no need to adjust lengths.
 }
 
 int SDL_strncasecmp(const char *str1, const char *str2, size_t maxlen)
 {
+    int result;
+    if (CompareASCIICaseless(&str1, &str2, &maxlen, &result)) {
+        return result;
+    }
     size_t slen1 = maxlen;
     size_t slen2 = maxlen;
     UNICODE_STRCASECMP(8, slen1, slen2, slen1 -= (size_t) (str1 - ((const char *) str1start)), slen2 -= (size_t) (str2 - ((const char *) str2start)));
@@ -0,0 +1,575 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+// A work-stealing job system.
+//
+// Each worker thread owns a queue of jobs. A job submitted from a worker goes
+// on the back of that worker's queue and the worker takes its next job from
+// the back too, so nested work runs while its data is still in cache. Jobs
+// submitted from other threads go on a shared queue, and a worker that runs
+// out of work takes from the front of the shared queue and then steals from
+// the front of the other workers' queues.
+
+#include "SDL_jobs_c.h"
+
+#define SDL_MAX_JOB_THREADS         16
+#define SDL_JOB_QUEUE_INITIAL_SIZE  64
+#define SDL_JOB_CHUNKS_PER_THREAD   4
+
+typedef struct SDL_Job
+{
+    SDL_JobFunction func;
+    void *userdata;
+    SDL_JobCounter *counter;
+    struct SDL_Job *next; // the next job held back by the same dependency
+} SDL_Job;
+
+struct SDL_JobCounter
+{
+    SDL_AtomicInt value;
+    SDL_SpinLock lock; // held while `value` is decremented and while `waiting` is used
+    SDL_Job *waiting;  // jobs that can't start until `value` reaches zero
+};
+
+// The owner pushes and pops at the tail, other threads steal from the head
+typedef struct SDL_JobQueue
+{
+    SDL_SpinLock lock;
+    SDL_Job **jobs; // ring buffer, the capacity is always a power of two
+    Uint32 capacity;
+    Uint32 head;
+    Uint32 tail;
+} SDL_JobQueue;
+
+typedef struct SDL_JobWorker
+{
+    SDL_JobQueue queue;
+    SDL_Thread *thread;
+    int index;
+} SDL_JobWorker;
+
+typedef struct SDL_ParallelForLoop
+{
+    SDL_ParallelForFunction func;
+    void *userdata;
+    int count;
+    int grain;
+    int num_chunks;
+    SDL_AtomicInt next_chunk;
+    SDL_AtomicInt refcount; // the calling thread plus each helper job that hasn't finished
+    SDL_JobCounter chunks_left;
+} SDL_ParallelForLoop;
+
+static SDL_InitState job_init;
+static SDL_TLSID job_worker_tls;
+static SDL_Mutex *job_lock;
+static SDL_Condition *job_cond;      // signaled when a job is queued, workers and helping waiters sleep on this
+static SDL_Condition *job_done_cond; // broadcast when a counter reaches zero, waiters that don't help sleep on this
+static SDL_JobWorker *job_workers;
+static int job_worker_slots;         // entries in job_workers, some may have failed to start
+static int num_job_workers;
+static SDL_JobQueue job_injected;    // jobs submitted from threads that aren't workers
+static SDL_AtomicInt num_jobs_queued;
+static SDL_AtomicInt num_job_sleepers; // threads sleeping on job_cond
+static SDL_AtomicInt num_job_waiters;  // threads sleeping until a counter reaches zero
+static bool job_stop;
+
+static bool PushJobQueue(SDL_JobQueue *queue, SDL_Job *job)
+{
+    bool result = true;
+
+    SDL_LockSpinlock(&queue->lock);
+    if (queue->tail - queue->head == queue->capacity) {
+        const Uint32 capacity = queue->capacity ? queue->capacity * 2 : SDL_JOB_QUEUE_INITIAL_SIZE;
+        SDL_Job **jobs = (SDL_Job **)SDL_malloc(capacity * sizeof(*jobs));
+        if (jobs) {
+            Uint32 i;
+            for (i = queue->head; i != queue->tail; ++i) {
+                jobs[i & (capacity - 1)] = queue->jobs[i & (queue->capacity - 1)];
+            }
+            SDL_free(queue->jobs);
+            queue->jobs = jobs;
+            queue->capacity = capacity;
+        } else {
+            result = false;
+        }
+    }
+    if (result) {
+        queue->jobs[queue->tail & (queue->capacity - 1)] = job;
+        ++queue->tail;
+    }
+    SDL_UnlockSpinlock(&queue->lock);
+
+    return result;
+}
+
+static SDL_Job *PopJobQueue(SDL_JobQueue *queue, bool newest)
+{
+    SDL_Job *job = NULL;
+
+    SDL_LockSpinlock(&queue->lock);
+    if (queue->head != queue->tail) {
+        if (newest) {
+            job = queue->jobs[--queue->tail & (queue->capacity - 1)];
+        } else {
+            job = queue->jobs[queue->head++ & (queue->capacity - 1)];
+        }
+    }
+    SDL_UnlockSpinlock(&queue->lock);
+
+    return job;
+}
+
+static SDL_Job *TakeJob(SDL_JobWorker *self)
+{
+    SDL_Job *job = NULL;
+    int i;
+
+    if (SDL_GetAtomicInt(&num_jobs_queued) == 0) {
+        return NULL;
+    }
+
+    if (self) {
+        job = PopJobQueue(&self->queue, true);
+    }
+    if (!job) {
+        job = PopJobQueue(&job_injected, false);
+    }
+    for (i = 0; !job && i < job_worker_slots; ++i) {
+        SDL_JobWorker *victim = &job_workers[((self ? self->index + 1 : 0) + i) % job_worker_slots];
+        if (victim != self) {
+            job = PopJobQueue(&victim->queue, false);
+        }
+    }
+
+    if (job) {
+        SDL_AddAtomicInt(&num_jobs_queued, -1);
+    }
+    return job;
+}
+
+static void QueueJob(SDL_Job *job);
+
+static void FinishJobCounter(SDL_JobCounter *counter)
+{
+    SDL_Job *ready = NULL;
+    bool done = false;
+
+    SDL_LockSpinlock(&counter->lock);
+    if (SDL_AddAtomicInt(&counter->value, -1) == 1) {
+        ready = counter->waiting;
+        counter->waiting = NULL;
+        done = true;
+    }
+    SDL_UnlockSpinlock(&counter->lock);
+
+    // The counter may be destroyed as soon as the lock is released, don't touch it from here on
+
+    if (done) {
+        // Jobs were added to the front of the list, so start them in the order they were submitted
+        SDL_Job *list = NULL;
+        while (ready) {
+            SDL_Job *next = ready->next;
+            ready->next = list;
+            list = ready;
+            ready = next;
+        }
+        while (list) {
+            SDL_Job *next = list->next;
+            QueueJob(list);
+            list = next;
+        }
+
+        if (SDL_GetAtomicInt(&num_job_waiters) > 0) {
+            SDL_LockMutex(job_lock);
+            SDL_BroadcastCondition(job_cond);
+            SDL_BroadcastCondition(job_done_cond);
+            SDL_UnlockMutex(job_lock);
+        }
+    }
+}
+
+static void RunJob(SDL_Job *job)
+{
+    SDL_JobCounter *counter = job->counter;
+
+    job->func(job->userdata);
+    SDL_free(job);
+
+    if (counter) {
+        FinishJobCounter(counter);
+    }
+}
+
+static void QueueJob(SDL_Job *job)
+{
+    if (num_job_workers == 0) {
+        RunJob(job);
+        return;
+    }
+
+    SDL_JobWorker *self = (SDL_JobWorker *)SDL_GetTLS(&job_worker_tls);
+    if (!PushJobQueue(self ? &self->queue : &job_injected, job)) {
+        // Out of memory, just run it here
+        RunJob(job);
+        return;
+    }
+
+    SDL_AddAtomicInt(&num_jobs_queued, 1);
+    if (SDL_GetAtomicInt(&num_job_sleepers) > 0) {
+        SDL_LockMutex(job_lock);
+        SDL_SignalCondition(job_cond);
+        SDL_UnlockMutex(job_lock);
+    }
+}
+
+static void WaitForJobCounter(SDL_JobCounter *counter, bool help)
+{
+    SDL_JobWorker *self = NULL;
+
+    if (help && SDL_GetAtomicInt(&counter->value) != 0) {
+        self = (SDL_JobWorker *)SDL_GetTLS(&job_worker_tls);
+    }
+
+    while (SDL_GetAtomicInt(&counter->value) != 0) {
+        if (help) {
+            SDL_Job *job = TakeJob(self);
+            if (job) {
+                RunJob(job);
+                continue;
+            }
+        }
+
+        SDL_LockMutex(job_lock);
+        SDL_AddAtomicInt(&num_job_waiters, 1);
+        if (help) {
+            SDL_AddAtomicInt(&num_job_sleepers, 1);
+            if (SDL_GetAtomicInt(&counter->value) != 0 && SDL_GetAtomicInt(&num_jobs_queued) == 0) {
+                SDL_WaitCondition(job_cond, job_lock);
+            }
+            SDL_AddAtomicInt(&num_job_sleepers, -1);
+        } else {
+            if (SDL_GetAtomicInt(&counter->value) != 0) {
+                SDL_WaitCondition(job_done_cond, job_lock);
+            }
+        }
+        SDL_AddAtomicInt(&num_job_waiters, -1);
+        SDL_UnlockMutex(job_lock);
+    }
+
+    // Make sure the thread that finished the last job is done with the counter
+    SDL_LockSpinlock(&counter->lock);
+    SDL_UnlockSpinlock(&counter->lock);
+}
+
+static int SDLCALL SDL_JobWorkerThread(void *data)
+{
+    SDL_JobWorker *self = (SDL_JobWorker *)data;
+
+    SDL_SetTLS(&job_worker_tls, self, NULL);
+
+    for (;;) {
+        SDL_Job *job = TakeJob(self);
+        if (job) {
+            RunJob(job);
+            continue;
+        }
+
+        SDL_LockMutex(job_lock);
+        if (job_stop && SDL_GetAtomicInt(&num_jobs_queued) == 0) {
+            SDL_UnlockMutex(job_lock);
+            break;
+        }
+        SDL_AddAtomicInt(&num_job_sleepers, 1);
+        if (!job_stop && SDL_GetAtomicInt(&num_jobs_queued) == 0) {
+            SDL_WaitCondition(job_cond, job_lock);
+        }
+        SDL_AddAtomicInt(&num_job_sleepers, -1);
+        SDL_UnlockMutex(job_lock);
+    }
+    return 0;
+}
+
+static void SDL_StopJobs(void)
+{
+    SDL_Job *job;
+    int i;
+
+    if (job_lock) {
+        SDL_LockMutex(job_lock);
+        job_stop = true;
+        SDL_BroadcastCondition(job_cond);
+        SDL_UnlockMutex(job_lock);
+    }
+
+    for (i = 0; i < num_job_workers; ++i) {
+        SDL_WaitThread(job_workers[i].thread, NULL);
+    }
+    num_job_workers = 0;
+
+    // The workers run everything that's queued before they exit, this catches anything submitted since
+    while ((job = TakeJob(NULL)) != NULL) {
+        RunJob(job);
+    }
+
+    for (i = 0; i < job_worker_slots; ++i) {
+        SDL_free(job_workers[i].queue.jobs);
+    }
+    SDL_free(job_workers);
+    job_workers = NULL;
+    job_worker_slots = 0;
+    SDL_free(job_injected.jobs);
+    SDL_zero(job_injected);
+
+    SDL_DestroyCondition(job_done_cond);
+    job_done_cond = NULL;
+    SDL_DestroyCondition(job_cond);
+    job_cond = NULL;
+    SDL_DestroyMutex(job_lock);
+    job_lock = NULL;
+    job_stop = false;
+}
+
+// We don't start any threads until the job system is first used
+static bool SDL_PrepareJobs(void)
+{
+    bool okay = true;
+
+    if (SDL_ShouldInit(&job_init)) {
+        int count = SDL_clamp(SDL_GetNumLogicalCPUCores() - 1, 1, SDL_MAX_JOB_THREADS);
+        const char *hint = SDL_GetHint(SDL_HINT_JOB_THREADS);
+        if (hint && *hint) {
+            count = SDL_clamp(SDL_atoi(hint), 0, SDL_MAX_JOB_THREADS);
+        }
+
+        okay = (okay && ((job_lock = SDL_CreateMutex()) != NULL));
+        okay = (okay && ((job_cond = SDL_CreateCondition()) != NULL));
+        okay = (okay && ((job_done_cond = SDL_CreateCondition()) != NULL));
+        if (okay && count > 0) {
+            job_workers = (SDL_JobWorker *)SDL_calloc(count, sizeof(*job_workers));
+            okay = (job_workers != NULL);
+            if (okay) {
+                job_worker_slots = count;
+            }
+        }
+        while (okay && num_job_workers < job_worker_slots) {
+            SDL_JobWorker *worker = &job_workers[num_job_workers];
+            char name[32];
+            SDL_snprintf(name, sizeof(name), "SDLjob%d", num_job_workers);
+            worker->index = num_job_workers;
+            worker->thread = SDL_CreateThread(SDL_JobWorkerThread, name, worker);
+            if (!worker->thread) {
+                // Carry on with the threads we have, jobs run on the submitting thread if there are none
+                break;
+            }
+            ++num_job_workers;
+        }
+
+        if (!okay) {
+            SDL_StopJobs();
+        }
+        SDL_SetInitialized(&job_init, okay);
+    }
+    return okay;
+}
+
+static SDL_Job *CreateJob(SDL_JobFunction func, void *userdata, SDL_JobCounter *counter)
+{
+    SDL_Job *job = (SDL_Job *)SDL_malloc(sizeof(*job));
+    if (job) {
+        job->func = func;
+        job->userdata = userdata;
+        job->counter = counter;
+        job->next = NULL;
+    }
+    return job;
+}
+
+SDL_JobCounter *SDL_CreateJobCounter(void)
+{
+    return (SDL_JobCounter *)SDL_calloc(1, sizeof(SDL_JobCounter));
+}
+
+bool SDL_SubmitJob(SDL_JobFunction func, void *userdata, SDL_JobCounter *counter, SDL_JobCounter *dependency)
+{
+    CHECK_PARAM(!func) {
+        return SDL_InvalidParamError("func");
+    }
+
+    if (!SDL_PrepareJobs()) {
+        return false;
+    }
+
+    SDL_Job *job = CreateJob(func, userdata, counter);
+    if (!job) {
+        return false;
+    }
+
+    if (counter) {
+        SDL_AddAtomicInt(&counter->value, 1);
+    }
+
+    if (dependency) {
+        SDL_LockSpinlock(&dependency->lock);
+        if (SDL_GetAtomicInt(&dependency->value) != 0) {
+            job->next = dependency->waiting;
+            dependency->waiting = job;
+            job = NULL;
+        }
+        SDL_UnlockSpinlock(&dependency->lock);
+    }
+
+    if (job) {
+        QueueJob(job);
+    }
+    return true;
+}
+
+bool SDL_IsJobCounterDone(SDL_JobCounter *counter)
+{
+    CHECK_PARAM(!counter) {
+        SDL_InvalidParamError("counter");
+        return false;
+    }
+
+    return (SDL_GetAtomicInt(&counter->value) == 0);
+}
+
+void SDL_WaitJobCounter(SDL_JobCounter *counter)
+{
+    CHECK_PARAM(!counter) {
+        SDL_InvalidParamError("counter");
+        return;
+    }
+
+    WaitForJobCounter(counter, true);
+}
+
+void SDL_DestroyJobCounter(SDL_JobCounter *counter)
+{
+    if (!counter) {
+        return;
+    }
+
+    WaitForJobCounter(counter, true);
+    SDL_assert(!counter->waiting);
+    SDL_free(counter);
+}
+
+static void RunParallelForChunks(SDL_ParallelForLoop *loop)
+{
+    for (;;) {
+        const int chunk = SDL_AddAtomicInt(&loop->next_chunk, 1);
+        if (chunk >= loop->num_chunks) {
+            break;
+        }
+
+        const int start = chunk * loop->grain;
+        const int end = (loop->count - start > loop->grain) ? start + loop->grain : loop->count;
+        loop->func(loop->userdata, start, end);
+        FinishJobCounter(&loop->chunks_left);
+    }
+}
+
+static void ReleaseParallelFor(SDL_ParallelForLoop *loop, int refs)
+{
+    if (SDL_AddAtomicInt(&loop->refcount, -refs) == refs) {
+        SDL_free(loop);
+    }
+}
+
+static void SDLCALL SDL_ParallelForHelper(void *userdata)
+{
+    SDL_ParallelForLoop *loop = (SDL_ParallelForLoop *)userdata;
+
+    RunParallelForChunks(loop);
+    ReleaseParallelFor(loop, 1);
+}
+
+void SDL_ParallelFor(int count, int grain, SDL_ParallelForFunction func, void *userdata)
+{
+    CHECK_PARAM(!func) {
+        SDL_InvalidParamError("func");
+        return;
+    }
+
+    if (count <= 0) {
+        return;
+    }
+
+    const int threads = SDL_GetNumJobThreads();
+    if (grain <= 0) {
+        grain = SDL_max(count / ((threads + 1) * SDL_JOB_CHUNKS_PER_THREAD), 1);
+    }
+    const int num_chunks = (count - 1) / grain + 1;
+
+    // Helper jobs may start after the loop is finished, so the loop lives on the heap until the last of them is done with it
+    SDL_ParallelForLoop *loop = NULL;
+    if (threads > 0 && num_chunks > 1) {
+        loop = (SDL_ParallelForLoop *)SDL_calloc(1, sizeof(*loop));
+    }
+    if (!loop) {
+        func(userdata, 0, count);
+        return;
+    }
+
+    const int helpers = SDL_min(threads, num_chunks - 1);
+    int i;
+
+    loop->func = func;
+    loop->userdata = userdata;
+    loop->count = count;
+    loop->grain = grain;
+    loop->num_chunks = num_chunks;
+    SDL_SetAtomicInt(&loop->chunks_left.value, num_chunks);
+    SDL_SetAtomicInt(&loop->refcount, helpers + 1);
+
+    for (i = 0; i < helpers; ++i) {
+        SDL_Job *job = CreateJob(SDL_ParallelForHelper, loop, NULL);
+        if (!job) {
+            ReleaseParallelFor(loop, helpers - i);
+            break;
+        }
+        QueueJob(job);
+    }
+
+    // Work on the loop here too, but don't pick up unrelated jobs while waiting for the last chunks
+    RunParallelForChunks(loop);
+    WaitForJobCounter(&loop->chunks_left, false);
+    ReleaseParallelFor(loop, 1);
+}
+
+int SDL_GetNumJobThreads(void)
+{
+    if (!SDL_PrepareJobs()) {
+        return 0;
+    }
+    return num_job_workers;
+}
+
+void SDL_QuitJobs(void)
+{
+    if (SDL_ShouldQuit(&job_init)) {
+        SDL_StopJobs();
+        SDL_SetInitialized(&job_init, false);
+    }
+}
@@ -27,6 +27,14 @@
 
 #if !defined(SDL_PLATFORM_EMSCRIPTEN)
 
+// How promptly timer callbacks have been dispatched so far
+typedef struct SDL_TimerStats
+{
+    Uint64 callbacks;         // number of callbacks made
+    Uint64 total_lateness_ns; // sum of how long after their scheduled time the callbacks were made
+    Uint64 max_lateness_ns;   // the latest any callback has been made
+} SDL_TimerStats;
+
 typedef struct SDL_Timer
 {
     SDL_TimerID timerID;
@@ -39,20 +47,32 @@ typedef struct SDL_Timer
     struct SDL_Timer *next;
 } SDL_Timer;
 
-typedef struct SDL_TimerMap
+/* The timer wheel has TIMER_WHEEL_LEVELS levels of TIMER_WHEEL_SLOTS slots each.
+ * A slot on the first level holds the timers due in a single tick of about a
+ * millisecond, and each slot on the levels above covers a whole revolution of
+ * the level below it. When the first level wraps around, the next slot of the
+ * level above is spread out over the level below, and so on up.
+ */
+#define TIMER_WHEEL_TICK_BITS 20 // a tick is 2^20 nanoseconds, about a millisecond
+#define TIMER_WHEEL_SLOT_BITS 6
+#define TIMER_WHEEL_SLOTS (1 << TIMER_WHEEL_SLOT_BITS)
+#define TIMER_WHEEL_SLOT_MASK (TIMER_WHEEL_SLOTS - 1)
+#define TIMER_WHEEL_LEVELS 6
+#define TIMER_WHEEL_MAX_TICKS (((Uint64)1 << (TIMER_WHEEL_LEVELS * TIMER_WHEEL_SLOT_BITS)) - 1)
+
+typedef struct SDL_TimerWheel
 {
-    SDL_TimerID timerID;
-    SDL_Timer *timer;
-    struct SDL_TimerMap *next;
-} SDL_TimerMap;
+    Uint64 tick;                          // the next tick that hasn't been processed yet
+    Uint64 occupied[TIMER_WHEEL_LEVELS];  // a bit for each slot that has timers in it
+    SDL_Timer *slots[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS];
+} SDL_TimerWheel;
 
-// The timers are kept in a sorted list
 typedef struct
 {
     // Data used by the main thread
     SDL_InitState init;
     SDL_Thread *thread;
-    SDL_TimerMap *timermap;
+    SDL_HashTable *timermap;
     SDL_Mutex *timermap_lock;
 
     // Padding to separate cache lines between threads
@@ -64,37 +84,169 @@ typedef struct
     SDL_Timer *pending;
     SDL_Timer *freelist;
     SDL_AtomicInt active;
-
-    // List of timers - this is only touched by the timer thread
-    SDL_Timer *timers;
+    SDL_TimerStats stats;
+
+    // Timers - these are only touched by the timer thread
+    SDL_TimerWheel wheel;
+    SDL_Timer *due;  // timers whose tick has come up, but that may still be a little early
+    SDL_Timer *unused_head;
+    SDL_Timer *unused_tail;
+    SDL_TimerStats thread_stats;
 } SDL_TimerData;
 
 static SDL_TimerData SDL_timer_data;
 
 /* The idea here is that any thread might add a timer, but a single
- * thread manages the active timer queue, sorted by scheduling time.
+ * thread manages the active timers in a timer wheel, so adding a timer
+ * takes the same amount of time no matter how many there are.
  *
  * Timers are removed by simply setting a canceled flag
  */
 
+static int SDL_GetLowestTimerWheelSlot(Uint64 occupied)
+{
+    const Uint32 low = (Uint32)occupied;
+    if (low) {
+        return SDL_MostSignificantBitIndex32(low & (~low + 1));
+    }
+    const Uint32 high = (Uint32)(occupied >> 32);
+    return 32 + SDL_MostSignificantBitIndex32(high & (~high + 1));
+}
+
+static bool SDL_IsTimerWheelEmpty(const SDL_TimerWheel *wheel)
+{
+    for (int level = 0; level < TIMER_WHEEL_LEVELS; ++level) {
+        if (wheel->occupied[level]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void SDL_ReleaseTimer(SDL_TimerData *data, SDL_Timer *timer)
+{
+    SDL_SetAtomicInt(&timer->canceled, 1);
+
+    timer->next = NULL;
+    if (data->unused_tail) {
+        data->unused_tail->next = timer;
+    } else {
+        data->unused_head = timer;
+    }
+    data->unused_tail = timer;
+}
+
 static void SDL_AddTimerInternal(SDL_TimerData *data, SDL_Timer *timer)
 {
-    SDL_Timer *prev, *curr;
+    SDL_TimerWheel *wheel = &data->wheel;
+    Uint64 expires = (timer->scheduled >> TIMER_WHEEL_TICK_BITS);
 
-    prev = NULL;
-    for (curr = data->timers; curr; prev = curr, curr = curr->next) {
-        if (curr->scheduled > timer->scheduled) {
+    if (expires < wheel->tick) {
+        // This tick has already been processed, the timer is due as soon as its time comes up.
+        timer->next = data->due;
+        data->due = timer;
+        return;
+    }
+
+    // Timers further out than the wheel can reach go in the last slot, and get placed again when it comes around.
+    Uint64 delta = expires - wheel->tick;
+    if (delta > TIMER_WHEEL_MAX_TICKS) {
+        delta = TIMER_WHEEL_MAX_TICKS;
+        expires = wheel->tick + delta;
+    }
+
+    int level = 0;
+    while (delta >= ((Uint64)TIMER_WHEEL_SLOTS << (level * TIMER_WHEEL_SLOT_BITS))) {
+        ++level;
+    }
+
+    const int slot = (int)((expires >> (level * TIMER_WHEEL_SLOT_BITS)) & TIMER_WHEEL_SLOT_MASK);
+    timer->next = wheel->slots[level][slot];
+    wheel->slots[level][slot] = timer;
+    wheel->occupied[level] |= ((Uint64)1 << slot);
+}
+
+static SDL_Timer *SDL_TakeTimerWheelSlot(SDL_TimerWheel *wheel, int level, int slot)
+{
+    SDL_Timer *timers = wheel->slots[level][slot];
+    wheel->slots[level][slot] = NULL;
+    wheel->occupied[level] &= ~((Uint64)1 << slot);
+    return timers;
+}
+
+// Move everything in the slots up to and including `tick` into the due list
+static void SDL_AdvanceTimerWheel(SDL_TimerData *data, Uint64 tick)
+{
+    SDL_TimerWheel *wheel = &data->wheel;
+
+    while (wheel->tick <= tick) {
+        if (SDL_IsTimerWheelEmpty(wheel)) {
+            wheel->tick = tick + 1;
             break;
         }
+
+        const Uint64 current = wheel->tick;
+        const int index = (int)(current & TIMER_WHEEL_SLOT_MASK);
+
+        // The first level wrapped around, spread the next slot of the level above over the levels below it.
+        if (index == 0) {
+            for (int level = 1; level < TIMER_WHEEL_LEVELS; ++level) {
+                const int slot = (int)((current >> (level * TIMER_WHEEL_SLOT_BITS)) & TIMER_WHEEL_SLOT_MASK);
+                SDL_Timer *timer = SDL_TakeTimerWheelSlot(wheel, level, slot);
+                while (timer) {
+                    SDL_Timer *next = timer->next;
+                    if (SDL_GetAtomicInt(&timer->canceled)) {
+                        SDL_ReleaseTimer(data, timer);
+                    } else {
+                        SDL_AddTimerInternal(data, timer);
+                    }
+                    timer = next;
+                }
+                if (slot != 0) {
+                    break;
+                }
+            }
+        }
+
+        SDL_Timer *timer = SDL_TakeTimerWheelSlot(wheel, 0, index);
+        while (timer) {
+            SDL_Timer *next = timer->next;
+            timer->next = data->due;
+            data->due = timer;
+            timer = next;
+        }
+
+        // Skip straight to the next slot with anything in it, or the next time the first level wraps around.
+        const Uint64 remaining = (wheel->occupied[0] >> index) >> 1;
+        Uint64 next_tick;
+        if (remaining) {
+            next_tick = current + 1 + SDL_GetLowestTimerWheelSlot(remaining);
+        } else {
+            next_tick = (current | TIMER_WHEEL_SLOT_MASK) + 1;
+        }
+        wheel->tick = SDL_min(next_tick, tick + 1);
     }
+}
 
-    // Insert the timer here!
-    if (prev) {
-        prev->next = timer;
-    } else {
-        data->timers = timer;
+// Returns the first tick at which the wheel has something to do, or SDL_MAX_UINT64 if it's empty
+static Uint64 SDL_GetNextTimerWheelTick(const SDL_TimerWheel *wheel)
+{
+    Uint64 next_tick = SDL_MAX_UINT64;
+
+    for (int level = 0; level < TIMER_WHEEL_LEVELS; ++level) {
+        const Uint64 occupied = wheel->occupied[level];
+        if (!occupied) {
+            continue;
+        }
+
+        // Slots on this level are visited every (1 << shift) ticks, starting with the first one not yet processed.
+        const int shift = level * TIMER_WHEEL_SLOT_BITS;
+        const Uint64 visit = (wheel->tick + (((Uint64)1 << shift) - 1)) >> shift;
+        const int rotate = (int)(visit & TIMER_WHEEL_SLOT_MASK);
+        const Uint64 upcoming = rotate ? ((occupied >> rotate) | (occupied << (TIMER_WHEEL_SLOTS - rotate))) : occupied;
+        next_tick = SDL_min(next_tick, (visit + SDL_GetLowestTimerWheelSlot(upcoming)) << shift);
     }
-    timer->next = curr;
+    return next_tick;
 }
 
 static int SDLCALL SDL_TimerThread(void *_data)
@@ -102,9 +254,8 @@ static int SDLCALL SDL_TimerThread(void *_data)
     SDL_TimerData *data = (SDL_TimerData *)_data;
     SDL_Timer *pending;
     SDL_Timer *current;
-    SDL_Timer *freelist_head = NULL;
-    SDL_Timer *freelist_tail = NULL;
-    Uint64 tick, now, interval, delay;
+    SDL_Timer *ready;
+    Uint64 tick, now, interval, delay, next_tick, dispatched;
 
     /* Threaded timer loop:
      *  1. Queue timers added by other threads
@@ -120,48 +271,59 @@ static int SDLCALL SDL_TimerThread(void *_data)
             data->pending = NULL;
 
             // Make any unused timer structures available
-            if (freelist_head) {
-                freelist_tail->next = data->freelist;
-                data->freelist = freelist_head;
+            if (data->unused_head) {
+                data->unused_tail->next = data->freelist;
+                data->freelist = data->unused_head;
             }
         }
         SDL_UnlockSpinlock(&data->lock);
 
-        // Sort the pending timers into our list
+        data->unused_head = NULL;
+        data->unused_tail = NULL;
+
+        tick = SDL_GetTicksNS();
+
+        // If nothing has been scheduled for a while, the wheel can catch up to now all at once
+        if (SDL_IsTimerWheelEmpty(&data->wheel)) {
+            data->wheel.tick = SDL_max(data->wheel.tick, tick >> TIMER_WHEEL_TICK_BITS);
+        }
+
+        // Put the pending timers on the wheel
         while (pending) {
             current = pending;
             pending = pending->next;
             SDL_AddTimerInternal(data, current);
         }
-        freelist_head = NULL;
-        freelist_tail = NULL;
 
         // Check to see if we're still running, after maintenance
         if (!SDL_GetAtomicInt(&data->active)) {
             break;
         }
 
-        // Initial delay if there are no timers
-        delay = (Uint64)-1;
-
-        tick = SDL_GetTicksNS();
-
-        // Process all the pending timers for this tick
-        while (data->timers) {
-            current = data->timers;
+        // Gather up everything due in this tick, and dispatch it as one batch
+        SDL_AdvanceTimerWheel(data, tick >> TIMER_WHEEL_TICK_BITS);
 
-            if (tick < current->scheduled) {
-                // Scheduled for the future, wait a bit
-                delay = (current->scheduled - tick);
-                break;
-            }
+        ready = data->due;
+        data->due = NULL;
+        dispatched = data->thread_stats.callbacks;
 
-            // We're going to do something with this timer
-            data->timers = current->next;
+        while (ready) {
+            current = ready;
+            ready = current->next;
 
             if (SDL_GetAtomicInt(&current->canceled)) {
                 interval = 0;
+            } else if (tick < current->scheduled) {
+                // Scheduled later in this tick, keep it around
+                current->next = data->due;
+                data->due = current;
+                continue;
             } else {
+                now = SDL_GetTicksNS();
+                data->thread_stats.callbacks++;
+                data->thread_stats.total_lateness_ns += (now - current->scheduled);
+                data->thread_stats.max_lateness_ns = SDL_max(data->thread_stats.max_lateness_ns, now - current->scheduled);
+
                 if (current->callback_ms) {
                     interval = SDL_MS_TO_NS(current->callback_ms(current->userdata, current->timerID, (Uint32)SDL_NS_TO_MS(current->interval)));
                 } else {
@@ -175,18 +337,29 @@ static int SDLCALL SDL_TimerThread(void *_data)
                 current->scheduled = tick + interval;
                 SDL_AddTimerInternal(data, current);
             } else {
-                if (!freelist_head) {
-                    freelist_head = current;
-                }
-                if (freelist_tail) {
-                    freelist_tail->next = current;
-                }
-                freelist_tail = current;
-
-                SDL_SetAtomicInt(&current->canceled, 1);
+                SDL_ReleaseTimer(data, current);
             }
         }
 
+        // Publish the statistics once per batch, rather than for every callback
+        if (data->thread_stats.callbacks != dispatched) {
+            SDL_LockSpinlock(&data->lock);
+            SDL_copyp(&data->stats, &data->thread_stats);
+            SDL_UnlockSpinlock(&data->lock);
+        }
+
+        // Initial delay if there are no timers
+        delay = (Uint64)-1;
+
+        for (current = data->due; current; current = current->next) {
+            delay = SDL_min(delay, current->scheduled - tick);
+        }
+
+        next_tick = SDL_GetNextTimerWheelTick(&data->wheel);
+        if (next_tick <= (SDL_MAX_UINT64 >> TIMER_WHEEL_TICK_BITS)) {
+            delay = SDL_min(delay, (next_tick << TIMER_WHEEL_TICK_BITS) - tick);
+        }
+
         // Adjust the delay based on processing time
         now = SDL_GetTicksNS();
         interval = (now - tick);
@@ -219,6 +392,11 @@ bool SDL_InitTimers(void)
         goto error;
     }
 
+    data->timermap = SDL_CreateHashTable(0, false, SDL_HashID, SDL_KeyMatchID, NULL, NULL);
+    if (!data->timermap) {
+        goto error;
+    }
+
     data->sem = SDL_CreateSemaphore(0);
     if (!data->sem) {
         goto error;
@@ -241,11 +419,18 @@ error:
     return false;
 }
 
+static void SDL_FreeTimerList(SDL_Timer *timer)
+{
+    while (timer) {
+        SDL_Timer *next = timer->next;
+        SDL_free(timer);
+        timer = next;
+    }
+}
+
 void SDL_QuitTimers(void)
 {
     SDL_TimerData *data = &SDL_timer_data;
-    SDL_Timer *timer;
-    SDL_TimerMap *entry;
 
     if (!SDL_ShouldQuit(&data->init)) {
         return;
@@ -265,21 +450,31 @@ void SDL_QuitTimers(void)
         data->sem = NULL;
     }
 
-    // Clean up the timer entries
-    while (data->timers) {
-        timer = data->timers;
-        data->timers = timer->next;
-        SDL_free(timer);
+    if (data->thread_stats.callbacks > 0) {
+        SDL_LogDebug(SDL_LOG_CATEGORY_SYSTEM, "TIMER: %" SDL_PRIu64 " callbacks, %" SDL_PRIu64 " ns late on average, %" SDL_PRIu64 " ns at worst",
+                     data->thread_stats.callbacks, data->thread_stats.total_lateness_ns / data->thread_stats.callbacks, data->thread_stats.max_lateness_ns);
     }
-    while (data->freelist) {
-        timer = data->freelist;
-        data->freelist = timer->next;
-        SDL_free(timer);
+
+    // Clean up the timer entries
+    for (int level = 0; level < TIMER_WHEEL_LEVELS; ++level) {
+        for (int slot = 0; slot < TIMER_WHEEL_SLOTS; ++slot) {
+            SDL_FreeTimerList(data->wheel.slots[level][slot]);
+        }
     }
-    while (data->timermap) {
-        entry = data->timermap;
-        data->timermap = entry->next;
-        SDL_free(entry);
+    SDL_zero(data->wheel);
+    SDL_FreeTimerList(data->due);
+    data->due = NULL;
+    SDL_FreeTimerList(data->unused_head);
+    data->unused_head = NULL;
+    data->unused_tail = NULL;
+    SDL_FreeTimerList(data->freelist);
+    data->freelist = NULL;
+    SDL_zero(data->stats);
+    SDL_zero(data->thread_stats);
+
+    if (data->timermap) {
+        SDL_DestroyHashTable(data->timermap);
+        data->timermap = NULL;
     }
 
     if (data->timermap_lock) {
@@ -290,6 +485,27 @@ void SDL_QuitTimers(void)
     SDL_SetInitialized(&data->init, false);
 }
 
+bool SDL_GetTimerStatistics(Uint64 *callbacks, Uint64 *average_lateness_ns, Uint64 *max_lateness_ns)
+{
+    SDL_TimerData *data = &SDL_timer_data;
+    SDL_TimerStats stats;
+
+    SDL_LockSpinlock(&data->lock);
+    SDL_copyp(&stats, &data->stats);
+    SDL_UnlockSpinlock(&data->lock);
+
+    if (callbacks) {
+        *callbacks = stats.callbacks;
+    }
+    if (average_lateness_ns) {
+        *average_lateness_ns = stats.callbacks ? (stats.total_lateness_ns / stats.callbacks) : 0;
+    }
+    if (max_lateness_ns) {
+        *max_lateness_ns = stats.max_lateness_ns;
+    }
+    return true;
+}
+
 static bool SDL_CheckInitTimers(void)
 {
     return SDL_InitTimers();
@@ -299,7 +515,8 @@ static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback_m
 {
     SDL_TimerData *data = &SDL_timer_data;
     SDL_Timer *timer;
-    SDL_TimerMap *entry;
+    SDL_TimerID timerID;
+    bool added;
 
     CHECK_PARAM(!callback_ms && !callback_ns) {
         SDL_InvalidParamError("callback");
@@ -333,19 +550,17 @@ static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback_m
     timer->scheduled = SDL_GetTicksNS() + timer->interval;
     SDL_SetAtomicInt(&timer->canceled, 0);
 
-    entry = (SDL_TimerMap *)SDL_malloc(sizeof(*entry));
-    if (!entry) {
-        SDL_free(timer);
-        return 0;
-    }
-    entry->timer = timer;
-    entry->timerID = timer->timerID;
+    timerID = timer->timerID;
 
     SDL_LockMutex(data->timermap_lock);
-    entry->next = data->timermap;
-    data->timermap = entry;
+    added = SDL_InsertIntoHashTable(data->timermap, (const void *)(uintptr_t)timerID, timer, false);
     SDL_UnlockMutex(data->timermap_lock);
 
+    if (!added) {
+        SDL_free(timer);
+        return 0;
+    }
+
     // Add the timer to the pending list for the timer thread
     SDL_LockSpinlock(&data->lock);
     timer->next = data->pending;
@@ -355,7 +570,7 @@ static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback_m
     // Wake up the timer thread if necessary
     SDL_SignalSemaphore(data->sem);
 
-    return entry->timerID;
+    return timerID;
 }
 
 SDL_TimerID SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *userdata)
@@ -371,7 +586,7 @@ SDL_TimerID SDL_AddTimerNS(Uint64 interval, SDL_NSTimerCallback callback, void *
 bool SDL_RemoveTimer(SDL_TimerID id)
 {
     SDL_TimerData *data = &SDL_timer_data;
-    SDL_TimerMap *prev, *entry;
+    SDL_Timer *timer = NULL;
     bool canceled = false;
 
     CHECK_PARAM(!id) {
@@ -380,25 +595,16 @@ bool SDL_RemoveTimer(SDL_TimerID id)
 
     // Find the timer
     SDL_LockMutex(data->timermap_lock);
-    prev = NULL;
-    for (entry = data->timermap; entry; prev = entry, entry = entry->next) {
-        if (entry->timerID == id) {
-            if (prev) {
-                prev->next = entry->next;
-            } else {
-                data->timermap = entry->next;
-            }
-            break;
-        }
+    if (data->timermap && SDL_FindInHashTable(data->timermap, (const void *)(uintptr_t)id, (const void **)&timer)) {
+        SDL_RemoveFromHashTable(data->timermap, (const void *)(uintptr_t)id);
     }
     SDL_UnlockMutex(data->timermap_lock);
 
-    if (entry) {
-        if (!SDL_GetAtomicInt(&entry->timer->canceled)) {
-            SDL_SetAtomicInt(&entry->timer->canceled, 1);
+    if (timer) {
+        if (!SDL_GetAtomicInt(&timer->canceled)) {
+            SDL_SetAtomicInt(&timer->canceled, 1);
             canceled = true;
         }
-        SDL_free(entry);
     }
     if (canceled) {
         return true;
@@ -462,6 +668,21 @@ void SDL_QuitTimers(void)
     }
 }
 
+bool SDL_GetTimerStatistics(Uint64 *callbacks, Uint64 *average_lateness_ns, Uint64 *max_lateness_ns)
+{
+    // The browser runs the callbacks, so we don't keep track of them.
+    if (callbacks) {
+        *callbacks = 0;
+    }
+    if (average_lateness_ns) {
+        *average_lateness_ns = 0;
+    }
+    if (max_lateness_ns) {
+        *max_lateness_ns = 0;
+    }
+    return SDL_Unsupported();
+}
+
 static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback_ms, SDL_NSTimerCallback callback_ns, void *userdata)
 {
     SDL_TimerData *data = &SDL_timer_data;
@@ -27,6 +27,23 @@
 #include "SDL_blit_slow.h"
 #include "SDL_RLEaccel_c.h"
 #include "SDL_pixels_c.h"
+#include "../SDL_hints_c.h"
+
+// Runs one band of rows of a blit, on a private copy of the blit info
+static bool SDLCALL SDL_SoftBlitBand(void *userdata, int y, int h)
+{
+    const SDL_BlitInfo *info = (const SDL_BlitInfo *)userdata;
+    SDL_BlitFunc RunBlit = (SDL_BlitFunc)info->src_surface->map.data;
+    SDL_BlitInfo band;
+
+    SDL_copyp(&band, info);
+    band.src += y * band.src_pitch;
+    band.dst += y * band.dst_pitch;
+    band.src_h = h;
+    band.dst_h = h;
+    RunBlit(&band);
+    return true;
+}
 
 // The general purpose software blit routine
 static bool SDLCALL SDL_SoftBlit(SDL_Surface *src, const SDL_Rect *srcrect,
@@ -91,8 +108,13 @@ static bool SDLCALL SDL_SoftBlit(SDL_Surface *src, const SDL_Rect *srcrect,
             info->dst_pitch - info->dst_w * info->dst_fmt->bytes_per_pixel;
         RunBlit = (SDL_BlitFunc)src->map.data;
 
-        // Run the actual software blit
-        RunBlit(info);
+        // Run the actual software blit, in bands of rows if it isn't scaled
+        // and doesn't share a palette lookup cache between rows
+        if (info->src_w == info->dst_w && info->src_h == info->dst_h && !info->palette_map) {
+            SDL_RunBlitBands(info->dst_w, info->dst_h, SDL_SoftBlitBand, info);
+        } else {
+            RunBlit(info);
+        }
     }
 
     // We need to unlock the surfaces if they're locked
@@ -293,3 +315,84 @@ bool SDL_CalculateBlit(SDL_Surface *surface, SDL_Surface *dst)
 
     return true;
 }
+
+// Parallel blits
+
+#define SDL_BLIT_MIN_BAND_ROWS      16
+#define SDL_BLIT_BANDS_PER_THREAD   4
+#define SDL_BLIT_DEFAULT_MIN_AREA   (512 * 512)
+
+typedef struct SDL_BlitBands
+{
+    SDL_BlitBandFunc func;
+    void *userdata;
+    SDL_AtomicInt failed;
+} SDL_BlitBands;
+
+static SDL_InitState blit_hints_init;
+static SDL_AtomicInt blit_parallel;
+static SDL_AtomicInt blit_min_area;
+
+static void SDLCALL SDL_ParallelBlitChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    SDL_SetAtomicInt(&blit_parallel, SDL_GetStringBoolean(hint, false));
+}
+
+static void SDLCALL SDL_ParallelBlitMinAreaChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    SDL_SetAtomicInt(&blit_min_area, (hint && *hint) ? SDL_atoi(hint) : SDL_BLIT_DEFAULT_MIN_AREA);
+}
+
+static void SDLCALL SDL_RunBlitBand(void *userdata, int start, int end)
+{
+    SDL_BlitBands *bands = (SDL_BlitBands *)userdata;
+
+    if (!bands->func(bands->userdata, start, end - start)) {
+        SDL_SetAtomicInt(&bands->failed, 1);
+    }
+}
+
+static bool SDL_UseParallelBlit(int w, int h)
+{
+    if (SDL_ShouldInit(&blit_hints_init)) {
+        SDL_AddHintCallback(SDL_HINT_SURFACE_PARALLEL_BLIT, SDL_ParallelBlitChanged, NULL);
+        SDL_AddHintCallback(SDL_HINT_SURFACE_PARALLEL_BLIT_MIN_AREA, SDL_ParallelBlitMinAreaChanged, NULL);
+        SDL_SetInitialized(&blit_hints_init, true);
+    }
+
+    if (h < 2 * SDL_BLIT_MIN_BAND_ROWS || !SDL_GetAtomicInt(&blit_parallel)) {
+        return false;
+    }
+    if ((Sint64)w * h < SDL_GetAtomicInt(&blit_min_area)) {
+        return false;
+    }
+    return true;
+}
+
+bool SDL_RunBlitBands(int w, int h, SDL_BlitBandFunc func, void *userdata)
+{
+    int threads;
+
+    if (!SDL_UseParallelBlit(w, h) || (threads = SDL_GetNumJobThreads()) == 0) {
+        return func(userdata, 0, h);
+    }
+
+    SDL_BlitBands bands;
+    bands.func = func;
+    bands.userdata = userdata;
+    SDL_SetAtomicInt(&bands.failed, 0);
+
+    const int num_bands = SDL_min(h / SDL_BLIT_MIN_BAND_ROWS, (threads + 1) * SDL_BLIT_BANDS_PER_THREAD);
+    SDL_ParallelFor(h, (h + num_bands - 1) / num_bands, SDL_RunBlitBand, &bands);
+
+    return !SDL_GetAtomicInt(&bands.failed);
+}
+
+void SDL_QuitParallelBlit(void)
+{
+    if (SDL_ShouldQuit(&blit_hints_init)) {
+        SDL_RemoveHintCallback(SDL_HINT_SURFACE_PARALLEL_BLIT, SDL_ParallelBlitChanged, NULL);
+        SDL_RemoveHintCallback(SDL_HINT_SURFACE_PARALLEL_BLIT_MIN_AREA, SDL_ParallelBlitMinAreaChanged, NULL);
+        SDL_SetInitialized(&blit_hints_init, false);
+    }
+}
@@ -53,6 +53,9 @@ extern const Uint16 SDL_expand_byte_10[];
 #define SDL_CPU_ALTIVEC_PREFETCH   0x00000008
 #define SDL_CPU_ALTIVEC_NOPREFETCH 0x00000010
 
+// Nearest color search for blits to an 8-bit palette, see SDL_LookupRGBAColor()
+typedef struct SDL_PaletteMap SDL_PaletteMap;
+
 typedef struct
 {
     SDL_Surface *src_surface;
@@ -71,7 +74,7 @@ typedef struct
     const SDL_PixelFormatDetails *dst_fmt;
     const SDL_Palette *dst_pal;
     Uint8 *table;
-    SDL_HashTable *palette_map;
+    SDL_PaletteMap *palette_map;
     int flags;
     Uint32 colorkey;
     Uint8 r, g, b, a;
@@ -104,8 +107,13 @@ typedef struct SDL_BlitMap
     Uint32 src_palette_version;
 } SDL_BlitMap;
 
+// Runs the rows [y, y + h) of an operation, returning false on failure
+typedef bool (SDLCALL *SDL_BlitBandFunc)(void *userdata, int y, int h);
+
 // Functions found in SDL_blit.c
 extern bool SDL_CalculateBlit(SDL_Surface *surface, SDL_Surface *dst);
+extern bool SDL_RunBlitBands(int w, int h, SDL_BlitBandFunc func, void *userdata);
+extern void SDL_QuitParallelBlit(void);
 
 /* Functions found in SDL_blit_*.c */
 extern SDL_BlitFunc SDL_CalculateBlit0(SDL_Surface *surface);
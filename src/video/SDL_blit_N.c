@@ -3204,6 +3204,11 @@ SDL_BlitFunc SDL_CalculateBlitN(SDL_Surface *surface)
            because RLE is the preferred fast way to deal with this.
            If a particular case turns out to be useful we'll add it. */
 
+        // These only pack RGB, so leave palette lookups (and dithering) to the slow blitter
+        if (SDL_ISPIXELFORMAT_INDEXED(dstfmt->format)) {
+            return NULL;
+        }
+
         if (srcfmt->bytes_per_pixel == 2 && surface->map.identity != 0) {
             return Blit2to2Key;
         } else {
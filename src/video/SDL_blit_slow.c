@@ -48,6 +48,137 @@ static SlowBlitPixelAccess GetPixelAccessMethod(SDL_PixelFormat format)
     }
 }
 
+typedef enum
+{
+    SlowBlitDither_None,
+    SlowBlitDither_Ordered,
+    SlowBlitDither_FloydSteinberg,
+} SlowBlitDitherMethod;
+
+typedef struct
+{
+    SlowBlitDitherMethod method;
+    const SDL_Palette *palette;
+    int width;
+    int x;
+    int y;
+    Sint16 threshold[64];  // ordered: the 8x8 Bayer matrix scaled to the palette spacing
+    int *errors;           // Floyd-Steinberg: RGB errors in 16ths for this row and the next, with a pixel of padding on each side
+} SlowBlitDither;
+
+static const Uint8 SlowBlitBayer8x8[64] = {
+     0, 32,  8, 40,  2, 34, 10, 42,
+    48, 16, 56, 24, 50, 18, 58, 26,
+    12, 44,  4, 36, 14, 46,  6, 38,
+    60, 28, 52, 20, 62, 30, 54, 22,
+     3, 35, 11, 43,  1, 33,  9, 41,
+    51, 19, 59, 27, 49, 17, 57, 25,
+    15, 47,  7, 39, 13, 45,  5, 37,
+    63, 31, 55, 23, 61, 29, 53, 21
+};
+
+static void InitDither(SlowBlitDither *dither, const SDL_BlitInfo *info)
+{
+    const char *method = SDL_GetStringProperty(info->src_surface->props, SDL_PROP_SURFACE_DITHER_STRING, NULL);
+
+    SDL_zerop(dither);
+    dither->palette = info->dst_pal;
+    dither->width = info->dst_w;
+
+    if (!method || !dither->palette || dither->palette->ncolors <= 0) {
+        return;
+    }
+
+    if (SDL_strcmp(method, "ordered") == 0) {
+        // Spread the thresholds over the distance between levels of a color cube with this many colors
+        const float levels = SDL_powf((float)dither->palette->ncolors, 1.0f / 3.0f);
+        const float spread = 255.0f / SDL_max(levels - 1.0f, 1.0f);
+        int i;
+
+        for (i = 0; i < (int)SDL_arraysize(SlowBlitBayer8x8); ++i) {
+            dither->threshold[i] = (Sint16)SDL_lroundf(((SlowBlitBayer8x8[i] + 0.5f) / 64.0f - 0.5f) * spread);
+        }
+        dither->method = SlowBlitDither_Ordered;
+    } else if (SDL_strcmp(method, "floyd-steinberg") == 0) {
+        dither->errors = (int *)SDL_calloc(2 * (dither->width + 2) * 3, sizeof(*dither->errors));
+        if (dither->errors) {
+            dither->method = SlowBlitDither_FloydSteinberg;
+        }
+    }
+}
+
+static void QuitDither(SlowBlitDither *dither)
+{
+    SDL_free(dither->errors);
+}
+
+static Uint32 DitherComponent(int value)
+{
+    return (Uint32)SDL_clamp(value, 0, 255);
+}
+
+// Adjust the color of the next pixel before it's matched to the palette
+static void DitherPixel(SlowBlitDither *dither, Uint32 *R, Uint32 *G, Uint32 *B)
+{
+    switch (dither->method) {
+    case SlowBlitDither_Ordered:
+    {
+        const int offset = dither->threshold[((dither->y & 7) << 3) | (dither->x & 7)];
+        *R = DitherComponent((int)*R + offset);
+        *G = DitherComponent((int)*G + offset);
+        *B = DitherComponent((int)*B + offset);
+        break;
+    }
+    case SlowBlitDither_FloydSteinberg:
+    {
+        const int *error = &dither->errors[((dither->y & 1) * (dither->width + 2) + dither->x + 1) * 3];
+        *R = DitherComponent((int)*R + error[0] / 16);
+        *G = DitherComponent((int)*G + error[1] / 16);
+        *B = DitherComponent((int)*B + error[2] / 16);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+// Spread the difference between the wanted color and the palette color that was chosen
+static void DitherError(SlowBlitDither *dither, Uint32 R, Uint32 G, Uint32 B, Uint8 index)
+{
+    if (dither->method == SlowBlitDither_FloydSteinberg && index < dither->palette->ncolors) {
+        const SDL_Color *color = &dither->palette->colors[index];
+        const int stride = dither->width + 2;
+        int *error = &dither->errors[((dither->y & 1) * stride + dither->x + 1) * 3];
+        int *below = &dither->errors[((~dither->y & 1) * stride + dither->x + 1) * 3];
+        const int diff[3] = { (int)R - color->r, (int)G - color->g, (int)B - color->b };
+        int i;
+
+        for (i = 0; i < 3; ++i) {
+            error[3 + i] += diff[i] * 7;
+            below[-3 + i] += diff[i] * 3;
+            below[i] += diff[i] * 5;
+            below[3 + i] += diff[i];
+        }
+    }
+    ++dither->x;
+}
+
+// Move past a pixel that was left alone, such as one matching the colorkey
+static void DitherSkip(SlowBlitDither *dither)
+{
+    ++dither->x;
+}
+
+static void DitherNextRow(SlowBlitDither *dither)
+{
+    if (dither->method == SlowBlitDither_FloydSteinberg) {
+        // This row's errors have all been used, so it becomes the row below the next one
+        SDL_memset(&dither->errors[(dither->y & 1) * (dither->width + 2) * 3], 0, (dither->width + 2) * 3 * sizeof(*dither->errors));
+    }
+    dither->x = 0;
+    ++dither->y;
+}
+
 /* The ONE TRUE BLITTER
  * This puppy has to handle all the unoptimized cases - yes, it's slow.
  */
@@ -69,7 +200,7 @@ void SDL_Blit_Slow(SDL_BlitInfo *info)
     const SDL_Palette *src_pal = info->src_pal;
     const SDL_PixelFormatDetails *dst_fmt = info->dst_fmt;
     const SDL_Palette *dst_pal = info->dst_pal;
-    SDL_HashTable *palette_map = info->palette_map;
+    SDL_PaletteMap *palette_map = info->palette_map;
     int srcbpp = src_fmt->bytes_per_pixel;
     int dstbpp = dst_fmt->bytes_per_pixel;
     SlowBlitPixelAccess src_access;
@@ -78,11 +209,15 @@ void SDL_Blit_Slow(SDL_BlitInfo *info)
     Uint32 ckey = info->colorkey & rgbmask;
     Uint32 last_pixel = 0;
     Uint8 last_index = 0;
+    SlowBlitDither dither;
 
     src_access = GetPixelAccessMethod(src_fmt->format);
     dst_access = GetPixelAccessMethod(dst_fmt->format);
     if (dst_access == SlowBlitPixelAccess_Index8) {
         last_index = SDL_LookupRGBAColor(palette_map, last_pixel, dst_pal);
+        InitDither(&dither, info);
+    } else {
+        SDL_zero(dither);
     }
 
     incy = info->dst_h ? ((Uint64)info->src_h << 16) / info->dst_h : 0;
@@ -147,6 +282,7 @@ void SDL_Blit_Slow(SDL_BlitInfo *info)
                                (srcG << src_fmt->Gshift) | (srcB << src_fmt->Bshift);
                 }
                 if ((srcpixel & rgbmask) == ckey) {
+                    DitherSkip(&dither);
                     posx += incx;
                     dst += dstbpp;
                     continue;
@@ -281,11 +417,13 @@ void SDL_Blit_Slow(SDL_BlitInfo *info)
 
             switch (dst_access) {
             case SlowBlitPixelAccess_Index8:
+                DitherPixel(&dither, &dstR, &dstG, &dstB);
                 dstpixel = ((dstR << 24) | (dstG << 16) | (dstB << 8) | dstA);
                 if (dstpixel != last_pixel) {
                     last_pixel = dstpixel;
                     last_index = SDL_LookupRGBAColor(palette_map, dstpixel, dst_pal);
                 }
+                DitherError(&dither, dstR, dstG, dstB, last_index);
                 *dst = last_index;
                 break;
             case SlowBlitPixelAccess_RGB:
@@ -325,9 +463,11 @@ void SDL_Blit_Slow(SDL_BlitInfo *info)
             posx += incx;
             dst += dstbpp;
         }
+        DitherNextRow(&dither);
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    QuitDither(&dither);
 }
 
 /* Convert from F16 to float
@@ -821,7 +961,7 @@ void SDL_Blit_Slow_Float(SDL_BlitInfo *info)
     const SDL_Palette *src_pal = info->src_pal;
     const SDL_PixelFormatDetails *dst_fmt = info->dst_fmt;
     const SDL_Palette *dst_pal = info->dst_pal;
-    SDL_HashTable *palette_map = info->palette_map;
+    SDL_PaletteMap *palette_map = info->palette_map;
     int srcbpp = src_fmt->bytes_per_pixel;
     int dstbpp = dst_fmt->bytes_per_pixel;
     SlowBlitPixelAccess src_access;
@@ -838,6 +978,7 @@ void SDL_Blit_Slow_Float(SDL_BlitInfo *info)
     SDL_TonemapContext tonemap;
     Uint32 last_pixel = 0;
     Uint8 last_index = 0;
+    SlowBlitDither dither;
 
     src_colorspace = info->src_surface->colorspace;
     dst_colorspace = info->dst_surface->colorspace;
@@ -890,6 +1031,9 @@ void SDL_Blit_Slow_Float(SDL_BlitInfo *info)
     dst_access = GetPixelAccessMethod(dst_fmt->format);
     if (dst_access == SlowBlitPixelAccess_Index8) {
         last_index = SDL_LookupRGBAColor(palette_map, last_pixel, dst_pal);
+        InitDither(&dither, info);
+    } else {
+        SDL_zero(dither);
     }
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
@@ -976,11 +1120,14 @@ void SDL_Blit_Slow_Float(SDL_BlitInfo *info)
                 Uint32 G = (Uint8)SDL_roundf(SDL_clamp(SDL_sRGBfromLinear(dstG), 0.0f, 1.0f) * 255.0f);
                 Uint32 B = (Uint8)SDL_roundf(SDL_clamp(SDL_sRGBfromLinear(dstB), 0.0f, 1.0f) * 255.0f);
                 Uint32 A = (Uint8)SDL_roundf(SDL_clamp(dstA, 0.0f, 1.0f) * 255.0f);
-                Uint32 dstpixel = ((R << 24) | (G << 16) | (B << 8) | A);
+                Uint32 dstpixel;
+                DitherPixel(&dither, &R, &G, &B);
+                dstpixel = ((R << 24) | (G << 16) | (B << 8) | A);
                 if (dstpixel != last_pixel) {
                     last_pixel = dstpixel;
                     last_index = SDL_LookupRGBAColor(palette_map, dstpixel, dst_pal);
                 }
+                DitherError(&dither, R, G, B, last_index);
                 *dst = last_index;
             } else {
                 WriteFloatPixel(dst, dst_access, dst_fmt, dst_colorspace, dst_white_point, dstR, dstG, dstB, dstA);
@@ -989,8 +1136,10 @@ void SDL_Blit_Slow_Float(SDL_BlitInfo *info)
             posx += incx;
             dst += dstbpp;
         }
+        DitherNextRow(&dither);
         posy += incy;
         info->dst += info->dst_pitch;
     }
+    QuitDither(&dither);
 }
 
@@ -317,6 +317,22 @@ bool SDL_FillSurfaceRect(SDL_Surface *dst, const SDL_Rect *rect, Uint32 color)
     return SDL_FillSurfaceRects(dst, rect, 1, color);
 }
 
+typedef struct
+{
+    void (*fill_function)(Uint8 *pixels, int pitch, Uint32 color, int w, int h);
+    Uint8 *pixels;
+    int pitch;
+    Uint32 color;
+    int w;
+} SDL_FillBand;
+
+static bool SDLCALL SDL_FillSurfaceRectBand(void *userdata, int y, int h)
+{
+    const SDL_FillBand *band = (const SDL_FillBand *)userdata;
+    band->fill_function(band->pixels + y * band->pitch, band->pitch, band->color, band->w, h);
+    return true;
+}
+
 bool SDL_FillSurfaceRects(SDL_Surface *dst, const SDL_Rect *rects, int count, Uint32 color)
 {
     SDL_Rect clipped;
@@ -429,7 +445,8 @@ bool SDL_FillSurfaceRects(SDL_Surface *dst, const SDL_Rect *rects, int count, Ui
         pixels = (Uint8 *)dst->pixels + rect->y * dst->pitch +
                  rect->x * SDL_BYTESPERPIXEL(dst->format);
 
-        fill_function(pixels, dst->pitch, color, rect->w, rect->h);
+        SDL_FillBand band = { fill_function, pixels, dst->pitch, color, rect->w };
+        SDL_RunBlitBands(rect->w, rect->h, SDL_FillSurfaceRectBand, &band);
     }
 
     // We're done!
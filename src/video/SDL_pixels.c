@@ -1284,20 +1284,403 @@ static Uint8 SDL_FindColor(const SDL_Palette *pal, Uint8 r, Uint8 g, Uint8 b, Ui
     return pixelvalue;
 }
 
-Uint8 SDL_LookupRGBAColor(SDL_HashTable *palette_map, Uint32 pixelvalue, const SDL_Palette *pal)
+/*
+ * Match RGBA values to palette indices for blits to an 8-bit palette.
+ *
+ * Recently looked up colors are kept in a direct-mapped cache, but images
+ * with lots of colors still miss often, so the search itself is sped up in
+ * two ways:
+ * the palette is kept as planes of 16-bit components that SIMD can compare
+ * eight colors at a time, and once there have been enough misses, a cube of
+ * candidate lists is built for opaque colors. Each cell of the cube lists
+ * the only palette entries that can be nearest to a color in that cell, in
+ * palette order, so the result is always the same as SDL_FindColor().
+ */
+#define PALETTE_MAP_CUBE_BITS   4
+#define PALETTE_MAP_CUBE_SIZE   (1 << PALETTE_MAP_CUBE_BITS)
+#define PALETTE_MAP_CUBE_CELLS  (PALETTE_MAP_CUBE_SIZE * PALETTE_MAP_CUBE_SIZE * PALETTE_MAP_CUBE_SIZE)
+#define PALETTE_MAP_CUBE_MISSES 256 // build the cube once this many colors had to be searched for
+#define PALETTE_MAP_PADDING     1000 // the value of unused color slots, too far away to ever match
+#define PALETTE_MAP_CACHE_BITS  12
+#define PALETTE_MAP_CACHE_SIZE  (1 << PALETTE_MAP_CACHE_BITS)
+#define PALETTE_MAP_CACHE_VALID ((Uint64)1 << 40)
+
+struct SDL_PaletteMap
+{
+    Uint32 version;
+    int ncolors;
+    int stride;             // number of colors in each plane, rounded up for SIMD
+    Sint16 *colors;         // planes of red, green, blue and alpha, each stride long
+    Uint64 *cache;          // PALETTE_MAP_CACHE_VALID | pixel value << 8 | palette index, or 0 if unused
+    int misses;
+    Uint32 *cube_offsets;   // where each cell's candidates start, plus one for the end
+    Uint8 *cube_candidates;
+};
+
+static Uint8 SDL_FindColorInPlanes(const SDL_PaletteMap *map, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    const Sint16 *R = map->colors;
+    const Sint16 *G = R + map->stride;
+    const Sint16 *B = G + map->stride;
+    const Sint16 *A = B + map->stride;
+    unsigned int smallest = ~0U;
+    Uint8 pixelvalue = 0;
+
+    for (int i = 0; i < map->ncolors; ++i) {
+        const int rd = R[i] - r;
+        const int gd = G[i] - g;
+        const int bd = B[i] - b;
+        const int ad = A[i] - a;
+        const unsigned int distance = (rd * rd) + (gd * gd) + (bd * bd) + (ad * ad);
+        if (distance < smallest) {
+            pixelvalue = (Uint8)i;
+            if (distance == 0) { // Perfect match!
+                break;
+            }
+            smallest = distance;
+        }
+    }
+    return pixelvalue;
+}
+
+// Each lane holds the best match among the colors that passed through it, pick the best of those
+static Uint8 SDL_ReduceColorLanes(const Sint32 *distances, const Uint32 *indices, int lanes)
+{
+    Sint32 smallest = distances[0];
+    Uint32 pixelvalue = indices[0];
+
+    for (int i = 1; i < lanes; ++i) {
+        if (distances[i] < smallest || (distances[i] == smallest && indices[i] < pixelvalue)) {
+            smallest = distances[i];
+            pixelvalue = indices[i];
+        }
+    }
+    return (Uint8)pixelvalue;
+}
+
+#ifdef SDL_SSE2_INTRINSICS
+static Uint8 SDL_TARGETING("sse2") SDL_FindColorInPlanesSSE2(const SDL_PaletteMap *map, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    const Sint16 *R = map->colors;
+    const Sint16 *G = R + map->stride;
+    const Sint16 *B = G + map->stride;
+    const Sint16 *A = B + map->stride;
+    const __m128i want_r = _mm_set1_epi16(r);
+    const __m128i want_g = _mm_set1_epi16(g);
+    const __m128i want_b = _mm_set1_epi16(b);
+    const __m128i want_a = _mm_set1_epi16(a);
+    const __m128i step = _mm_set1_epi32(8);
+    __m128i index_lo = _mm_setr_epi32(0, 1, 2, 3);
+    __m128i index_hi = _mm_setr_epi32(4, 5, 6, 7);
+    __m128i best_lo = _mm_set1_epi32(SDL_MAX_SINT32);
+    __m128i best_hi = best_lo;
+    __m128i best_index_lo = _mm_setzero_si128();
+    __m128i best_index_hi = best_index_lo;
+    SDL_ALIGNED(16) Sint32 distances[8];
+    SDL_ALIGNED(16) Uint32 indices[8];
+
+    for (int i = 0; i < map->stride; i += 8) {
+        const __m128i rd = _mm_sub_epi16(_mm_load_si128((const __m128i *)(R + i)), want_r);
+        const __m128i gd = _mm_sub_epi16(_mm_load_si128((const __m128i *)(G + i)), want_g);
+        const __m128i bd = _mm_sub_epi16(_mm_load_si128((const __m128i *)(B + i)), want_b);
+        const __m128i ad = _mm_sub_epi16(_mm_load_si128((const __m128i *)(A + i)), want_a);
+
+        // Interleave red with green and blue with alpha, so each multiply-add gives two squares per color
+        const __m128i rg_lo = _mm_unpacklo_epi16(rd, gd);
+        const __m128i rg_hi = _mm_unpackhi_epi16(rd, gd);
+        const __m128i ba_lo = _mm_unpacklo_epi16(bd, ad);
+        const __m128i ba_hi = _mm_unpackhi_epi16(bd, ad);
+        const __m128i dist_lo = _mm_add_epi32(_mm_madd_epi16(rg_lo, rg_lo), _mm_madd_epi16(ba_lo, ba_lo));
+        const __m128i dist_hi = _mm_add_epi32(_mm_madd_epi16(rg_hi, rg_hi), _mm_madd_epi16(ba_hi, ba_hi));
+
+        const __m128i closer_lo = _mm_cmplt_epi32(dist_lo, best_lo);
+        const __m128i closer_hi = _mm_cmplt_epi32(dist_hi, best_hi);
+        best_lo = _mm_or_si128(_mm_and_si128(closer_lo, dist_lo), _mm_andnot_si128(closer_lo, best_lo));
+        best_hi = _mm_or_si128(_mm_and_si128(closer_hi, dist_hi), _mm_andnot_si128(closer_hi, best_hi));
+        best_index_lo = _mm_or_si128(_mm_and_si128(closer_lo, index_lo), _mm_andnot_si128(closer_lo, best_index_lo));
+        best_index_hi = _mm_or_si128(_mm_and_si128(closer_hi, index_hi), _mm_andnot_si128(closer_hi, best_index_hi));
+
+        index_lo = _mm_add_epi32(index_lo, step);
+        index_hi = _mm_add_epi32(index_hi, step);
+    }
+
+    _mm_store_si128((__m128i *)&distances[0], best_lo);
+    _mm_store_si128((__m128i *)&distances[4], best_hi);
+    _mm_store_si128((__m128i *)&indices[0], best_index_lo);
+    _mm_store_si128((__m128i *)&indices[4], best_index_hi);
+    return SDL_ReduceColorLanes(distances, indices, 8);
+}
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+static Uint8 SDL_FindColorInPlanesNEON(const SDL_PaletteMap *map, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    const Sint16 *R = map->colors;
+    const Sint16 *G = R + map->stride;
+    const Sint16 *B = G + map->stride;
+    const Sint16 *A = B + map->stride;
+    const int16x8_t want_r = vdupq_n_s16(r);
+    const int16x8_t want_g = vdupq_n_s16(g);
+    const int16x8_t want_b = vdupq_n_s16(b);
+    const int16x8_t want_a = vdupq_n_s16(a);
+    const uint32x4_t step = vdupq_n_u32(8);
+    static const Uint32 first_indices[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+    uint32x4_t index_lo = vld1q_u32(&first_indices[0]);
+    uint32x4_t index_hi = vld1q_u32(&first_indices[4]);
+    int32x4_t best_lo = vdupq_n_s32(SDL_MAX_SINT32);
+    int32x4_t best_hi = best_lo;
+    uint32x4_t best_index_lo = vdupq_n_u32(0);
+    uint32x4_t best_index_hi = best_index_lo;
+    Sint32 distances[8];
+    Uint32 indices[8];
+
+    for (int i = 0; i < map->stride; i += 8) {
+        const int16x8_t rd = vsubq_s16(vld1q_s16(R + i), want_r);
+        const int16x8_t gd = vsubq_s16(vld1q_s16(G + i), want_g);
+        const int16x8_t bd = vsubq_s16(vld1q_s16(B + i), want_b);
+        const int16x8_t ad = vsubq_s16(vld1q_s16(A + i), want_a);
+
+        int32x4_t dist_lo = vmull_s16(vget_low_s16(rd), vget_low_s16(rd));
+        int32x4_t dist_hi = vmull_s16(vget_high_s16(rd), vget_high_s16(rd));
+        dist_lo = vmlal_s16(dist_lo, vget_low_s16(gd), vget_low_s16(gd));
+        dist_hi = vmlal_s16(dist_hi, vget_high_s16(gd), vget_high_s16(gd));
+        dist_lo = vmlal_s16(dist_lo, vget_low_s16(bd), vget_low_s16(bd));
+        dist_hi = vmlal_s16(dist_hi, vget_high_s16(bd), vget_high_s16(bd));
+        dist_lo = vmlal_s16(dist_lo, vget_low_s16(ad), vget_low_s16(ad));
+        dist_hi = vmlal_s16(dist_hi, vget_high_s16(ad), vget_high_s16(ad));
+
+        const uint32x4_t closer_lo = vcltq_s32(dist_lo, best_lo);
+        const uint32x4_t closer_hi = vcltq_s32(dist_hi, best_hi);
+        best_lo = vbslq_s32(closer_lo, dist_lo, best_lo);
+        best_hi = vbslq_s32(closer_hi, dist_hi, best_hi);
+        best_index_lo = vbslq_u32(closer_lo, index_lo, best_index_lo);
+        best_index_hi = vbslq_u32(closer_hi, index_hi, best_index_hi);
+
+        index_lo = vaddq_u32(index_lo, step);
+        index_hi = vaddq_u32(index_hi, step);
+    }
+
+    vst1q_s32(&distances[0], best_lo);
+    vst1q_s32(&distances[4], best_hi);
+    vst1q_u32(&indices[0], best_index_lo);
+    vst1q_u32(&indices[4], best_index_hi);
+    return SDL_ReduceColorLanes(distances, indices, 8);
+}
+#endif
+
+static Uint8 SDL_SearchPaletteMap(const SDL_PaletteMap *map, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        return SDL_FindColorInPlanesSSE2(map, r, g, b, a);
+    }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        return SDL_FindColorInPlanesNEON(map, r, g, b, a);
+    }
+#endif
+    return SDL_FindColorInPlanes(map, r, g, b, a);
+}
+
+static void SDL_BuildPaletteMapCube(SDL_PaletteMap *map)
+{
+    const Sint16 *R = map->colors;
+    const Sint16 *G = R + map->stride;
+    const Sint16 *B = G + map->stride;
+    const Sint16 *A = B + map->stride;
+    const int ncolors = map->ncolors;
+    Uint32 *offsets;
+    Uint8 *candidates;
+    Uint32 *nearest, *farthest;
+    size_t allocated, used = 0;
+
+    offsets = (Uint32 *)SDL_malloc((PALETTE_MAP_CUBE_CELLS + 1) * sizeof(*offsets));
+    allocated = PALETTE_MAP_CUBE_CELLS * 8;
+    candidates = (Uint8 *)SDL_malloc(allocated);
+    nearest = (Uint32 *)SDL_malloc(ncolors * 2 * sizeof(*nearest));
+    if (!offsets || !candidates || !nearest) {
+        goto error;
+    }
+    farthest = nearest + ncolors;
+
+    for (int cell = 0; cell < PALETTE_MAP_CUBE_CELLS; ++cell) {
+        const int lo_r = ((cell >> (2 * PALETTE_MAP_CUBE_BITS)) & (PALETTE_MAP_CUBE_SIZE - 1)) << (8 - PALETTE_MAP_CUBE_BITS);
+        const int lo_g = ((cell >> PALETTE_MAP_CUBE_BITS) & (PALETTE_MAP_CUBE_SIZE - 1)) << (8 - PALETTE_MAP_CUBE_BITS);
+        const int lo_b = (cell & (PALETTE_MAP_CUBE_SIZE - 1)) << (8 - PALETTE_MAP_CUBE_BITS);
+        const int span = (1 << (8 - PALETTE_MAP_CUBE_BITS)) - 1;
+        Uint32 threshold = ~0U;
+
+        // Every color in the cell is at least `nearest` and at most `farthest` away from a palette entry
+        for (int i = 0; i < ncolors; ++i) {
+            const int lo[3] = { lo_r, lo_g, lo_b };
+            const int c[3] = { R[i], G[i], B[i] };
+            const int ad = A[i] - SDL_ALPHA_OPAQUE;
+            Uint32 near_distance = ad * ad;
+            Uint32 far_distance = ad * ad;
+            for (int channel = 0; channel < 3; ++channel) {
+                const int below = lo[channel] - c[channel];
+                const int above = c[channel] - (lo[channel] + span);
+                const int inside = (below > 0) ? below : ((above > 0) ? above : 0);
+                const int outside = SDL_max(SDL_abs(below), SDL_abs(c[channel] - (lo[channel] + span)));
+                near_distance += inside * inside;
+                far_distance += outside * outside;
+            }
+            nearest[i] = near_distance;
+            farthest[i] = far_distance;
+            threshold = SDL_min(threshold, far_distance);
+        }
+
+        if (used + ncolors > allocated) {
+            Uint8 *more;
+            allocated *= 2;
+            more = (Uint8 *)SDL_realloc(candidates, allocated);
+            if (!more) {
+                goto error;
+            }
+            candidates = more;
+        }
+
+        // Anything that can't get within the threshold can never be the nearest
+        offsets[cell] = (Uint32)used;
+        for (int i = 0; i < ncolors; ++i) {
+            if (nearest[i] <= threshold) {
+                candidates[used++] = (Uint8)i;
+            }
+        }
+    }
+    offsets[PALETTE_MAP_CUBE_CELLS] = (Uint32)used;
+
+    SDL_free(nearest);
+    map->cube_offsets = offsets;
+    map->cube_candidates = candidates;
+    return;
+
+error:
+    // We'll just keep searching the whole palette
+    SDL_free(offsets);
+    SDL_free(candidates);
+    SDL_free(nearest);
+}
+
+static Uint8 SDL_SearchPaletteMapCube(const SDL_PaletteMap *map, Uint8 r, Uint8 g, Uint8 b)
+{
+    const Sint16 *R = map->colors;
+    const Sint16 *G = R + map->stride;
+    const Sint16 *B = G + map->stride;
+    const Sint16 *A = B + map->stride;
+    const int cell = ((r >> (8 - PALETTE_MAP_CUBE_BITS)) << (2 * PALETTE_MAP_CUBE_BITS)) |
+                     ((g >> (8 - PALETTE_MAP_CUBE_BITS)) << PALETTE_MAP_CUBE_BITS) |
+                     (b >> (8 - PALETTE_MAP_CUBE_BITS));
+    const Uint8 *candidate = &map->cube_candidates[map->cube_offsets[cell]];
+    const Uint8 *end = &map->cube_candidates[map->cube_offsets[cell + 1]];
+    unsigned int smallest = ~0U;
+    Uint8 pixelvalue = 0;
+
+    for (; candidate != end; ++candidate) {
+        const int i = *candidate;
+        const int rd = R[i] - r;
+        const int gd = G[i] - g;
+        const int bd = B[i] - b;
+        const int ad = A[i] - SDL_ALPHA_OPAQUE;
+        const unsigned int distance = (rd * rd) + (gd * gd) + (bd * bd) + (ad * ad);
+        if (distance < smallest) {
+            pixelvalue = (Uint8)i;
+            if (distance == 0) { // Perfect match!
+                break;
+            }
+            smallest = distance;
+        }
+    }
+    return pixelvalue;
+}
+
+static void SDL_ResetPaletteMap(SDL_PaletteMap *map, const SDL_Palette *pal)
+{
+    SDL_free(map->cube_offsets);
+    map->cube_offsets = NULL;
+    SDL_free(map->cube_candidates);
+    map->cube_candidates = NULL;
+    map->misses = 0;
+    SDL_memset(map->cache, 0, PALETTE_MAP_CACHE_SIZE * sizeof(*map->cache));
+
+    Sint16 *R = map->colors;
+    Sint16 *G = R + map->stride;
+    Sint16 *B = G + map->stride;
+    Sint16 *A = B + map->stride;
+    const int ncolors = SDL_min(pal->ncolors, map->stride);
+    for (int i = 0; i < map->stride; ++i) {
+        if (i < ncolors) {
+            R[i] = pal->colors[i].r;
+            G[i] = pal->colors[i].g;
+            B[i] = pal->colors[i].b;
+            A[i] = pal->colors[i].a;
+        } else {
+            R[i] = G[i] = B[i] = A[i] = PALETTE_MAP_PADDING;
+        }
+    }
+    map->ncolors = ncolors;
+    map->version = pal->version;
+}
+
+SDL_PaletteMap *SDL_CreatePaletteMap(const SDL_Palette *pal)
+{
+    SDL_PaletteMap *map = (SDL_PaletteMap *)SDL_calloc(1, sizeof(*map));
+    if (!map) {
+        return NULL;
+    }
+
+    // Palettes used for blitting never have more than 256 colors, since the indices are bytes
+    map->stride = 256;
+    map->colors = (Sint16 *)SDL_aligned_alloc(SDL_GetSIMDAlignment(), 4 * map->stride * sizeof(*map->colors));
+    map->cache = (Uint64 *)SDL_calloc(PALETTE_MAP_CACHE_SIZE, sizeof(*map->cache));
+    if (!map->colors || !map->cache) {
+        SDL_DestroyPaletteMap(map);
+        return NULL;
+    }
+
+    if (pal) {
+        SDL_ResetPaletteMap(map, pal);
+    }
+    return map;
+}
+
+void SDL_DestroyPaletteMap(SDL_PaletteMap *map)
+{
+    if (map) {
+        SDL_free(map->cache);
+        SDL_aligned_free(map->colors);
+        SDL_free(map->cube_offsets);
+        SDL_free(map->cube_candidates);
+        SDL_free(map);
+    }
+}
+
+Uint8 SDL_LookupRGBAColor(SDL_PaletteMap *palette_map, Uint32 pixelvalue, const SDL_Palette *pal)
 {
     Uint8 color_index = 0;
     if (pal) {
-        const void *value;
-        if (SDL_FindInHashTable(palette_map, (const void *)(uintptr_t)pixelvalue, &value)) {
-            color_index = (Uint8)(uintptr_t)value;
+        if (palette_map->version != pal->version) {
+            SDL_ResetPaletteMap(palette_map, pal);
+        }
+        // The top bits of a multiplicative hash depend on every bit of the pixel
+        Uint64 *entry = &palette_map->cache[(pixelvalue * 0x9E3779B1u) >> (32 - PALETTE_MAP_CACHE_BITS)];
+        if ((*entry >> 8) == ((PALETTE_MAP_CACHE_VALID >> 8) | pixelvalue)) {
+            color_index = (Uint8)*entry;
         } else {
             Uint8 r = (Uint8)((pixelvalue >> 24) & 0xFF);
             Uint8 g = (Uint8)((pixelvalue >> 16) & 0xFF);
             Uint8 b = (Uint8)((pixelvalue >>  8) & 0xFF);
             Uint8 a = (Uint8)((pixelvalue >>  0) & 0xFF);
-            color_index = SDL_FindColor(pal, r, g, b, a);
-            SDL_InsertIntoHashTable(palette_map, (const void *)(uintptr_t)pixelvalue, (const void *)(uintptr_t)color_index, true);
+            if (!palette_map->cube_offsets && ++palette_map->misses == PALETTE_MAP_CUBE_MISSES) {
+                SDL_BuildPaletteMapCube(palette_map);
+            }
+            if (palette_map->cube_offsets && a == SDL_ALPHA_OPAQUE) {
+                color_index = SDL_SearchPaletteMapCube(palette_map, r, g, b);
+            } else {
+                color_index = SDL_SearchPaletteMap(palette_map, r, g, b, a);
+            }
+            *entry = PALETTE_MAP_CACHE_VALID | ((Uint64)pixelvalue << 8) | color_index;
         }
     }
     return color_index;
@@ -1615,7 +1998,7 @@ void SDL_InvalidateMap(SDL_BlitMap *map)
         map->info.table = NULL;
     }
     if (map->info.palette_map) {
-        SDL_DestroyHashTable(map->info.palette_map);
+        SDL_DestroyPaletteMap(map->info.palette_map);
         map->info.palette_map = NULL;
     }
 }
@@ -1671,7 +2054,10 @@ bool SDL_MapSurface(SDL_Surface *src, SDL_Surface *dst)
     } else {
         if (SDL_ISPIXELFORMAT_INDEXED(dstfmt->format)) {
             // BitField --> Palette
-            map->info.palette_map = SDL_CreateHashTable(0, false, SDL_HashID, SDL_KeyMatchID, NULL, NULL);
+            map->info.palette_map = SDL_CreatePaletteMap(dstpal);
+            if (!map->info.palette_map) {
+                return false;
+            }
         } else {
             // BitField --> BitField
             if (srcfmt == dstfmt) {
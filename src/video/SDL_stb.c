@@ -533,6 +533,529 @@ SDL_Surface *SDL_LoadPNG(const char *file)
     return SDL_LoadPNG_IO(stream, true);
 }
 
+#ifdef SDL_HAVE_STB
+/* PNG writer
+
+   The image data is split into strips of rows that are compressed independently and in parallel.
+   Every strip but the last ends byte aligned, with no references back into earlier strips, so the
+   compressed strips can simply be concatenated into one zlib stream. Each strip is written out as
+   its own IDAT chunk as soon as its batch is done, and the stream's Adler-32 checksum is combined
+   from the per-strip checksums and written in a final IDAT chunk.
+
+   Level 0 writes stored deflate blocks and level 1 only encodes runs of repeated bytes with the
+   fixed Huffman codes, neither of which need miniz's compressor. The other levels use miniz.
+ */
+
+#define PNG_STRIP_BYTES (256 * 1024)
+#define PNG_DEFAULT_COMPRESSION_LEVEL 6
+#define PNG_FILTER_NONE 0
+#define PNG_FILTER_SUB 1
+#define PNG_MIN_RUN 3
+#define PNG_MAX_RUN 258
+
+typedef enum PNGCompression
+{
+    PNG_COMPRESSION_STORE,
+    PNG_COMPRESSION_RLE,
+    PNG_COMPRESSION_DEFLATE
+} PNGCompression;
+
+typedef struct PNGStrip
+{
+    tdefl_output_buffer chunk;  // the complete IDAT chunk, including its length, type and CRC
+    Uint32 adler;               // the Adler-32 checksum of the uncompressed strip
+    size_t length;              // the size of the uncompressed strip
+    bool failed;
+} PNGStrip;
+
+typedef struct PNGEncoder
+{
+    const Uint8 *pixels;
+    int pitch;
+    size_t row_size;
+    size_t bpp;
+    int h;
+    int rows_per_strip;
+    int first_strip;
+    PNGCompression compression;
+    int flags;                  // miniz compression flags, for PNG_COMPRESSION_DEFLATE
+    Uint8 filter;
+    Uint8 zlib_header[2];
+    PNGStrip *strips;
+} PNGEncoder;
+
+typedef struct PNGStripState
+{
+    tdefl_output_buffer *chunk;
+    bool last;
+
+    // Stored blocks
+    size_t remaining;           // uncompressed bytes left in the strip
+    size_t block_left;          // uncompressed bytes left in the current block
+
+    // Run-length encoding
+    Uint64 bits;
+    int num_bits;
+    Uint8 buffer[4096];
+    size_t buffered;
+    bool failed;
+    int prev;                   // the last byte written as a literal, or -1 at the start of the strip
+    int run;                    // the number of times prev has been repeated since
+} PNGStripState;
+
+// The fixed Huffman codes, bit reversed so they can be written least significant bit first
+typedef struct PNGHuffmanCode
+{
+    Uint32 bits;
+    Uint8 num_bits;
+} PNGHuffmanCode;
+
+static SDL_InitState png_rle_codes_init;
+static PNGHuffmanCode png_literal_codes[257];
+static PNGHuffmanCode png_run_codes[PNG_MAX_RUN + 1];  // a length code and the distance code for 1
+
+static Uint32 ReversePNGBits(Uint32 code, int num_bits)
+{
+    Uint32 result = 0;
+    for (int i = 0; i < num_bits; ++i) {
+        result = (result << 1) | ((code >> i) & 1);
+    }
+    return result;
+}
+
+static PNGHuffmanCode GetFixedPNGHuffmanCode(int symbol)
+{
+    PNGHuffmanCode code;
+
+    if (symbol < 144) {
+        code.bits = ReversePNGBits(0x30 + symbol, 8);
+        code.num_bits = 8;
+    } else if (symbol < 256) {
+        code.bits = ReversePNGBits(0x190 + (symbol - 144), 9);
+        code.num_bits = 9;
+    } else if (symbol < 280) {
+        code.bits = ReversePNGBits(symbol - 256, 7);
+        code.num_bits = 7;
+    } else {
+        code.bits = ReversePNGBits(0xc0 + (symbol - 280), 8);
+        code.num_bits = 8;
+    }
+    return code;
+}
+
+static void InitPNGRLECodes(void)
+{
+    static const Uint16 length_base[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    static const Uint8 length_extra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+
+    if (SDL_ShouldInit(&png_rle_codes_init)) {
+        for (int i = 0; i <= 256; ++i) {
+            png_literal_codes[i] = GetFixedPNGHuffmanCode(i);
+        }
+        for (int length = PNG_MIN_RUN, i = 0; length <= PNG_MAX_RUN; ++length) {
+            while (i < 28 && length >= length_base[i + 1]) {
+                ++i;
+            }
+            const PNGHuffmanCode code = GetFixedPNGHuffmanCode(257 + i);
+            // The distance code for a distance of 1 is five zero bits, so it's just added to the length
+            png_run_codes[length].bits = code.bits | ((Uint32)(length - length_base[i]) << code.num_bits);
+            png_run_codes[length].num_bits = code.num_bits + length_extra[i] + 5;
+        }
+        SDL_SetInitialized(&png_rle_codes_init, true);
+    }
+}
+
+static void WritePNGUint32(Uint8 *data, Uint32 value)
+{
+    data[0] = (Uint8)(value >> 24);
+    data[1] = (Uint8)(value >> 16);
+    data[2] = (Uint8)(value >> 8);
+    data[3] = (Uint8)(value >> 0);
+}
+
+static bool WritePNGChunk(SDL_IOStream *dst, const char *type, const Uint8 *data, size_t size)
+{
+    Uint8 header[8];
+    Uint8 footer[4];
+    Uint32 crc;
+
+    WritePNGUint32(header, (Uint32)size);
+    SDL_memcpy(&header[4], type, 4);
+    crc = SDL_crc32(0, &header[4], 4);
+    crc = SDL_crc32(crc, data, size);
+    WritePNGUint32(footer, crc);
+
+    return SDL_WriteIO(dst, header, sizeof(header)) == sizeof(header) &&
+           (size == 0 || SDL_WriteIO(dst, data, size) == size) &&
+           SDL_WriteIO(dst, footer, sizeof(footer)) == sizeof(footer);
+}
+
+// Returns the Adler-32 checksum of two buffers joined together, as zlib's adler32_combine() does
+static Uint32 CombinePNGAdler32(Uint32 adler1, Uint32 adler2, size_t length2)
+{
+    const Uint32 BASE = 65521;
+    const Uint32 rem = (Uint32)(length2 % BASE);
+    Uint32 sum1 = adler1 & 0xffff;
+    Uint32 sum2 = (rem * sum1) % BASE;
+
+    sum1 += (adler2 & 0xffff) + BASE - 1;
+    sum2 += (adler1 >> 16) + (adler2 >> 16) + BASE - rem;
+    if (sum1 >= BASE) {
+        sum1 -= BASE;
+    }
+    if (sum1 >= BASE) {
+        sum1 -= BASE;
+    }
+    if (sum2 >= (BASE << 1)) {
+        sum2 -= (BASE << 1);
+    }
+    if (sum2 >= BASE) {
+        sum2 -= BASE;
+    }
+    return sum1 | (sum2 << 16);
+}
+
+// Returns a row of the image with the filter applied, which goes after the filter type byte
+static const Uint8 *FilterPNGRow(const PNGEncoder *encoder, int y, Uint8 *buffer)
+{
+    const Uint8 *row = encoder->pixels + (size_t)y * encoder->pitch;
+
+    if (encoder->filter == PNG_FILTER_SUB) {
+        const size_t bpp = encoder->bpp;
+        SDL_memcpy(buffer, row, bpp);
+        for (size_t i = bpp; i < encoder->row_size; ++i) {
+            buffer[i] = (Uint8)(row[i] - row[i - bpp]);
+        }
+        return buffer;
+    }
+    return row;
+}
+
+// Writes data as stored deflate blocks
+static bool StorePNGData(PNGStripState *state, const Uint8 *data, size_t size)
+{
+    while (size > 0) {
+        if (state->block_left == 0) {
+            Uint8 header[5];
+            state->block_left = SDL_min(state->remaining, 65535);
+            header[0] = (state->last && state->block_left == state->remaining) ? 1 : 0;
+            header[1] = (Uint8)(state->block_left >> 0);
+            header[2] = (Uint8)(state->block_left >> 8);
+            header[3] = (Uint8)~header[1];
+            header[4] = (Uint8)~header[2];
+            if (!tdefl_output_buffer_putter(header, sizeof(header), state->chunk)) {
+                return false;
+            }
+        }
+
+        const size_t amount = SDL_min(size, state->block_left);
+        if (!tdefl_output_buffer_putter(data, (int)amount, state->chunk)) {
+            return false;
+        }
+        data += amount;
+        size -= amount;
+        state->block_left -= amount;
+        state->remaining -= amount;
+    }
+    return true;
+}
+
+static void FlushPNGBits(PNGStripState *state)
+{
+    if (state->buffered > 0) {
+        if (!tdefl_output_buffer_putter(state->buffer, (int)state->buffered, state->chunk)) {
+            state->failed = true;
+        }
+        state->buffered = 0;
+    }
+}
+
+static SDL_INLINE void PutPNGBits(PNGStripState *state, Uint32 bits, int num_bits)
+{
+    state->bits |= (Uint64)bits << state->num_bits;
+    state->num_bits += num_bits;
+    if (state->num_bits >= 32) {
+        if (state->buffered + 4 > sizeof(state->buffer)) {
+            FlushPNGBits(state);
+        }
+        state->buffer[state->buffered++] = (Uint8)(state->bits >> 0);
+        state->buffer[state->buffered++] = (Uint8)(state->bits >> 8);
+        state->buffer[state->buffered++] = (Uint8)(state->bits >> 16);
+        state->buffer[state->buffered++] = (Uint8)(state->bits >> 24);
+        state->bits >>= 32;
+        state->num_bits -= 32;
+    }
+}
+
+// Pads the output to a byte boundary
+static void AlignPNGBits(PNGStripState *state)
+{
+    PutPNGBits(state, 0, (8 - (state->num_bits % 8)) % 8);
+    while (state->num_bits > 0) {
+        if (state->buffered == sizeof(state->buffer)) {
+            FlushPNGBits(state);
+        }
+        state->buffer[state->buffered++] = (Uint8)state->bits;
+        state->bits >>= 8;
+        state->num_bits -= 8;
+    }
+}
+
+static void EndPNGRun(PNGStripState *state)
+{
+    if (state->run >= PNG_MIN_RUN) {
+        PutPNGBits(state, png_run_codes[state->run].bits, png_run_codes[state->run].num_bits);
+    } else {
+        for (int i = 0; i < state->run; ++i) {
+            PutPNGBits(state, png_literal_codes[state->prev].bits, png_literal_codes[state->prev].num_bits);
+        }
+    }
+    state->run = 0;
+}
+
+// Encodes runs of a repeated byte as matches at a distance of 1, and everything else as literals
+static void EncodePNGRuns(PNGStripState *state, const Uint8 *data, size_t size)
+{
+    for (size_t i = 0; i < size; ++i) {
+        const int value = data[i];
+        if (value == state->prev && state->run < PNG_MAX_RUN) {
+            ++state->run;
+        } else {
+            EndPNGRun(state);
+            PutPNGBits(state, png_literal_codes[value].bits, png_literal_codes[value].num_bits);
+            state->prev = value;
+        }
+    }
+}
+
+static bool EncodePNGStrip(const PNGEncoder *encoder, tdefl_compressor *comp, Uint8 *buffer, int index, PNGStrip *strip, PNGStripState *state)
+{
+    static const Uint8 chunk_header[8] = { 0, 0, 0, 0, 'I', 'D', 'A', 'T' };
+    static const Uint8 empty_block[5] = { 1, 0, 0, 0xff, 0xff };
+    static const Uint8 sync_marker[4] = { 0, 0, 0xff, 0xff };
+    const int first_row = index * encoder->rows_per_strip;
+    const int last_row = SDL_min(first_row + encoder->rows_per_strip, encoder->h);
+    mz_ulong adler = MZ_ADLER32_INIT;
+
+    state->chunk = &strip->chunk;
+    state->last = (last_row == encoder->h);
+    state->remaining = (size_t)(last_row - first_row) * (1 + encoder->row_size);
+    state->block_left = 0;
+    strip->length = state->remaining;
+
+    strip->chunk.m_size = 0;
+    strip->chunk.m_expandable = MZ_TRUE;
+    if (!tdefl_output_buffer_putter(chunk_header, sizeof(chunk_header), &strip->chunk)) {
+        return false;
+    }
+    if (index == 0 && !tdefl_output_buffer_putter(encoder->zlib_header, sizeof(encoder->zlib_header), &strip->chunk)) {
+        return false;
+    }
+
+    switch (encoder->compression) {
+    case PNG_COMPRESSION_STORE:
+        for (int y = first_row; y < last_row; ++y) {
+            const Uint8 *row = FilterPNGRow(encoder, y, buffer);
+            if (!StorePNGData(state, &encoder->filter, 1) ||
+                !StorePNGData(state, row, encoder->row_size)) {
+                return false;
+            }
+            adler = mz_adler32(adler, &encoder->filter, 1);
+            adler = mz_adler32(adler, row, encoder->row_size);
+        }
+        if (state->last && strip->length == 0 &&
+            !tdefl_output_buffer_putter(empty_block, sizeof(empty_block), &strip->chunk)) {
+            return false;
+        }
+        break;
+
+    case PNG_COMPRESSION_RLE:
+        state->bits = 0;
+        state->num_bits = 0;
+        state->buffered = 0;
+        state->failed = false;
+        state->prev = -1;
+        state->run = 0;
+
+        PutPNGBits(state, state->last ? 1 : 0, 1);  // BFINAL
+        PutPNGBits(state, 1, 2);                    // BTYPE, fixed Huffman codes
+        for (int y = first_row; y < last_row; ++y) {
+            const Uint8 *row = FilterPNGRow(encoder, y, buffer);
+            EncodePNGRuns(state, &encoder->filter, 1);
+            EncodePNGRuns(state, row, encoder->row_size);
+            adler = mz_adler32(adler, &encoder->filter, 1);
+            adler = mz_adler32(adler, row, encoder->row_size);
+        }
+        EndPNGRun(state);
+        PutPNGBits(state, png_literal_codes[256].bits, png_literal_codes[256].num_bits);
+        if (!state->last) {
+            // An empty stored block brings the stream to a byte boundary, as a full flush would
+            PutPNGBits(state, 0, 3);
+            AlignPNGBits(state);
+            FlushPNGBits(state);
+            if (!tdefl_output_buffer_putter(sync_marker, sizeof(sync_marker), &strip->chunk)) {
+                return false;
+            }
+        } else {
+            AlignPNGBits(state);
+            FlushPNGBits(state);
+        }
+        if (state->failed) {
+            return false;
+        }
+        break;
+
+    case PNG_COMPRESSION_DEFLATE:
+        tdefl_init(comp, tdefl_output_buffer_putter, &strip->chunk, encoder->flags);
+        for (int y = first_row; y < last_row; ++y) {
+            const Uint8 *row = FilterPNGRow(encoder, y, buffer);
+            if (tdefl_compress_buffer(comp, &encoder->filter, 1, TDEFL_NO_FLUSH) < TDEFL_STATUS_OKAY ||
+                tdefl_compress_buffer(comp, row, encoder->row_size, TDEFL_NO_FLUSH) < TDEFL_STATUS_OKAY) {
+                return false;
+            }
+            adler = mz_adler32(adler, &encoder->filter, 1);
+            adler = mz_adler32(adler, row, encoder->row_size);
+        }
+        if (tdefl_compress_buffer(comp, NULL, 0, state->last ? TDEFL_FINISH : TDEFL_FULL_FLUSH) < TDEFL_STATUS_OKAY) {
+            return false;
+        }
+        break;
+    }
+    strip->adler = (Uint32)adler;
+
+    // Fill in the chunk length and CRC
+    const Uint8 crc[4] = { 0, 0, 0, 0 };
+    if (!tdefl_output_buffer_putter(crc, sizeof(crc), &strip->chunk)) {
+        return false;
+    }
+    Uint8 *data = strip->chunk.m_pBuf;
+    const size_t size = strip->chunk.m_size;
+    WritePNGUint32(data, (Uint32)(size - 12));
+    WritePNGUint32(data + size - 4, SDL_crc32(0, data + 4, size - 8));
+    return true;
+}
+
+static void SDLCALL EncodePNGStrips(void *userdata, int start, int end)
+{
+    const PNGEncoder *encoder = (const PNGEncoder *)userdata;
+    tdefl_compressor *comp = NULL;
+    PNGStripState *state = (PNGStripState *)SDL_malloc(sizeof(*state));
+    Uint8 *buffer = (Uint8 *)SDL_malloc(encoder->row_size);
+    bool ok = (state && buffer);
+
+    if (encoder->compression == PNG_COMPRESSION_DEFLATE) {
+        comp = (tdefl_compressor *)SDL_malloc(sizeof(*comp));
+        ok = ok && comp;
+    }
+
+    for (int i = start; i < end; ++i) {
+        PNGStrip *strip = &encoder->strips[i];
+        strip->failed = !ok || !EncodePNGStrip(encoder, comp, buffer, encoder->first_strip + i, strip, state);
+    }
+    SDL_free(buffer);
+    SDL_free(state);
+    SDL_free(comp);
+}
+
+static int GetPNGCompressionFlags(int level)
+{
+    // These are the probe counts miniz uses for its compression levels
+    static const int probes[10] = { 0, 1, 6, 32, 16, 32, 128, 256, 512, 768 };
+
+    level = SDL_clamp(level, 2, 9);
+    return probes[level] | ((level <= 3) ? TDEFL_GREEDY_PARSING_FLAG : 0);
+}
+
+static bool WritePNG(SDL_Surface *surface, SDL_IOStream *dst, int level, const Uint8 *plte, int plte_size, const Uint8 *trns, int trns_size)
+{
+    PNGEncoder encoder;
+    Uint8 ihdr[13];
+    Uint8 adler[4];
+    int num_strips, batch_size;
+    Uint32 checksum = MZ_ADLER32_INIT;
+    bool result = false;
+
+    static const Uint8 signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    if (SDL_WriteIO(dst, signature, sizeof(signature)) != sizeof(signature)) {
+        return false;
+    }
+
+    WritePNGUint32(&ihdr[0], (Uint32)surface->w);
+    WritePNGUint32(&ihdr[4], (Uint32)surface->h);
+    ihdr[8] = 8;                    // bit depth
+    ihdr[9] = plte ? 3 : 6;         // indexed or RGBA color
+    ihdr[10] = 0;                   // deflate compression
+    ihdr[11] = 0;                   // adaptive filtering
+    ihdr[12] = 0;                   // no interlacing
+    if (!WritePNGChunk(dst, "IHDR", ihdr, sizeof(ihdr)) ||
+        (plte && !WritePNGChunk(dst, "PLTE", plte, plte_size)) ||
+        (trns && !WritePNGChunk(dst, "tRNS", trns, trns_size))) {
+        return false;
+    }
+
+    SDL_zero(encoder);
+    encoder.pixels = (const Uint8 *)surface->pixels;
+    encoder.pitch = surface->pitch;
+    encoder.bpp = SDL_BYTESPERPIXEL(surface->format);
+    encoder.row_size = (size_t)surface->w * encoder.bpp;
+    encoder.h = surface->h;
+    encoder.rows_per_strip = (int)SDL_max(1, PNG_STRIP_BYTES / (1 + encoder.row_size));
+    if (level <= 0) {
+        encoder.compression = PNG_COMPRESSION_STORE;
+    } else if (level == 1) {
+        encoder.compression = PNG_COMPRESSION_RLE;
+        InitPNGRLECodes();
+    } else {
+        encoder.compression = PNG_COMPRESSION_DEFLATE;
+        encoder.flags = GetPNGCompressionFlags(level);
+    }
+    // Runs of repeated pixels become runs of zeros after the Sub filter, which is what makes run-length encoding worthwhile
+    encoder.filter = (level == 1 && !plte) ? PNG_FILTER_SUB : PNG_FILTER_NONE;
+    encoder.zlib_header[0] = 0x78;
+    encoder.zlib_header[1] = (level < 2) ? 0x01 : (level < 6) ? 0x5e : (level == 6) ? 0x9c : 0xda;
+
+    // Strips are encoded a batch at a time, to limit how much compressed data is held in memory
+    num_strips = SDL_max(1, (surface->h + encoder.rows_per_strip - 1) / encoder.rows_per_strip);
+    batch_size = SDL_min(num_strips, (SDL_GetNumJobThreads() + 1) * 2);
+    encoder.strips = (PNGStrip *)SDL_calloc(batch_size, sizeof(*encoder.strips));
+    if (!encoder.strips) {
+        return false;
+    }
+
+    for (encoder.first_strip = 0; encoder.first_strip < num_strips; encoder.first_strip += batch_size) {
+        const int count = SDL_min(batch_size, num_strips - encoder.first_strip);
+
+        SDL_ParallelFor(count, 1, EncodePNGStrips, &encoder);
+
+        for (int i = 0; i < count; ++i) {
+            PNGStrip *strip = &encoder.strips[i];
+            if (strip->failed) {
+                SDL_SetError("Failed to compress image data");
+                goto done;
+            }
+            if (SDL_WriteIO(dst, strip->chunk.m_pBuf, strip->chunk.m_size) != strip->chunk.m_size) {
+                goto done;
+            }
+            checksum = CombinePNGAdler32(checksum, strip->adler, strip->length);
+        }
+    }
+
+    WritePNGUint32(adler, checksum);
+    if (!WritePNGChunk(dst, "IDAT", adler, sizeof(adler)) ||
+        !WritePNGChunk(dst, "IEND", NULL, 0)) {
+        goto done;
+    }
+    result = true;
+
+done:
+    for (int i = 0; i < batch_size; ++i) {
+        SDL_free(encoder.strips[i].chunk.m_pBuf);
+    }
+    SDL_free(encoder.strips);
+    return result;
+}
+#endif // SDL_HAVE_STB
+
 bool SDL_SavePNG_IO(SDL_Surface *surface, SDL_IOStream *dst, bool closeio)
 {
     bool retval = false;
@@ -553,6 +1076,7 @@ bool SDL_SavePNG_IO(SDL_Surface *surface, SDL_IOStream *dst, bool closeio)
 #ifdef SDL_HAVE_STB
     int plte_size = 0;
     int trns_size = 0;
+    int level = (int)SDL_GetNumberProperty(surface->props, SDL_PROP_SURFACE_PNG_COMPRESSION_LEVEL_NUMBER, PNG_DEFAULT_COMPRESSION_LEVEL);
 
     if (SDL_ISPIXELFORMAT_INDEXED(surface->format)) {
         if (!surface->palette) {
@@ -592,15 +1116,8 @@ bool SDL_SavePNG_IO(SDL_Surface *surface, SDL_IOStream *dst, bool closeio)
         }
     }
 
-    size_t size = 0;
-    void *png = tdefl_write_image_to_png_file_in_memory_ex(surface->pixels, surface->w, surface->h, SDL_BYTESPERPIXEL(surface->format), surface->pitch, &size, 6, MZ_FALSE, plte, plte_size, trns, trns_size);
-    if (png) {
-        if (SDL_WriteIO(dst, png, size)) {
-            retval = true;
-        }
-        mz_free(png); /* calls SDL_free() */
-    } else {
-        SDL_SetError("Failed to convert and save image");
+    if (WritePNG(surface, dst, level, plte, plte_size, trns, trns_size)) {
+        retval = true;
     }
 
 #else
@@ -22,8 +22,40 @@
 
 #include "SDL_surface_c.h"
 
-static bool SDL_StretchSurfaceUncheckedNearest(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect);
-static bool SDL_StretchSurfaceUncheckedLinear(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect);
+typedef struct bilinear_table_t bilinear_table_t;
+typedef struct cubic_table_t cubic_table_t;
+
+static bool SDL_StretchSurfaceUncheckedNearest(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect, int y0, int y1);
+static bool SDL_StretchSurfaceUncheckedLinear(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect, const bilinear_table_t *table, int y0, int y1);
+static bool SDL_StretchSurfaceUncheckedBicubic(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect, const cubic_table_t *table_w, const cubic_table_t *table_h, int y0, int y1);
+
+typedef struct
+{
+    SDL_Surface *src;
+    const SDL_Rect *srcrect;
+    SDL_Surface *dst;
+    const SDL_Rect *dstrect;
+    SDL_ScaleMode scaleMode;
+    // Built once per blit by SDL_RunStretchBands(), then only read by the bands
+    const bilinear_table_t *bilinear;
+    const cubic_table_t *cubic_w;
+    const cubic_table_t *cubic_h;
+} SDL_StretchBand;
+
+static bool SDL_RunStretchBands(SDL_StretchBand *band);
+
+static bool SDLCALL SDL_StretchSurfaceBand(void *userdata, int y, int h)
+{
+    const SDL_StretchBand *band = (const SDL_StretchBand *)userdata;
+
+    if (band->scaleMode == SDL_SCALEMODE_NEAREST) {
+        return SDL_StretchSurfaceUncheckedNearest(band->src, band->srcrect, band->dst, band->dstrect, y, y + h);
+    } else if (band->scaleMode == SDL_SCALEMODE_BICUBIC) {
+        return SDL_StretchSurfaceUncheckedBicubic(band->src, band->srcrect, band->dst, band->dstrect, band->cubic_w, band->cubic_h, y, y + h);
+    } else {
+        return SDL_StretchSurfaceUncheckedLinear(band->src, band->srcrect, band->dst, band->dstrect, band->bilinear, y, y + h);
+    }
+}
 
 bool SDL_StretchSurface(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect, SDL_ScaleMode scaleMode)
 {
@@ -84,6 +116,7 @@ bool SDL_StretchSurface(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *
     case SDL_SCALEMODE_NEAREST:
         break;
     case SDL_SCALEMODE_LINEAR:
+    case SDL_SCALEMODE_BICUBIC:
         break;
     case SDL_SCALEMODE_PIXELART:
         scaleMode = SDL_SCALEMODE_NEAREST;
@@ -92,7 +125,7 @@ bool SDL_StretchSurface(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *
         return SDL_InvalidParamError("scaleMode");
     }
 
-    if (scaleMode == SDL_SCALEMODE_LINEAR) {
+    if (scaleMode == SDL_SCALEMODE_LINEAR || scaleMode == SDL_SCALEMODE_BICUBIC) {
         if (SDL_BYTESPERPIXEL(src->format) != 4 || src->format == SDL_PIXELFORMAT_ARGB2101010) {
             return SDL_SetError("Wrong format");
         }
@@ -155,11 +188,8 @@ bool SDL_StretchSurface(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *
         src_locked = 1;
     }
 
-    if (scaleMode == SDL_SCALEMODE_NEAREST) {
-        result = SDL_StretchSurfaceUncheckedNearest(src, srcrect, dst, dstrect);
-    } else {
-        result = SDL_StretchSurfaceUncheckedLinear(src, srcrect, dst, dstrect);
-    }
+    SDL_StretchBand band = { src, srcrect, dst, dstrect, scaleMode, NULL, NULL, NULL };
+    result = SDL_RunStretchBands(&band);
 
     // We need to unlock the surfaces if they're locked
     if (dst_locked) {
@@ -200,7 +230,9 @@ bool SDL_StretchSurface(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *
     left_pad_w_init = left_pad_w;                                                     \
     right_pad_w_init = right_pad_w;                                                   \
     dst_gap = dst_pitch - 4 * dst_w;                                                  \
-    middle_init = dst_w - left_pad_w - right_pad_w;
+    middle_init = dst_w - left_pad_w - right_pad_w;                                   \
+    fp_sum_h += (Sint64)y0 * fp_step_h;                                               \
+    dst = (Uint32 *)((Uint8 *)dst + (size_t)y0 * dst_pitch);
 
 #define BILINEAR___HEIGHT                                              \
     int index_h, frac_h0, frac_h1, middle;                             \
@@ -327,11 +359,11 @@ static SDL_INLINE void INTERPOL_BILINEAR(const Uint32 *s0, const Uint32 *s1, int
     INTERPOL(tmp, tmp + 1, frac_w0, frac_w1, dst);
 }
 
-static bool scale_mat(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+static bool scale_mat(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int y0, int y1)
 {
     BILINEAR___START
 
-    for (i = 0; i < dst_h; i++) {
+    for (i = y0; i < y1; i++) {
 
         BILINEAR___HEIGHT
 
@@ -375,6 +407,84 @@ static bool scale_mat(const Uint32 *src, int src_w, int src_h, int src_pitch, Ui
     return true;
 }
 
+#if defined(SDL_AVX2_INTRINSICS) || defined(SDL_NEON_INTRINSICS)
+
+/* The wide kernels look up source positions and weights in a table rather than stepping fp_sum,
+   since the horizontal coefficients are the same for every row.
+   Padding is folded in: the first pair with FRAC_ZERO on the left, the last pair with FRAC_ONE on the right. */
+struct bilinear_table_t
+{
+    Uint32 *index_w; // byte offset of the left source pixel, per destination column
+    Uint32 *frac_w;  // (FRAC_ONE - frac) | (frac << 16), per destination column
+    Uint32 *index_h; // top source row, per destination row
+    Uint32 *frac_h;  // (FRAC_ONE - frac) | (frac << 16), per destination row
+};
+
+static void get_scaler_table(int src_nb, int dst_nb, int stride, Uint32 *index, Uint32 *frac)
+{
+    Sint64 fp_sum;
+    int fp_step, left_pad, right_pad;
+    int i;
+
+    get_scaler_datas(src_nb, dst_nb, &fp_sum, &fp_step, &left_pad, &right_pad);
+    fp_sum += (Sint64)left_pad * fp_step;
+
+    for (i = 0; i < dst_nb; i++) {
+        Uint32 f;
+        if (i < left_pad) {
+            index[i] = 0;
+            f = FRAC_ZERO;
+        } else if (i >= dst_nb - right_pad) {
+            index[i] = stride * (src_nb - 2);
+            f = FRAC_ONE;
+        } else {
+            index[i] = stride * SRC_INDEX(fp_sum);
+            f = FRAC(fp_sum);
+            fp_sum += fp_step;
+        }
+        frac[i] = (FRAC_ONE - f) | (f << 16);
+    }
+}
+
+static bool get_bilinear_table(int src_w, int src_h, int dst_w, int dst_h, bilinear_table_t *table)
+{
+    Uint32 *data;
+
+    // Every destination pixel reads a 2x2 block, so smaller sources are left to the other kernels
+    if (src_w < 2 || src_h < 2) {
+        return false;
+    }
+
+    data = (Uint32 *)SDL_malloc(2 * ((size_t)dst_w + dst_h) * sizeof(Uint32));
+    if (!data) {
+        return false;
+    }
+    table->index_w = data;
+    table->frac_w = table->index_w + dst_w;
+    table->index_h = table->frac_w + dst_w;
+    table->frac_h = table->index_h + dst_h;
+
+    get_scaler_table(src_w, dst_w, 4, table->index_w, table->frac_w);
+    get_scaler_table(src_h, dst_h, 1, table->index_h, table->frac_h);
+    return true;
+}
+
+// One pixel with the same arithmetic as the wide kernels, which keep the full precision of the vertical pass
+static SDL_INLINE void INTERPOL_BILINEAR_TABLE(const Uint8 *s0, const Uint8 *s1, Uint32 frac_w, int frac_h0, int frac_h1, Uint8 *dst)
+{
+    const int f2 = frac_w & 0xFFFF;
+    const int f = frac_w >> 16;
+    int c;
+
+    for (c = 0; c < 4; c++) {
+        const int k0 = s0[c] * frac_h1 + s1[c] * frac_h0;
+        const int k1 = s0[c + 4] * frac_h1 + s1[c + 4] * frac_h0;
+        dst[c] = (Uint8)((k0 * f2 + k1 * f) >> (2 * PRECISION));
+    }
+}
+
+#endif // SDL_AVX2_INTRINSICS || SDL_NEON_INTRINSICS
+
 #ifdef SDL_SSE2_INTRINSICS
 
 #if 0
@@ -433,11 +543,11 @@ static SDL_INLINE void SDL_TARGETING("sse2") INTERPOL_BILINEAR_SSE(const Uint32
     *dst = _mm_cvtsi128_si32(e0);
 }
 
-static bool SDL_TARGETING("sse2") scale_mat_SSE(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+static bool SDL_TARGETING("sse2") scale_mat_SSE(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int y0, int y1)
 {
     BILINEAR___START
 
-    for (i = 0; i < dst_h; i++) {
+    for (i = y0; i < y1; i++) {
         int nb_block2;
         __m128i v_frac_h0;
         __m128i v_frac_h1;
@@ -553,269 +663,172 @@ static bool SDL_TARGETING("sse2") scale_mat_SSE(const Uint32 *src, int src_w, in
 }
 #endif
 
-#ifdef SDL_NEON_INTRINSICS
+#ifdef SDL_AVX2_INTRINSICS
 
-static SDL_INLINE int hasNEON(void)
+static SDL_INLINE int hasAVX2(void)
 {
     static int val = -1;
     if (val != -1) {
         return val;
     }
-    val = SDL_HasNEON();
+    val = SDL_HasAVX2();
     return val;
 }
 
-static SDL_INLINE void INTERPOL_BILINEAR_NEON(const Uint32 *s0, const Uint32 *s1, int frac_w, uint8x8_t v_frac_h0, uint8x8_t v_frac_h1, Uint32 *dst)
+// Interpolate 4 destination columns, { 0, 1 } in the low lane and { 2, 3 } in the high lane, as 16 bits per channel
+static SDL_INLINE __m256i SDL_TARGETING("avx2") INTERPOL_BILINEAR_AVX2_X4(const Uint8 *s0, const Uint8 *s1, const Uint32 *index_w, const Uint32 *frac_w, __m256i v_frac_h0, __m256i v_frac_h1)
 {
-    uint8x8_t x_00_01, x_10_11; /* Pixels in 4*uint8 in row */
-    uint16x8_t k0;
-    uint32x4_t l0;
-    uint16x8_t d0;
-    uint8x8_t e0;
-
-    x_00_01 = vreinterpret_u8_u32(vld1_u32(s0)); // Load 2 pixels
-    x_10_11 = vreinterpret_u8_u32(vld1_u32(s1));
+    const __m256i zero = _mm256_setzero_si256();
+    __m128i lo, hi;
+    __m256i x0, x1, k_02, k_13, w_02, w_13;
+
+    // Load the pixel pair of each column, from both rows
+    lo = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)(s0 + index_w[0])), _mm_loadl_epi64((const __m128i *)(s0 + index_w[1])));
+    hi = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)(s0 + index_w[2])), _mm_loadl_epi64((const __m128i *)(s0 + index_w[3])));
+    x0 = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+    lo = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)(s1 + index_w[0])), _mm_loadl_epi64((const __m128i *)(s1 + index_w[1])));
+    hi = _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)(s1 + index_w[2])), _mm_loadl_epi64((const __m128i *)(s1 + index_w[3])));
+    x1 = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
 
     /* Interpolated == x0 + frac * (x1 - x0) == x0 * (1 - frac) + x1 * frac */
-    k0 = vmull_u8(x_00_01, v_frac_h1);     /* k0 := x0 * (1 - frac)    */
-    k0 = vmlal_u8(k0, x_10_11, v_frac_h0); /* k0 += x1 * frac          */
-
-    // k0 now contains 2 interpolated pixels { j0, j1 }
-    l0 = vshll_n_u16(vget_low_u16(k0), PRECISION);
-    l0 = vmlsl_n_u16(l0, vget_low_u16(k0), frac_w);
-    l0 = vmlal_n_u16(l0, vget_high_u16(k0), frac_w);
-
-    // Shift and narrow
-    d0 = vcombine_u16(
-        /* uint16x4_t */ vshrn_n_u32(l0, 2 * PRECISION),
-        /* uint16x4_t */ vshrn_n_u32(l0, 2 * PRECISION));
-
-    // Narrow again
-    e0 = vmovn_u16(d0);
 
-    // Store 1 pixel
-    *dst = vget_lane_u32(vreinterpret_u32_u8(e0), 0);
+    // Interpolation vertical, columns 0 and 2 are in the low half of each lane, 1 and 3 in the high half
+    k_02 = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(x0, zero), v_frac_h1),
+                            _mm256_mullo_epi16(_mm256_unpacklo_epi8(x1, zero), v_frac_h0));
+    k_13 = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(x0, zero), v_frac_h1),
+                            _mm256_mullo_epi16(_mm256_unpackhi_epi8(x1, zero), v_frac_h0));
+
+    // Interpolation horizontal, each channel of the left pixel next to the same channel of the right pixel
+    w_02 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_set1_epi32((int)frac_w[0])), _mm_set1_epi32((int)frac_w[2]), 1);
+    w_13 = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_set1_epi32((int)frac_w[1])), _mm_set1_epi32((int)frac_w[3]), 1);
+    k_02 = _mm256_madd_epi16(_mm256_unpacklo_epi16(k_02, _mm256_srli_si256(k_02, 8)), w_02);
+    k_13 = _mm256_madd_epi16(_mm256_unpacklo_epi16(k_13, _mm256_srli_si256(k_13, 8)), w_13);
+
+    k_02 = _mm256_srli_epi32(k_02, PRECISION * 2);
+    k_13 = _mm256_srli_epi32(k_13, PRECISION * 2);
+    return _mm256_packs_epi32(k_02, k_13);
 }
 
-static bool scale_mat_NEON(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+static bool SDL_TARGETING("avx2") scale_mat_AVX2(const Uint32 *src, int src_pitch, Uint32 *dst, int dst_w, int dst_pitch, const bilinear_table_t *table, int y0, int y1)
 {
-    BILINEAR___START
-
-    for (i = 0; i < dst_h; i++) {
-        int nb_block4;
-        uint8x8_t v_frac_h0, v_frac_h1;
-
-        BILINEAR___HEIGHT
-
-        nb_block4 = middle / 4;
-
-        v_frac_h0 = vmov_n_u8(frac_h0);
-        v_frac_h1 = vmov_n_u8(frac_h1);
-
-        while (left_pad_w--) {
-            INTERPOL_BILINEAR_NEON(src_h0, src_h1, FRAC_ZERO, v_frac_h0, v_frac_h1, dst);
-            dst += 1;
+    int i, j;
+
+    for (i = y0; i < y1; i++) {
+        const Uint8 *s0 = (const Uint8 *)src + (size_t)table->index_h[i] * src_pitch;
+        const Uint8 *s1 = s0 + src_pitch;
+        const int frac_h0 = table->frac_h[i] >> 16;
+        const int frac_h1 = table->frac_h[i] & 0xFFFF;
+        const __m256i v_frac_h0 = _mm256_set1_epi16((short)frac_h0);
+        const __m256i v_frac_h1 = _mm256_set1_epi16((short)frac_h1);
+        Uint32 *d = (Uint32 *)((Uint8 *)dst + (size_t)i * dst_pitch);
+
+        for (j = 0; j + 8 <= dst_w; j += 8) {
+            __m256i e0 = INTERPOL_BILINEAR_AVX2_X4(s0, s1, table->index_w + j, table->frac_w + j, v_frac_h0, v_frac_h1);
+            __m256i e1 = INTERPOL_BILINEAR_AVX2_X4(s0, s1, table->index_w + j + 4, table->frac_w + j + 4, v_frac_h0, v_frac_h1);
+
+            // Narrow to columns { 0, 1, 4, 5 | 2, 3, 6, 7 }, put them back in order and store 8 pixels
+            e0 = _mm256_packus_epi16(e0, e1);
+            e0 = _mm256_permute4x64_epi64(e0, _MM_SHUFFLE(3, 1, 2, 0));
+            _mm256_storeu_si256((__m256i *)(d + j), e0);
         }
 
-        while (nb_block4--) {
-            int index_w_0, frac_w_0;
-            int index_w_1, frac_w_1;
-            int index_w_2, frac_w_2;
-            int index_w_3, frac_w_3;
-
-            const Uint32 *s_00_01, *s_02_03, *s_04_05, *s_06_07;
-            const Uint32 *s_10_11, *s_12_13, *s_14_15, *s_16_17;
-
-            uint8x8_t x_00_01, x_10_11, x_02_03, x_12_13; /* Pixels in 4*uint8 in row */
-            uint8x8_t x_04_05, x_14_15, x_06_07, x_16_17;
-
-            uint16x8_t k0, k1, k2, k3;
-            uint32x4_t l0, l1, l2, l3;
-            uint16x8_t d0, d1;
-            uint8x8_t e0, e1;
-            uint32x4_t f0;
-
-            index_w_0 = 4 * SRC_INDEX(fp_sum_w);
-            frac_w_0 = FRAC(fp_sum_w);
-            fp_sum_w += fp_step_w;
-            index_w_1 = 4 * SRC_INDEX(fp_sum_w);
-            frac_w_1 = FRAC(fp_sum_w);
-            fp_sum_w += fp_step_w;
-            index_w_2 = 4 * SRC_INDEX(fp_sum_w);
-            frac_w_2 = FRAC(fp_sum_w);
-            fp_sum_w += fp_step_w;
-            index_w_3 = 4 * SRC_INDEX(fp_sum_w);
-            frac_w_3 = FRAC(fp_sum_w);
-            fp_sum_w += fp_step_w;
-
-            s_00_01 = (const Uint32 *)((const Uint8 *)src_h0 + index_w_0);
-            s_02_03 = (const Uint32 *)((const Uint8 *)src_h0 + index_w_1);
-            s_04_05 = (const Uint32 *)((const Uint8 *)src_h0 + index_w_2);
-            s_06_07 = (const Uint32 *)((const Uint8 *)src_h0 + index_w_3);
-            s_10_11 = (const Uint32 *)((const Uint8 *)src_h1 + index_w_0);
-            s_12_13 = (const Uint32 *)((const Uint8 *)src_h1 + index_w_1);
-            s_14_15 = (const Uint32 *)((const Uint8 *)src_h1 + index_w_2);
-            s_16_17 = (const Uint32 *)((const Uint8 *)src_h1 + index_w_3);
-
-            // Interpolation vertical
-            x_00_01 = vreinterpret_u8_u32(vld1_u32(s_00_01)); // Load 2 pixels
-            x_02_03 = vreinterpret_u8_u32(vld1_u32(s_02_03));
-            x_04_05 = vreinterpret_u8_u32(vld1_u32(s_04_05));
-            x_06_07 = vreinterpret_u8_u32(vld1_u32(s_06_07));
-            x_10_11 = vreinterpret_u8_u32(vld1_u32(s_10_11));
-            x_12_13 = vreinterpret_u8_u32(vld1_u32(s_12_13));
-            x_14_15 = vreinterpret_u8_u32(vld1_u32(s_14_15));
-            x_16_17 = vreinterpret_u8_u32(vld1_u32(s_16_17));
-
-            /* Interpolated == x0 + frac * (x1 - x0) == x0 * (1 - frac) + x1 * frac */
-            k0 = vmull_u8(x_00_01, v_frac_h1);     /* k0 := x0 * (1 - frac)    */
-            k0 = vmlal_u8(k0, x_10_11, v_frac_h0); /* k0 += x1 * frac          */
-
-            k1 = vmull_u8(x_02_03, v_frac_h1);
-            k1 = vmlal_u8(k1, x_12_13, v_frac_h0);
-
-            k2 = vmull_u8(x_04_05, v_frac_h1);
-            k2 = vmlal_u8(k2, x_14_15, v_frac_h0);
-
-            k3 = vmull_u8(x_06_07, v_frac_h1);
-            k3 = vmlal_u8(k3, x_16_17, v_frac_h0);
-
-            // k0 now contains 2 interpolated pixels { j0, j1 }
-            // k1 now contains 2 interpolated pixels { j2, j3 }
-            // k2 now contains 2 interpolated pixels { j4, j5 }
-            // k3 now contains 2 interpolated pixels { j6, j7 }
-
-            l0 = vshll_n_u16(vget_low_u16(k0), PRECISION);
-            l0 = vmlsl_n_u16(l0, vget_low_u16(k0), frac_w_0);
-            l0 = vmlal_n_u16(l0, vget_high_u16(k0), frac_w_0);
-
-            l1 = vshll_n_u16(vget_low_u16(k1), PRECISION);
-            l1 = vmlsl_n_u16(l1, vget_low_u16(k1), frac_w_1);
-            l1 = vmlal_n_u16(l1, vget_high_u16(k1), frac_w_1);
-
-            l2 = vshll_n_u16(vget_low_u16(k2), PRECISION);
-            l2 = vmlsl_n_u16(l2, vget_low_u16(k2), frac_w_2);
-            l2 = vmlal_n_u16(l2, vget_high_u16(k2), frac_w_2);
-
-            l3 = vshll_n_u16(vget_low_u16(k3), PRECISION);
-            l3 = vmlsl_n_u16(l3, vget_low_u16(k3), frac_w_3);
-            l3 = vmlal_n_u16(l3, vget_high_u16(k3), frac_w_3);
-
-            // shift and narrow
-            d0 = vcombine_u16(
-                /* uint16x4_t */ vshrn_n_u32(l0, 2 * PRECISION),
-                /* uint16x4_t */ vshrn_n_u32(l1, 2 * PRECISION));
-            // narrow again
-            e0 = vmovn_u16(d0);
-
-            // Shift and narrow
-            d1 = vcombine_u16(
-                /* uint16x4_t */ vshrn_n_u32(l2, 2 * PRECISION),
-                /* uint16x4_t */ vshrn_n_u32(l3, 2 * PRECISION));
-            // Narrow again
-            e1 = vmovn_u16(d1);
-
-            f0 = vcombine_u32(vreinterpret_u32_u8(e0), vreinterpret_u32_u8(e1));
-            // Store 4 pixels
-            vst1q_u32(dst, f0);
-
-            dst += 4;
+        for (; j < dst_w; j++) {
+            INTERPOL_BILINEAR_TABLE(s0 + table->index_w[j], s1 + table->index_w[j], table->frac_w[j], frac_h0, frac_h1, (Uint8 *)(d + j));
         }
+    }
 
-        if (middle & 0x2) {
-            int index_w_0, frac_w_0;
-            int index_w_1, frac_w_1;
-            const Uint32 *s_00_01, *s_02_03;
-            const Uint32 *s_10_11, *s_12_13;
-            uint8x8_t x_00_01, x_10_11, x_02_03, x_12_13; /* Pixels in 4*uint8 in row */
-            uint16x8_t k0, k1;
-            uint32x4_t l0, l1;
-            uint16x8_t d0;
-            uint8x8_t e0;
-
-            index_w_0 = 4 * SRC_INDEX(fp_sum_w);
-            frac_w_0 = FRAC(fp_sum_w);
-            fp_sum_w += fp_step_w;
-            index_w_1 = 4 * SRC_INDEX(fp_sum_w);
-            frac_w_1 = FRAC(fp_sum_w);
-            fp_sum_w += fp_step_w;
-            /*
-                        x00............ x01   x02...........x03
-                        .      .         .     .       .     .
-                        j0   dest0       j1    j2    dest1   j3
-                        .      .         .     .       .     .
-                        .      .         .     .       .     .
-                        .      .         .     .       .     .
-                        x10............ x11   x12...........x13
-            */
-            s_00_01 = (const Uint32 *)((const Uint8 *)src_h0 + index_w_0);
-            s_02_03 = (const Uint32 *)((const Uint8 *)src_h0 + index_w_1);
-            s_10_11 = (const Uint32 *)((const Uint8 *)src_h1 + index_w_0);
-            s_12_13 = (const Uint32 *)((const Uint8 *)src_h1 + index_w_1);
-
-            // Interpolation vertical
-            x_00_01 = vreinterpret_u8_u32(vld1_u32(s_00_01)); // Load 2 pixels
-            x_02_03 = vreinterpret_u8_u32(vld1_u32(s_02_03));
-            x_10_11 = vreinterpret_u8_u32(vld1_u32(s_10_11));
-            x_12_13 = vreinterpret_u8_u32(vld1_u32(s_12_13));
-
-            /* Interpolated == x0 + frac * (x1 - x0) == x0 * (1 - frac) + x1 * frac */
-            k0 = vmull_u8(x_00_01, v_frac_h1);     /* k0 := x0 * (1 - frac)    */
-            k0 = vmlal_u8(k0, x_10_11, v_frac_h0); /* k0 += x1 * frac          */
-
-            k1 = vmull_u8(x_02_03, v_frac_h1);
-            k1 = vmlal_u8(k1, x_12_13, v_frac_h0);
+    return true;
+}
+#endif
 
-            // k0 now contains 2 interpolated pixels { j0, j1 }
-            // k1 now contains 2 interpolated pixels { j2, j3 }
+#ifdef SDL_NEON_INTRINSICS
 
-            l0 = vshll_n_u16(vget_low_u16(k0), PRECISION);
-            l0 = vmlsl_n_u16(l0, vget_low_u16(k0), frac_w_0);
-            l0 = vmlal_n_u16(l0, vget_high_u16(k0), frac_w_0);
+static SDL_INLINE int hasNEON(void)
+{
+    static int val = -1;
+    if (val != -1) {
+        return val;
+    }
+    val = SDL_HasNEON();
+    return val;
+}
 
-            l1 = vshll_n_u16(vget_low_u16(k1), PRECISION);
-            l1 = vmlsl_n_u16(l1, vget_low_u16(k1), frac_w_1);
-            l1 = vmlal_n_u16(l1, vget_high_u16(k1), frac_w_1);
+// Interpolate one destination column, as 32 bits per channel scaled by FRAC_ONE * FRAC_ONE
+static SDL_INLINE uint32x4_t INTERPOL_BILINEAR_NEON(const Uint8 *s0, const Uint8 *s1, Uint32 frac_w, uint8x8_t v_frac_h0, uint8x8_t v_frac_h1)
+{
+    const uint16_t f = (uint16_t)(frac_w >> 16);
+    uint8x8_t x_00_01, x_10_11; /* Pixels in 4*uint8 in row */
+    uint16x8_t k0;
+    uint32x4_t l0;
 
-            // Shift and narrow
+    x_00_01 = vld1_u8(s0); // Load 2 pixels
+    x_10_11 = vld1_u8(s1);
 
-            d0 = vcombine_u16(
-                /* uint16x4_t */ vshrn_n_u32(l0, 2 * PRECISION),
-                /* uint16x4_t */ vshrn_n_u32(l1, 2 * PRECISION));
+    /* Interpolated == x0 + frac * (x1 - x0) == x0 * (1 - frac) + x1 * frac */
+    k0 = vmull_u8(x_00_01, v_frac_h1);     /* k0 := x0 * (1 - frac)    */
+    k0 = vmlal_u8(k0, x_10_11, v_frac_h0); /* k0 += x1 * frac          */
 
-            // Narrow again
-            e0 = vmovn_u16(d0);
+    // k0 now contains 2 interpolated pixels { j0, j1 }
+    l0 = vshll_n_u16(vget_low_u16(k0), PRECISION);
+    l0 = vmlsl_n_u16(l0, vget_low_u16(k0), f);
+    l0 = vmlal_n_u16(l0, vget_high_u16(k0), f);
+    return l0;
+}
 
-            // Store 2 pixels
-            vst1_u32(dst, vreinterpret_u32_u8(e0));
-            dst += 2;
-        }
+// Shift and narrow 2 interpolated columns to 2 pixels
+static SDL_INLINE uint8x8_t NARROW_BILINEAR_NEON(uint32x4_t l0, uint32x4_t l1)
+{
+    return vmovn_u16(vcombine_u16(vshrn_n_u32(l0, 2 * PRECISION), vshrn_n_u32(l1, 2 * PRECISION)));
+}
 
-        // Last point
-        if (middle & 0x1) {
-            int index_w = 4 * SRC_INDEX(fp_sum_w);
-            int frac_w = FRAC(fp_sum_w);
-            const Uint32 *s_00_01 = (const Uint32 *)((const Uint8 *)src_h0 + index_w);
-            const Uint32 *s_10_11 = (const Uint32 *)((const Uint8 *)src_h1 + index_w);
-            INTERPOL_BILINEAR_NEON(s_00_01, s_10_11, frac_w, v_frac_h0, v_frac_h1, dst);
-            dst += 1;
+static bool scale_mat_NEON(const Uint32 *src, int src_pitch, Uint32 *dst, int dst_w, int dst_pitch, const bilinear_table_t *table, int y0, int y1)
+{
+    int i, j;
+
+    for (i = y0; i < y1; i++) {
+        const Uint8 *s0 = (const Uint8 *)src + (size_t)table->index_h[i] * src_pitch;
+        const Uint8 *s1 = s0 + src_pitch;
+        const int frac_h0 = table->frac_h[i] >> 16;
+        const int frac_h1 = table->frac_h[i] & 0xFFFF;
+        const uint8x8_t v_frac_h0 = vmov_n_u8((uint8_t)frac_h0);
+        const uint8x8_t v_frac_h1 = vmov_n_u8((uint8_t)frac_h1);
+        Uint32 *d = (Uint32 *)((Uint8 *)dst + (size_t)i * dst_pitch);
+
+        for (j = 0; j + 8 <= dst_w; j += 8) {
+            const Uint32 *index_w = table->index_w + j;
+            const Uint32 *frac_w = table->frac_w + j;
+            uint32x4_t l0, l1, l2, l3, l4, l5, l6, l7;
+            uint8x8_t e0, e1, e2, e3;
+
+            l0 = INTERPOL_BILINEAR_NEON(s0 + index_w[0], s1 + index_w[0], frac_w[0], v_frac_h0, v_frac_h1);
+            l1 = INTERPOL_BILINEAR_NEON(s0 + index_w[1], s1 + index_w[1], frac_w[1], v_frac_h0, v_frac_h1);
+            l2 = INTERPOL_BILINEAR_NEON(s0 + index_w[2], s1 + index_w[2], frac_w[2], v_frac_h0, v_frac_h1);
+            l3 = INTERPOL_BILINEAR_NEON(s0 + index_w[3], s1 + index_w[3], frac_w[3], v_frac_h0, v_frac_h1);
+            l4 = INTERPOL_BILINEAR_NEON(s0 + index_w[4], s1 + index_w[4], frac_w[4], v_frac_h0, v_frac_h1);
+            l5 = INTERPOL_BILINEAR_NEON(s0 + index_w[5], s1 + index_w[5], frac_w[5], v_frac_h0, v_frac_h1);
+            l6 = INTERPOL_BILINEAR_NEON(s0 + index_w[6], s1 + index_w[6], frac_w[6], v_frac_h0, v_frac_h1);
+            l7 = INTERPOL_BILINEAR_NEON(s0 + index_w[7], s1 + index_w[7], frac_w[7], v_frac_h0, v_frac_h1);
+
+            e0 = NARROW_BILINEAR_NEON(l0, l1);
+            e1 = NARROW_BILINEAR_NEON(l2, l3);
+            e2 = NARROW_BILINEAR_NEON(l4, l5);
+            e3 = NARROW_BILINEAR_NEON(l6, l7);
+
+            // Store 8 pixels
+            vst1q_u8((Uint8 *)(d + j), vcombine_u8(e0, e1));
+            vst1q_u8((Uint8 *)(d + j + 4), vcombine_u8(e2, e3));
         }
 
-        while (right_pad_w--) {
-            int index_w = 4 * (src_w - 2);
-            const Uint32 *s_00_01 = (const Uint32 *)((const Uint8 *)src_h0 + index_w);
-            const Uint32 *s_10_11 = (const Uint32 *)((const Uint8 *)src_h1 + index_w);
-            INTERPOL_BILINEAR_NEON(s_00_01, s_10_11, FRAC_ONE, v_frac_h0, v_frac_h1, dst);
-            dst += 1;
+        for (; j < dst_w; j++) {
+            INTERPOL_BILINEAR_TABLE(s0 + table->index_w[j], s1 + table->index_w[j], table->frac_w[j], frac_h0, frac_h1, (Uint8 *)(d + j));
         }
-
-        dst = (Uint32 *)((Uint8 *)dst + dst_gap);
     }
+
     return true;
 }
 #endif
 
-bool SDL_StretchSurfaceUncheckedLinear(SDL_Surface *s, const SDL_Rect *srcrect, SDL_Surface *d, const SDL_Rect *dstrect)
+bool SDL_StretchSurfaceUncheckedLinear(SDL_Surface *s, const SDL_Rect *srcrect, SDL_Surface *d, const SDL_Rect *dstrect, const bilinear_table_t *table, int y0, int y1)
 {
     bool result = false;
     int src_w = srcrect->w;
@@ -828,24 +841,196 @@ bool SDL_StretchSurfaceUncheckedLinear(SDL_Surface *s, const SDL_Rect *srcrect,
     Uint32 *dst = (Uint32 *)((Uint8 *)d->pixels + dstrect->x * 4 + dstrect->y * dst_pitch);
 
 #ifdef SDL_NEON_INTRINSICS
-    if (!result && hasNEON()) {
-        result = scale_mat_NEON(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+    if (!result && table && hasNEON()) {
+        result = scale_mat_NEON(src, src_pitch, dst, dst_w, dst_pitch, table, y0, y1);
+    }
+#endif
+
+#ifdef SDL_AVX2_INTRINSICS
+    if (!result && table && hasAVX2()) {
+        result = scale_mat_AVX2(src, src_pitch, dst, dst_w, dst_pitch, table, y0, y1);
     }
 #endif
 
 #ifdef SDL_SSE2_INTRINSICS
     if (!result && hasSSE2()) {
-        result = scale_mat_SSE(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        result = scale_mat_SSE(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch, y0, y1);
     }
 #endif
 
     if (!result) {
-        result = scale_mat(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        result = scale_mat(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch, y0, y1);
     }
 
     return result;
 }
 
+/* Bicubic filtering is separable: each destination row is a weighted sum of source rows,
+   which is then filtered horizontally. When downscaling, the kernel is widened to cover
+   every source pixel under the destination pixel, instead of skipping over them. */
+struct cubic_table_t
+{
+    int taps;
+    int *index;    // source pixel of each tap, clamped to the edges
+    float *weight; // normalized weight of each tap
+};
+
+// Catmull-Rom spline (B = 0, C = 1/2)
+static float cubic_weight(float x)
+{
+    x = SDL_fabsf(x);
+    if (x < 1.0f) {
+        return (1.5f * x - 2.5f) * x * x + 1.0f;
+    } else if (x < 2.0f) {
+        return ((-0.5f * x + 2.5f) * x - 4.0f) * x + 2.0f;
+    }
+    return 0.0f;
+}
+
+static bool get_cubic_table(int src_nb, int dst_nb, cubic_table_t *table)
+{
+    const float scale = (float)src_nb / dst_nb;
+    const float filter_scale = SDL_max(scale, 1.0f);
+    const float support = 2.0f * filter_scale;
+    const int taps = (int)SDL_ceilf(2.0f * support) + 1;
+    int i, t;
+
+    table->taps = taps;
+    table->index = (int *)SDL_malloc((size_t)dst_nb * taps * sizeof(int));
+    table->weight = (float *)SDL_malloc((size_t)dst_nb * taps * sizeof(float));
+    if (!table->index || !table->weight) {
+        return false;
+    }
+
+    for (i = 0; i < dst_nb; i++) {
+        const float center = (i + 0.5f) * scale - 0.5f;
+        const int first = (int)SDL_floorf(center - support) + 1;
+        int *index = table->index + i * taps;
+        float *weight = table->weight + i * taps;
+        float sum = 0.0f;
+
+        for (t = 0; t < taps; t++) {
+            weight[t] = cubic_weight((first + t - center) / filter_scale);
+            index[t] = SDL_clamp(first + t, 0, src_nb - 1);
+            sum += weight[t];
+        }
+        for (t = 0; t < taps; t++) {
+            weight[t] /= sum;
+        }
+    }
+    return true;
+}
+
+static SDL_INLINE Uint8 cubic_pixel(float v)
+{
+    // The spline overshoots around sharp edges
+    const int i = (int)(v + 0.5f);
+    return (Uint8)SDL_clamp(i, 0, 255);
+}
+
+bool SDL_StretchSurfaceUncheckedBicubic(SDL_Surface *s, const SDL_Rect *srcrect, SDL_Surface *d, const SDL_Rect *dstrect, const cubic_table_t *table_w, const cubic_table_t *table_h, int y0, int y1)
+{
+    int src_w = srcrect->w;
+    int dst_w = dstrect->w;
+    int src_pitch = s->pitch;
+    int dst_pitch = d->pitch;
+    const Uint8 *src = (const Uint8 *)s->pixels + srcrect->x * 4 + srcrect->y * src_pitch;
+    Uint8 *dst = (Uint8 *)d->pixels + dstrect->x * 4 + dstrect->y * dst_pitch;
+    float *row;
+    int i, j, t, x;
+
+    row = (float *)SDL_malloc((size_t)src_w * 4 * sizeof(float));
+    if (!row) {
+        return false;
+    }
+
+    for (i = y0; i < y1; i++) {
+        const int *index_h = table_h->index + i * table_h->taps;
+        const float *weight_h = table_h->weight + i * table_h->taps;
+        Uint8 *d_row = dst + (size_t)i * dst_pitch;
+
+        // Vertical, into a row of 4 floats per source pixel
+        SDL_memset(row, 0, (size_t)src_w * 4 * sizeof(float));
+        for (t = 0; t < table_h->taps; t++) {
+            const Uint8 *s_row = src + (size_t)index_h[t] * src_pitch;
+            const float w = weight_h[t];
+            if (w == 0.0f) {
+                continue;
+            }
+            for (x = 0; x < 4 * src_w; x++) {
+                row[x] += w * s_row[x];
+            }
+        }
+
+        // Horizontal, store to 'dst'
+        for (j = 0; j < dst_w; j++) {
+            const int *index_w = table_w->index + j * table_w->taps;
+            const float *weight_w = table_w->weight + j * table_w->taps;
+            float c0 = 0.0f, c1 = 0.0f, c2 = 0.0f, c3 = 0.0f;
+
+            for (t = 0; t < table_w->taps; t++) {
+                const float *p = row + 4 * index_w[t];
+                const float w = weight_w[t];
+                c0 += w * p[0];
+                c1 += w * p[1];
+                c2 += w * p[2];
+                c3 += w * p[3];
+            }
+            d_row[4 * j + 0] = cubic_pixel(c0);
+            d_row[4 * j + 1] = cubic_pixel(c1);
+            d_row[4 * j + 2] = cubic_pixel(c2);
+            d_row[4 * j + 3] = cubic_pixel(c3);
+        }
+    }
+    SDL_free(row);
+    return true;
+}
+
+static bool SDL_RunStretchBands(SDL_StretchBand *band)
+{
+    const int src_w = band->srcrect->w;
+    const int src_h = band->srcrect->h;
+    const int dst_w = band->dstrect->w;
+    const int dst_h = band->dstrect->h;
+    bilinear_table_t bilinear;
+    cubic_table_t cubic_w, cubic_h;
+    bool result = false;
+
+    SDL_zero(bilinear);
+    SDL_zero(cubic_w);
+    SDL_zero(cubic_h);
+
+    if (band->scaleMode == SDL_SCALEMODE_LINEAR) {
+        bool use_table = false;
+#ifdef SDL_NEON_INTRINSICS
+        use_table = use_table || hasNEON();
+#endif
+#ifdef SDL_AVX2_INTRINSICS
+        use_table = use_table || hasAVX2();
+#endif
+        // Without a table the bands fall back to the incremental kernels
+        if (use_table && get_bilinear_table(src_w, src_h, dst_w, dst_h, &bilinear)) {
+            band->bilinear = &bilinear;
+        }
+    } else if (band->scaleMode == SDL_SCALEMODE_BICUBIC) {
+        if (!get_cubic_table(src_w, dst_w, &cubic_w) || !get_cubic_table(src_h, dst_h, &cubic_h)) {
+            goto done;
+        }
+        band->cubic_w = &cubic_w;
+        band->cubic_h = &cubic_h;
+    }
+
+    result = SDL_RunBlitBands(dst_w, dst_h, SDL_StretchSurfaceBand, band);
+
+done:
+    SDL_free(bilinear.index_w);
+    SDL_free(cubic_w.index);
+    SDL_free(cubic_w.weight);
+    SDL_free(cubic_h.index);
+    SDL_free(cubic_h.weight);
+    return result;
+}
+
 #define SDL_SCALE_NEAREST__START          \
     int i;                                \
     Uint64 posy, incy;                    \
@@ -856,7 +1041,8 @@ bool SDL_StretchSurfaceUncheckedLinear(SDL_Surface *s, const SDL_Rect *srcrect,
     incy = ((Uint64)src_h << 16) / dst_h; \
     incx = ((Uint64)src_w << 16) / dst_w; \
     dst_gap = dst_pitch - bpp * dst_w;    \
-    posy = incy / 2;
+    posy = incy / 2 + y0 * incy;          \
+    dst = (Uint32 *)((Uint8 *)dst + (size_t)y0 * dst_pitch);
 
 #define SDL_SCALE_NEAREST__HEIGHT                                         \
     srcy = (posy >> 16);                                                  \
@@ -865,11 +1051,11 @@ bool SDL_StretchSurfaceUncheckedLinear(SDL_Surface *s, const SDL_Rect *srcrect,
     posx = incx / 2;                                                      \
     n = dst_w;
 
-static bool scale_mat_nearest_1(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+static bool scale_mat_nearest_1(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int y0, int y1)
 {
     Uint32 bpp = 1;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = y0; i < y1; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint8 *src;
@@ -884,11 +1070,11 @@ static bool scale_mat_nearest_1(const Uint32 *src_ptr, int src_w, int src_h, int
     return true;
 }
 
-static bool scale_mat_nearest_2(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+static bool scale_mat_nearest_2(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int y0, int y1)
 {
     Uint32 bpp = 2;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = y0; i < y1; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint16 *src;
@@ -903,11 +1089,11 @@ static bool scale_mat_nearest_2(const Uint32 *src_ptr, int src_w, int src_h, int
     return true;
 }
 
-static bool scale_mat_nearest_3(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+static bool scale_mat_nearest_3(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int y0, int y1)
 {
     Uint32 bpp = 3;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = y0; i < y1; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint8 *src;
@@ -924,11 +1110,11 @@ static bool scale_mat_nearest_3(const Uint32 *src_ptr, int src_w, int src_h, int
     return true;
 }
 
-static bool scale_mat_nearest_4(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+static bool scale_mat_nearest_4(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int y0, int y1)
 {
     Uint32 bpp = 4;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = y0; i < y1; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint32 *src;
@@ -943,7 +1129,7 @@ static bool scale_mat_nearest_4(const Uint32 *src_ptr, int src_w, int src_h, int
     return true;
 }
 
-bool SDL_StretchSurfaceUncheckedNearest(SDL_Surface *s, const SDL_Rect *srcrect, SDL_Surface *d, const SDL_Rect *dstrect)
+bool SDL_StretchSurfaceUncheckedNearest(SDL_Surface *s, const SDL_Rect *srcrect, SDL_Surface *d, const SDL_Rect *dstrect, int y0, int y1)
 {
     int src_w = srcrect->w;
     int src_h = srcrect->h;
@@ -957,12 +1143,12 @@ bool SDL_StretchSurfaceUncheckedNearest(SDL_Surface *s, const SDL_Rect *srcrect,
     Uint32 *dst = (Uint32 *)((Uint8 *)d->pixels + dstrect->x * bpp + dstrect->y * dst_pitch);
 
     if (bpp == 4) {
-        return scale_mat_nearest_4(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        return scale_mat_nearest_4(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch, y0, y1);
     } else if (bpp == 3) {
-        return scale_mat_nearest_3(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        return scale_mat_nearest_3(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch, y0, y1);
     } else if (bpp == 2) {
-        return scale_mat_nearest_2(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        return scale_mat_nearest_2(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch, y0, y1);
     } else {
-        return scale_mat_nearest_1(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        return scale_mat_nearest_1(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch, y0, y1);
     }
 }
@@ -1166,6 +1166,7 @@ bool SDL_BlitSurfaceScaled(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surfac
     case SDL_SCALEMODE_NEAREST:
         break;
     case SDL_SCALEMODE_LINEAR:
+    case SDL_SCALEMODE_BICUBIC:
         break;
     case SDL_SCALEMODE_PIXELART:
         scaleMode = SDL_SCALEMODE_NEAREST;
@@ -1306,7 +1307,7 @@ bool SDL_BlitSurfaceUncheckedScaled(SDL_Surface *src, const SDL_Rect *srcrect, S
             SDL_BYTESPERPIXEL(src->format) == 4 &&
             src->format != SDL_PIXELFORMAT_ARGB2101010) {
             // fast path
-            return SDL_StretchSurface(src, srcrect, dst, dstrect, SDL_SCALEMODE_LINEAR);
+            return SDL_StretchSurface(src, srcrect, dst, dstrect, scaleMode);
         } else if (SDL_BITSPERPIXEL(src->format) < 8) {
             // Scaling bitmap not yet supported, convert to RGBA for blit
             bool result = false;
@@ -1358,7 +1359,7 @@ bool SDL_BlitSurfaceUncheckedScaled(SDL_Surface *src, const SDL_Rect *srcrect, S
             if (is_complex_copy_flags || src->format != dst->format) {
                 SDL_Rect tmprect;
                 SDL_Surface *tmp2 = SDL_CreateSurfaceUninitialized(dstrect->w, dstrect->h, src->format);
-                SDL_StretchSurface(src, &srcrect2, tmp2, NULL, SDL_SCALEMODE_LINEAR);
+                SDL_StretchSurface(src, &srcrect2, tmp2, NULL, scaleMode);
 
                 SDL_SetSurfaceColorMod(tmp2, r, g, b);
                 SDL_SetSurfaceAlphaMod(tmp2, alpha);
@@ -1371,7 +1372,7 @@ bool SDL_BlitSurfaceUncheckedScaled(SDL_Surface *src, const SDL_Rect *srcrect, S
                 result = SDL_BlitSurfaceUnchecked(tmp2, &tmprect, dst, dstrect);
                 SDL_DestroySurface(tmp2);
             } else {
-                result = SDL_StretchSurface(src, &srcrect2, dst, dstrect, SDL_SCALEMODE_LINEAR);
+                result = SDL_StretchSurface(src, &srcrect2, dst, dstrect, scaleMode);
             }
 
             SDL_DestroySurface(tmp1);
@@ -2386,6 +2387,33 @@ SDL_Surface *SDL_DuplicatePixels(int width, int height, SDL_PixelFormat format,
     return surface;
 }
 
+typedef struct
+{
+    const Uint8 *src;
+    int src_pitch;
+    Uint8 *dst;
+    int dst_pitch;
+    size_t row_size;
+} SDL_CopyPixelsBand;
+
+static bool SDLCALL SDL_CopyPixelsRows(void *userdata, int y, int h)
+{
+    const SDL_CopyPixelsBand *band = (const SDL_CopyPixelsBand *)userdata;
+    const Uint8 *src = band->src + (size_t)y * band->src_pitch;
+    Uint8 *dst = band->dst + (size_t)y * band->dst_pitch;
+
+    if (band->src_pitch == band->dst_pitch) {
+        SDL_memcpy(dst, src, (size_t)h * band->src_pitch);
+    } else {
+        while (h--) {
+            SDL_memcpy(dst, src, band->row_size);
+            src += band->src_pitch;
+            dst += band->dst_pitch;
+        }
+    }
+    return true;
+}
+
 bool SDL_ConvertPixelsAndColorspace(int width, int height,
                       SDL_PixelFormat src_format, SDL_Colorspace src_colorspace, SDL_PropertiesID src_properties, const void *src, int src_pitch,
                       SDL_PixelFormat dst_format, SDL_Colorspace dst_colorspace, SDL_PropertiesID dst_properties, void *dst, int dst_pitch)
@@ -2436,19 +2464,8 @@ bool SDL_ConvertPixelsAndColorspace(int width, int height,
 
     // Fast path for same format copy
     if (src_format == dst_format && src_colorspace == dst_colorspace) {
-        if (src_pitch == dst_pitch) {
-            SDL_memcpy(dst, src, height * src_pitch);
-        } else {
-            int i;
-            const int bpp = SDL_BYTESPERPIXEL(src_format);
-            width *= bpp;
-            for (i = height; i--;) {
-                SDL_memcpy(dst, src, width);
-                src = (const Uint8 *)src + src_pitch;
-                dst = (Uint8 *)dst + dst_pitch;
-            }
-        }
-        return true;
+        SDL_CopyPixelsBand band = { (const Uint8 *)src, src_pitch, (Uint8 *)dst, dst_pitch, (size_t)width * SDL_BYTESPERPIXEL(src_format) };
+        return SDL_RunBlitBands(width, height, SDL_CopyPixelsRows, &band);
     }
 
     if (!SDL_InitializeSurface(&src_surface, width, height, src_format, src_colorspace, src_properties, nonconst_src, src_pitch, true)) {
@@ -20,6 +20,7 @@
 */
 #include "SDL_internal.h"
 
+#include "SDL_blit.h"
 #include "SDL_pixels_c.h"
 #include "SDL_yuv_c.h"
 
@@ -329,6 +330,169 @@ static bool GetYUVPlanes(int width, int height, SDL_PixelFormat format, const vo
     return true;
 }
 
+#ifdef SDL_AVX2_INTRINSICS
+static bool SDL_TARGETING("avx2") yuv_rgb_avx2(
+    SDL_PixelFormat src_format, SDL_PixelFormat dst_format,
+    Uint32 width, Uint32 height,
+    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride,
+    Uint8 *rgb, Uint32 rgb_stride,
+    YCbCrType yuv_type)
+{
+    if (!SDL_HasAVX2()) {
+        return false;
+    }
+
+    if (src_format == SDL_PIXELFORMAT_YV12 ||
+        src_format == SDL_PIXELFORMAT_IYUV) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuv420_rgb565_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_RGB24:
+            yuv420_rgb24_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuv420_rgba_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuv420_bgra_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XRGB8888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuv420_argb_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XBGR8888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuv420_abgr_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_P408) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuv444_rgba_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuv444_bgra_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XRGB8888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuv444_argb_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XBGR8888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuv444_abgr_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_YUY2 ||
+        src_format == SDL_PIXELFORMAT_UYVY ||
+        src_format == SDL_PIXELFORMAT_YVYU) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuv422_rgb565_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_RGB24:
+            yuv422_rgb24_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuv422_rgba_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuv422_bgra_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XRGB8888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuv422_argb_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XBGR8888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuv422_abgr_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_NV12 ||
+        src_format == SDL_PIXELFORMAT_NV21) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuvnv12_rgb565_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_RGB24:
+            yuvnv12_rgb24_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuvnv12_rgba_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuvnv12_bgra_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XRGB8888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuvnv12_argb_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XBGR8888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuvnv12_abgr_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_P010) {
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_XBGR2101010:
+            yuvp010_xbgr2101010_avx2(width, height, (const uint16_t *)y, (const uint16_t *)u, (const uint16_t *)v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_P416) {
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB48:
+            yuvp416_rgb48_avx2(width, height, (const uint16_t *)y, (const uint16_t *)u, (const uint16_t *)v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        default:
+            break;
+        }
+    }
+    return false;
+}
+#else
+static bool yuv_rgb_avx2(
+    SDL_PixelFormat src_format, SDL_PixelFormat dst_format,
+    Uint32 width, Uint32 height,
+    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride,
+    Uint8 *rgb, Uint32 rgb_stride,
+    YCbCrType yuv_type)
+{
+    return false;
+}
+#endif
+
 #ifdef SDL_SSE2_INTRINSICS
 static bool SDL_TARGETING("sse2") yuv_rgb_sse(
     SDL_PixelFormat src_format, SDL_PixelFormat dst_format,
@@ -448,6 +612,169 @@ static bool yuv_rgb_sse(
 }
 #endif
 
+#ifdef SDL_NEON_INTRINSICS
+static bool yuv_rgb_neon(
+    SDL_PixelFormat src_format, SDL_PixelFormat dst_format,
+    Uint32 width, Uint32 height,
+    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride,
+    Uint8 *rgb, Uint32 rgb_stride,
+    YCbCrType yuv_type)
+{
+    if (!SDL_HasNEON()) {
+        return false;
+    }
+
+    if (src_format == SDL_PIXELFORMAT_YV12 ||
+        src_format == SDL_PIXELFORMAT_IYUV) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuv420_rgb565_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_RGB24:
+            yuv420_rgb24_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuv420_rgba_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuv420_bgra_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XRGB8888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuv420_argb_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XBGR8888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuv420_abgr_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_P408) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuv444_rgba_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuv444_bgra_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XRGB8888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuv444_argb_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XBGR8888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuv444_abgr_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_YUY2 ||
+        src_format == SDL_PIXELFORMAT_UYVY ||
+        src_format == SDL_PIXELFORMAT_YVYU) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuv422_rgb565_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_RGB24:
+            yuv422_rgb24_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuv422_rgba_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuv422_bgra_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XRGB8888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuv422_argb_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XBGR8888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuv422_abgr_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_NV12 ||
+        src_format == SDL_PIXELFORMAT_NV21) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuvnv12_rgb565_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_RGB24:
+            yuvnv12_rgb24_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuvnv12_rgba_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuvnv12_bgra_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XRGB8888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuvnv12_argb_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        case SDL_PIXELFORMAT_XBGR8888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuvnv12_abgr_neon(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_P010) {
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_XBGR2101010:
+            yuvp010_xbgr2101010_neon(width, height, (const uint16_t *)y, (const uint16_t *)u, (const uint16_t *)v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_P416) {
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB48:
+            yuvp416_rgb48_neon(width, height, (const uint16_t *)y, (const uint16_t *)u, (const uint16_t *)v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return true;
+        default:
+            break;
+        }
+    }
+    return false;
+}
+#else
+static bool yuv_rgb_neon(
+    SDL_PixelFormat src_format, SDL_PixelFormat dst_format,
+    Uint32 width, Uint32 height,
+    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride,
+    Uint8 *rgb, Uint32 rgb_stride,
+    YCbCrType yuv_type)
+{
+    return false;
+}
+#endif
+
 #ifdef SDL_LSX_INTRINSICS
 static bool yuv_rgb_lsx(
     SDL_PixelFormat src_format, SDL_PixelFormat dst_format,
@@ -666,10 +993,18 @@ bool SDL_ConvertPixels_YUV_to_RGB(int width, int height,
         return false;
     }
 
+    if (yuv_rgb_avx2(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
+        return true;
+    }
+
     if (yuv_rgb_sse(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
         return true;
     }
 
+    if (yuv_rgb_neon(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
+        return true;
+    }
+
     if (yuv_rgb_lsx(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
         return true;
     }
@@ -797,11 +1132,519 @@ static struct RGB2YUVFactors RGB2YUVFactorTables[] = {
     },
 };
 
+/* The row converters below work in fixed point, with the factors above scaled
+ * by 2^15 so that an RGB pair and a blue/rounding pair each fit one 16-bit
+ * multiply-add.
+ */
+#define RGB2YUV_FIXED_BITS 15
+
+typedef struct RGB2YUVFixedFactors
+{
+    int y_offset;
+    Sint16 y[3]; // Rfactor, Gfactor, Bfactor
+    Sint16 u[3]; // Rfactor, Gfactor, Bfactor
+    Sint16 v[3]; // Rfactor, Gfactor, Bfactor
+} RGB2YUVFixedFactors;
+
+typedef struct RGB2YUVBands RGB2YUVBands;
+
+typedef void (*RGB2YUVRowPairFunc)(const RGB2YUVBands *job, const Uint8 *row1, const Uint8 *row2, Uint8 *y1, Uint8 *y2, Uint8 *u, Uint8 *v);
+
+struct RGB2YUVBands
+{
+    RGB2YUVFixedFactors cvt;
+    RGB2YUVRowPairFunc convert_row_pair;
+    int width;
+    int height;
+    const Uint8 *src;
+    int src_pitch;
+    int src_shift[3]; // Rshift, Gshift, Bshift
+    Uint8 *plane_y;
+    Uint8 *plane_u;
+    Uint8 *plane_v;
+    Uint32 y_stride;
+    Uint32 uv_stride;
+    int uv_step; // 1 for separate U and V planes, 2 for interleaved UV
+};
+
+static void InitRGB2YUVFixedFactors(RGB2YUVFixedFactors *fixed, YCbCrType yuv_type)
+{
+    const struct RGB2YUVFactors *cvt = &RGB2YUVFactorTables[yuv_type];
+    const float scale = (float)(1 << RGB2YUV_FIXED_BITS);
+    int i;
+
+    fixed->y_offset = cvt->y_offset;
+    for (i = 0; i < 3; ++i) {
+        fixed->y[i] = (Sint16)SDL_lroundf(cvt->y[i] * scale);
+        fixed->u[i] = (Sint16)SDL_lroundf(cvt->u[i] * scale);
+        fixed->v[i] = (Sint16)SDL_lroundf(cvt->v[i] * scale);
+    }
+}
+
+#define FIXED_DOT(f, r, g, b) (((f)[0] * (int)(r) + (f)[1] * (int)(g) + (f)[2] * (int)(b) + (1 << (RGB2YUV_FIXED_BITS - 1))) >> RGB2YUV_FIXED_BITS)
+
+/* Convert columns [x, width) of a pair of rows into 4:2:0 samples.
+ * The last row of an odd height image is passed as both rows, with y2 NULL.
+ */
+static void ConvertRowPair_8888_to_420_std(const RGB2YUVBands *job, int x, const Uint32 *row1, const Uint32 *row2, Uint8 *y1, Uint8 *y2, Uint8 *u, Uint8 *v)
+{
+    const RGB2YUVFixedFactors *cvt = &job->cvt;
+    const int rshift = job->src_shift[0];
+    const int gshift = job->src_shift[1];
+    const int bshift = job->src_shift[2];
+    const int uv_step = job->uv_step;
+    int i;
+
+#define MAKE_Y(r, g, b) (Uint8)SDL_clamp(FIXED_DOT(cvt->y, r, g, b) + cvt->y_offset, 0, 255)
+#define MAKE_U(r, g, b) (Uint8)SDL_clamp(FIXED_DOT(cvt->u, r, g, b) + 128, 0, 255)
+#define MAKE_V(r, g, b) (Uint8)SDL_clamp(FIXED_DOT(cvt->v, r, g, b) + 128, 0, 255)
+
+    u += (x / 2) * uv_step;
+    v += (x / 2) * uv_step;
+    for (; x < job->width; x += 2) {
+        // The last column of an odd width image is averaged with itself
+        const int x1 = SDL_min(x + 1, job->width - 1);
+        const Uint32 p1 = row1[x], p2 = row1[x1], p3 = row2[x], p4 = row2[x1];
+        const Uint32 r = (((p1 >> rshift) & 0xff) + ((p2 >> rshift) & 0xff) + ((p3 >> rshift) & 0xff) + ((p4 >> rshift) & 0xff)) >> 2;
+        const Uint32 g = (((p1 >> gshift) & 0xff) + ((p2 >> gshift) & 0xff) + ((p3 >> gshift) & 0xff) + ((p4 >> gshift) & 0xff)) >> 2;
+        const Uint32 b = (((p1 >> bshift) & 0xff) + ((p2 >> bshift) & 0xff) + ((p3 >> bshift) & 0xff) + ((p4 >> bshift) & 0xff)) >> 2;
+
+        for (i = x; i <= x1; ++i) {
+            y1[i] = MAKE_Y((row1[i] >> rshift) & 0xff, (row1[i] >> gshift) & 0xff, (row1[i] >> bshift) & 0xff);
+            if (y2) {
+                y2[i] = MAKE_Y((row2[i] >> rshift) & 0xff, (row2[i] >> gshift) & 0xff, (row2[i] >> bshift) & 0xff);
+            }
+        }
+        *u = MAKE_U(r, g, b);
+        *v = MAKE_V(r, g, b);
+        u += uv_step;
+        v += uv_step;
+    }
+
+#undef MAKE_Y
+#undef MAKE_U
+#undef MAKE_V
+}
+
+static void ConvertRowPair_XBGR2101010_to_P010_std(const RGB2YUVBands *job, int x, const Uint32 *row1, const Uint32 *row2, Uint16 *y1, Uint16 *y2, Uint16 *u, Uint16 *v)
+{
+    const RGB2YUVFixedFactors *cvt = &job->cvt;
+    int i;
+
+#define MAKE_Y(r, g, b) (Uint16)(SDL_clamp(FIXED_DOT(cvt->y, r, g, b) + cvt->y_offset, 0, 1023) << 6)
+#define MAKE_U(r, g, b) (Uint16)(SDL_clamp(FIXED_DOT(cvt->u, r, g, b) + 512, 0, 1023) << 6)
+#define MAKE_V(r, g, b) (Uint16)(SDL_clamp(FIXED_DOT(cvt->v, r, g, b) + 512, 0, 1023) << 6)
+
+    u += x;
+    v += x;
+    for (; x < job->width; x += 2) {
+        const int x1 = SDL_min(x + 1, job->width - 1);
+        const Uint32 p1 = row1[x], p2 = row1[x1], p3 = row2[x], p4 = row2[x1];
+        const Uint32 r = ((p1 & 0x3ff) + (p2 & 0x3ff) + (p3 & 0x3ff) + (p4 & 0x3ff)) >> 2;
+        const Uint32 g = (((p1 >> 10) & 0x3ff) + ((p2 >> 10) & 0x3ff) + ((p3 >> 10) & 0x3ff) + ((p4 >> 10) & 0x3ff)) >> 2;
+        const Uint32 b = (((p1 >> 20) & 0x3ff) + ((p2 >> 20) & 0x3ff) + ((p3 >> 20) & 0x3ff) + ((p4 >> 20) & 0x3ff)) >> 2;
+
+        for (i = x; i <= x1; ++i) {
+            y1[i] = MAKE_Y(row1[i] & 0x3ff, (row1[i] >> 10) & 0x3ff, (row1[i] >> 20) & 0x3ff);
+            if (y2) {
+                y2[i] = MAKE_Y(row2[i] & 0x3ff, (row2[i] >> 10) & 0x3ff, (row2[i] >> 20) & 0x3ff);
+            }
+        }
+        *u = MAKE_U(r, g, b);
+        *v = MAKE_V(r, g, b);
+        u += 2;
+        v += 2;
+    }
+
+#undef MAKE_Y
+#undef MAKE_U
+#undef MAKE_V
+}
+
+static void ConvertRowPair_8888_to_420(const RGB2YUVBands *job, const Uint8 *row1, const Uint8 *row2, Uint8 *y1, Uint8 *y2, Uint8 *u, Uint8 *v)
+{
+    ConvertRowPair_8888_to_420_std(job, 0, (const Uint32 *)row1, (const Uint32 *)row2, y1, y2, u, v);
+}
+
+static void ConvertRowPair_XBGR2101010_to_P010(const RGB2YUVBands *job, const Uint8 *row1, const Uint8 *row2, Uint8 *y1, Uint8 *y2, Uint8 *u, Uint8 *v)
+{
+    ConvertRowPair_XBGR2101010_to_P010_std(job, 0, (const Uint32 *)row1, (const Uint32 *)row2, (Uint16 *)y1, (Uint16 *)y2, (Uint16 *)u, (Uint16 *)v);
+}
+
+#ifdef SDL_SSE2_INTRINSICS
+
+// Compute 4 fixed point dot products from 16-bit (r, g) and (b, 1) pairs
+#define FIXED_DOT_SSE2(rg, b1, f_rg, f_b1) _mm_srai_epi32(_mm_add_epi32(_mm_madd_epi16(rg, f_rg), _mm_madd_epi16(b1, f_b1)), RGB2YUV_FIXED_BITS)
+
+static SDL_INLINE __m128i SDL_TARGETING("sse2") FixedFactorPairSSE2(int lo, int hi)
+{
+    return _mm_set1_epi32((int)((Uint16)lo | ((Uint32)(Uint16)hi << 16)));
+}
+
+// Sum horizontal pairs of 4 pixel sums in each of a and b, returning the 4 pair sums in order
+static SDL_INLINE __m128i SDL_TARGETING("sse2") SumPixelPairsSSE2(__m128i a, __m128i b)
+{
+    a = _mm_add_epi32(a, _mm_srli_epi64(a, 32));
+    b = _mm_add_epi32(b, _mm_srli_epi64(b, 32));
+    return _mm_unpacklo_epi64(_mm_shuffle_epi32(a, _MM_SHUFFLE(3, 1, 2, 0)), _mm_shuffle_epi32(b, _MM_SHUFFLE(3, 1, 2, 0)));
+}
+
+static void SDL_TARGETING("sse2") ConvertRowPair_8888_to_420_SSE2(const RGB2YUVBands *job, const Uint8 *row1, const Uint8 *row2, Uint8 *y1, Uint8 *y2, Uint8 *u, Uint8 *v)
+{
+    const RGB2YUVFixedFactors *cvt = &job->cvt;
+    const __m128i rshift = _mm_cvtsi32_si128(job->src_shift[0]);
+    const __m128i gshift = _mm_cvtsi32_si128(job->src_shift[1]);
+    const __m128i bshift = _mm_cvtsi32_si128(job->src_shift[2]);
+    const __m128i mask = _mm_set1_epi32(0xff);
+    const __m128i one = _mm_set1_epi32(1 << 16);
+    const int round = (1 << (RGB2YUV_FIXED_BITS - 1));
+    const __m128i y_rg = FixedFactorPairSSE2(cvt->y[0], cvt->y[1]);
+    const __m128i y_b1 = FixedFactorPairSSE2(cvt->y[2], round);
+    const __m128i u_rg = FixedFactorPairSSE2(cvt->u[0], cvt->u[1]);
+    const __m128i u_b1 = FixedFactorPairSSE2(cvt->u[2], round);
+    const __m128i v_rg = FixedFactorPairSSE2(cvt->v[0], cvt->v[1]);
+    const __m128i v_b1 = FixedFactorPairSSE2(cvt->v[2], round);
+    const __m128i y_offset = _mm_set1_epi32(cvt->y_offset);
+    const __m128i uv_offset = _mm_set1_epi32(128);
+    const int width = job->width & ~7;
+    int x;
+
+#define EXTRACT_RGB(p, r, g, b)                           \
+    r = _mm_and_si128(_mm_srl_epi32(p, rshift), mask);    \
+    g = _mm_and_si128(_mm_srl_epi32(p, gshift), mask);    \
+    b = _mm_and_si128(_mm_srl_epi32(p, bshift), mask);
+
+#define MAKE_Y(r, g, b) _mm_add_epi32(FIXED_DOT_SSE2(_mm_or_si128(r, _mm_slli_epi32(g, 16)), _mm_or_si128(b, one), y_rg, y_b1), y_offset)
+
+    for (x = 0; x < width; x += 8) {
+        const __m128i p1a = _mm_loadu_si128((const __m128i *)(row1 + x * 4));
+        const __m128i p1b = _mm_loadu_si128((const __m128i *)(row1 + x * 4 + 16));
+        const __m128i p2a = _mm_loadu_si128((const __m128i *)(row2 + x * 4));
+        const __m128i p2b = _mm_loadu_si128((const __m128i *)(row2 + x * 4 + 16));
+        __m128i r1a, g1a, b1a, r1b, g1b, b1b, r2a, g2a, b2a, r2b, g2b, b2b;
+        __m128i r, g, b, rg, b1, yy, uv;
+
+        EXTRACT_RGB(p1a, r1a, g1a, b1a)
+        EXTRACT_RGB(p1b, r1b, g1b, b1b)
+        EXTRACT_RGB(p2a, r2a, g2a, b2a)
+        EXTRACT_RGB(p2b, r2b, g2b, b2b)
+
+        yy = _mm_packs_epi32(MAKE_Y(r1a, g1a, b1a), MAKE_Y(r1b, g1b, b1b));
+        _mm_storel_epi64((__m128i *)(y1 + x), _mm_packus_epi16(yy, yy));
+        if (y2) {
+            yy = _mm_packs_epi32(MAKE_Y(r2a, g2a, b2a), MAKE_Y(r2b, g2b, b2b));
+            _mm_storel_epi64((__m128i *)(y2 + x), _mm_packus_epi16(yy, yy));
+        }
+
+        // Average each 2x2 block
+        r = _mm_srli_epi32(SumPixelPairsSSE2(_mm_add_epi32(r1a, r2a), _mm_add_epi32(r1b, r2b)), 2);
+        g = _mm_srli_epi32(SumPixelPairsSSE2(_mm_add_epi32(g1a, g2a), _mm_add_epi32(g1b, g2b)), 2);
+        b = _mm_srli_epi32(SumPixelPairsSSE2(_mm_add_epi32(b1a, b2a), _mm_add_epi32(b1b, b2b)), 2);
+        rg = _mm_or_si128(r, _mm_slli_epi32(g, 16));
+        b1 = _mm_or_si128(b, one);
+        uv = _mm_packs_epi32(_mm_add_epi32(FIXED_DOT_SSE2(rg, b1, u_rg, u_b1), uv_offset),
+                             _mm_add_epi32(FIXED_DOT_SSE2(rg, b1, v_rg, v_b1), uv_offset));
+        uv = _mm_packus_epi16(uv, uv); // U0 U1 U2 U3 V0 V1 V2 V3
+
+        if (job->uv_step == 1) {
+            const int u32 = _mm_cvtsi128_si32(uv);
+            const int v32 = _mm_cvtsi128_si32(_mm_srli_si128(uv, 4));
+            SDL_memcpy(u + x / 2, &u32, sizeof(u32));
+            SDL_memcpy(v + x / 2, &v32, sizeof(v32));
+        } else if (u < v) {
+            _mm_storel_epi64((__m128i *)(u + x), _mm_unpacklo_epi8(uv, _mm_srli_si128(uv, 4)));
+        } else {
+            _mm_storel_epi64((__m128i *)(v + x), _mm_unpacklo_epi8(_mm_srli_si128(uv, 4), uv));
+        }
+    }
+
+#undef EXTRACT_RGB
+#undef MAKE_Y
+
+    ConvertRowPair_8888_to_420_std(job, x, (const Uint32 *)row1, (const Uint32 *)row2, y1, y2, u, v);
+}
+
+static void SDL_TARGETING("sse2") ConvertRowPair_XBGR2101010_to_P010_SSE2(const RGB2YUVBands *job, const Uint8 *row1, const Uint8 *row2, Uint8 *y1, Uint8 *y2, Uint8 *u, Uint8 *v)
+{
+    const RGB2YUVFixedFactors *cvt = &job->cvt;
+    const __m128i mask = _mm_set1_epi32(0x3ff);
+    const __m128i one = _mm_set1_epi32(1 << 16);
+    const int round = (1 << (RGB2YUV_FIXED_BITS - 1));
+    const __m128i y_rg = FixedFactorPairSSE2(cvt->y[0], cvt->y[1]);
+    const __m128i y_b1 = FixedFactorPairSSE2(cvt->y[2], round);
+    const __m128i u_rg = FixedFactorPairSSE2(cvt->u[0], cvt->u[1]);
+    const __m128i u_b1 = FixedFactorPairSSE2(cvt->u[2], round);
+    const __m128i v_rg = FixedFactorPairSSE2(cvt->v[0], cvt->v[1]);
+    const __m128i v_b1 = FixedFactorPairSSE2(cvt->v[2], round);
+    /* Samples are offset by -512 before they're shifted into the high bits,
+     * so signed packing clamps them to 16 bits, and then flipped back.
+     */
+    const __m128i y_offset = _mm_set1_epi32(cvt->y_offset - 512);
+    const __m128i sign = _mm_set1_epi16((short)0x8000);
+    const __m128i mask10 = _mm_set1_epi16((short)0xffc0);
+    const int width = job->width & ~7;
+    int x;
+
+#define EXTRACT_RGB(p, r, g, b)                           \
+    r = _mm_and_si128(p, mask);                           \
+    g = _mm_and_si128(_mm_srli_epi32(p, 10), mask);       \
+    b = _mm_and_si128(_mm_srli_epi32(p, 20), mask);
+
+#define MAKE_Y(r, g, b) _mm_slli_epi32(_mm_add_epi32(FIXED_DOT_SSE2(_mm_or_si128(r, _mm_slli_epi32(g, 16)), _mm_or_si128(b, one), y_rg, y_b1), y_offset), 6)
+#define PACK_P010(a, b) _mm_and_si128(_mm_xor_si128(_mm_packs_epi32(a, b), sign), mask10)
+
+    for (x = 0; x < width; x += 8) {
+        const __m128i p1a = _mm_loadu_si128((const __m128i *)(row1 + x * 4));
+        const __m128i p1b = _mm_loadu_si128((const __m128i *)(row1 + x * 4 + 16));
+        const __m128i p2a = _mm_loadu_si128((const __m128i *)(row2 + x * 4));
+        const __m128i p2b = _mm_loadu_si128((const __m128i *)(row2 + x * 4 + 16));
+        __m128i r1a, g1a, b1a, r1b, g1b, b1b, r2a, g2a, b2a, r2b, g2b, b2b;
+        __m128i r, g, b, rg, b1, uv;
+
+        EXTRACT_RGB(p1a, r1a, g1a, b1a)
+        EXTRACT_RGB(p1b, r1b, g1b, b1b)
+        EXTRACT_RGB(p2a, r2a, g2a, b2a)
+        EXTRACT_RGB(p2b, r2b, g2b, b2b)
+
+        _mm_storeu_si128((__m128i *)(y1 + x * 2), PACK_P010(MAKE_Y(r1a, g1a, b1a), MAKE_Y(r1b, g1b, b1b)));
+        if (y2) {
+            _mm_storeu_si128((__m128i *)(y2 + x * 2), PACK_P010(MAKE_Y(r2a, g2a, b2a), MAKE_Y(r2b, g2b, b2b)));
+        }
+
+        // Average each 2x2 block
+        r = _mm_srli_epi32(SumPixelPairsSSE2(_mm_add_epi32(r1a, r2a), _mm_add_epi32(r1b, r2b)), 2);
+        g = _mm_srli_epi32(SumPixelPairsSSE2(_mm_add_epi32(g1a, g2a), _mm_add_epi32(g1b, g2b)), 2);
+        b = _mm_srli_epi32(SumPixelPairsSSE2(_mm_add_epi32(b1a, b2a), _mm_add_epi32(b1b, b2b)), 2);
+        rg = _mm_or_si128(r, _mm_slli_epi32(g, 16));
+        b1 = _mm_or_si128(b, one);
+        // The chroma offset of 512 cancels out with the packing offset
+        uv = PACK_P010(_mm_slli_epi32(FIXED_DOT_SSE2(rg, b1, u_rg, u_b1), 6),
+                       _mm_slli_epi32(FIXED_DOT_SSE2(rg, b1, v_rg, v_b1), 6)); // U0 U1 U2 U3 V0 V1 V2 V3
+        _mm_storeu_si128((__m128i *)(u + x * 2), _mm_unpacklo_epi16(uv, _mm_srli_si128(uv, 8)));
+    }
+
+#undef EXTRACT_RGB
+#undef MAKE_Y
+#undef PACK_P010
+
+    ConvertRowPair_XBGR2101010_to_P010_std(job, x, (const Uint32 *)row1, (const Uint32 *)row2, (Uint16 *)y1, (Uint16 *)y2, (Uint16 *)u, (Uint16 *)v);
+}
+
+#undef FIXED_DOT_SSE2
+
+#endif // SDL_SSE2_INTRINSICS
+
+#ifdef SDL_NEON_INTRINSICS
+
+// Compute 4 fixed point dot products, rounded and narrowed to 16 bits
+static SDL_INLINE int16x4_t FixedDotNEON(int16x4_t r, int16x4_t g, int16x4_t b, const Sint16 *f)
+{
+    int32x4_t sum = vmull_n_s16(r, f[0]);
+    sum = vmlal_n_s16(sum, g, f[1]);
+    sum = vmlal_n_s16(sum, b, f[2]);
+    return vrshrn_n_s32(sum, RGB2YUV_FIXED_BITS);
+}
+
+// Average each 2x2 block of 8 pixels from two rows
+static SDL_INLINE int16x4_t Average2x2NEON(uint16x8_t row1, uint16x8_t row2)
+{
+    return vreinterpret_s16_u16(vmovn_u32(vshrq_n_u32(vpaddlq_u16(vaddq_u16(row1, row2)), 2)));
+}
+
+static void ConvertRowPair_8888_to_420_NEON(const RGB2YUVBands *job, const Uint8 *row1, const Uint8 *row2, Uint8 *y1, Uint8 *y2, Uint8 *u, Uint8 *v)
+{
+    const RGB2YUVFixedFactors *cvt = &job->cvt;
+    // Each channel is a byte of the pixel, which de-interleaving loads put in its own vector
+    const int ri = job->src_shift[0] / 8;
+    const int gi = job->src_shift[1] / 8;
+    const int bi = job->src_shift[2] / 8;
+    const int16x8_t y_offset = vdupq_n_s16((Sint16)cvt->y_offset);
+    const int16x8_t uv_offset = vdupq_n_s16(128);
+    const int width = job->width & ~7;
+    int x;
+
+#define MAKE_Y(r, g, b) \
+    vqmovun_s16(vaddq_s16(vcombine_s16(FixedDotNEON(vget_low_s16(r), vget_low_s16(g), vget_low_s16(b), cvt->y), \
+                                       FixedDotNEON(vget_high_s16(r), vget_high_s16(g), vget_high_s16(b), cvt->y)), y_offset))
+
+    for (x = 0; x < width; x += 8) {
+        const uint8x8x4_t p1 = vld4_u8(row1 + x * 4);
+        const uint8x8x4_t p2 = vld4_u8(row2 + x * 4);
+        const uint16x8_t r1 = vmovl_u8(p1.val[ri]), g1 = vmovl_u8(p1.val[gi]), b1 = vmovl_u8(p1.val[bi]);
+        const uint16x8_t r2 = vmovl_u8(p2.val[ri]), g2 = vmovl_u8(p2.val[gi]), b2 = vmovl_u8(p2.val[bi]);
+        int16x4_t r, g, b;
+        uint8x8_t uv;
+
+        vst1_u8(y1 + x, MAKE_Y(vreinterpretq_s16_u16(r1), vreinterpretq_s16_u16(g1), vreinterpretq_s16_u16(b1)));
+        if (y2) {
+            vst1_u8(y2 + x, MAKE_Y(vreinterpretq_s16_u16(r2), vreinterpretq_s16_u16(g2), vreinterpretq_s16_u16(b2)));
+        }
+
+        r = Average2x2NEON(r1, r2);
+        g = Average2x2NEON(g1, g2);
+        b = Average2x2NEON(b1, b2);
+        uv = vqmovun_s16(vaddq_s16(vcombine_s16(FixedDotNEON(r, g, b, cvt->u), FixedDotNEON(r, g, b, cvt->v)), uv_offset)); // U0 U1 U2 U3 V0 V1 V2 V3
+
+        if (job->uv_step == 1) {
+            const Uint32 u32 = vget_lane_u32(vreinterpret_u32_u8(uv), 0);
+            const Uint32 v32 = vget_lane_u32(vreinterpret_u32_u8(uv), 1);
+            SDL_memcpy(u + x / 2, &u32, sizeof(u32));
+            SDL_memcpy(v + x / 2, &v32, sizeof(v32));
+        } else if (u < v) {
+            vst1_u8(u + x, vzip_u8(uv, vext_u8(uv, uv, 4)).val[0]);
+        } else {
+            vst1_u8(v + x, vzip_u8(vext_u8(uv, uv, 4), uv).val[0]);
+        }
+    }
+
+#undef MAKE_Y
+
+    ConvertRowPair_8888_to_420_std(job, x, (const Uint32 *)row1, (const Uint32 *)row2, y1, y2, u, v);
+}
+
+static void ConvertRowPair_XBGR2101010_to_P010_NEON(const RGB2YUVBands *job, const Uint8 *row1, const Uint8 *row2, Uint8 *y1, Uint8 *y2, Uint8 *u, Uint8 *v)
+{
+    const RGB2YUVFixedFactors *cvt = &job->cvt;
+    const uint32x4_t mask = vdupq_n_u32(0x3ff);
+    const int16x8_t y_offset = vdupq_n_s16((Sint16)cvt->y_offset);
+    const int16x8_t uv_offset = vdupq_n_s16(512);
+    const int16x8_t zero = vdupq_n_s16(0);
+    const int16x8_t max = vdupq_n_s16(1023);
+    const int width = job->width & ~7;
+    int x;
+
+#define EXTRACT_RGB(row, r, g, b)                                                   \
+    {                                                                               \
+        const uint32x4_t pa = vld1q_u32((const uint32_t *)(row + x * 4));           \
+        const uint32x4_t pb = vld1q_u32((const uint32_t *)(row + x * 4 + 16));      \
+        r = vcombine_u16(vmovn_u32(vandq_u32(pa, mask)), vmovn_u32(vandq_u32(pb, mask))); \
+        g = vcombine_u16(vmovn_u32(vandq_u32(vshrq_n_u32(pa, 10), mask)), vmovn_u32(vandq_u32(vshrq_n_u32(pb, 10), mask))); \
+        b = vcombine_u16(vmovn_u32(vandq_u32(vshrq_n_u32(pa, 20), mask)), vmovn_u32(vandq_u32(vshrq_n_u32(pb, 20), mask))); \
+    }
+
+// Clamp to 10 bits, stored in the high bits of each 16-bit sample
+#define PACK_P010(x) vshlq_n_u16(vreinterpretq_u16_s16(vminq_s16(vmaxq_s16(x, zero), max)), 6)
+
+#define MAKE_Y(r, g, b) \
+    PACK_P010(vaddq_s16(vcombine_s16(FixedDotNEON(vget_low_s16(r), vget_low_s16(g), vget_low_s16(b), cvt->y), \
+                                     FixedDotNEON(vget_high_s16(r), vget_high_s16(g), vget_high_s16(b), cvt->y)), y_offset))
+
+    for (x = 0; x < width; x += 8) {
+        uint16x8_t r1, g1, b1, r2, g2, b2;
+        int16x4_t r, g, b;
+        uint16x8_t uv;
+        uint16x4x2_t interleaved;
+
+        EXTRACT_RGB(row1, r1, g1, b1)
+        EXTRACT_RGB(row2, r2, g2, b2)
+
+        vst1q_u16((uint16_t *)(y1 + x * 2), MAKE_Y(vreinterpretq_s16_u16(r1), vreinterpretq_s16_u16(g1), vreinterpretq_s16_u16(b1)));
+        if (y2) {
+            vst1q_u16((uint16_t *)(y2 + x * 2), MAKE_Y(vreinterpretq_s16_u16(r2), vreinterpretq_s16_u16(g2), vreinterpretq_s16_u16(b2)));
+        }
+
+        r = Average2x2NEON(r1, r2);
+        g = Average2x2NEON(g1, g2);
+        b = Average2x2NEON(b1, b2);
+        uv = PACK_P010(vaddq_s16(vcombine_s16(FixedDotNEON(r, g, b, cvt->u), FixedDotNEON(r, g, b, cvt->v)), uv_offset));
+        interleaved = vzip_u16(vget_low_u16(uv), vget_high_u16(uv));
+        vst1q_u16((uint16_t *)(u + x * 2), vcombine_u16(interleaved.val[0], interleaved.val[1]));
+    }
+
+#undef EXTRACT_RGB
+#undef PACK_P010
+#undef MAKE_Y
+
+    ConvertRowPair_XBGR2101010_to_P010_std(job, x, (const Uint32 *)row1, (const Uint32 *)row2, (Uint16 *)y1, (Uint16 *)y2, (Uint16 *)u, (Uint16 *)v);
+}
+
+#endif // SDL_NEON_INTRINSICS
+
+#undef FIXED_DOT
+
+static bool SDLCALL ConvertRGBToYUVBand(void *userdata, int y, int h)
+{
+    const RGB2YUVBands *job = (const RGB2YUVBands *)userdata;
+    int pair;
+
+    // Bands are counted in pairs of rows, which share a row of chroma samples
+    for (pair = y; pair < y + h; ++pair) {
+        const int row = pair * 2;
+        const bool last_odd_row = (row + 1 == job->height);
+        const Uint8 *row1 = job->src + row * job->src_pitch;
+        const Uint8 *row2 = last_odd_row ? row1 : row1 + job->src_pitch;
+        Uint8 *y1 = job->plane_y + row * job->y_stride;
+        Uint8 *y2 = last_odd_row ? NULL : y1 + job->y_stride;
+
+        job->convert_row_pair(job, row1, row2, y1, y2, job->plane_u + pair * job->uv_stride, job->plane_v + pair * job->uv_stride);
+    }
+    return true;
+}
+
+static bool IsRGB8888Format(SDL_PixelFormat format)
+{
+    return SDL_PIXELTYPE(format) == SDL_PIXELTYPE_PACKED32 && SDL_PIXELLAYOUT(format) == SDL_PACKEDLAYOUT_8888;
+}
+
+/* Convert 8888 pixels to YV12, IYUV, NV12 or NV21, or XBGR2101010 pixels to P010,
+ * splitting the image into bands of rows on the blit worker threads.
+ */
+static bool SDL_ConvertPixels_RGB_to_420(int width, int height, SDL_PixelFormat src_format, const void *src, int src_pitch, SDL_PixelFormat dst_format, void *dst, int dst_pitch, YCbCrType yuv_type)
+{
+    RGB2YUVBands job;
+
+    SDL_zero(job);
+    if (!GetYUVPlanes(width, height, dst_format, dst, dst_pitch,
+                      (const Uint8 **)&job.plane_y, (const Uint8 **)&job.plane_u, (const Uint8 **)&job.plane_v,
+                      &job.y_stride, &job.uv_stride)) {
+        return false;
+    }
+    InitRGB2YUVFixedFactors(&job.cvt, yuv_type);
+    job.width = width;
+    job.height = height;
+    job.src = (const Uint8 *)src;
+    job.src_pitch = src_pitch;
+    job.uv_step = (dst_format == SDL_PIXELFORMAT_NV12 || dst_format == SDL_PIXELFORMAT_NV21) ? 2 : 1;
+
+    if (dst_format == SDL_PIXELFORMAT_P010) {
+        SDL_assert(src_format == SDL_PIXELFORMAT_XBGR2101010);
+        job.convert_row_pair = ConvertRowPair_XBGR2101010_to_P010;
+#ifdef SDL_SSE2_INTRINSICS
+        if (SDL_HasSSE2()) {
+            job.convert_row_pair = ConvertRowPair_XBGR2101010_to_P010_SSE2;
+        }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+        if (SDL_HasNEON()) {
+            job.convert_row_pair = ConvertRowPair_XBGR2101010_to_P010_NEON;
+        }
+#endif
+    } else {
+        const SDL_PixelFormatDetails *details = SDL_GetPixelFormatDetails(src_format);
+        if (!details) {
+            return false;
+        }
+        job.src_shift[0] = details->Rshift;
+        job.src_shift[1] = details->Gshift;
+        job.src_shift[2] = details->Bshift;
+        job.convert_row_pair = ConvertRowPair_8888_to_420;
+#ifdef SDL_SSE2_INTRINSICS
+        if (SDL_HasSSE2()) {
+            job.convert_row_pair = ConvertRowPair_8888_to_420_SSE2;
+        }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+        if (SDL_HasNEON()) {
+            job.convert_row_pair = ConvertRowPair_8888_to_420_NEON;
+        }
+#endif
+    }
+
+    return SDL_RunBlitBands(width * 2, (height + 1) / 2, ConvertRGBToYUVBand, &job);
+}
+
 static bool SDL_ConvertPixels_XRGB8888_to_YUV(int width, int height, const void *src, int src_pitch, SDL_PixelFormat dst_format, void *dst, int dst_pitch, YCbCrType yuv_type)
 {
-    const int src_pitch_x_2 = src_pitch * 2;
-    const int height_half = height / 2;
-    const int height_remainder = (height & 0x1);
     const int width_half = width / 2;
     const int width_remainder = (width & 0x1);
     int i, j;
@@ -812,29 +1655,6 @@ static bool SDL_ConvertPixels_XRGB8888_to_YUV(int width, int height, const void
 #define MAKE_U(r, g, b) (Uint8)SDL_clamp(((int)(cvt->u[0] * (r) + cvt->u[1] * (g) + cvt->u[2] * (b) + 0.5f) + 128), 0, 255)
 #define MAKE_V(r, g, b) (Uint8)SDL_clamp(((int)(cvt->v[0] * (r) + cvt->v[1] * (g) + cvt->v[2] * (b) + 0.5f) + 128), 0, 255)
 
-#define READ_2x2_PIXELS                                                                                     \
-    const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];                                                    \
-    const Uint32 p2 = ((const Uint32 *)curr_row)[2 * i + 1];                                                \
-    const Uint32 p3 = ((const Uint32 *)next_row)[2 * i];                                                    \
-    const Uint32 p4 = ((const Uint32 *)next_row)[2 * i + 1];                                                \
-    const Uint32 r = ((p1 & 0x00ff0000) + (p2 & 0x00ff0000) + (p3 & 0x00ff0000) + (p4 & 0x00ff0000)) >> 18; \
-    const Uint32 g = ((p1 & 0x0000ff00) + (p2 & 0x0000ff00) + (p3 & 0x0000ff00) + (p4 & 0x0000ff00)) >> 10; \
-    const Uint32 b = ((p1 & 0x000000ff) + (p2 & 0x000000ff) + (p3 & 0x000000ff) + (p4 & 0x000000ff)) >> 2
-
-#define READ_2x1_PIXELS                                             \
-    const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];            \
-    const Uint32 p2 = ((const Uint32 *)next_row)[2 * i];            \
-    const Uint32 r = ((p1 & 0x00ff0000) + (p2 & 0x00ff0000)) >> 17; \
-    const Uint32 g = ((p1 & 0x0000ff00) + (p2 & 0x0000ff00)) >> 9;  \
-    const Uint32 b = ((p1 & 0x000000ff) + (p2 & 0x000000ff)) >> 1
-
-#define READ_1x2_PIXELS                                             \
-    const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];            \
-    const Uint32 p2 = ((const Uint32 *)curr_row)[2 * i + 1];        \
-    const Uint32 r = ((p1 & 0x00ff0000) + (p2 & 0x00ff0000)) >> 17; \
-    const Uint32 g = ((p1 & 0x0000ff00) + (p2 & 0x0000ff00)) >> 9;  \
-    const Uint32 b = ((p1 & 0x000000ff) + (p2 & 0x000000ff)) >> 1
-
 #define READ_1x1_PIXEL                                  \
     const Uint32 p = ((const Uint32 *)curr_row)[2 * i]; \
     const Uint32 r = (p & 0x00ff0000) >> 16;            \
@@ -859,16 +1679,17 @@ static bool SDL_ConvertPixels_XRGB8888_to_YUV(int width, int height, const void
     switch (dst_format) {
     case SDL_PIXELFORMAT_YV12:
     case SDL_PIXELFORMAT_IYUV:
-    case SDL_PIXELFORMAT_P408:
     case SDL_PIXELFORMAT_NV12:
     case SDL_PIXELFORMAT_NV21:
+        return SDL_ConvertPixels_RGB_to_420(width, height, SDL_PIXELFORMAT_XRGB8888, src, src_pitch, dst_format, dst, dst_pitch, yuv_type);
+
+    case SDL_PIXELFORMAT_P408:
     {
-        const Uint8 *curr_row, *next_row;
+        const Uint8 *curr_row;
 
         Uint8 *plane_y;
         Uint8 *plane_u;
         Uint8 *plane_v;
-        Uint8 *plane_interleaved_uv;
         Uint32 y_stride, uv_stride, y_skip, uv_skip;
 
         if (!GetYUVPlanes(width, height, dst_format, dst, dst_pitch,
@@ -877,7 +1698,6 @@ static bool SDL_ConvertPixels_XRGB8888_to_YUV(int width, int height, const void
             return false;
         }
 
-        plane_interleaved_uv = (plane_y + height * y_stride);
         y_skip = (y_stride - width);
 
         curr_row = (const Uint8 *)src;
@@ -896,116 +1716,21 @@ static bool SDL_ConvertPixels_XRGB8888_to_YUV(int width, int height, const void
         }
 
         curr_row = (const Uint8 *)src;
-        next_row = (const Uint8 *)src;
-        next_row += src_pitch;
 
-        if (dst_format == SDL_PIXELFORMAT_YV12 || dst_format == SDL_PIXELFORMAT_IYUV) {
-            // Write UV planes, not interleaved
-            uv_skip = (uv_stride - (width + 1) / 2);
-            for (j = 0; j < height_half; j++) {
-                for (i = 0; i < width_half; i++) {
-                    READ_2x2_PIXELS;
-                    *plane_u++ = MAKE_U(r, g, b);
-                    *plane_v++ = MAKE_V(r, g, b);
-                }
-                if (width_remainder) {
-                    READ_2x1_PIXELS;
-                    *plane_u++ = MAKE_U(r, g, b);
-                    *plane_v++ = MAKE_V(r, g, b);
-                }
-                plane_u += uv_skip;
-                plane_v += uv_skip;
-                curr_row += src_pitch_x_2;
-                next_row += src_pitch_x_2;
-            }
-            if (height_remainder) {
-                for (i = 0; i < width_half; i++) {
-                    READ_1x2_PIXELS;
-                    *plane_u++ = MAKE_U(r, g, b);
-                    *plane_v++ = MAKE_V(r, g, b);
-                }
-                if (width_remainder) {
-                    READ_1x1_PIXEL;
-                    *plane_u++ = MAKE_U(r, g, b);
-                    *plane_v++ = MAKE_V(r, g, b);
-                }
-                plane_u += uv_skip;
-                plane_v += uv_skip;
-            }
-        } else if (dst_format == SDL_PIXELFORMAT_P408) {
-            // Write UV planes, not interleaved
-            uv_skip = (uv_stride - width);
-            for (j = 0; j < height; j++) {
-                for (i = 0; i < width; i++) {
-                    const Uint32 p1 = ((const Uint32 *)curr_row)[i];
-                    const Uint32 r = (p1 & 0x00ff0000) >> 16;
-                    const Uint32 g = (p1 & 0x0000ff00) >> 8;
-                    const Uint32 b = (p1 & 0x000000ff);
-                    *plane_u++ = MAKE_U(r, g, b);
-                    *plane_v++ = MAKE_V(r, g, b);
-                }
-                plane_u += uv_skip;
-                plane_v += uv_skip;
-                curr_row += src_pitch;
-            }
-        } else if (dst_format == SDL_PIXELFORMAT_NV12) {
-            uv_skip = (uv_stride - ((width + 1) / 2) * 2);
-            for (j = 0; j < height_half; j++) {
-                for (i = 0; i < width_half; i++) {
-                    READ_2x2_PIXELS;
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                }
-                if (width_remainder) {
-                    READ_2x1_PIXELS;
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                }
-                plane_interleaved_uv += uv_skip;
-                curr_row += src_pitch_x_2;
-                next_row += src_pitch_x_2;
-            }
-            if (height_remainder) {
-                for (i = 0; i < width_half; i++) {
-                    READ_1x2_PIXELS;
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                }
-                if (width_remainder) {
-                    READ_1x1_PIXEL;
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                }
-            }
-        } else /* dst_format == SDL_PIXELFORMAT_NV21 */ {
-            uv_skip = (uv_stride - ((width + 1) / 2) * 2);
-            for (j = 0; j < height_half; j++) {
-                for (i = 0; i < width_half; i++) {
-                    READ_2x2_PIXELS;
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                }
-                if (width_remainder) {
-                    READ_2x1_PIXELS;
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                }
-                plane_interleaved_uv += uv_skip;
-                curr_row += src_pitch_x_2;
-                next_row += src_pitch_x_2;
-            }
-            if (height_remainder) {
-                for (i = 0; i < width_half; i++) {
-                    READ_1x2_PIXELS;
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                }
-                if (width_remainder) {
-                    READ_1x1_PIXEL;
-                    *plane_interleaved_uv++ = MAKE_V(r, g, b);
-                    *plane_interleaved_uv++ = MAKE_U(r, g, b);
-                }
+        // Write UV planes, not interleaved
+        uv_skip = (uv_stride - width);
+        for (j = 0; j < height; j++) {
+            for (i = 0; i < width; i++) {
+                const Uint32 p1 = ((const Uint32 *)curr_row)[i];
+                const Uint32 r = (p1 & 0x00ff0000) >> 16;
+                const Uint32 g = (p1 & 0x0000ff00) >> 8;
+                const Uint32 b = (p1 & 0x000000ff);
+                *plane_u++ = MAKE_U(r, g, b);
+                *plane_v++ = MAKE_V(r, g, b);
             }
+            plane_u += uv_skip;
+            plane_v += uv_skip;
+            curr_row += src_pitch;
         }
     } break;
 
@@ -1096,137 +1821,12 @@ static bool SDL_ConvertPixels_XRGB8888_to_YUV(int width, int height, const void
 #undef MAKE_Y
 #undef MAKE_U
 #undef MAKE_V
-#undef READ_2x2_PIXELS
-#undef READ_2x1_PIXELS
-#undef READ_1x2_PIXELS
 #undef READ_1x1_PIXEL
 #undef READ_TWO_RGB_PIXELS
 #undef READ_ONE_RGB_PIXEL
     return true;
 }
 
-static bool SDL_ConvertPixels_XBGR2101010_to_P010(int width, int height, const void *src, int src_pitch, SDL_PixelFormat dst_format, void *dst, int dst_pitch, YCbCrType yuv_type)
-{
-    const int src_pitch_x_2 = src_pitch * 2;
-    const int height_half = height / 2;
-    const int height_remainder = (height & 0x1);
-    const int width_half = width / 2;
-    const int width_remainder = (width & 0x1);
-    int i, j;
-
-    const struct RGB2YUVFactors *cvt = &RGB2YUVFactorTables[yuv_type];
-
-#define MAKE_Y(r, g, b) (Uint16)(((int)(cvt->y[0] * (r) + cvt->y[1] * (g) + cvt->y[2] * (b) + 0.5f) + cvt->y_offset) << 6)
-#define MAKE_U(r, g, b) (Uint16)(((int)(cvt->u[0] * (r) + cvt->u[1] * (g) + cvt->u[2] * (b) + 0.5f) + 512) << 6)
-#define MAKE_V(r, g, b) (Uint16)(((int)(cvt->v[0] * (r) + cvt->v[1] * (g) + cvt->v[2] * (b) + 0.5f) + 512) << 6)
-
-#define READ_2x2_PIXELS                                                                                     \
-    const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];                                                    \
-    const Uint32 p2 = ((const Uint32 *)curr_row)[2 * i + 1];                                                \
-    const Uint32 p3 = ((const Uint32 *)next_row)[2 * i];                                                    \
-    const Uint32 p4 = ((const Uint32 *)next_row)[2 * i + 1];                                                \
-    const Uint32 r = ((p1 & 0x000003ff) + (p2 & 0x000003ff) + (p3 & 0x000003ff) + (p4 & 0x000003ff)) >> 2;  \
-    const Uint32 g = ((p1 & 0x000ffc00) + (p2 & 0x000ffc00) + (p3 & 0x000ffc00) + (p4 & 0x000ffc00)) >> 12; \
-    const Uint32 b = ((p1 & 0x3ff00000) + (p2 & 0x3ff00000) + (p3 & 0x3ff00000) + (p4 & 0x3ff00000)) >> 22
-
-#define READ_2x1_PIXELS                                             \
-    const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];            \
-    const Uint32 p2 = ((const Uint32 *)next_row)[2 * i];            \
-    const Uint32 r = ((p1 & 0x000003ff) + (p2 & 0x000003ff)) >> 1;  \
-    const Uint32 g = ((p1 & 0x000ffc00) + (p2 & 0x000ffc00)) >> 11; \
-    const Uint32 b = ((p1 & 0x3ff00000) + (p2 & 0x3ff00000)) >> 21
-
-#define READ_1x2_PIXELS                                             \
-    const Uint32 p1 = ((const Uint32 *)curr_row)[2 * i];            \
-    const Uint32 p2 = ((const Uint32 *)curr_row)[2 * i + 1];        \
-    const Uint32 r = ((p1 & 0x000003ff) + (p2 & 0x000003ff)) >> 1;  \
-    const Uint32 g = ((p1 & 0x000ffc00) + (p2 & 0x000ffc00)) >> 11; \
-    const Uint32 b = ((p1 & 0x3ff00000) + (p2 & 0x3ff00000)) >> 21
-
-#define READ_1x1_PIXEL                                  \
-    const Uint32 p = ((const Uint32 *)curr_row)[2 * i]; \
-    const Uint32 r = (p & 0x000003ff);                  \
-    const Uint32 g = (p & 0x000ffc00) >> 10;            \
-    const Uint32 b = (p & 0x3ff00000) >> 20
-
-    const Uint8 *curr_row, *next_row;
-
-    Uint16 *plane_y;
-    Uint16 *plane_u;
-    Uint16 *plane_v;
-    Uint16 *plane_interleaved_uv;
-    Uint32 y_stride, uv_stride, y_skip, uv_skip;
-
-    if (!GetYUVPlanes(width, height, dst_format, dst, dst_pitch,
-                      (const Uint8 **)&plane_y, (const Uint8 **)&plane_u, (const Uint8 **)&plane_v,
-                      &y_stride, &uv_stride)) {
-        return false;
-    }
-
-    y_stride /= sizeof(Uint16);
-    uv_stride /= sizeof(Uint16);
-
-    plane_interleaved_uv = (plane_y + height * y_stride);
-    y_skip = (y_stride - width);
-
-    curr_row = (const Uint8 *)src;
-
-    // Write Y plane
-    for (j = 0; j < height; j++) {
-        for (i = 0; i < width; i++) {
-            const Uint32 p1 = ((const Uint32 *)curr_row)[i];
-            const Uint32 r = (p1 >>  0) & 0x03ff;
-            const Uint32 g = (p1 >> 10) & 0x03ff;
-            const Uint32 b = (p1 >> 20) & 0x03ff;
-            *plane_y++ = MAKE_Y(r, g, b);
-        }
-        plane_y += y_skip;
-        curr_row += src_pitch;
-    }
-
-    curr_row = (const Uint8 *)src;
-    next_row = (const Uint8 *)src;
-    next_row += src_pitch;
-
-    uv_skip = (uv_stride - ((width + 1) / 2) * 2);
-    for (j = 0; j < height_half; j++) {
-        for (i = 0; i < width_half; i++) {
-            READ_2x2_PIXELS;
-            *plane_interleaved_uv++ = MAKE_U(r, g, b);
-            *plane_interleaved_uv++ = MAKE_V(r, g, b);
-        }
-        if (width_remainder) {
-            READ_2x1_PIXELS;
-            *plane_interleaved_uv++ = MAKE_U(r, g, b);
-            *plane_interleaved_uv++ = MAKE_V(r, g, b);
-        }
-        plane_interleaved_uv += uv_skip;
-        curr_row += src_pitch_x_2;
-        next_row += src_pitch_x_2;
-    }
-    if (height_remainder) {
-        for (i = 0; i < width_half; i++) {
-            READ_1x2_PIXELS;
-            *plane_interleaved_uv++ = MAKE_U(r, g, b);
-            *plane_interleaved_uv++ = MAKE_V(r, g, b);
-        }
-        if (width_remainder) {
-            READ_1x1_PIXEL;
-            *plane_interleaved_uv++ = MAKE_U(r, g, b);
-            *plane_interleaved_uv++ = MAKE_V(r, g, b);
-        }
-    }
-
-#undef MAKE_Y
-#undef MAKE_U
-#undef MAKE_V
-#undef READ_2x2_PIXELS
-#undef READ_2x1_PIXELS
-#undef READ_1x2_PIXELS
-#undef READ_1x1_PIXEL
-    return true;
-}
-
 bool SDL_ConvertPixels_RGB_to_YUV(int width, int height,
                                   SDL_PixelFormat src_format, SDL_Colorspace src_colorspace, SDL_PropertiesID src_properties, const void *src, int src_pitch,
                                   SDL_PixelFormat dst_format, SDL_Colorspace dst_colorspace, SDL_PropertiesID dst_properties, void *dst, int dst_pitch)
@@ -1260,9 +1860,16 @@ bool SDL_ConvertPixels_RGB_to_YUV(int width, int height,
         return SDL_ConvertPixels_XRGB8888_to_YUV(width, height, src, src_pitch, dst_format, dst, dst_pitch, yuv_type);
     }
 
+    // Any other 8888 layout to 4:2:0, reading the pixels in place
+    if (IsRGB8888Format(src_format) && src_colorspace == SDL_COLORSPACE_SRGB &&
+        (dst_format == SDL_PIXELFORMAT_YV12 || dst_format == SDL_PIXELFORMAT_IYUV ||
+         dst_format == SDL_PIXELFORMAT_NV12 || dst_format == SDL_PIXELFORMAT_NV21)) {
+        return SDL_ConvertPixels_RGB_to_420(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch, yuv_type);
+    }
+
     if (dst_format == SDL_PIXELFORMAT_P010) {
         if (src_format == SDL_PIXELFORMAT_XBGR2101010) {
-            return SDL_ConvertPixels_XBGR2101010_to_P010(width, height, src, src_pitch, dst_format, dst, dst_pitch, yuv_type);
+            return SDL_ConvertPixels_RGB_to_420(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch, yuv_type);
         }
 
         // We currently only support converting from XBGR2101010 to P010
@@ -1283,7 +1890,7 @@ bool SDL_ConvertPixels_RGB_to_YUV(int width, int height,
         }
 
         // convert tmp/XBGR2101010 to dst/P010
-        result = SDL_ConvertPixels_XBGR2101010_to_P010(width, height, tmp, tmp_pitch, dst_format, dst, dst_pitch, yuv_type);
+        result = SDL_ConvertPixels_RGB_to_420(width, height, SDL_PIXELFORMAT_XBGR2101010, tmp, tmp_pitch, dst_format, dst, dst_pitch, yuv_type);
         SDL_free(tmp);
         return result;
     }
@@ -23,10 +23,308 @@
 #ifdef SDL_VIDEO_DRIVER_OFFSCREEN
 
 #include "../SDL_sysvideo.h"
+#include "../../SDL_hints_c.h"
 #include "../../SDL_properties_c.h"
 #include "SDL_offscreenframebuffer_c.h"
 
 #define OFFSCREEN_SURFACE "SDL.internal.window.surface"
+#define OFFSCREEN_CAPTURE "SDL.internal.window.capture"
+
+/* Frame capture for SDL_HINT_VIDEO_OFFSCREEN_SAVE_FRAMES
+ *
+ * Frames are copied into one of two capture buffers and handed to a writer thread, so the
+ * app can render the next frame while the last one is being encoded and written out. Only
+ * the dirty rectangles are copied: a buffer last held the frame before the previous one, so
+ * it's brought up to date with the previous frame's rectangles as well as the current ones.
+ */
+
+typedef enum OFFSCREEN_CaptureMode
+{
+    OFFSCREEN_CAPTURE_NONE,
+    OFFSCREEN_CAPTURE_BMP,
+    OFFSCREEN_CAPTURE_PNG,
+    OFFSCREEN_CAPTURE_RAW,
+    OFFSCREEN_CAPTURE_HASH
+} OFFSCREEN_CaptureMode;
+
+typedef struct OFFSCREEN_FrameCapture
+{
+    OFFSCREEN_CaptureMode mode;
+    SDL_WindowID windowID;
+    SDL_IOStream *stream;       // raw and hash modes write here
+    bool close_stream;
+    Uint32 *hash_row;           // hash mode's copy of a row, with the unused bits cleared
+
+    SDL_Surface *buffers[2];
+    bool filled[2];             // false until a buffer has had a full frame copied into it
+    int next;                   // the buffer the next frame is copied into
+
+    SDL_Rect *last_rects;       // dirty rectangles of the previous frame
+    int num_last_rects;
+    int max_last_rects;
+
+    SDL_Mutex *lock;
+    SDL_Condition *cond;
+    SDL_Thread *thread;
+    int queue[2];               // buffers waiting to be written, oldest first
+    int frame_numbers[2];
+    int queued;
+    bool busy[2];               // true from when a buffer is queued until it's written
+    bool quit;
+} OFFSCREEN_FrameCapture;
+
+static int frame_number;
+
+static OFFSCREEN_CaptureMode GetCaptureMode(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_VIDEO_OFFSCREEN_SAVE_FRAMES);
+
+    if (!hint) {
+        return OFFSCREEN_CAPTURE_NONE;
+    } else if (SDL_strcasecmp(hint, "bmp") == 0) {
+        return OFFSCREEN_CAPTURE_BMP;
+    } else if (SDL_strcasecmp(hint, "png") == 0) {
+        return OFFSCREEN_CAPTURE_PNG;
+    } else if (SDL_strcasecmp(hint, "raw") == 0) {
+        return OFFSCREEN_CAPTURE_RAW;
+    } else if (SDL_strcasecmp(hint, "hash") == 0) {
+        return OFFSCREEN_CAPTURE_HASH;
+    }
+    return SDL_GetStringBoolean(hint, false) ? OFFSCREEN_CAPTURE_BMP : OFFSCREEN_CAPTURE_NONE;
+}
+
+static void WriteFrame(OFFSCREEN_FrameCapture *capture, SDL_Surface *surface, int number)
+{
+    char file[128];
+
+    switch (capture->mode) {
+    case OFFSCREEN_CAPTURE_BMP:
+        (void)SDL_snprintf(file, sizeof(file), "SDL_window%" SDL_PRIu32 "-%8.8d.bmp", capture->windowID, number);
+        SDL_SaveBMP(surface, file);
+        break;
+    case OFFSCREEN_CAPTURE_PNG:
+        (void)SDL_snprintf(file, sizeof(file), "SDL_window%" SDL_PRIu32 "-%8.8d.png", capture->windowID, number);
+        SDL_SavePNG(surface, file);
+        break;
+    case OFFSCREEN_CAPTURE_RAW:
+    {
+        const size_t row_size = (size_t)surface->w * SDL_BYTESPERPIXEL(surface->format);
+        const Uint8 *row = (const Uint8 *)surface->pixels;
+
+        if (capture->stream && surface->pitch == (int)row_size) {
+            SDL_WriteIO(capture->stream, row, row_size * surface->h);
+        } else if (capture->stream) {
+            for (int y = 0; y < surface->h; ++y, row += surface->pitch) {
+                if (SDL_WriteIO(capture->stream, row, row_size) != row_size) {
+                    break;
+                }
+            }
+        }
+        break;
+    }
+    case OFFSCREEN_CAPTURE_HASH:
+    {
+        // the unused byte of XRGB8888 is undefined, so it's masked out and only the color channels are hashed.
+        const SDL_PixelFormatDetails *details = SDL_GetPixelFormatDetails(surface->format);
+        const Uint32 mask = details->Rmask | details->Gmask | details->Bmask | details->Amask;
+        const Uint8 *row = (const Uint8 *)surface->pixels;
+        Uint32 hash = 0;
+
+        SDL_assert(SDL_BYTESPERPIXEL(surface->format) == 4);
+        for (int y = 0; y < surface->h; ++y, row += surface->pitch) {
+            const Uint32 *src = (const Uint32 *)row;
+            for (int x = 0; x < surface->w; ++x) {
+                capture->hash_row[x] = src[x] & mask;
+            }
+            hash = SDL_murmur3_32(capture->hash_row, (size_t)surface->w * sizeof(*capture->hash_row), hash);
+        }
+        if (capture->stream) {
+            SDL_IOprintf(capture->stream, "%8.8d %dx%d %8.8" SDL_PRIx32 "\n", number, surface->w, surface->h, hash);
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+static int SDLCALL FrameCaptureThread(void *data)
+{
+    OFFSCREEN_FrameCapture *capture = (OFFSCREEN_FrameCapture *)data;
+
+    SDL_LockMutex(capture->lock);
+    for (;;) {
+        while (!capture->queued && !capture->quit) {
+            SDL_WaitCondition(capture->cond, capture->lock);
+        }
+        if (!capture->queued) {
+            break;  // quitting, and everything has been written.
+        }
+
+        const int buffer = capture->queue[0];
+        const int number = capture->frame_numbers[0];
+        SDL_UnlockMutex(capture->lock);
+
+        WriteFrame(capture, capture->buffers[buffer], number);
+
+        SDL_LockMutex(capture->lock);
+        capture->queue[0] = capture->queue[1];
+        capture->frame_numbers[0] = capture->frame_numbers[1];
+        --capture->queued;
+        capture->busy[buffer] = false;
+        SDL_BroadcastCondition(capture->cond);
+    }
+    SDL_UnlockMutex(capture->lock);
+
+    return 0;
+}
+
+static void SDLCALL DestroyFrameCapture(void *userdata, void *value)
+{
+    OFFSCREEN_FrameCapture *capture = (OFFSCREEN_FrameCapture *)value;
+
+    if (capture->thread) {
+        // let the writer finish any queued frames first.
+        SDL_LockMutex(capture->lock);
+        capture->quit = true;
+        SDL_BroadcastCondition(capture->cond);
+        SDL_UnlockMutex(capture->lock);
+        SDL_WaitThread(capture->thread, NULL);
+    }
+    if (capture->stream) {
+        if (capture->close_stream) {
+            SDL_CloseIO(capture->stream);
+        } else {
+            SDL_FlushIO(capture->stream);
+        }
+    }
+    SDL_DestroySurface(capture->buffers[0]);
+    SDL_DestroySurface(capture->buffers[1]);
+    SDL_DestroyCondition(capture->cond);
+    SDL_DestroyMutex(capture->lock);
+    SDL_free(capture->last_rects);
+    SDL_free(capture->hash_row);
+    SDL_free(capture);
+}
+
+static OFFSCREEN_FrameCapture *CreateFrameCapture(SDL_Window *window, SDL_Surface *surface, OFFSCREEN_CaptureMode mode)
+{
+    OFFSCREEN_FrameCapture *capture = (OFFSCREEN_FrameCapture *)SDL_calloc(1, sizeof(*capture));
+    if (!capture) {
+        return NULL;
+    }
+
+    capture->mode = mode;
+    capture->windowID = SDL_GetWindowID(window);
+
+    if (mode == OFFSCREEN_CAPTURE_RAW || mode == OFFSCREEN_CAPTURE_HASH) {
+        capture->stream = (SDL_IOStream *)SDL_GetPointerProperty(SDL_GetWindowProperties(window), SDL_PROP_WINDOW_OFFSCREEN_FRAME_STREAM_POINTER, NULL);
+        if (!capture->stream) {
+            char file[128];
+            (void)SDL_snprintf(file, sizeof(file), "SDL_window%" SDL_PRIu32 "%s", capture->windowID,
+                               (mode == OFFSCREEN_CAPTURE_RAW) ? ".raw" : "-hashes.txt");
+            capture->stream = SDL_IOFromFile(file, "wb");
+            capture->close_stream = true;
+            if (!capture->stream) {
+                goto failed;
+            }
+        }
+    }
+
+    if (mode == OFFSCREEN_CAPTURE_HASH) {
+        capture->hash_row = (Uint32 *)SDL_malloc(surface->w * sizeof(*capture->hash_row));
+        if (!capture->hash_row) {
+            goto failed;
+        }
+    }
+
+    capture->buffers[0] = SDL_CreateSurface(surface->w, surface->h, surface->format);
+    capture->buffers[1] = SDL_CreateSurface(surface->w, surface->h, surface->format);
+    capture->lock = SDL_CreateMutex();
+    capture->cond = SDL_CreateCondition();
+    if (!capture->buffers[0] || !capture->buffers[1] || !capture->lock || !capture->cond) {
+        goto failed;
+    }
+
+    capture->thread = SDL_CreateThread(FrameCaptureThread, "SDLFrameCapture", capture);
+    if (!capture->thread) {
+        goto failed;
+    }
+    return capture;
+
+failed:
+    DestroyFrameCapture(NULL, capture);
+    return NULL;
+}
+
+static void CopyCaptureRects(SDL_Surface *dst, SDL_Surface *src, const SDL_Rect *rects, int numrects)
+{
+    const SDL_Rect bounds = { 0, 0, src->w, src->h };
+    const int bpp = SDL_BYTESPERPIXEL(src->format);
+
+    for (int i = 0; i < numrects; ++i) {
+        SDL_Rect rect;
+        if (!SDL_GetRectIntersection(&rects[i], &bounds, &rect)) {
+            continue;
+        }
+
+        const Uint8 *srcrow = (const Uint8 *)src->pixels + rect.y * src->pitch + rect.x * bpp;
+        Uint8 *dstrow = (Uint8 *)dst->pixels + rect.y * dst->pitch + rect.x * bpp;
+        for (int y = 0; y < rect.h; ++y) {
+            SDL_memcpy(dstrow, srcrow, (size_t)rect.w * bpp);
+            srcrow += src->pitch;
+            dstrow += dst->pitch;
+        }
+    }
+}
+
+static bool CaptureFrame(OFFSCREEN_FrameCapture *capture, SDL_Surface *surface, const SDL_Rect *rects, int numrects)
+{
+    const int buffer = capture->next;
+    SDL_Surface *dst = capture->buffers[buffer];
+
+    // wait for the writer to finish with this buffer, which held the frame before last.
+    SDL_LockMutex(capture->lock);
+    while (capture->busy[buffer]) {
+        SDL_WaitCondition(capture->cond, capture->lock);
+    }
+    SDL_UnlockMutex(capture->lock);
+
+    if (!capture->filled[buffer]) {
+        SDL_memcpy(dst->pixels, surface->pixels, (size_t)surface->h * surface->pitch);
+        capture->filled[buffer] = true;
+    } else {
+        CopyCaptureRects(dst, surface, capture->last_rects, capture->num_last_rects);
+        CopyCaptureRects(dst, surface, rects, numrects);
+    }
+
+    if (numrects > capture->max_last_rects) {
+        SDL_Rect *last_rects = (SDL_Rect *)SDL_realloc(capture->last_rects, numrects * sizeof(*last_rects));
+        if (!last_rects) {
+            // we can't track what changed, so make the next buffer copy everything.
+            capture->filled[!buffer] = false;
+            numrects = 0;
+        } else {
+            capture->last_rects = last_rects;
+            capture->max_last_rects = numrects;
+        }
+    }
+    if (numrects > 0) {
+        SDL_memcpy(capture->last_rects, rects, numrects * sizeof(*rects));
+    }
+    capture->num_last_rects = numrects;
+    capture->next = !buffer;
+
+    SDL_LockMutex(capture->lock);
+    capture->busy[buffer] = true;
+    capture->queue[capture->queued] = buffer;
+    capture->frame_numbers[capture->queued] = ++frame_number;
+    ++capture->queued;
+    SDL_SignalCondition(capture->cond);
+    SDL_UnlockMutex(capture->lock);
+
+    return true;
+}
 
 
 bool SDL_OFFSCREEN_CreateWindowFramebuffer(SDL_VideoDevice *_this, SDL_Window *window, SDL_PixelFormat *format, void **pixels, int *pitch)
@@ -53,26 +351,39 @@ bool SDL_OFFSCREEN_CreateWindowFramebuffer(SDL_VideoDevice *_this, SDL_Window *w
 
 bool SDL_OFFSCREEN_UpdateWindowFramebuffer(SDL_VideoDevice *_this, SDL_Window *window, const SDL_Rect *rects, int numrects)
 {
-    static int frame_number;
+    SDL_PropertiesID props = SDL_GetWindowProperties(window);
     SDL_Surface *surface;
+    OFFSCREEN_FrameCapture *capture;
+    OFFSCREEN_CaptureMode mode;
 
-    surface = (SDL_Surface *)SDL_GetPointerProperty(SDL_GetWindowProperties(window), OFFSCREEN_SURFACE, NULL);
+    surface = (SDL_Surface *)SDL_GetPointerProperty(props, OFFSCREEN_SURFACE, NULL);
     if (!surface) {
         return SDL_SetError("Couldn't find offscreen surface for window");
     }
 
     // Send the data to the display
-    if (SDL_GetHintBoolean(SDL_HINT_VIDEO_OFFSCREEN_SAVE_FRAMES, false)) {
-        char file[128];
-        (void)SDL_snprintf(file, sizeof(file), "SDL_window%" SDL_PRIu32 "-%8.8d.bmp",
-                           SDL_GetWindowID(window), ++frame_number);
-        SDL_SaveBMP(surface, file);
+    mode = GetCaptureMode();
+    capture = (OFFSCREEN_FrameCapture *)SDL_GetPointerProperty(props, OFFSCREEN_CAPTURE, NULL);
+    if (capture && (capture->mode != mode || capture->buffers[0]->w != surface->w || capture->buffers[0]->h != surface->h)) {
+        SDL_ClearProperty(props, OFFSCREEN_CAPTURE);  // this waits for queued frames to be written.
+        capture = NULL;
+    }
+    if (mode != OFFSCREEN_CAPTURE_NONE) {
+        if (!capture) {
+            capture = CreateFrameCapture(window, surface, mode);
+            if (!capture) {
+                return false;
+            }
+            SDL_SetPointerPropertyWithCleanup(props, OFFSCREEN_CAPTURE, capture, DestroyFrameCapture, NULL);
+        }
+        return CaptureFrame(capture, surface, rects, numrects);
     }
     return true;
 }
 
 void SDL_OFFSCREEN_DestroyWindowFramebuffer(SDL_VideoDevice *_this, SDL_Window *window)
 {
+    SDL_ClearProperty(SDL_GetWindowProperties(window), OFFSCREEN_CAPTURE);
     SDL_ClearProperty(SDL_GetWindowProperties(window), OFFSCREEN_SURFACE);
 }
 
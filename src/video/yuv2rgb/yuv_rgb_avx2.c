@@ -0,0 +1,286 @@
+// Copyright 2016 Adrien Descamps
+// Distributed under BSD 3-Clause License
+#include "SDL_internal.h"
+
+#ifdef SDL_HAVE_YUV
+#include "yuv_rgb_internal.h"
+
+#ifdef SDL_AVX2_INTRINSICS
+
+/* The unpack and pack instructions work within each 128-bit lane, so the
+ * helpers below take their channels with the pixels in memory order and put
+ * them back in order before storing.
+ */
+
+// Interleave 4 planes of 32 bytes into 32 pixels, returned as 4 vectors of 8 pixels in order
+static SDL_INLINE void SDL_TARGETING("avx2") avx2_interleave_32bpp(__m256i c0, __m256i c1, __m256i c2, __m256i c3, __m256i *out)
+{
+	const __m256i lo_01 = _mm256_unpacklo_epi8(c0, c1);
+	const __m256i hi_01 = _mm256_unpackhi_epi8(c0, c1);
+	const __m256i lo_23 = _mm256_unpacklo_epi8(c2, c3);
+	const __m256i hi_23 = _mm256_unpackhi_epi8(c2, c3);
+	const __m256i p0 = _mm256_unpacklo_epi16(lo_01, lo_23); // pixels 0-3, 16-19
+	const __m256i p1 = _mm256_unpackhi_epi16(lo_01, lo_23); // pixels 4-7, 20-23
+	const __m256i p2 = _mm256_unpacklo_epi16(hi_01, hi_23); // pixels 8-11, 24-27
+	const __m256i p3 = _mm256_unpackhi_epi16(hi_01, hi_23); // pixels 12-15, 28-31
+
+	out[0] = _mm256_permute2x128_si256(p0, p1, 0x20);
+	out[1] = _mm256_permute2x128_si256(p2, p3, 0x20);
+	out[2] = _mm256_permute2x128_si256(p0, p1, 0x31);
+	out[3] = _mm256_permute2x128_si256(p2, p3, 0x31);
+}
+
+// Save 32 pixels with c0 in the first byte of each pixel and c3 in the last
+static SDL_INLINE void SDL_TARGETING("avx2") avx2_save_32bpp(uint8_t *rgb_ptr, __m256i c0, __m256i c1, __m256i c2, __m256i c3)
+{
+	__m256i out[4];
+
+	avx2_interleave_32bpp(c0, c1, c2, c3, out);
+	_mm256_storeu_si256((__m256i *)(rgb_ptr), out[0]);
+	_mm256_storeu_si256((__m256i *)(rgb_ptr + 32), out[1]);
+	_mm256_storeu_si256((__m256i *)(rgb_ptr + 64), out[2]);
+	_mm256_storeu_si256((__m256i *)(rgb_ptr + 96), out[3]);
+}
+
+// Save 32 RGB24 pixels, without writing past the 96 bytes they cover
+static SDL_INLINE void SDL_TARGETING("avx2") avx2_save_rgb24(uint8_t *rgb_ptr, __m256i r, __m256i g, __m256i b)
+{
+	const __m256i drop_pad = _mm256_setr_epi8(
+		0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1,
+		0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+	const __m256i join_lanes = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+	__m256i out[4];
+	int i;
+
+	avx2_interleave_32bpp(r, g, b, _mm256_setzero_si256(), out);
+	for (i = 0; i < 4; ++i) {
+		const __m256i rgb = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(out[i], drop_pad), join_lanes);
+		_mm_storeu_si128((__m128i *)(rgb_ptr + i * 24), _mm256_castsi256_si128(rgb));
+		_mm_storel_epi64((__m128i *)(rgb_ptr + i * 24 + 16), _mm256_extracti128_si256(rgb, 1));
+	}
+}
+
+// Pack 16 pixels of unclamped 16-bit channels into RGB565
+static SDL_INLINE __m256i SDL_TARGETING("avx2") avx2_pack_rgb565(__m256i r, __m256i g, __m256i b)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i max = _mm256_set1_epi16(255);
+
+	r = _mm256_min_epi16(_mm256_max_epi16(r, zero), max);
+	g = _mm256_min_epi16(_mm256_max_epi16(g, zero), max);
+	b = _mm256_min_epi16(_mm256_max_epi16(b, zero), max);
+	r = _mm256_slli_epi16(_mm256_and_si256(r, _mm256_set1_epi16(0xF8)), 8);
+	g = _mm256_slli_epi16(_mm256_and_si256(g, _mm256_set1_epi16(0xFC)), 3);
+	b = _mm256_srli_epi16(b, 3);
+	return _mm256_or_si256(_mm256_or_si256(r, g), b);
+}
+
+// Pack 8 pixels of unclamped 32-bit channels into XBGR2101010
+static SDL_INLINE __m256i SDL_TARGETING("avx2") avx2_pack_xbgr2101010(__m256i r, __m256i g, __m256i b)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i max = _mm256_set1_epi32(1023);
+
+	r = _mm256_min_epi32(_mm256_max_epi32(r, zero), max);
+	g = _mm256_min_epi32(_mm256_max_epi32(g, zero), max);
+	b = _mm256_min_epi32(_mm256_max_epi32(b, zero), max);
+	return _mm256_or_si256(_mm256_set1_epi32((int)0xC0000000),
+		_mm256_or_si256(_mm256_slli_epi32(b, 20), _mm256_or_si256(_mm256_slli_epi32(g, 10), r)));
+}
+
+#define W(i)	(char)(2 * (i)), (char)(2 * (i) + 1)
+#define Z		-1, -1
+
+// Save 8 RGB48 pixels from 16-bit channels
+static SDL_INLINE void SDL_TARGETING("avx2") avx2_save_rgb48_half(uint8_t *rgb_ptr, __m128i r, __m128i g, __m128i b)
+{
+	const __m128i rg_lo = _mm_unpacklo_epi16(r, g);
+	const __m128i rg_hi = _mm_unpackhi_epi16(r, g);
+	__m128i out;
+
+	// R0 G0 B0 R1 G1 B1 R2 G2
+	out = _mm_or_si128(
+		_mm_shuffle_epi8(rg_lo, _mm_setr_epi8(W(0), W(1), Z, W(2), W(3), Z, W(4), W(5))),
+		_mm_shuffle_epi8(b, _mm_setr_epi8(Z, Z, W(0), Z, Z, W(1), Z, Z)));
+	_mm_storeu_si128((__m128i *)(rgb_ptr), out);
+
+	// B2 R3 G3 B3 R4 G4 B4 R5
+	out = _mm_or_si128(_mm_or_si128(
+		_mm_shuffle_epi8(rg_lo, _mm_setr_epi8(Z, W(6), W(7), Z, Z, Z, Z, Z)),
+		_mm_shuffle_epi8(rg_hi, _mm_setr_epi8(Z, Z, Z, Z, W(0), W(1), Z, W(2)))),
+		_mm_shuffle_epi8(b, _mm_setr_epi8(W(2), Z, Z, W(3), Z, Z, W(4), Z)));
+	_mm_storeu_si128((__m128i *)(rgb_ptr + 16), out);
+
+	// G5 B5 R6 G6 B6 R7 G7 B7
+	out = _mm_or_si128(
+		_mm_shuffle_epi8(rg_hi, _mm_setr_epi8(W(3), Z, W(4), W(5), Z, W(6), W(7), Z)),
+		_mm_shuffle_epi8(b, _mm_setr_epi8(Z, W(5), Z, Z, W(6), Z, Z, W(7))));
+	_mm_storeu_si128((__m128i *)(rgb_ptr + 32), out);
+}
+
+#undef W
+#undef Z
+
+// Save 16 RGB48 pixels from 16-bit channels
+static SDL_INLINE void SDL_TARGETING("avx2") avx2_save_rgb48(uint8_t *rgb_ptr, __m256i r, __m256i g, __m256i b)
+{
+	avx2_save_rgb48_half(rgb_ptr, _mm256_castsi256_si128(r), _mm256_castsi256_si128(g), _mm256_castsi256_si128(b));
+	avx2_save_rgb48_half(rgb_ptr + 48, _mm256_extracti128_si256(r, 1), _mm256_extracti128_si256(g, 1), _mm256_extracti128_si256(b, 1));
+}
+
+#define YUV_BITS	8
+
+#define AVX2_FUNCTION_NAME	yuv420_rgb565_avx2
+#define STD_FUNCTION_NAME	yuv420_rgb565_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_RGB565
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv420_rgb24_avx2
+#define STD_FUNCTION_NAME	yuv420_rgb24_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_RGB24
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv420_rgba_avx2
+#define STD_FUNCTION_NAME	yuv420_rgba_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_RGBA
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv420_bgra_avx2
+#define STD_FUNCTION_NAME	yuv420_bgra_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_BGRA
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv420_argb_avx2
+#define STD_FUNCTION_NAME	yuv420_argb_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_ARGB
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv420_abgr_avx2
+#define STD_FUNCTION_NAME	yuv420_abgr_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_ABGR
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv422_rgb565_avx2
+#define STD_FUNCTION_NAME	yuv422_rgb565_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_RGB565
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv422_rgb24_avx2
+#define STD_FUNCTION_NAME	yuv422_rgb24_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_RGB24
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv422_rgba_avx2
+#define STD_FUNCTION_NAME	yuv422_rgba_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_RGBA
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv422_bgra_avx2
+#define STD_FUNCTION_NAME	yuv422_bgra_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_BGRA
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv422_argb_avx2
+#define STD_FUNCTION_NAME	yuv422_argb_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_ARGB
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv422_abgr_avx2
+#define STD_FUNCTION_NAME	yuv422_abgr_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_ABGR
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv444_rgba_avx2
+#define STD_FUNCTION_NAME	yuv444_rgba_std
+#define YUV_FORMAT			YUV_FORMAT_444
+#define RGB_FORMAT			RGB_FORMAT_RGBA
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv444_bgra_avx2
+#define STD_FUNCTION_NAME	yuv444_bgra_std
+#define YUV_FORMAT			YUV_FORMAT_444
+#define RGB_FORMAT			RGB_FORMAT_BGRA
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv444_argb_avx2
+#define STD_FUNCTION_NAME	yuv444_argb_std
+#define YUV_FORMAT			YUV_FORMAT_444
+#define RGB_FORMAT			RGB_FORMAT_ARGB
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv444_abgr_avx2
+#define STD_FUNCTION_NAME	yuv444_abgr_std
+#define YUV_FORMAT			YUV_FORMAT_444
+#define RGB_FORMAT			RGB_FORMAT_ABGR
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuvnv12_rgb565_avx2
+#define STD_FUNCTION_NAME	yuvnv12_rgb565_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_RGB565
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuvnv12_rgb24_avx2
+#define STD_FUNCTION_NAME	yuvnv12_rgb24_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_RGB24
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuvnv12_rgba_avx2
+#define STD_FUNCTION_NAME	yuvnv12_rgba_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_RGBA
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuvnv12_bgra_avx2
+#define STD_FUNCTION_NAME	yuvnv12_bgra_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_BGRA
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuvnv12_argb_avx2
+#define STD_FUNCTION_NAME	yuvnv12_argb_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_ARGB
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuvnv12_abgr_avx2
+#define STD_FUNCTION_NAME	yuvnv12_abgr_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_ABGR
+#include "yuv_rgb_avx2_func.h"
+
+#undef YUV_BITS
+#define YUV_BITS	10
+
+#define AVX2_FUNCTION_NAME	yuvp010_xbgr2101010_avx2
+#define STD_FUNCTION_NAME	yuvp010_xbgr2101010_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_XBGR2101010
+#include "yuv_rgb_avx2_func.h"
+
+#undef YUV_BITS
+#define YUV_BITS	16
+
+#define AVX2_FUNCTION_NAME	yuvp416_rgb48_avx2
+#define STD_FUNCTION_NAME	yuvp416_rgb48_std
+#define YUV_FORMAT			YUV_FORMAT_444
+#define RGB_FORMAT			RGB_FORMAT_RGB48
+#include "yuv_rgb_avx2_func.h"
+
+#undef YUV_BITS
+#endif // SDL_AVX2_INTRINSICS
+
+#endif // SDL_HAVE_YUV
@@ -0,0 +1,418 @@
+// Copyright 2016 Adrien Descamps
+// Distributed under BSD 3-Clause License
+
+/* You need to define the following macros before including this file:
+	AVX2_FUNCTION_NAME
+	STD_FUNCTION_NAME
+	YUV_FORMAT
+	RGB_FORMAT
+	YUV_BITS
+*/
+
+/* The vector loop produces BLOCK pixels of each line per iteration.
+ * 8-bit formats are computed in 16-bit lanes like the sse2 version, with a
+ * saturating add of the Y and UV contributions. Deeper formats need 32-bit
+ * lanes to hold their products, as in the std version.
+ */
+
+#if YUV_BITS > 8
+
+#define BLOCK 16
+
+#if YUV_BITS == 10
+#define GET(X) _mm256_srai_epi32(X, 6)
+#else
+#define GET(X) (X)
+#endif
+
+#define UV2RGB(U, V, R, G, B) \
+	U = _mm256_sub_epi32(GET(U), uv_offset); \
+	V = _mm256_sub_epi32(GET(V), uv_offset); \
+	R = _mm256_mullo_epi32(V, v_r_factor); \
+	G = _mm256_add_epi32(_mm256_mullo_epi32(U, u_g_factor), _mm256_mullo_epi32(V, v_g_factor)); \
+	B = _mm256_mullo_epi32(U, u_b_factor);
+
+#if YUV_FORMAT == YUV_FORMAT_NV12
+
+#define READ_UV \
+{ \
+	__m256i u, v, r, g, b; \
+	u = _mm256_and_si256(_mm256_loadu_si256((const __m256i *)(u_ptr)), _mm256_set1_epi32(0xFFFF)); \
+	v = _mm256_and_si256(_mm256_loadu_si256((const __m256i *)(v_ptr)), _mm256_set1_epi32(0xFFFF)); \
+	UV2RGB(u, v, r, g, b) \
+	r_uv_1 = _mm256_permutevar8x32_epi32(r, dup_lo); \
+	g_uv_1 = _mm256_permutevar8x32_epi32(g, dup_lo); \
+	b_uv_1 = _mm256_permutevar8x32_epi32(b, dup_lo); \
+	r_uv_2 = _mm256_permutevar8x32_epi32(r, dup_hi); \
+	g_uv_2 = _mm256_permutevar8x32_epi32(g, dup_hi); \
+	b_uv_2 = _mm256_permutevar8x32_epi32(b, dup_hi); \
+}
+
+#elif YUV_FORMAT == YUV_FORMAT_444
+
+#define READ_UV \
+{ \
+	__m256i u, v; \
+	u = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(u_ptr))); \
+	v = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(v_ptr))); \
+	UV2RGB(u, v, r_uv_1, g_uv_1, b_uv_1) \
+	u = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(u_ptr + 8))); \
+	v = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(v_ptr + 8))); \
+	UV2RGB(u, v, r_uv_2, g_uv_2, b_uv_2) \
+}
+
+#else
+#error READ_UV unimplemented
+#endif
+
+#define READ_Y(y_ptr) \
+	y_1 = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(y_ptr))); \
+	y_2 = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(y_ptr + 8))); \
+	y_1 = _mm256_mullo_epi32(GET(_mm256_sub_epi32(y_1, y_shift)), y_factor); \
+	y_2 = _mm256_mullo_epi32(GET(_mm256_sub_epi32(y_2, y_shift)), y_factor);
+
+#define ADD_Y2RGB \
+	r_1 = _mm256_srai_epi32(_mm256_add_epi32(r_uv_1, y_1), PRECISION); \
+	g_1 = _mm256_srai_epi32(_mm256_add_epi32(g_uv_1, y_1), PRECISION); \
+	b_1 = _mm256_srai_epi32(_mm256_add_epi32(b_uv_1, y_1), PRECISION); \
+	r_2 = _mm256_srai_epi32(_mm256_add_epi32(r_uv_2, y_2), PRECISION); \
+	g_2 = _mm256_srai_epi32(_mm256_add_epi32(g_uv_2, y_2), PRECISION); \
+	b_2 = _mm256_srai_epi32(_mm256_add_epi32(b_uv_2, y_2), PRECISION);
+
+#if RGB_FORMAT == RGB_FORMAT_XBGR2101010
+
+#define PACK_PIXEL(rgb_ptr) \
+	_mm256_storeu_si256((__m256i *)(rgb_ptr), avx2_pack_xbgr2101010(r_1, g_1, b_1)); \
+	_mm256_storeu_si256((__m256i *)(rgb_ptr + 32), avx2_pack_xbgr2101010(r_2, g_2, b_2));
+
+#elif RGB_FORMAT == RGB_FORMAT_RGB48
+
+#define PACK_PIXEL(rgb_ptr) \
+	avx2_save_rgb48(rgb_ptr, \
+		_mm256_permute4x64_epi64(_mm256_packus_epi32(r_1, r_2), 0xD8), \
+		_mm256_permute4x64_epi64(_mm256_packus_epi32(g_1, g_2), 0xD8), \
+		_mm256_permute4x64_epi64(_mm256_packus_epi32(b_1, b_2), 0xD8));
+
+#else
+#error PACK_PIXEL unimplemented
+#endif
+
+#else // YUV_BITS == 8
+
+#define BLOCK 32
+
+#define UV2RGB(U, V, R, G, B) \
+	U = _mm256_sub_epi16(U, uv_offset); \
+	V = _mm256_sub_epi16(V, uv_offset); \
+	R = _mm256_mullo_epi16(V, v_r_factor); \
+	G = _mm256_add_epi16(_mm256_mullo_epi16(U, u_g_factor), _mm256_mullo_epi16(V, v_g_factor)); \
+	B = _mm256_mullo_epi16(U, u_b_factor);
+
+/* The U and V samples of a block are widened in order, then each one is
+ * repeated for the two pixels it covers. The 64-bit permute puts the samples
+ * for each half of the block in the lanes the in-lane unpacks read from.
+ */
+#define DUP_UV(R, G, B) \
+	R = _mm256_permute4x64_epi64(R, 0xD8); \
+	G = _mm256_permute4x64_epi64(G, 0xD8); \
+	B = _mm256_permute4x64_epi64(B, 0xD8); \
+	r_uv_1 = _mm256_unpacklo_epi16(R, R); \
+	g_uv_1 = _mm256_unpacklo_epi16(G, G); \
+	b_uv_1 = _mm256_unpacklo_epi16(B, B); \
+	r_uv_2 = _mm256_unpackhi_epi16(R, R); \
+	g_uv_2 = _mm256_unpackhi_epi16(G, G); \
+	b_uv_2 = _mm256_unpackhi_epi16(B, B);
+
+#if YUV_FORMAT == YUV_FORMAT_420
+
+#define READ_UV \
+{ \
+	__m256i u, v, r, g, b; \
+	u = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(u_ptr))); \
+	v = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(v_ptr))); \
+	UV2RGB(u, v, r, g, b) \
+	DUP_UV(r, g, b) \
+}
+
+#elif YUV_FORMAT == YUV_FORMAT_422
+
+#define READ_UV \
+{ \
+	__m256i u, v, r, g, b; \
+	u = _mm256_packs_epi32( \
+		_mm256_and_si256(_mm256_loadu_si256((const __m256i *)(u_ptr)), _mm256_set1_epi32(0xFF)), \
+		_mm256_and_si256(_mm256_loadu_si256((const __m256i *)(u_ptr + 32)), _mm256_set1_epi32(0xFF))); \
+	v = _mm256_packs_epi32( \
+		_mm256_and_si256(_mm256_loadu_si256((const __m256i *)(v_ptr)), _mm256_set1_epi32(0xFF)), \
+		_mm256_and_si256(_mm256_loadu_si256((const __m256i *)(v_ptr + 32)), _mm256_set1_epi32(0xFF))); \
+	u = _mm256_permute4x64_epi64(u, 0xD8); \
+	v = _mm256_permute4x64_epi64(v, 0xD8); \
+	UV2RGB(u, v, r, g, b) \
+	DUP_UV(r, g, b) \
+}
+
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+
+#define READ_UV \
+{ \
+	__m256i u, v, r, g, b; \
+	u = _mm256_and_si256(_mm256_loadu_si256((const __m256i *)(u_ptr)), _mm256_set1_epi16(0xFF)); \
+	v = _mm256_and_si256(_mm256_loadu_si256((const __m256i *)(v_ptr)), _mm256_set1_epi16(0xFF)); \
+	UV2RGB(u, v, r, g, b) \
+	DUP_UV(r, g, b) \
+}
+
+#elif YUV_FORMAT == YUV_FORMAT_444
+
+#define READ_UV \
+{ \
+	__m256i u, v; \
+	u = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(u_ptr))); \
+	v = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(v_ptr))); \
+	UV2RGB(u, v, r_uv_1, g_uv_1, b_uv_1) \
+	u = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(u_ptr + 16))); \
+	v = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(v_ptr + 16))); \
+	UV2RGB(u, v, r_uv_2, g_uv_2, b_uv_2) \
+}
+
+#else
+#error READ_UV unimplemented
+#endif
+
+#if YUV_FORMAT == YUV_FORMAT_422
+
+#define LOAD_Y(y_ptr) \
+	y_1 = _mm256_and_si256(_mm256_loadu_si256((const __m256i *)(y_ptr)), _mm256_set1_epi16(0xFF)); \
+	y_2 = _mm256_and_si256(_mm256_loadu_si256((const __m256i *)(y_ptr + 32)), _mm256_set1_epi16(0xFF));
+
+#else
+
+#define LOAD_Y(y_ptr) \
+	y_1 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(y_ptr))); \
+	y_2 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)(y_ptr + 16)));
+
+#endif
+
+#define READ_Y(y_ptr) \
+	LOAD_Y(y_ptr) \
+	y_1 = _mm256_mullo_epi16(_mm256_sub_epi16(y_1, y_shift), y_factor); \
+	y_2 = _mm256_mullo_epi16(_mm256_sub_epi16(y_2, y_shift), y_factor);
+
+#define ADD_Y2RGB \
+	r_1 = _mm256_srai_epi16(_mm256_adds_epi16(r_uv_1, y_1), PRECISION); \
+	g_1 = _mm256_srai_epi16(_mm256_adds_epi16(g_uv_1, y_1), PRECISION); \
+	b_1 = _mm256_srai_epi16(_mm256_adds_epi16(b_uv_1, y_1), PRECISION); \
+	r_2 = _mm256_srai_epi16(_mm256_adds_epi16(r_uv_2, y_2), PRECISION); \
+	g_2 = _mm256_srai_epi16(_mm256_adds_epi16(g_uv_2, y_2), PRECISION); \
+	b_2 = _mm256_srai_epi16(_mm256_adds_epi16(b_uv_2, y_2), PRECISION);
+
+// Saturate to 8 bits, with the 32 pixels back in order
+#define PACK_U8(X1, X2) _mm256_permute4x64_epi64(_mm256_packus_epi16(X1, X2), 0xD8)
+
+#if RGB_FORMAT == RGB_FORMAT_RGB565
+
+#define PACK_PIXEL(rgb_ptr) \
+	_mm256_storeu_si256((__m256i *)(rgb_ptr), avx2_pack_rgb565(r_1, g_1, b_1)); \
+	_mm256_storeu_si256((__m256i *)(rgb_ptr + 32), avx2_pack_rgb565(r_2, g_2, b_2));
+
+#elif RGB_FORMAT == RGB_FORMAT_RGB24
+
+#define PACK_PIXEL(rgb_ptr) \
+	avx2_save_rgb24(rgb_ptr, PACK_U8(r_1, r_2), PACK_U8(g_1, g_2), PACK_U8(b_1, b_2));
+
+#elif RGB_FORMAT == RGB_FORMAT_RGBA
+
+#define PACK_PIXEL(rgb_ptr) \
+	avx2_save_32bpp(rgb_ptr, _mm256_set1_epi8(-1), PACK_U8(b_1, b_2), PACK_U8(g_1, g_2), PACK_U8(r_1, r_2));
+
+#elif RGB_FORMAT == RGB_FORMAT_BGRA
+
+#define PACK_PIXEL(rgb_ptr) \
+	avx2_save_32bpp(rgb_ptr, _mm256_set1_epi8(-1), PACK_U8(r_1, r_2), PACK_U8(g_1, g_2), PACK_U8(b_1, b_2));
+
+#elif RGB_FORMAT == RGB_FORMAT_ARGB
+
+#define PACK_PIXEL(rgb_ptr) \
+	avx2_save_32bpp(rgb_ptr, PACK_U8(b_1, b_2), PACK_U8(g_1, g_2), PACK_U8(r_1, r_2), _mm256_set1_epi8(-1));
+
+#elif RGB_FORMAT == RGB_FORMAT_ABGR
+
+#define PACK_PIXEL(rgb_ptr) \
+	avx2_save_32bpp(rgb_ptr, PACK_U8(r_1, r_2), PACK_U8(g_1, g_2), PACK_U8(b_1, b_2), _mm256_set1_epi8(-1));
+
+#else
+#error PACK_PIXEL unimplemented
+#endif
+
+#endif // YUV_BITS
+
+#undef YUV_TYPE
+#if YUV_BITS > 8
+#define YUV_TYPE	uint16_t
+#else
+#define YUV_TYPE	uint8_t
+#endif
+
+void SDL_TARGETING("avx2") AVX2_FUNCTION_NAME(uint32_t width, uint32_t height,
+	const YUV_TYPE *Y, const YUV_TYPE *U, const YUV_TYPE *V, uint32_t Y_stride, uint32_t UV_stride,
+	uint8_t *RGB, uint32_t RGB_stride,
+	YCbCrType yuv_type)
+{
+	const YUV2RGBParam *const param = &(YUV2RGB[yuv_type]);
+#if YUV_FORMAT == YUV_FORMAT_420
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 1;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 2;
+#elif YUV_FORMAT == YUV_FORMAT_422
+	const int y_pixel_stride = 2;
+	const int uv_pixel_stride = 4;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 1;
+#elif YUV_FORMAT == YUV_FORMAT_444
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 1;
+	const int uv_x_sample_interval = 1;
+	const int uv_y_sample_interval = 1;
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 2;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 2;
+#endif
+#if RGB_FORMAT == RGB_FORMAT_RGB565
+	const int rgb_pixel_stride = 2;
+#elif RGB_FORMAT == RGB_FORMAT_RGB24
+	const int rgb_pixel_stride = 3;
+#elif RGB_FORMAT == RGB_FORMAT_RGB48
+	const int rgb_pixel_stride = 6;
+#else
+	const int rgb_pixel_stride = 4;
+#endif
+
+#if YUV_FORMAT == YUV_FORMAT_NV12
+	/* The U and V reads of the last block of a line run one sample past it,
+	 * so a line that ends on a block boundary leaves its last block to the std version.
+	 */
+	const int fix_read_nv12 = ((width % BLOCK) == 0);
+#else
+	const int fix_read_nv12 = 0;
+#endif
+
+#if YUV_FORMAT == YUV_FORMAT_422
+	/* Avoid invalid read on last line */
+	const int fix_read_422 = 1;
+#else
+	const int fix_read_422 = 0;
+#endif
+
+#if YUV_BITS > 8
+	const __m256i y_shift = _mm256_set1_epi32(param->y_shift);
+	const __m256i y_factor = _mm256_set1_epi32(param->y_factor);
+	const __m256i v_r_factor = _mm256_set1_epi32(param->v_r_factor);
+	const __m256i u_g_factor = _mm256_set1_epi32(param->u_g_factor);
+	const __m256i v_g_factor = _mm256_set1_epi32(param->v_g_factor);
+	const __m256i u_b_factor = _mm256_set1_epi32(param->u_b_factor);
+	const __m256i uv_offset = _mm256_set1_epi32(1 << (YUV_BITS - 1));
+#if YUV_FORMAT == YUV_FORMAT_NV12
+	const __m256i dup_lo = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+	const __m256i dup_hi = _mm256_setr_epi32(4, 4, 5, 5, 6, 6, 7, 7);
+#endif
+#else
+	const __m256i y_shift = _mm256_set1_epi16(param->y_shift);
+	const __m256i y_factor = _mm256_set1_epi16(param->y_factor);
+	const __m256i v_r_factor = _mm256_set1_epi16(param->v_r_factor);
+	const __m256i u_g_factor = _mm256_set1_epi16(param->u_g_factor);
+	const __m256i v_g_factor = _mm256_set1_epi16(param->v_g_factor);
+	const __m256i u_b_factor = _mm256_set1_epi16(param->u_b_factor);
+	const __m256i uv_offset = _mm256_set1_epi16(128);
+#endif
+
+	uint32_t converted = width - (width % BLOCK);
+	if (fix_read_nv12 && converted > 0) {
+		converted -= BLOCK;
+	}
+
+	if (converted > 0) {
+		uint32_t xpos, ypos;
+		for(ypos=0; ypos+(uv_y_sample_interval-1)+fix_read_422 < height; ypos+=uv_y_sample_interval)
+		{
+			const YUV_TYPE *y_ptr1=(const YUV_TYPE *)((const uint8_t *)Y+ypos*Y_stride),
+				*u_ptr=(const YUV_TYPE *)((const uint8_t *)U+(ypos/uv_y_sample_interval)*UV_stride),
+				*v_ptr=(const YUV_TYPE *)((const uint8_t *)V+(ypos/uv_y_sample_interval)*UV_stride);
+#if YUV_FORMAT == YUV_FORMAT_420 || YUV_FORMAT == YUV_FORMAT_NV12
+			const YUV_TYPE *y_ptr2=(const YUV_TYPE *)((const uint8_t *)y_ptr1+Y_stride);
+#endif
+
+			uint8_t *rgb_ptr1=RGB+ypos*RGB_stride;
+#if YUV_FORMAT == YUV_FORMAT_420 || YUV_FORMAT == YUV_FORMAT_NV12
+			uint8_t *rgb_ptr2=rgb_ptr1+RGB_stride;
+#endif
+
+			for(xpos=0; xpos<converted; xpos+=BLOCK)
+			{
+				__m256i r_uv_1, g_uv_1, b_uv_1, r_uv_2, g_uv_2, b_uv_2;
+				__m256i y_1, y_2, r_1, g_1, b_1, r_2, g_2, b_2;
+
+				READ_UV
+
+				READ_Y(y_ptr1)
+				ADD_Y2RGB
+				PACK_PIXEL(rgb_ptr1)
+
+#if YUV_FORMAT == YUV_FORMAT_420 || YUV_FORMAT == YUV_FORMAT_NV12
+				READ_Y(y_ptr2)
+				ADD_Y2RGB
+				PACK_PIXEL(rgb_ptr2)
+
+				y_ptr2+=BLOCK*y_pixel_stride;
+				rgb_ptr2+=BLOCK*rgb_pixel_stride;
+#endif
+
+				y_ptr1+=BLOCK*y_pixel_stride;
+				u_ptr+=BLOCK*uv_pixel_stride/uv_x_sample_interval;
+				v_ptr+=BLOCK*uv_pixel_stride/uv_x_sample_interval;
+				rgb_ptr1+=BLOCK*rgb_pixel_stride;
+			}
+		}
+
+		/* Catch the last line, if needed */
+		if (ypos < height)
+		{
+			const YUV_TYPE *y_ptr=(const YUV_TYPE *)((const uint8_t *)Y+ypos*Y_stride),
+				*u_ptr=(const YUV_TYPE *)((const uint8_t *)U+(ypos/uv_y_sample_interval)*UV_stride),
+				*v_ptr=(const YUV_TYPE *)((const uint8_t *)V+(ypos/uv_y_sample_interval)*UV_stride);
+
+			uint8_t *rgb_ptr=RGB+ypos*RGB_stride;
+
+			STD_FUNCTION_NAME(converted, 1, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+		}
+	}
+
+	/* Catch the right column, if needed */
+	if (converted != width)
+	{
+		const YUV_TYPE *y_ptr=Y+converted*y_pixel_stride,
+			*u_ptr=U+converted*uv_pixel_stride/uv_x_sample_interval,
+			*v_ptr=V+converted*uv_pixel_stride/uv_x_sample_interval;
+
+		uint8_t *rgb_ptr=RGB+converted*rgb_pixel_stride;
+
+		STD_FUNCTION_NAME(width-converted, height, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+	}
+}
+
+#undef AVX2_FUNCTION_NAME
+#undef STD_FUNCTION_NAME
+#undef YUV_FORMAT
+#undef RGB_FORMAT
+#undef BLOCK
+#undef GET
+#undef UV2RGB
+#undef DUP_UV
+#undef READ_UV
+#undef LOAD_Y
+#undef READ_Y
+#undef ADD_Y2RGB
+#undef PACK_U8
+#undef PACK_PIXEL
@@ -0,0 +1,190 @@
+// Copyright 2016 Adrien Descamps
+// Distributed under BSD 3-Clause License
+#include "SDL_internal.h"
+
+#ifdef SDL_HAVE_YUV
+#include "yuv_rgb_internal.h"
+
+#ifdef SDL_NEON_INTRINSICS
+
+// Pack 8 pixels of unclamped 16-bit channels into RGB565
+static SDL_INLINE uint16x8_t neon_pack_rgb565(int16x8_t r, int16x8_t g, int16x8_t b)
+{
+	uint16x8_t rgb = vshll_n_u8(vqmovun_s16(r), 8);
+	rgb = vsriq_n_u16(rgb, vshll_n_u8(vqmovun_s16(g), 8), 5);
+	rgb = vsriq_n_u16(rgb, vshll_n_u8(vqmovun_s16(b), 8), 11);
+	return rgb;
+}
+
+// Pack 4 pixels of unclamped 32-bit channels into XBGR2101010
+static SDL_INLINE uint32x4_t neon_pack_xbgr2101010(int32x4_t r, int32x4_t g, int32x4_t b)
+{
+	const int32x4_t zero = vdupq_n_s32(0);
+	const int32x4_t max = vdupq_n_s32(1023);
+	uint32x4_t rgb;
+
+	r = vminq_s32(vmaxq_s32(r, zero), max);
+	g = vminq_s32(vmaxq_s32(g, zero), max);
+	b = vminq_s32(vmaxq_s32(b, zero), max);
+	rgb = vorrq_u32(vdupq_n_u32(0xC0000000), vreinterpretq_u32_s32(r));
+	rgb = vorrq_u32(rgb, vshlq_n_u32(vreinterpretq_u32_s32(g), 10));
+	rgb = vorrq_u32(rgb, vshlq_n_u32(vreinterpretq_u32_s32(b), 20));
+	return rgb;
+}
+
+#define YUV_BITS	8
+
+#define NEON_FUNCTION_NAME	yuv420_rgb565_neon
+#define STD_FUNCTION_NAME	yuv420_rgb565_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_RGB565
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv420_rgb24_neon
+#define STD_FUNCTION_NAME	yuv420_rgb24_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_RGB24
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv420_rgba_neon
+#define STD_FUNCTION_NAME	yuv420_rgba_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_RGBA
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv420_bgra_neon
+#define STD_FUNCTION_NAME	yuv420_bgra_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_BGRA
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv420_argb_neon
+#define STD_FUNCTION_NAME	yuv420_argb_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_ARGB
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv420_abgr_neon
+#define STD_FUNCTION_NAME	yuv420_abgr_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_ABGR
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv422_rgb565_neon
+#define STD_FUNCTION_NAME	yuv422_rgb565_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_RGB565
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv422_rgb24_neon
+#define STD_FUNCTION_NAME	yuv422_rgb24_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_RGB24
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv422_rgba_neon
+#define STD_FUNCTION_NAME	yuv422_rgba_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_RGBA
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv422_bgra_neon
+#define STD_FUNCTION_NAME	yuv422_bgra_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_BGRA
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv422_argb_neon
+#define STD_FUNCTION_NAME	yuv422_argb_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_ARGB
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv422_abgr_neon
+#define STD_FUNCTION_NAME	yuv422_abgr_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_ABGR
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv444_rgba_neon
+#define STD_FUNCTION_NAME	yuv444_rgba_std
+#define YUV_FORMAT			YUV_FORMAT_444
+#define RGB_FORMAT			RGB_FORMAT_RGBA
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv444_bgra_neon
+#define STD_FUNCTION_NAME	yuv444_bgra_std
+#define YUV_FORMAT			YUV_FORMAT_444
+#define RGB_FORMAT			RGB_FORMAT_BGRA
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv444_argb_neon
+#define STD_FUNCTION_NAME	yuv444_argb_std
+#define YUV_FORMAT			YUV_FORMAT_444
+#define RGB_FORMAT			RGB_FORMAT_ARGB
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuv444_abgr_neon
+#define STD_FUNCTION_NAME	yuv444_abgr_std
+#define YUV_FORMAT			YUV_FORMAT_444
+#define RGB_FORMAT			RGB_FORMAT_ABGR
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuvnv12_rgb565_neon
+#define STD_FUNCTION_NAME	yuvnv12_rgb565_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_RGB565
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuvnv12_rgb24_neon
+#define STD_FUNCTION_NAME	yuvnv12_rgb24_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_RGB24
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuvnv12_rgba_neon
+#define STD_FUNCTION_NAME	yuvnv12_rgba_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_RGBA
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuvnv12_bgra_neon
+#define STD_FUNCTION_NAME	yuvnv12_bgra_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_BGRA
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuvnv12_argb_neon
+#define STD_FUNCTION_NAME	yuvnv12_argb_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_ARGB
+#include "yuv_rgb_neon_func.h"
+
+#define NEON_FUNCTION_NAME	yuvnv12_abgr_neon
+#define STD_FUNCTION_NAME	yuvnv12_abgr_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_ABGR
+#include "yuv_rgb_neon_func.h"
+
+#undef YUV_BITS
+#define YUV_BITS	10
+
+#define NEON_FUNCTION_NAME	yuvp010_xbgr2101010_neon
+#define STD_FUNCTION_NAME	yuvp010_xbgr2101010_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_XBGR2101010
+#include "yuv_rgb_neon_func.h"
+
+#undef YUV_BITS
+#define YUV_BITS	16
+
+#define NEON_FUNCTION_NAME	yuvp416_rgb48_neon
+#define STD_FUNCTION_NAME	yuvp416_rgb48_std
+#define YUV_FORMAT			YUV_FORMAT_444
+#define RGB_FORMAT			RGB_FORMAT_RGB48
+#include "yuv_rgb_neon_func.h"
+
+#undef YUV_BITS
+#endif // SDL_NEON_INTRINSICS
+
+#endif // SDL_HAVE_YUV
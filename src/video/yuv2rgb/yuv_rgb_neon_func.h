@@ -0,0 +1,411 @@
+// Copyright 2016 Adrien Descamps
+// Distributed under BSD 3-Clause License
+
+/* You need to define the following macros before including this file:
+	NEON_FUNCTION_NAME
+	STD_FUNCTION_NAME
+	YUV_FORMAT
+	RGB_FORMAT
+	YUV_BITS
+*/
+
+/* The vector loop produces BLOCK pixels of each line per iteration, with the
+ * same lane widths as the avx2 version: 16-bit lanes and a saturating add for
+ * 8-bit formats, 32-bit lanes for deeper ones.
+ */
+
+#if YUV_BITS > 8
+
+#define BLOCK 8
+#define LANE_TYPE int32x4_t
+
+#if YUV_BITS == 10
+#define GET(X) vshrq_n_s32(X, 6)
+#else
+#define GET(X) (X)
+#endif
+
+#define UV2RGB(U, V, R, G, B) \
+	U = vsubq_s32(GET(U), uv_offset); \
+	V = vsubq_s32(GET(V), uv_offset); \
+	R = vmulq_s32(V, v_r_factor); \
+	G = vmlaq_s32(vmulq_s32(U, u_g_factor), V, v_g_factor); \
+	B = vmulq_s32(U, u_b_factor);
+
+#define LOAD_U16(ptr) vreinterpretq_s32_u32(vmovl_u16(ptr))
+
+#if YUV_FORMAT == YUV_FORMAT_NV12
+
+#define READ_UV \
+{ \
+	int32x4_t u, v, r, g, b; \
+	int32x4x2_t dup; \
+	u = LOAD_U16(vld2_u16(u_ptr).val[0]); \
+	v = LOAD_U16(vld2_u16(v_ptr).val[0]); \
+	UV2RGB(u, v, r, g, b) \
+	dup = vzipq_s32(r, r); r_uv_1 = dup.val[0]; r_uv_2 = dup.val[1]; \
+	dup = vzipq_s32(g, g); g_uv_1 = dup.val[0]; g_uv_2 = dup.val[1]; \
+	dup = vzipq_s32(b, b); b_uv_1 = dup.val[0]; b_uv_2 = dup.val[1]; \
+}
+
+#elif YUV_FORMAT == YUV_FORMAT_444
+
+#define READ_UV \
+{ \
+	int32x4_t u, v; \
+	u = LOAD_U16(vld1_u16(u_ptr)); \
+	v = LOAD_U16(vld1_u16(v_ptr)); \
+	UV2RGB(u, v, r_uv_1, g_uv_1, b_uv_1) \
+	u = LOAD_U16(vld1_u16(u_ptr + 4)); \
+	v = LOAD_U16(vld1_u16(v_ptr + 4)); \
+	UV2RGB(u, v, r_uv_2, g_uv_2, b_uv_2) \
+}
+
+#else
+#error READ_UV unimplemented
+#endif
+
+#define READ_Y(y_ptr) \
+	y_1 = LOAD_U16(vld1_u16(y_ptr)); \
+	y_2 = LOAD_U16(vld1_u16(y_ptr + 4)); \
+	y_1 = vmulq_s32(GET(vsubq_s32(y_1, y_shift)), y_factor); \
+	y_2 = vmulq_s32(GET(vsubq_s32(y_2, y_shift)), y_factor);
+
+#define ADD_Y2RGB \
+	r_1 = vshrq_n_s32(vaddq_s32(r_uv_1, y_1), PRECISION); \
+	g_1 = vshrq_n_s32(vaddq_s32(g_uv_1, y_1), PRECISION); \
+	b_1 = vshrq_n_s32(vaddq_s32(b_uv_1, y_1), PRECISION); \
+	r_2 = vshrq_n_s32(vaddq_s32(r_uv_2, y_2), PRECISION); \
+	g_2 = vshrq_n_s32(vaddq_s32(g_uv_2, y_2), PRECISION); \
+	b_2 = vshrq_n_s32(vaddq_s32(b_uv_2, y_2), PRECISION);
+
+#if RGB_FORMAT == RGB_FORMAT_XBGR2101010
+
+#define PACK_PIXEL(rgb_ptr) \
+	vst1q_u8(rgb_ptr, vreinterpretq_u8_u32(neon_pack_xbgr2101010(r_1, g_1, b_1))); \
+	vst1q_u8(rgb_ptr + 16, vreinterpretq_u8_u32(neon_pack_xbgr2101010(r_2, g_2, b_2)));
+
+#elif RGB_FORMAT == RGB_FORMAT_RGB48
+
+#define PACK_PIXEL(rgb_ptr) \
+{ \
+	uint16x8x3_t rgb; \
+	rgb.val[0] = vcombine_u16(vqmovun_s32(r_1), vqmovun_s32(r_2)); \
+	rgb.val[1] = vcombine_u16(vqmovun_s32(g_1), vqmovun_s32(g_2)); \
+	rgb.val[2] = vcombine_u16(vqmovun_s32(b_1), vqmovun_s32(b_2)); \
+	vst3q_u16((uint16_t *)(rgb_ptr), rgb); \
+}
+
+#else
+#error PACK_PIXEL unimplemented
+#endif
+
+#else // YUV_BITS == 8
+
+#define BLOCK 16
+#define LANE_TYPE int16x8_t
+
+#define UV2RGB(U, V, R, G, B) \
+	U = vsubq_s16(U, uv_offset); \
+	V = vsubq_s16(V, uv_offset); \
+	R = vmulq_s16(V, v_r_factor); \
+	G = vmlaq_s16(vmulq_s16(U, u_g_factor), V, v_g_factor); \
+	B = vmulq_s16(U, u_b_factor);
+
+#define LOAD_U8(ptr) vreinterpretq_s16_u16(vmovl_u8(ptr))
+
+// Repeat each U and V contribution for the two pixels it covers
+#define DUP_UV(R, G, B) \
+{ \
+	int16x8x2_t dup; \
+	dup = vzipq_s16(R, R); r_uv_1 = dup.val[0]; r_uv_2 = dup.val[1]; \
+	dup = vzipq_s16(G, G); g_uv_1 = dup.val[0]; g_uv_2 = dup.val[1]; \
+	dup = vzipq_s16(B, B); b_uv_1 = dup.val[0]; b_uv_2 = dup.val[1]; \
+}
+
+#if YUV_FORMAT == YUV_FORMAT_420
+
+#define READ_UV \
+{ \
+	int16x8_t u, v, r, g, b; \
+	u = LOAD_U8(vld1_u8(u_ptr)); \
+	v = LOAD_U8(vld1_u8(v_ptr)); \
+	UV2RGB(u, v, r, g, b) \
+	DUP_UV(r, g, b) \
+}
+
+#elif YUV_FORMAT == YUV_FORMAT_422
+
+#define READ_UV \
+{ \
+	int16x8_t u, v, r, g, b; \
+	u = LOAD_U8(vld4_u8(u_ptr).val[0]); \
+	v = LOAD_U8(vld4_u8(v_ptr).val[0]); \
+	UV2RGB(u, v, r, g, b) \
+	DUP_UV(r, g, b) \
+}
+
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+
+#define READ_UV \
+{ \
+	int16x8_t u, v, r, g, b; \
+	u = LOAD_U8(vld2_u8(u_ptr).val[0]); \
+	v = LOAD_U8(vld2_u8(v_ptr).val[0]); \
+	UV2RGB(u, v, r, g, b) \
+	DUP_UV(r, g, b) \
+}
+
+#elif YUV_FORMAT == YUV_FORMAT_444
+
+#define READ_UV \
+{ \
+	int16x8_t u, v; \
+	u = LOAD_U8(vld1_u8(u_ptr)); \
+	v = LOAD_U8(vld1_u8(v_ptr)); \
+	UV2RGB(u, v, r_uv_1, g_uv_1, b_uv_1) \
+	u = LOAD_U8(vld1_u8(u_ptr + 8)); \
+	v = LOAD_U8(vld1_u8(v_ptr + 8)); \
+	UV2RGB(u, v, r_uv_2, g_uv_2, b_uv_2) \
+}
+
+#else
+#error READ_UV unimplemented
+#endif
+
+#if YUV_FORMAT == YUV_FORMAT_422
+#define LOAD_Y(y_ptr) vld2q_u8(y_ptr).val[0]
+#else
+#define LOAD_Y(y_ptr) vld1q_u8(y_ptr)
+#endif
+
+#define READ_Y(y_ptr) \
+{ \
+	const uint8x16_t y = LOAD_Y(y_ptr); \
+	y_1 = vmulq_s16(vsubq_s16(LOAD_U8(vget_low_u8(y)), y_shift), y_factor); \
+	y_2 = vmulq_s16(vsubq_s16(LOAD_U8(vget_high_u8(y)), y_shift), y_factor); \
+}
+
+#define ADD_Y2RGB \
+	r_1 = vshrq_n_s16(vqaddq_s16(r_uv_1, y_1), PRECISION); \
+	g_1 = vshrq_n_s16(vqaddq_s16(g_uv_1, y_1), PRECISION); \
+	b_1 = vshrq_n_s16(vqaddq_s16(b_uv_1, y_1), PRECISION); \
+	r_2 = vshrq_n_s16(vqaddq_s16(r_uv_2, y_2), PRECISION); \
+	g_2 = vshrq_n_s16(vqaddq_s16(g_uv_2, y_2), PRECISION); \
+	b_2 = vshrq_n_s16(vqaddq_s16(b_uv_2, y_2), PRECISION);
+
+// Saturate to 8 bits
+#define PACK_U8(X1, X2) vcombine_u8(vqmovun_s16(X1), vqmovun_s16(X2))
+
+#if RGB_FORMAT == RGB_FORMAT_RGB565
+
+#define PACK_PIXEL(rgb_ptr) \
+	vst1q_u8(rgb_ptr, vreinterpretq_u8_u16(neon_pack_rgb565(r_1, g_1, b_1))); \
+	vst1q_u8(rgb_ptr + 16, vreinterpretq_u8_u16(neon_pack_rgb565(r_2, g_2, b_2)));
+
+#elif RGB_FORMAT == RGB_FORMAT_RGB24
+
+#define PACK_PIXEL(rgb_ptr) \
+{ \
+	uint8x16x3_t rgb; \
+	rgb.val[0] = PACK_U8(r_1, r_2); \
+	rgb.val[1] = PACK_U8(g_1, g_2); \
+	rgb.val[2] = PACK_U8(b_1, b_2); \
+	vst3q_u8(rgb_ptr, rgb); \
+}
+
+#else
+
+#if RGB_FORMAT == RGB_FORMAT_RGBA
+#define PIXEL_CHANNELS(C0, C1, C2, C3) C0 = vdupq_n_u8(255); C1 = PACK_U8(b_1, b_2); C2 = PACK_U8(g_1, g_2); C3 = PACK_U8(r_1, r_2);
+#elif RGB_FORMAT == RGB_FORMAT_BGRA
+#define PIXEL_CHANNELS(C0, C1, C2, C3) C0 = vdupq_n_u8(255); C1 = PACK_U8(r_1, r_2); C2 = PACK_U8(g_1, g_2); C3 = PACK_U8(b_1, b_2);
+#elif RGB_FORMAT == RGB_FORMAT_ARGB
+#define PIXEL_CHANNELS(C0, C1, C2, C3) C0 = PACK_U8(b_1, b_2); C1 = PACK_U8(g_1, g_2); C2 = PACK_U8(r_1, r_2); C3 = vdupq_n_u8(255);
+#elif RGB_FORMAT == RGB_FORMAT_ABGR
+#define PIXEL_CHANNELS(C0, C1, C2, C3) C0 = PACK_U8(r_1, r_2); C1 = PACK_U8(g_1, g_2); C2 = PACK_U8(b_1, b_2); C3 = vdupq_n_u8(255);
+#else
+#error PACK_PIXEL unimplemented
+#endif
+
+#define PACK_PIXEL(rgb_ptr) \
+{ \
+	uint8x16x4_t rgba; \
+	PIXEL_CHANNELS(rgba.val[0], rgba.val[1], rgba.val[2], rgba.val[3]) \
+	vst4q_u8(rgb_ptr, rgba); \
+}
+
+#endif
+
+#endif // YUV_BITS
+
+#undef YUV_TYPE
+#if YUV_BITS > 8
+#define YUV_TYPE	uint16_t
+#else
+#define YUV_TYPE	uint8_t
+#endif
+
+void NEON_FUNCTION_NAME(uint32_t width, uint32_t height,
+	const YUV_TYPE *Y, const YUV_TYPE *U, const YUV_TYPE *V, uint32_t Y_stride, uint32_t UV_stride,
+	uint8_t *RGB, uint32_t RGB_stride,
+	YCbCrType yuv_type)
+{
+	const YUV2RGBParam *const param = &(YUV2RGB[yuv_type]);
+#if YUV_FORMAT == YUV_FORMAT_420
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 1;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 2;
+#elif YUV_FORMAT == YUV_FORMAT_422
+	const int y_pixel_stride = 2;
+	const int uv_pixel_stride = 4;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 1;
+#elif YUV_FORMAT == YUV_FORMAT_444
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 1;
+	const int uv_x_sample_interval = 1;
+	const int uv_y_sample_interval = 1;
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 2;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 2;
+#endif
+#if RGB_FORMAT == RGB_FORMAT_RGB565
+	const int rgb_pixel_stride = 2;
+#elif RGB_FORMAT == RGB_FORMAT_RGB24
+	const int rgb_pixel_stride = 3;
+#elif RGB_FORMAT == RGB_FORMAT_RGB48
+	const int rgb_pixel_stride = 6;
+#else
+	const int rgb_pixel_stride = 4;
+#endif
+
+#if YUV_FORMAT == YUV_FORMAT_NV12
+	/* The U and V reads of the last block of a line run one sample past it,
+	 * so a line that ends on a block boundary leaves its last block to the std version.
+	 */
+	const int fix_read_nv12 = ((width % BLOCK) == 0);
+#else
+	const int fix_read_nv12 = 0;
+#endif
+
+#if YUV_FORMAT == YUV_FORMAT_422
+	/* Avoid invalid read on last line */
+	const int fix_read_422 = 1;
+#else
+	const int fix_read_422 = 0;
+#endif
+
+#if YUV_BITS > 8
+	const int32x4_t y_shift = vdupq_n_s32(param->y_shift);
+	const int32x4_t y_factor = vdupq_n_s32(param->y_factor);
+	const int32x4_t v_r_factor = vdupq_n_s32(param->v_r_factor);
+	const int32x4_t u_g_factor = vdupq_n_s32(param->u_g_factor);
+	const int32x4_t v_g_factor = vdupq_n_s32(param->v_g_factor);
+	const int32x4_t u_b_factor = vdupq_n_s32(param->u_b_factor);
+	const int32x4_t uv_offset = vdupq_n_s32(1 << (YUV_BITS - 1));
+#else
+	const int16x8_t y_shift = vdupq_n_s16(param->y_shift);
+	const int16x8_t y_factor = vdupq_n_s16(param->y_factor);
+	const int16x8_t v_r_factor = vdupq_n_s16(param->v_r_factor);
+	const int16x8_t u_g_factor = vdupq_n_s16(param->u_g_factor);
+	const int16x8_t v_g_factor = vdupq_n_s16(param->v_g_factor);
+	const int16x8_t u_b_factor = vdupq_n_s16(param->u_b_factor);
+	const int16x8_t uv_offset = vdupq_n_s16(128);
+#endif
+
+	uint32_t converted = width - (width % BLOCK);
+	if (fix_read_nv12 && converted > 0) {
+		converted -= BLOCK;
+	}
+
+	if (converted > 0) {
+		uint32_t xpos, ypos;
+		for(ypos=0; ypos+(uv_y_sample_interval-1)+fix_read_422 < height; ypos+=uv_y_sample_interval)
+		{
+			const YUV_TYPE *y_ptr1=(const YUV_TYPE *)((const uint8_t *)Y+ypos*Y_stride),
+				*u_ptr=(const YUV_TYPE *)((const uint8_t *)U+(ypos/uv_y_sample_interval)*UV_stride),
+				*v_ptr=(const YUV_TYPE *)((const uint8_t *)V+(ypos/uv_y_sample_interval)*UV_stride);
+#if YUV_FORMAT == YUV_FORMAT_420 || YUV_FORMAT == YUV_FORMAT_NV12
+			const YUV_TYPE *y_ptr2=(const YUV_TYPE *)((const uint8_t *)y_ptr1+Y_stride);
+#endif
+
+			uint8_t *rgb_ptr1=RGB+ypos*RGB_stride;
+#if YUV_FORMAT == YUV_FORMAT_420 || YUV_FORMAT == YUV_FORMAT_NV12
+			uint8_t *rgb_ptr2=rgb_ptr1+RGB_stride;
+#endif
+
+			for(xpos=0; xpos<converted; xpos+=BLOCK)
+			{
+				LANE_TYPE r_uv_1, g_uv_1, b_uv_1, r_uv_2, g_uv_2, b_uv_2;
+				LANE_TYPE y_1, y_2, r_1, g_1, b_1, r_2, g_2, b_2;
+
+				READ_UV
+
+				READ_Y(y_ptr1)
+				ADD_Y2RGB
+				PACK_PIXEL(rgb_ptr1)
+
+#if YUV_FORMAT == YUV_FORMAT_420 || YUV_FORMAT == YUV_FORMAT_NV12
+				READ_Y(y_ptr2)
+				ADD_Y2RGB
+				PACK_PIXEL(rgb_ptr2)
+
+				y_ptr2+=BLOCK*y_pixel_stride;
+				rgb_ptr2+=BLOCK*rgb_pixel_stride;
+#endif
+
+				y_ptr1+=BLOCK*y_pixel_stride;
+				u_ptr+=BLOCK*uv_pixel_stride/uv_x_sample_interval;
+				v_ptr+=BLOCK*uv_pixel_stride/uv_x_sample_interval;
+				rgb_ptr1+=BLOCK*rgb_pixel_stride;
+			}
+		}
+
+		/* Catch the last line, if needed */
+		if (ypos < height)
+		{
+			const YUV_TYPE *y_ptr=(const YUV_TYPE *)((const uint8_t *)Y+ypos*Y_stride),
+				*u_ptr=(const YUV_TYPE *)((const uint8_t *)U+(ypos/uv_y_sample_interval)*UV_stride),
+				*v_ptr=(const YUV_TYPE *)((const uint8_t *)V+(ypos/uv_y_sample_interval)*UV_stride);
+
+			uint8_t *rgb_ptr=RGB+ypos*RGB_stride;
+
+			STD_FUNCTION_NAME(converted, 1, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+		}
+	}
+
+	/* Catch the right column, if needed */
+	if (converted != width)
+	{
+		const YUV_TYPE *y_ptr=Y+converted*y_pixel_stride,
+			*u_ptr=U+converted*uv_pixel_stride/uv_x_sample_interval,
+			*v_ptr=V+converted*uv_pixel_stride/uv_x_sample_interval;
+
+		uint8_t *rgb_ptr=RGB+converted*rgb_pixel_stride;
+
+		STD_FUNCTION_NAME(width-converted, height, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+	}
+}
+
+#undef NEON_FUNCTION_NAME
+#undef STD_FUNCTION_NAME
+#undef YUV_FORMAT
+#undef RGB_FORMAT
+#undef BLOCK
+#undef LANE_TYPE
+#undef GET
+#undef LOAD_U16
+#undef LOAD_U8
+#undef UV2RGB
+#undef DUP_UV
+#undef READ_UV
+#undef LOAD_Y
+#undef READ_Y
+#undef ADD_Y2RGB
+#undef PACK_U8
+#undef PIXEL_CHANNELS
+#undef PACK_PIXEL
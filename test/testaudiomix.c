@@ -0,0 +1,166 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark for the playback mixer: reports device mixes per second as more streams are bound. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define NOISE_FRAMES 4096
+
+static SDL_AudioSpec spec;
+static float *noise;
+static SDL_AtomicInt mixes;
+
+static void SDLCALL FeedStream(void *userdata, SDL_AudioStream *stream, int additional_amount, int total_amount)
+{
+    const int noise_size = NOISE_FRAMES * SDL_AUDIO_FRAMESIZE(spec);
+    (void)userdata;
+    (void)total_amount;
+    while (additional_amount > 0) {
+        const int len = SDL_min(additional_amount, noise_size);
+        SDL_PutAudioStreamData(stream, noise, len);
+        additional_amount -= len;
+    }
+}
+
+static void SDLCALL CountMix(void *userdata, const SDL_AudioSpec *outspec, float *buffer, int buflen)
+{
+    (void)userdata;
+    (void)outspec;
+    (void)buffer;
+    (void)buflen;
+    SDL_AddAtomicInt(&mixes, 1);
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    SDL_AudioStream **streams = NULL;
+    SDL_AudioDeviceID device = 0;
+    int max_voices = 256;
+    int milliseconds = 1000;
+    int freq = 0;
+    int result = 1;
+    int i;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--voices") == 0 && argv[i + 1]) {
+                max_voices = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--ms") == 0 && argv[i + 1]) {
+                milliseconds = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--freq") == 0 && argv[i + 1]) {
+                freq = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0 || max_voices <= 0 || milliseconds <= 0 || freq < 0) {
+            static const char *options[] = { "[--voices N]", "[--ms N]", "[--freq HZ]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    /* Run the dummy driver as fast as it can go, so the mixer is the only thing limiting throughput. */
+    SDL_SetHint(SDL_HINT_AUDIO_DRIVER, "dummy");
+    SDL_SetHint(SDL_HINT_AUDIO_DUMMY_TIMESCALE, "0");
+
+    if (!SDL_Init(SDL_INIT_AUDIO)) {
+        SDL_Log("Couldn't initialize audio: %s", SDL_GetError());
+        goto done;
+    }
+
+    spec.format = SDL_AUDIO_F32;
+    spec.channels = 2;
+    spec.freq = 48000;
+
+    device = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec);
+    if (!device) {
+        SDL_Log("Couldn't open audio device: %s", SDL_GetError());
+        goto done;
+    }
+    SDL_GetAudioDeviceFormat(device, &spec, NULL);
+    SDL_SetAudioPostmixCallback(device, CountMix, NULL);
+
+    noise = (float *)SDL_malloc(NOISE_FRAMES * SDL_AUDIO_FRAMESIZE(spec));
+    streams = (SDL_AudioStream **)SDL_calloc(max_voices, sizeof(*streams));
+    if (!noise || !streams) {
+        goto done;
+    }
+    SDL_srand(0);
+    for (i = 0; i < NOISE_FRAMES * spec.channels; ++i) {
+        noise[i] = (SDL_randf() - 0.5f) * 0.01f;
+    }
+
+    SDL_Log("Mixing %d Hz float32 stereo, %d ms per step, streams fed at %d Hz", spec.freq, milliseconds, freq ? freq : spec.freq);
+
+    for (int voices = 1, created = 0; voices <= max_voices; voices *= 2) {
+        SDL_AudioSpec srcspec;
+
+        SDL_copyp(&srcspec, &spec);
+        if (freq) {
+            srcspec.freq = freq;
+        }
+
+        for (; created < voices; ++created) {
+            streams[created] = SDL_CreateAudioStream(&srcspec, &spec);
+            if (!streams[created] ||
+                !SDL_SetAudioStreamGetCallback(streams[created], FeedStream, NULL) ||
+                !SDL_BindAudioStream(device, streams[created])) {
+                SDL_Log("Couldn't set up stream %d: %s", created, SDL_GetError());
+                goto done;
+            }
+        }
+
+        /* skip the first mix after binding new streams, since it includes their startup costs. */
+        SDL_Delay(10);
+
+        const int start_mixes = SDL_GetAtomicInt(&mixes);
+        const Uint64 start = SDL_GetTicksNS();
+        SDL_Delay(milliseconds);
+        const int count = SDL_GetAtomicInt(&mixes) - start_mixes;
+        const double seconds = (double)(SDL_GetTicksNS() - start) / SDL_NS_PER_SECOND;
+
+        SDL_Log("%4d voices: %10.1f mixes/sec, %12.1f voice-mixes/sec", voices, count / seconds, (count * (double)voices) / seconds);
+    }
+
+    result = 0;
+
+done:
+    if (device) {
+        SDL_CloseAudioDevice(device);
+    }
+    if (streams) {
+        for (i = 0; i < max_voices; ++i) {
+            SDL_DestroyAudioStream(streams[i]);
+        }
+        SDL_free(streams);
+    }
+    SDL_free(noise);
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
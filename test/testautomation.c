@@ -29,6 +29,7 @@ static SDLTest_TestSuiteReference *testSuites[] = {
     &guidTestSuite,
     &hintsTestSuite,
     &intrinsicsTestSuite,
+    &jobsTestSuite,
     &joystickTestSuite,
     &keyboardTestSuite,
     &logTestSuite,
@@ -1052,11 +1052,14 @@ static int SDLCALL audio_resampleLoss(void *arg)
     int rate_out;
     double signal_to_noise;
     double max_error;
+    SDL_AudioResampleQuality quality;
   } test_specs[] = {
-    { 50, 440, 0, 44100, 48000, 80, 0.0010 },
-    { 50, 5000, SDL_PI_D / 2, 20000, 10000, 999, 0.0001 },
-    { 50, 440, 0, 22050, 96000, 79, 0.0120 },
-    { 50, 440, 0, 96000, 22050, 80, 0.0002 },
+    { 50, 440, 0, 44100, 48000, 80, 0.0010, SDL_AUDIO_RESAMPLE_QUALITY_HIGH },
+    { 50, 5000, SDL_PI_D / 2, 20000, 10000, 999, 0.0001, SDL_AUDIO_RESAMPLE_QUALITY_HIGH },
+    { 50, 440, 0, 22050, 96000, 79, 0.0120, SDL_AUDIO_RESAMPLE_QUALITY_HIGH },
+    { 50, 440, 0, 96000, 22050, 80, 0.0002, SDL_AUDIO_RESAMPLE_QUALITY_HIGH },
+    { 50, 440, 0, 44100, 48000, 90, 0.0003, SDL_AUDIO_RESAMPLE_QUALITY_CUBIC },
+    { 50, 440, 0, 44100, 48000, 65, 0.0006, SDL_AUDIO_RESAMPLE_QUALITY_LINEAR },
     { 0 }
   };
 
@@ -1090,8 +1093,8 @@ static int SDLCALL audio_resampleLoss(void *arg)
     SDL_zero(tmpspec1);
     SDL_zero(tmpspec2);
 
-    SDLTest_AssertPass("Test resampling of %i s %i Hz %f phase sine wave from sampling rate of %i Hz to %i Hz",
-                       spec->time, spec->freq, spec->phase, spec->rate_in, spec->rate_out);
+    SDLTest_AssertPass("Test resampling of %i s %i Hz %f phase sine wave from sampling rate of %i Hz to %i Hz with quality %i",
+                       spec->time, spec->freq, spec->phase, spec->rate_in, spec->rate_out, (int)spec->quality);
 
     tmpspec1.format = SDL_AUDIO_F32;
     tmpspec1.channels = num_channels;
@@ -1106,6 +1109,9 @@ static int SDLCALL audio_resampleLoss(void *arg)
       return TEST_ABORTED;
     }
 
+    SDL_SetNumberProperty(SDL_GetAudioStreamProperties(stream), SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER, spec->quality);
+    SDLTest_AssertPass("Call to SDL_SetNumberProperty(SDL_PROP_AUDIOSTREAM_RESAMPLE_QUALITY_NUMBER, %i)", (int)spec->quality);
+
     buf_in = (float *)SDL_malloc(len_in);
     SDLTest_AssertCheck(buf_in != NULL, "Expected input buffer to be created.");
     if (buf_in == NULL) {
@@ -1470,6 +1476,141 @@ cleanup:
 
     return status;
 }
+
+/**
+ * Check that a stream reports the scratch space it allocates, and stops allocating once running.
+ *
+ * \sa SDL_GetAudioStreamProperties
+ */
+static int SDLCALL audio_scratchAllocations(void *arg)
+{
+    const SDL_AudioSpec src_spec = { SDL_AUDIO_S16, 2, 44100 };
+    const SDL_AudioSpec dst_spec = { SDL_AUDIO_F32, 2, 48000 };
+    const int src_len = src_spec.freq * SDL_AUDIO_FRAMESIZE(src_spec);
+    const int dst_len = 1024 * SDL_AUDIO_FRAMESIZE(dst_spec);
+    SDL_AudioStream *stream = NULL;
+    SDL_PropertiesID props;
+    Uint8 *src = NULL;
+    Uint8 *dst = NULL;
+    Sint64 allocated;
+    int status = TEST_ABORTED;
+    int i, result;
+
+    src = (Uint8 *)SDL_calloc(1, src_len);
+    dst = (Uint8 *)SDL_malloc(dst_len);
+    if (!SDLTest_AssertCheck(src != NULL && dst != NULL, "Expected buffers to be created.")) {
+        goto cleanup;
+    }
+
+    stream = SDL_CreateAudioStream(&src_spec, &dst_spec);
+    if (!SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed")) {
+        goto cleanup;
+    }
+    props = SDL_GetAudioStreamProperties(stream);
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_AUDIOSTREAM_SCRATCH_ALLOCATED_NUMBER, -1) == 0,
+                        "Expected no scratch space to be reported before converting");
+
+    if (!SDLTest_AssertCheck(SDL_PutAudioStreamData(stream, src, src_len), "Expected SDL_PutAudioStreamData to succeed")) {
+        goto cleanup;
+    }
+
+    result = SDL_GetAudioStreamData(stream, dst, dst_len);
+    SDLTest_AssertCheck(result == dst_len, "Expected SDL_GetAudioStreamData to return %i, got %i", dst_len, result);
+    allocated = SDL_GetNumberProperty(props, SDL_PROP_AUDIOSTREAM_SCRATCH_ALLOCATED_NUMBER, 0);
+    SDLTest_AssertCheck(allocated > 0, "Expected the first conversion to report scratch space, got %" SDL_PRIs64, allocated);
+
+    /* The same request again should reuse the scratch space */
+    for (i = 0; i < 8; ++i) {
+        result = SDL_GetAudioStreamData(stream, dst, dst_len);
+        SDLTest_AssertCheck(result == dst_len, "Expected SDL_GetAudioStreamData to return %i, got %i", dst_len, result);
+    }
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_AUDIOSTREAM_SCRATCH_ALLOCATED_NUMBER, 0) == allocated,
+                        "Expected no more scratch space to be allocated, still %" SDL_PRIs64 " bytes", allocated);
+
+    status = TEST_COMPLETED;
+
+cleanup:
+    SDL_free(src);
+    SDL_free(dst);
+    SDL_DestroyAudioStream(stream);
+
+    return status;
+}
+
+/**
+ * Check that scratch space grows with headroom, so small changes in the amount converted don't reallocate it.
+ *
+ * \sa SDL_GetAudioStreamProperties
+ * \sa SDL_SetAudioStreamFrequencyRatio
+ */
+static int SDLCALL audio_scratchGrowth(void *arg)
+{
+    const SDL_AudioSpec src_spec = { SDL_AUDIO_S16, 2, 44100 };
+    const SDL_AudioSpec dst_spec = { SDL_AUDIO_F32, 2, 48000 };
+    const int frame_size = SDL_AUDIO_FRAMESIZE(dst_spec);
+    const int src_len = 2 * src_spec.freq * SDL_AUDIO_FRAMESIZE(src_spec);
+    const int dst_len = 4096 * frame_size;
+    SDL_AudioStream *stream = NULL;
+    SDL_PropertiesID props;
+    Uint8 *src = NULL;
+    Uint8 *dst = NULL;
+    Sint64 allocated, grown;
+    int status = TEST_ABORTED;
+    int i, result;
+
+    src = (Uint8 *)SDL_calloc(1, src_len);
+    dst = (Uint8 *)SDL_malloc(dst_len);
+    if (!SDLTest_AssertCheck(src != NULL && dst != NULL, "Expected buffers to be created.")) {
+        goto cleanup;
+    }
+
+    stream = SDL_CreateAudioStream(&src_spec, &dst_spec);
+    if (!SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed")) {
+        goto cleanup;
+    }
+    props = SDL_GetAudioStreamProperties(stream);
+    if (!SDLTest_AssertCheck(SDL_PutAudioStreamData(stream, src, src_len), "Expected SDL_PutAudioStreamData to succeed")) {
+        goto cleanup;
+    }
+
+    result = SDL_GetAudioStreamData(stream, dst, 1024 * frame_size);
+    SDLTest_AssertCheck(result == 1024 * frame_size, "Expected SDL_GetAudioStreamData to return %i, got %i", 1024 * frame_size, result);
+    allocated = SDL_GetNumberProperty(props, SDL_PROP_AUDIOSTREAM_SCRATCH_ALLOCATED_NUMBER, 0);
+    SDLTest_AssertCheck(allocated > 0, "Expected the first conversion to report scratch space, got %" SDL_PRIs64, allocated);
+
+    /* A few frames more or less, or a slightly different rate, should fit in the headroom */
+    for (i = 0; i < 16; ++i) {
+        const int frames = 1024 + (i % 4) * 16 - 24;
+
+        SDLTest_AssertCheck(SDL_SetAudioStreamFrequencyRatio(stream, 1.0f + ((i % 3) - 1) * 0.05f), "Expected SDL_SetAudioStreamFrequencyRatio to succeed");
+        result = SDL_GetAudioStreamData(stream, dst, frames * frame_size);
+        SDLTest_AssertCheck(result == frames * frame_size, "Expected SDL_GetAudioStreamData to return %i, got %i", frames * frame_size, result);
+    }
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_AUDIOSTREAM_SCRATCH_ALLOCATED_NUMBER, 0) == allocated,
+                        "Expected small changes to reuse the scratch space, still %" SDL_PRIs64 " bytes", allocated);
+
+    /* Converting much more at once has to grow it, once */
+    SDLTest_AssertCheck(SDL_SetAudioStreamFrequencyRatio(stream, 1.0f), "Expected SDL_SetAudioStreamFrequencyRatio to succeed");
+    result = SDL_GetAudioStreamData(stream, dst, dst_len);
+    SDLTest_AssertCheck(result == dst_len, "Expected SDL_GetAudioStreamData to return %i, got %i", dst_len, result);
+    grown = SDL_GetNumberProperty(props, SDL_PROP_AUDIOSTREAM_SCRATCH_ALLOCATED_NUMBER, 0);
+    SDLTest_AssertCheck(grown > allocated, "Expected a larger conversion to allocate more scratch space, got %" SDL_PRIs64 " after %" SDL_PRIs64, grown, allocated);
+
+    result = SDL_GetAudioStreamData(stream, dst, dst_len);
+    SDLTest_AssertCheck(result == dst_len, "Expected SDL_GetAudioStreamData to return %i, got %i", dst_len, result);
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_AUDIOSTREAM_SCRATCH_ALLOCATED_NUMBER, 0) == grown,
+                        "Expected no more scratch space to be allocated, still %" SDL_PRIs64 " bytes", grown);
+
+    status = TEST_COMPLETED;
+
+cleanup:
+    SDL_free(src);
+    SDL_free(dst);
+    SDL_DestroyAudioStream(stream);
+
+    return status;
+}
+
 /* ================= Test Case References ================== */
 
 /* Audio test cases */
@@ -1551,13 +1692,21 @@ static const SDLTest_TestCaseReference audioTest18 = {
     audio_formatChange, "audio_formatChange", "Check handling of format changes.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference audioTest19 = {
+    audio_scratchAllocations, "audio_scratchAllocations", "Check the scratch space reported by an audio stream.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest20 = {
+    audio_scratchGrowth, "audio_scratchGrowth", "Check that audio stream scratch space grows with headroom.", TEST_ENABLED
+};
+
 /* Sequence of Audio test cases */
 static const SDLTest_TestCaseReference *audioTests[] = {
     &audioTestGetAudioFormatName,
     &audioTest1, &audioTest2, &audioTest3, &audioTest4, &audioTest5, &audioTest6,
     &audioTest7, &audioTest8, &audioTest9, &audioTest10, &audioTest11,
     &audioTest12, &audioTest13, &audioTest14, &audioTest15, &audioTest16,
-    &audioTest17, &audioTest18, NULL
+    &audioTest17, &audioTest18, &audioTest19, &audioTest20, NULL
 };
 
 /* Audio test suite (global) */
@@ -308,6 +308,162 @@ static int SDLCALL events_mainThreadCallbacks(void *arg)
     return TEST_COMPLETED;
 }
 
+#define QUEUE_ORDER_EVENTS  3000
+#define QUEUE_ORDER_THREADS 4
+
+#ifndef SDL_PLATFORM_EMSCRIPTEN /* Emscripten doesn't have threads */
+static int SDLCALL PushOrderedEventsThread(void *userdata)
+{
+    SDL_Event event;
+    int i;
+
+    SDL_zero(event);
+    event.type = SDL_EVENT_USER;
+    event.user.data1 = userdata;
+    for (i = 0; i < QUEUE_ORDER_EVENTS; ++i) {
+        event.user.code = i;
+        SDL_PushEvent(&event);
+    }
+    return 0;
+}
+
+typedef struct FullRingProducer
+{
+    SDL_AtomicInt *start;
+    int id;
+} FullRingProducer;
+
+static int SDLCALL PushEventsIntoFullRingThread(void *userdata)
+{
+    FullRingProducer *producer = (FullRingProducer *)userdata;
+    SDL_Event event;
+    int i;
+
+    /* Start together, so the threads race each other for ring slots while it's full */
+    while (!SDL_GetAtomicInt(producer->start)) {
+        SDL_CPUPauseInstruction();
+    }
+
+    SDL_zero(event);
+    event.type = SDL_EVENT_USER;
+    event.user.data1 = (void *)(intptr_t)producer->id;
+    for (i = 0; i < QUEUE_ORDER_EVENTS; ++i) {
+        event.user.code = i;
+        SDL_PushEvent(&event);
+    }
+    return 0;
+}
+#endif /* !SDL_PLATFORM_EMSCRIPTEN */
+
+/**
+ * Pushes more events than fit in the lock-free part of the queue, from several threads, and checks they come out in order.
+ */
+static int SDLCALL events_queueOrdering(void *arg)
+{
+    int next_code[1 + QUEUE_ORDER_THREADS];
+    int num_producers = 1;
+    int received = 0;
+    int mismatches = 0;
+    SDL_Event event;
+    int i;
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+    SDL_zeroa(next_code);
+
+    SDL_zero(event);
+    event.type = SDL_EVENT_USER;
+    event.user.data1 = (void *)(intptr_t)0;
+    for (i = 0; i < QUEUE_ORDER_EVENTS; ++i) {
+        event.user.code = i;
+        SDL_PushEvent(&event);
+    }
+    SDLTest_AssertPass("Pushed %d events from the main thread", QUEUE_ORDER_EVENTS);
+
+#ifndef SDL_PLATFORM_EMSCRIPTEN /* Emscripten doesn't have threads */
+    {
+        SDL_Thread *threads[QUEUE_ORDER_THREADS];
+
+        for (i = 0; i < QUEUE_ORDER_THREADS; ++i) {
+            threads[i] = SDL_CreateThread(PushOrderedEventsThread, "PushOrderedEvents", (void *)(intptr_t)(i + 1));
+            SDLTest_AssertCheck(threads[i] != NULL, "Create producer thread %d", i);
+        }
+        for (i = 0; i < QUEUE_ORDER_THREADS; ++i) {
+            SDL_WaitThread(threads[i], NULL);
+        }
+        num_producers += QUEUE_ORDER_THREADS;
+    }
+#endif /* !SDL_PLATFORM_EMSCRIPTEN */
+
+    SDLTest_AssertCheck(SDL_HasEvent(SDL_EVENT_USER), "Check SDL_HasEvent sees the pushed events");
+
+    while (SDL_PeepEvents(&event, 1, SDL_GETEVENT, SDL_EVENT_USER, SDL_EVENT_USER) == 1) {
+        const int producer = (int)(intptr_t)event.user.data1;
+        if (producer < 0 || producer >= num_producers || event.user.code != next_code[producer]) {
+            ++mismatches;
+        } else {
+            ++next_code[producer];
+        }
+        ++received;
+    }
+
+    SDLTest_AssertCheck(mismatches == 0, "Check events from each producer arrive in order, got %d out of order", mismatches);
+    SDLTest_AssertCheck(received == num_producers * QUEUE_ORDER_EVENTS, "Check all events arrived, expected %d, got %d", num_producers * QUEUE_ORDER_EVENTS, received);
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Fills the lock-free part of the queue and keeps several threads pushing into it at once, so events
+ * keep taking the full ring path, and checks each thread's events still come out in the order it pushed them.
+ */
+static int SDLCALL events_queueOrderingFullRing(void *arg)
+{
+#ifndef SDL_PLATFORM_EMSCRIPTEN /* Emscripten doesn't have threads */
+    SDL_Thread *threads[QUEUE_ORDER_THREADS];
+    FullRingProducer producers[QUEUE_ORDER_THREADS];
+    int next_code[QUEUE_ORDER_THREADS];
+    SDL_AtomicInt start;
+    int received = 0;
+    int mismatches = 0;
+    SDL_Event event;
+    int i;
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+    SDL_zeroa(next_code);
+    SDL_SetAtomicInt(&start, 0);
+
+    for (i = 0; i < QUEUE_ORDER_THREADS; ++i) {
+        producers[i].start = &start;
+        producers[i].id = i;
+        threads[i] = SDL_CreateThread(PushEventsIntoFullRingThread, "PushEventsIntoFullRing", &producers[i]);
+        SDLTest_AssertCheck(threads[i] != NULL, "Create producer thread %d", i);
+    }
+    SDL_SetAtomicInt(&start, 1);
+    for (i = 0; i < QUEUE_ORDER_THREADS; ++i) {
+        SDL_WaitThread(threads[i], NULL);
+    }
+
+    while (SDL_PeepEvents(&event, 1, SDL_GETEVENT, SDL_EVENT_USER, SDL_EVENT_USER) == 1) {
+        const int producer = (int)(intptr_t)event.user.data1;
+        if (producer < 0 || producer >= QUEUE_ORDER_THREADS || event.user.code != next_code[producer]) {
+            ++mismatches;
+        } else {
+            ++next_code[producer];
+        }
+        ++received;
+    }
+
+    SDLTest_AssertCheck(mismatches == 0, "Check events from each producer arrive in order, got %d out of order", mismatches);
+    SDLTest_AssertCheck(received == QUEUE_ORDER_THREADS * QUEUE_ORDER_EVENTS, "Check all events arrived, expected %d, got %d", QUEUE_ORDER_THREADS * QUEUE_ORDER_EVENTS, received);
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+#endif /* !SDL_PLATFORM_EMSCRIPTEN */
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Events test cases */
@@ -327,12 +483,22 @@ static const SDLTest_TestCaseReference eventsTest_mainThreadCallbacks = {
     events_mainThreadCallbacks, "events_mainThreadCallbacks", "Run callbacks on the main thread", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference eventsTest_queueOrdering = {
+    events_queueOrdering, "events_queueOrdering", "Push events from several threads and check their order", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference eventsTest_queueOrderingFullRing = {
+    events_queueOrderingFullRing, "events_queueOrderingFullRing", "Push events from several threads at once into a full queue and check their order", TEST_ENABLED
+};
+
 /* Sequence of Events test cases */
 static const SDLTest_TestCaseReference *eventsTests[] = {
     &eventsTest_pushPumpAndPollUserevent,
     &eventsTest_addDelEventWatch,
     &eventsTest_addDelEventWatchWithUserdata,
     &eventsTest_mainThreadCallbacks,
+    &eventsTest_queueOrdering,
+    &eventsTest_queueOrderingFullRing,
     NULL
 };
 
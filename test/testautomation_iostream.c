@@ -603,6 +603,105 @@ static int SDLCALL iostrm_testFileRead(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Tests reading from a memory-mapped file.
+ *
+ * \sa SDL_IOFromMappedFile
+ * \sa SDL_GetIOMappedPointer
+ * \sa SDL_CloseIO
+ */
+static int SDLCALL iostrm_testMappedFile(void *arg)
+{
+    SDL_IOStream *rw;
+    const char *mapped;
+    size_t size;
+    int result;
+
+    rw = SDL_IOFromMappedFile(IOStreamReadTestFilename, SDL_IO_MAP_SEQUENTIAL);
+    SDLTest_AssertPass("Call to SDL_IOFromMappedFile(..., SDL_IO_MAP_SEQUENTIAL) succeeded");
+    SDLTest_AssertCheck(rw != NULL, "Verify opening file with SDL_IOFromMappedFile does not return NULL");
+
+    /* Bail out if NULL */
+    if (rw == NULL) {
+        return TEST_ABORTED;
+    }
+
+    /* Run generic tests */
+    testGenericIOStreamValidations(rw, false);
+
+    /* The mapping should follow the read position */
+    SDL_SeekIO(rw, 6, SDL_IO_SEEK_SET);
+    mapped = (const char *)SDL_GetIOMappedPointer(rw, &size);
+    SDLTest_AssertPass("Call to SDL_GetIOMappedPointer() succeeded");
+    SDLTest_AssertCheck(mapped != NULL, "Verify mapped pointer is not NULL");
+    SDLTest_AssertCheck(size == SDL_strlen(IOStreamHelloWorldCompString) - 6, "Verify mapped size, expected %d, got %d", (int)SDL_strlen(IOStreamHelloWorldCompString) - 6, (int)size);
+    if (mapped) {
+        SDLTest_AssertCheck(SDL_memcmp(mapped, IOStreamHelloWorldCompString + 6, size) == 0, "Verify mapped data matches the file contents");
+    }
+
+    /* The memory properties are only informational, changing them doesn't change the mapping */
+    SDL_SetPointerProperty(SDL_GetIOProperties(rw), SDL_PROP_IOSTREAM_MEMORY_POINTER, NULL);
+    SDL_SetNumberProperty(SDL_GetIOProperties(rw), SDL_PROP_IOSTREAM_MEMORY_SIZE_NUMBER, 1000000);
+    mapped = (const char *)SDL_GetIOMappedPointer(rw, &size);
+    SDLTest_AssertCheck(mapped != NULL && size == SDL_strlen(IOStreamHelloWorldCompString) - 6, "Verify mapped pointer ignores changed properties");
+
+    /* Close handle */
+    result = SDL_CloseIO(rw);
+    SDLTest_AssertPass("Call to SDL_CloseIO() succeeded");
+    SDLTest_AssertCheck(result == true, "Verify result value is true; got: %d", result);
+
+    /* Streams that aren't backed by memory have nothing to map */
+    rw = SDL_IOFromFile(IOStreamReadTestFilename, "r");
+    if (rw) {
+        mapped = (const char *)SDL_GetIOMappedPointer(rw, &size);
+        SDLTest_AssertCheck(mapped == NULL && size == 0, "Verify SDL_GetIOMappedPointer() fails on a file stream");
+        SDL_CloseIO(rw);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Tests mapping a file that doesn't report its size, which has to be read instead.
+ *
+ * \sa SDL_IOFromMappedFile
+ * \sa SDL_GetIOMappedPointer
+ */
+static int SDLCALL iostrm_testMappedNonRegularFile(void *arg)
+{
+    const char *file = "/proc/self/status";
+    SDL_IOStream *rw;
+    const char *mapped;
+    size_t size = 0;
+    void *data;
+
+    if (!SDL_GetPathInfo(file, NULL)) {
+        SDLTest_Log("Skipping test, %s isn't available", file);
+        return TEST_SKIPPED;
+    }
+
+    rw = SDL_IOFromMappedFile(file, 0);
+    SDLTest_AssertPass("Call to SDL_IOFromMappedFile(\"%s\", 0) succeeded", file);
+    SDLTest_AssertCheck(rw != NULL, "Verify opening file with SDL_IOFromMappedFile does not return NULL");
+    if (rw == NULL) {
+        return TEST_ABORTED;
+    }
+
+    mapped = (const char *)SDL_GetIOMappedPointer(rw, &size);
+    SDLTest_AssertCheck(mapped != NULL && size > 0, "Verify the file contents were loaded, got %d bytes", (int)size);
+    SDLTest_AssertCheck(SDL_GetIOSize(rw) == (Sint64)size, "Verify stream size matches, expected %d, got %d", (int)size, (int)SDL_GetIOSize(rw));
+    if (mapped && size >= 5) {
+        SDLTest_AssertCheck(SDL_strncmp(mapped, "Name:", 5) == 0, "Verify the file contents start with \"Name:\"");
+    }
+    SDL_CloseIO(rw);
+
+    data = SDL_LoadFile(file, &size);
+    SDLTest_AssertCheck(data != NULL && size > 0, "Verify SDL_LoadFile() read the file contents, got %d bytes", (int)size);
+    SDL_free(data);
+
+    return TEST_COMPLETED;
+}
+
 /**
  * Tests writing from file.
  *
@@ -913,10 +1012,18 @@ static const SDLTest_TestCaseReference iostrmTest12 = {
     iostrm_testConstMemEmpty, "iostrm_testConstMemEmpty", "Tests opening empty (const) memory stream", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference iostrmTest13 = {
+    iostrm_testMappedFile, "iostrm_testMappedFile", "Tests reading from a memory-mapped file", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference iostrmTest14 = {
+    iostrm_testMappedNonRegularFile, "iostrm_testMappedNonRegularFile", "Tests mapping a file that doesn't report its size", TEST_ENABLED
+};
+
 /* Sequence of IOStream test cases */
 static const SDLTest_TestCaseReference *iostrmTests[] = {
     &iostrmTest1, &iostrmTest2, &iostrmTest3, &iostrmTest4, &iostrmTest5, &iostrmTest6,
-    &iostrmTest7, &iostrmTest8, &iostrmTest9, &iostrmTest10, &iostrmTest11, &iostrmTest12, NULL
+    &iostrmTest7, &iostrmTest8, &iostrmTest9, &iostrmTest10, &iostrmTest11, &iostrmTest12, &iostrmTest13, &iostrmTest14, NULL
 };
 
 /* IOStream test suite (global) */
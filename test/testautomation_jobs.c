@@ -0,0 +1,212 @@
+/**
+ * Job system test suite
+ */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_test.h>
+#include "testautomation_suites.h"
+
+#define NUM_JOBS 1000
+
+typedef struct JobTestData
+{
+    SDL_AtomicInt count;
+    SDL_AtomicInt order_failures;
+    SDL_JobCounter *inner;
+    int values[NUM_JOBS];
+} JobTestData;
+
+/* Test case functions */
+
+static void SDLCALL job_increment(void *userdata)
+{
+    JobTestData *data = (JobTestData *)userdata;
+    SDL_AddAtomicInt(&data->count, 1);
+}
+
+static void SDLCALL job_check_count(void *userdata)
+{
+    JobTestData *data = (JobTestData *)userdata;
+    if (SDL_GetAtomicInt(&data->count) != NUM_JOBS) {
+        SDL_AddAtomicInt(&data->order_failures, 1);
+    }
+}
+
+static void SDLCALL job_submit_and_wait(void *userdata)
+{
+    JobTestData *data = (JobTestData *)userdata;
+    SDL_JobCounter *counter = SDL_CreateJobCounter();
+    int i;
+
+    if (!counter) {
+        SDL_AddAtomicInt(&data->order_failures, 1);
+        return;
+    }
+    for (i = 0; i < 10; ++i) {
+        SDL_SubmitJob(job_increment, data, counter, NULL);
+    }
+    SDL_WaitJobCounter(counter);
+    if (!SDL_IsJobCounterDone(counter)) {
+        SDL_AddAtomicInt(&data->order_failures, 1);
+    }
+    SDL_DestroyJobCounter(counter);
+}
+
+static void SDLCALL job_fill_values(void *userdata, int start, int end)
+{
+    JobTestData *data = (JobTestData *)userdata;
+    int i;
+
+    for (i = start; i < end; ++i) {
+        data->values[i] += i;
+    }
+    SDL_AddAtomicInt(&data->count, end - start);
+}
+
+/**
+ * Test that every submitted job runs and is counted.
+ */
+static int SDLCALL jobs_testSubmit(void *arg)
+{
+    JobTestData data;
+    SDL_JobCounter *counter;
+    bool result;
+    int i;
+
+    SDL_zero(data);
+
+    SDLTest_AssertCheck(SDL_GetNumJobThreads() >= 0, "Check SDL_GetNumJobThreads()");
+
+    counter = SDL_CreateJobCounter();
+    SDLTest_AssertPass("Call to SDL_CreateJobCounter()");
+    SDLTest_AssertCheck(counter != NULL, "Verify counter was created");
+    if (!counter) {
+        return TEST_ABORTED;
+    }
+    SDLTest_AssertCheck(SDL_IsJobCounterDone(counter), "Verify a new counter is done");
+
+    result = true;
+    for (i = 0; i < NUM_JOBS; ++i) {
+        result = SDL_SubmitJob(job_increment, &data, counter, NULL) && result;
+    }
+    SDLTest_AssertCheck(result, "Verify SDL_SubmitJob() succeeded");
+
+    SDL_WaitJobCounter(counter);
+    SDLTest_AssertPass("Call to SDL_WaitJobCounter()");
+    SDLTest_AssertCheck(SDL_IsJobCounterDone(counter), "Verify counter is done");
+    SDLTest_AssertCheck(SDL_GetAtomicInt(&data.count) == NUM_JOBS,
+        "Verify all jobs ran, expected %d, got %d", NUM_JOBS, SDL_GetAtomicInt(&data.count));
+
+    SDL_DestroyJobCounter(counter);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Test that jobs wait for their dependency, and that jobs can wait on jobs.
+ */
+static int SDLCALL jobs_testDependencies(void *arg)
+{
+    JobTestData data;
+    SDL_JobCounter *first, *second;
+    int i;
+
+    SDL_zero(data);
+
+    first = SDL_CreateJobCounter();
+    second = SDL_CreateJobCounter();
+    SDLTest_AssertCheck(first && second, "Verify counters were created");
+    if (!first || !second) {
+        SDL_DestroyJobCounter(first);
+        SDL_DestroyJobCounter(second);
+        return TEST_ABORTED;
+    }
+
+    for (i = 0; i < NUM_JOBS; ++i) {
+        SDL_SubmitJob(job_increment, &data, first, NULL);
+    }
+    for (i = 0; i < 10; ++i) {
+        SDL_SubmitJob(job_check_count, &data, second, first);
+    }
+    SDL_WaitJobCounter(second);
+    SDLTest_AssertPass("Call to SDL_WaitJobCounter()");
+    SDLTest_AssertCheck(SDL_IsJobCounterDone(first), "Verify dependency is done");
+    SDLTest_AssertCheck(SDL_GetAtomicInt(&data.order_failures) == 0,
+        "Verify dependent jobs ran after their dependency, %d ran early", SDL_GetAtomicInt(&data.order_failures));
+
+    SDL_SetAtomicInt(&data.count, 0);
+    for (i = 0; i < 100; ++i) {
+        SDL_SubmitJob(job_submit_and_wait, &data, first, NULL);
+    }
+    SDL_DestroyJobCounter(first);
+    SDLTest_AssertPass("Call to SDL_DestroyJobCounter()");
+    SDLTest_AssertCheck(SDL_GetAtomicInt(&data.count) == 1000,
+        "Verify nested jobs ran, expected 1000, got %d", SDL_GetAtomicInt(&data.count));
+    SDLTest_AssertCheck(SDL_GetAtomicInt(&data.order_failures) == 0, "Verify nested waits finished");
+
+    SDL_DestroyJobCounter(second);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Test that a parallel loop covers every index exactly once.
+ */
+static int SDLCALL jobs_testParallelFor(void *arg)
+{
+    static JobTestData data;
+    const int grains[] = { 0, 1, 7, NUM_JOBS, NUM_JOBS * 2 };
+    int i, j, bad;
+
+    for (i = 0; i < SDL_arraysize(grains); ++i) {
+        SDL_zero(data);
+        SDL_ParallelFor(NUM_JOBS, grains[i], job_fill_values, &data);
+        SDLTest_AssertPass("Call to SDL_ParallelFor(%d, %d)", NUM_JOBS, grains[i]);
+
+        bad = 0;
+        for (j = 0; j < NUM_JOBS; ++j) {
+            if (data.values[j] != j) {
+                ++bad;
+            }
+        }
+        SDLTest_AssertCheck(bad == 0 && SDL_GetAtomicInt(&data.count) == NUM_JOBS,
+            "Verify every index was visited once, %d wrong, %d visited", bad, SDL_GetAtomicInt(&data.count));
+    }
+
+    SDL_zero(data);
+    SDL_ParallelFor(0, 0, job_fill_values, &data);
+    SDLTest_AssertCheck(SDL_GetAtomicInt(&data.count) == 0, "Verify an empty loop does nothing");
+
+    return TEST_COMPLETED;
+}
+
+/* ================= Test References ================== */
+
+/* Job system test cases */
+static const SDLTest_TestCaseReference jobsTestSubmit = {
+    jobs_testSubmit, "jobs_testSubmit", "Test submitting and waiting on jobs", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference jobsTestDependencies = {
+    jobs_testDependencies, "jobs_testDependencies", "Test job dependencies and nested waits", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference jobsTestParallelFor = {
+    jobs_testParallelFor, "jobs_testParallelFor", "Test parallel loops", TEST_ENABLED
+};
+
+/* Sequence of Job system test cases */
+static const SDLTest_TestCaseReference *jobsTests[] = {
+    &jobsTestSubmit,
+    &jobsTestDependencies,
+    &jobsTestParallelFor,
+    NULL
+};
+
+/* Job system test suite (global) */
+SDLTest_TestSuiteReference jobsTestSuite = {
+    "Jobs",
+    NULL,
+    jobsTests,
+    NULL
+};
@@ -279,6 +279,94 @@ static int SDLCALL joystick_testMappings(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Check adding and looking up a large number of gamepad mappings
+ *
+ * \sa SDL_AddGamepadMapping
+ * \sa SDL_GetGamepadMappingForGUID
+ */
+static int SDLCALL joystick_testMappingDatabase(void *arg)
+{
+    const int num_mappings = 5000;
+    char guid_string[33];
+    char mapping[256];
+    char expected_name[64];
+    Uint64 start, added, found;
+    int i, added_count = 0, found_count = 0, version_count = 0;
+    int gamepad_refs = 0, joystick_refs = 0;
+
+    /* A database about the size of the community one, with a few versions of each device */
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < num_mappings; ++i) {
+        const int product = 1 + i / 2;
+        const int version = 0x100 + (i % 2);
+        SDL_snprintf(mapping, sizeof(mapping), "03000000%02x%02x0000%02x%02x0000%02x%02x0000,Test Gamepad %d,a:b0,b:b1,x:b2,y:b3,leftx:a0,lefty:a1,",
+                     0x34, 0x12, product & 0xFF, product >> 8, version & 0xFF, version >> 8, i);
+        if (SDL_AddGamepadMapping(mapping) == 1) {
+            ++added_count;
+        }
+    }
+    added = SDL_GetPerformanceCounter() - start;
+    SDLTest_AssertCheck(added_count == num_mappings, "SDL_AddGamepadMapping() added %d mappings (expected %d)", added_count, num_mappings);
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < num_mappings; ++i) {
+        const int product = 1 + i / 2;
+        const int version = 0x100 + (i % 2);
+        char *result;
+
+        SDL_snprintf(guid_string, sizeof(guid_string), "03000000%02x%02x0000%02x%02x0000%02x%02x0000",
+                     0x34, 0x12, product & 0xFF, product >> 8, version & 0xFF, version >> 8);
+        SDL_snprintf(expected_name, sizeof(expected_name), ",Test Gamepad %d,", i);
+        result = SDL_GetGamepadMappingForGUID(SDL_StringToGUID(guid_string));
+        if (result && SDL_strstr(result, expected_name)) {
+            ++found_count;
+        }
+        SDL_free(result);
+
+        /* An unknown version of a known device falls back to the first mapping for it */
+        if ((i % 2) == 0) {
+            SDL_snprintf(guid_string, sizeof(guid_string), "03000000%02x%02x0000%02x%02x000000030000",
+                         0x34, 0x12, product & 0xFF, product >> 8);
+            result = SDL_GetGamepadMappingForGUID(SDL_StringToGUID(guid_string));
+            if (result && SDL_strstr(result, expected_name)) {
+                ++version_count;
+            }
+            SDL_free(result);
+        }
+    }
+    found = SDL_GetPerformanceCounter() - start;
+    SDLTest_AssertCheck(found_count == num_mappings, "SDL_GetGamepadMappingForGUID() found %d exact matches (expected %d)", found_count, num_mappings);
+    SDLTest_AssertCheck(version_count == num_mappings / 2, "SDL_GetGamepadMappingForGUID() found %d matches ignoring version (expected %d)", version_count, num_mappings / 2);
+
+    SDLTest_Log("Added %d mappings in %.2f ms, looked up %d GUIDs in %.2f ms", num_mappings,
+                (double)added * 1000.0 / SDL_GetPerformanceFrequency(), num_mappings + num_mappings / 2,
+                (double)found * 1000.0 / SDL_GetPerformanceFrequency());
+
+    /* The mappings live until the joystick subsystem is shut down, so restart it to keep them out of later tests */
+    while (SDL_WasInit(SDL_INIT_GAMEPAD)) {
+        SDL_QuitSubSystem(SDL_INIT_GAMEPAD);
+        ++gamepad_refs;
+    }
+    while (SDL_WasInit(SDL_INIT_JOYSTICK)) {
+        SDL_QuitSubSystem(SDL_INIT_JOYSTICK);
+        ++joystick_refs;
+    }
+    for (i = 0; i < joystick_refs; ++i) {
+        SDL_InitSubSystem(SDL_INIT_JOYSTICK);
+    }
+    for (i = 0; i < gamepad_refs; ++i) {
+        SDL_InitSubSystem(SDL_INIT_GAMEPAD);
+    }
+    {
+        char *result = SDL_GetGamepadMappingForGUID(SDL_StringToGUID("03000000341200000100000000010000"));
+        SDLTest_AssertCheck(result == NULL, "SDL_GetGamepadMappingForGUID() -> %s (expected NULL after restarting the subsystem)", result ? result : "NULL");
+        SDL_free(result);
+    }
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Joystick routine test cases */
@@ -288,11 +376,15 @@ static const SDLTest_TestCaseReference joystickTest1 = {
 static const SDLTest_TestCaseReference joystickTest2 = {
     joystick_testMappings, "joystick_testMappings", "Test gamepad mapping functionality", TEST_ENABLED
 };
+static const SDLTest_TestCaseReference joystickTest3 = {
+    joystick_testMappingDatabase, "joystick_testMappingDatabase", "Test adding and looking up many gamepad mappings", TEST_ENABLED
+};
 
 /* Sequence of Joystick routine test cases */
 static const SDLTest_TestCaseReference *joystickTests[] = {
     &joystickTest1,
     &joystickTest2,
+    &joystickTest3,
     NULL
 };
 
@@ -1197,6 +1197,225 @@ static int SDLCALL pixels_saveLoadPNG(void *arg)
     return TEST_COMPLETED;
 }
 
+static Uint32 updatePNGAdler32(Uint32 adler, const Uint8 *data, size_t size)
+{
+    Uint32 sum1 = adler & 0xffff, sum2 = adler >> 16;
+    size_t i;
+
+    for (i = 0; i < size; i++) {
+        sum1 = (sum1 + data[i]) % 65521;
+        sum2 = (sum2 + sum1) % 65521;
+    }
+    return sum1 | (sum2 << 16);
+}
+
+/* Computes the Adler-32 of the scanlines the encoder should write, which use the Sub filter only at level 1 for non-indexed images */
+static Uint32 computePNGAdler32(const SDL_Surface *surface, int level)
+{
+    const int bpp = SDL_BYTESPERPIXEL(surface->format);
+    const size_t row_size = (size_t)surface->w * bpp;
+    const Uint8 filter = (level == 1 && !SDL_ISPIXELFORMAT_INDEXED(surface->format)) ? 1 : 0;
+    Uint8 *filtered = (Uint8 *)SDL_malloc(row_size);
+    Uint32 adler = 1;
+    size_t i;
+    int y;
+
+    if (!filtered) {
+        return 0;
+    }
+    for (y = 0; y < surface->h; y++) {
+        const Uint8 *row = (const Uint8 *)surface->pixels + y * surface->pitch;
+
+        for (i = 0; i < row_size; i++) {
+            filtered[i] = (filter && i >= (size_t)bpp) ? (Uint8)(row[i] - row[i - bpp]) : row[i];
+        }
+        adler = updatePNGAdler32(adler, &filter, 1);
+        adler = updatePNGAdler32(adler, filtered, row_size);
+    }
+    SDL_free(filtered);
+    return adler;
+}
+
+static Uint32 readPNGUint32(const Uint8 *data)
+{
+    return ((Uint32)data[0] << 24) | ((Uint32)data[1] << 16) | ((Uint32)data[2] << 8) | data[3];
+}
+
+/* Checks the CRC of every chunk and the Adler-32 of the image data in a saved PNG */
+static void verifyPNGChecksums(const Uint8 *png, size_t size, const SDL_Surface *surface, int level)
+{
+    static const Uint8 signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    Uint8 *idat = NULL;
+    size_t idat_size = 0;
+    size_t pos;
+    int chunks = 0, bad_crcs = 0;
+    bool has_iend = false;
+
+    SDLTest_AssertCheck(size >= sizeof(signature) && SDL_memcmp(png, signature, sizeof(signature)) == 0, "Verify PNG signature at level %d", level);
+    if (size < sizeof(signature)) {
+        return;
+    }
+
+    for (pos = sizeof(signature); pos + 12 <= size && !has_iend;) {
+        const Uint32 length = readPNGUint32(png + pos);
+        const Uint8 *type = png + pos + 4;
+        Uint32 crc;
+
+        if (length > size - pos - 12) {
+            break;
+        }
+        crc = readPNGUint32(type + 4 + length);
+        if (SDL_crc32(0, type, 4 + length) != crc) {
+            SDLTest_Log("Chunk %.4s at offset %d has CRC %08" SDL_PRIx32 ", expected %08" SDL_PRIx32, (const char *)type, (int)pos, crc, SDL_crc32(0, type, 4 + length));
+            bad_crcs++;
+        }
+        if (SDL_memcmp(type, "IDAT", 4) == 0) {
+            Uint8 *data = (Uint8 *)SDL_realloc(idat, idat_size + length + 1);
+            if (data) {
+                idat = data;
+                SDL_memcpy(idat + idat_size, type + 4, length);
+                idat_size += length;
+            }
+        } else if (SDL_memcmp(type, "IEND", 4) == 0) {
+            has_iend = true;
+        }
+        pos += 12 + length;
+        chunks++;
+    }
+    SDLTest_AssertCheck(has_iend && pos == size, "Verify PNG chunks cover the whole file at level %d", level);
+    SDLTest_AssertCheck(bad_crcs == 0, "Verify the CRCs of %d PNG chunks at level %d, %d are wrong", chunks, level, bad_crcs);
+
+    SDLTest_AssertCheck(idat != NULL && idat_size >= 6, "Verify PNG image data was collected at level %d", level);
+    if (idat && idat_size >= 6) {
+        const Uint32 expected = computePNGAdler32(surface, level);
+        const Uint32 actual = readPNGUint32(idat + idat_size - 4);
+
+        SDLTest_AssertCheck((idat[0] & 0x0f) == 8 && ((idat[0] << 8) | idat[1]) % 31 == 0, "Verify PNG zlib header at level %d, got %02x %02x", level, idat[0], idat[1]);
+        SDLTest_AssertCheck(actual == expected, "Verify PNG Adler-32 at level %d, expected %08" SDL_PRIx32 ", got %08" SDL_PRIx32, level, expected, actual);
+    }
+    SDL_free(idat);
+}
+
+/* Saves the surface at the given level, checks the file's checksums and that it loads back with the same pixels */
+static void saveLoadPNGAtLevel(SDL_Surface *surface, int level)
+{
+    const int bpp = SDL_BYTESPERPIXEL(surface->format);
+    SDL_IOStream *io;
+    SDL_Surface *loaded;
+    bool result;
+    int mismatches = 0;
+    int y;
+
+    SDL_SetNumberProperty(SDL_GetSurfaceProperties(surface), SDL_PROP_SURFACE_PNG_COMPRESSION_LEVEL_NUMBER, level);
+
+    io = SDL_IOFromDynamicMem();
+    SDLTest_AssertCheck(io != NULL, "Verify SDL_IOFromDynamicMem() succeeded");
+    if (!io) {
+        return;
+    }
+    result = SDL_SavePNG_IO(surface, io, false);
+    SDLTest_AssertCheck(result, "Verify SDL_SavePNG_IO() succeeded at level %d", level);
+    if (result) {
+        const Uint8 *png = (const Uint8 *)SDL_GetPointerProperty(SDL_GetIOProperties(io), SDL_PROP_IOSTREAM_DYNAMIC_MEMORY_POINTER, NULL);
+        verifyPNGChecksums(png, (size_t)SDL_GetIOSize(io), surface, level);
+    }
+
+    SDL_SeekIO(io, 0, SDL_IO_SEEK_SET);
+    loaded = SDL_LoadPNG_IO(io, true);
+    SDLTest_AssertCheck(loaded != NULL, "Verify SDL_LoadPNG_IO() succeeded at level %d", level);
+    if (!loaded) {
+        return;
+    }
+
+    SDLTest_AssertCheck(loaded->w == surface->w && loaded->h == surface->h && loaded->format == surface->format,
+                        "Verify PNG size and format, expected %dx%d %s, got %dx%d %s", surface->w, surface->h, SDL_GetPixelFormatName(surface->format),
+                        loaded->w, loaded->h, SDL_GetPixelFormatName(loaded->format));
+    if (loaded->w == surface->w && loaded->h == surface->h && loaded->format == surface->format) {
+        for (y = 0; y < surface->h; y++) {
+            if (SDL_memcmp((Uint8 *)surface->pixels + y * surface->pitch, (Uint8 *)loaded->pixels + y * loaded->pitch, surface->w * bpp) != 0) {
+                mismatches++;
+            }
+        }
+    }
+    SDLTest_AssertCheck(mismatches == 0, "Verify PNG contents at level %d, %d rows differ", level, mismatches);
+    if (SDL_ISPIXELFORMAT_INDEXED(surface->format)) {
+        const SDL_Palette *expected = SDL_GetSurfacePalette(surface);
+        const SDL_Palette *actual = SDL_GetSurfacePalette(loaded);
+        SDLTest_AssertCheck(expected != NULL && actual != NULL &&
+                            actual->ncolors >= expected->ncolors &&
+                            SDL_memcmp(actual->colors, expected->colors, expected->ncolors * sizeof(SDL_Color)) == 0,
+                            "Verify PNG palette at level %d", level);
+    }
+    SDL_DestroySurface(loaded);
+}
+
+/**
+ * Call to SDL_SavePNG_IO and SDL_LoadPNG_IO with each compression level, on an image large enough to be split into several strips
+ *
+ * \sa SDL_SavePNG_IO
+ * \sa SDL_LoadPNG_IO
+ */
+static int SDLCALL pixels_saveLoadPNGCompression(void *arg)
+{
+    const int levels[] = { 0, 1, 2, 6, 9 };
+    const int w = 513, h = 300;
+    SDL_Surface *surface;
+    SDL_Palette *palette;
+    int i, x, y;
+
+    surface = SDL_CreateSurface(w, h, SDL_PIXELFORMAT_RGBA32);
+    SDLTest_AssertCheck(surface != NULL, "Verify surface is not NULL");
+    if (!surface) {
+        return TEST_ABORTED;
+    }
+
+    /* Fill with runs of flat color and some noise */
+    for (y = 0; y < h; y++) {
+        Uint32 *row = (Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch);
+        for (x = 0; x < w; x++) {
+            row[x] = ((x / 16) * 0x01020304) ^ ((y / 8) * 0x04030201);
+            if ((x * y) % 37 == 0) {
+                row[x] ^= (Uint32)SDLTest_RandomUint32();
+            }
+        }
+    }
+
+    for (i = 0; i < SDL_arraysize(levels); i++) {
+        saveLoadPNGAtLevel(surface, levels[i]);
+    }
+    SDL_DestroySurface(surface);
+
+    /* Indexed images are run-length encoded without the Sub filter */
+    surface = SDL_CreateSurface(w, h, SDL_PIXELFORMAT_INDEX8);
+    SDLTest_AssertCheck(surface != NULL, "Verify surface is not NULL");
+    if (!surface) {
+        return TEST_ABORTED;
+    }
+    palette = SDL_CreateSurfacePalette(surface);
+    SDLTest_AssertCheck(palette != NULL, "Verify SDL_CreateSurfacePalette() succeeded");
+    if (palette) {
+        for (i = 0; i < palette->ncolors; i++) {
+            palette->colors[i].r = (Uint8)SDLTest_RandomUint8();
+            palette->colors[i].g = (Uint8)SDLTest_RandomUint8();
+            palette->colors[i].b = (Uint8)SDLTest_RandomUint8();
+            palette->colors[i].a = (Uint8)((i % 4) ? 0xff : i);
+        }
+    }
+    for (y = 0; y < h; y++) {
+        Uint8 *row = (Uint8 *)surface->pixels + y * surface->pitch;
+        for (x = 0; x < w; x++) {
+            row[x] = (Uint8)((x / 24) + (y / 10) * 7);
+            if ((x * y) % 41 == 0) {
+                row[x] = SDLTest_RandomUint8();
+            }
+        }
+    }
+    saveLoadPNGAtLevel(surface, 1);
+    SDL_DestroySurface(surface);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Pixels test cases */
@@ -1220,6 +1439,10 @@ static const SDLTest_TestCaseReference pixelsTestSaveLoadPNG = {
     pixels_saveLoadPNG, "pixels_saveLoadPNG", "Call to SDL_SavePNG and SDL_LoadPNG", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference pixelsTestSaveLoadPNGCompression = {
+    pixels_saveLoadPNGCompression, "pixels_saveLoadPNGCompression", "Call to SDL_SavePNG_IO and SDL_LoadPNG_IO with each compression level", TEST_ENABLED
+};
+
 /* Sequence of Pixels test cases */
 static const SDLTest_TestCaseReference *pixelsTests[] = {
     &pixelsTestGetPixelFormatName,
@@ -1227,6 +1450,7 @@ static const SDLTest_TestCaseReference *pixelsTests[] = {
     &pixelsTestAllocFreePalette,
     &pixelsTestSaveLoadBMP,
     &pixelsTestSaveLoadPNG,
+    &pixelsTestSaveLoadPNGCompression,
     NULL
 };
 
@@ -1331,6 +1331,130 @@ static int SDLCALL render_testRGBSurfaceNoAlpha(void* arg)
     return TEST_COMPLETED;
 }
 
+static void drawReorderScene(SDL_Renderer *target, SDL_Texture **textures)
+{
+    const SDL_FColor white = { 1.0f, 1.0f, 1.0f, 1.0f };
+    const int indices[] = { 0, 1, 2, 0, 2, 3 };
+    int i;
+
+    CHECK_FUNC(SDL_SetRenderDrawColor, (target, 0x20, 0x20, 0x20, SDL_ALPHA_OPAQUE))
+    CHECK_FUNC(SDL_RenderClear, (target))
+
+    /* Separate cells, which can be batched by texture */
+    for (i = 0; i < 16; ++i) {
+        SDL_FRect rect;
+        rect.x = (float)((i % 4) * 16);
+        rect.y = (float)((i / 4) * 16);
+        rect.w = 12.0f;
+        rect.h = 12.0f;
+        CHECK_FUNC(SDL_RenderTexture, (target, textures[i % 2], NULL, &rect))
+    }
+
+    /* Overlapping blended geometry, which has to stay in order */
+    for (i = 0; i < 8; ++i) {
+        SDL_Vertex verts[4];
+        const float x = (float)(i * 6);
+        const float y = (float)(i * 4);
+        SDL_zeroa(verts);
+        verts[0].position.x = x;
+        verts[0].position.y = y;
+        verts[1].position.x = x + 20.0f;
+        verts[1].position.y = y;
+        verts[1].tex_coord.x = 1.0f;
+        verts[2].position.x = x + 20.0f;
+        verts[2].position.y = y + 20.0f;
+        verts[2].tex_coord.x = 1.0f;
+        verts[2].tex_coord.y = 1.0f;
+        verts[3].position.x = x;
+        verts[3].position.y = y + 20.0f;
+        verts[3].tex_coord.y = 1.0f;
+        verts[0].color = verts[1].color = verts[2].color = verts[3].color = white;
+        CHECK_FUNC(SDL_RenderGeometry, (target, textures[i % 2], verts, SDL_arraysize(verts), indices, SDL_arraysize(indices)))
+    }
+}
+
+/**
+ * Draws interleaved sprites from two textures with a software renderer, with
+ * and without command reordering, and checks that the results match.
+ */
+static int SDLCALL render_testReorderCommands(void *arg)
+{
+    SDL_Surface *surfaces[2] = { NULL, NULL };
+    SDL_Renderer *renderers[2] = { NULL, NULL };
+    SDL_Texture *textures[2][2] = { { NULL, NULL }, { NULL, NULL } };
+    SDL_Texture *targets[2] = { NULL, NULL };
+    const Uint32 colors[2] = { 0x80FF0000, 0xC00000FF };
+    Sint64 queued, submitted;
+    int i, j, ret;
+
+    for (i = 0; i < 2; ++i) {
+        SDL_PropertiesID props;
+
+        surfaces[i] = SDL_CreateSurface(64, 64, RENDER_COMPARE_FORMAT);
+        SDLTest_AssertCheck(surfaces[i] != NULL, "Check SDL_CreateSurface result");
+        if (!surfaces[i]) {
+            goto done;
+        }
+
+        props = SDL_CreateProperties();
+        SDL_SetPointerProperty(props, SDL_PROP_RENDERER_CREATE_SURFACE_POINTER, surfaces[i]);
+        SDL_SetBooleanProperty(props, SDL_PROP_RENDERER_CREATE_REORDER_COMMANDS_BOOLEAN, (i == 1));
+        renderers[i] = SDL_CreateRendererWithProperties(props);
+        SDL_DestroyProperties(props);
+        SDLTest_AssertCheck(renderers[i] != NULL, "Check SDL_CreateRendererWithProperties result: %s", renderers[i] != NULL ? "success" : SDL_GetError());
+        if (!renderers[i]) {
+            goto done;
+        }
+
+        for (j = 0; j < 2; ++j) {
+            SDL_Surface *pixels = SDL_CreateSurface(4, 4, RENDER_COMPARE_FORMAT);
+            if (!pixels) {
+                goto done;
+            }
+            SDL_FillSurfaceRect(pixels, NULL, colors[j]);
+            textures[i][j] = SDL_CreateTextureFromSurface(renderers[i], pixels);
+            SDL_DestroySurface(pixels);
+            SDLTest_AssertCheck(textures[i][j] != NULL, "Check SDL_CreateTextureFromSurface result");
+            if (!textures[i][j]) {
+                goto done;
+            }
+            SDL_SetTextureBlendMode(textures[i][j], SDL_BLENDMODE_BLEND);
+        }
+
+        drawReorderScene(renderers[i], textures[i]);
+
+        /* Switching targets mid-frame shouldn't reset the draw call counts */
+        targets[i] = SDL_CreateTexture(renderers[i], SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, 4, 4);
+        SDLTest_AssertCheck(targets[i] != NULL, "Check SDL_CreateTexture result");
+        if (!targets[i]) {
+            goto done;
+        }
+        CHECK_FUNC(SDL_SetRenderTarget, (renderers[i], targets[i]))
+        CHECK_FUNC(SDL_RenderClear, (renderers[i]))
+        CHECK_FUNC(SDL_SetRenderTarget, (renderers[i], NULL))
+
+        CHECK_FUNC(SDL_RenderPresent, (renderers[i]))
+    }
+
+    ret = SDLTest_CompareSurfaces(surfaces[1], surfaces[0], 0);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDLTest_CompareSurfaces, expected: 0, got: %i", ret);
+
+    queued = SDL_GetNumberProperty(SDL_GetRendererProperties(renderers[1]), SDL_PROP_RENDERER_QUEUED_DRAW_CALLS_NUMBER, 0);
+    submitted = SDL_GetNumberProperty(SDL_GetRendererProperties(renderers[1]), SDL_PROP_RENDERER_SUBMITTED_DRAW_CALLS_NUMBER, 0);
+    SDLTest_AssertCheck(submitted > 0 && submitted < queued, "Check draw calls were batched, queued: %" SDL_PRIs64 ", submitted: %" SDL_PRIs64, queued, submitted);
+
+done:
+    for (i = 0; i < 2; ++i) {
+        for (j = 0; j < 2; ++j) {
+            SDL_DestroyTexture(textures[i][j]);
+        }
+        SDL_DestroyTexture(targets[i]);
+        SDL_DestroyRenderer(renderers[i]);
+        SDL_DestroySurface(surfaces[i]);
+    }
+    return TEST_COMPLETED;
+}
+
 /**
  * Test clip rect
  */
@@ -2318,6 +2442,86 @@ static int SDLCALL render_testColorspaceSRGB(void *arg)
     return TEST_COMPLETED;
 }
 
+static Uint32 getVertexRingColor(int x, int y)
+{
+    return 0xFF000000 | ((Uint32)(x * 3) << 16) | ((Uint32)(y * 4) << 8) | (Uint32)((x + y) & 0xFF);
+}
+
+static void drawVertexRingPixels(int y, int h)
+{
+    SDL_FRect rect;
+    int x;
+
+    rect.w = 1.0f;
+    rect.h = 1.0f;
+    for (; h > 0; --h, ++y) {
+        for (x = 0; x < TESTRENDER_SCREEN_W; x++) {
+            const Uint32 color = getVertexRingColor(x, y);
+            rect.x = (float)x;
+            rect.y = (float)y;
+            SDL_SetRenderDrawColor(renderer, (Uint8)(color >> 16), (Uint8)(color >> 8), (Uint8)color, SDL_ALPHA_OPAQUE);
+            SDL_RenderFillRect(renderer, &rect);
+        }
+    }
+}
+
+/**
+ * Tests that the GPU renderer's vertex ring wraps around and grows within a frame
+ *
+ * \sa SDL_FlushRenderer
+ * \sa SDL_RenderReadPixels
+ */
+static int SDLCALL render_testGPUVertexRing(void *arg)
+{
+    SDL_Surface *referenceSurface;
+    Sint64 vertex_bytes;
+    int x, y;
+
+    SDL_DestroyRenderer(renderer);
+    renderer = SDL_CreateRenderer(window, "gpu");
+    if (!renderer) {
+        SDLTest_Log("Skipping test render_testGPUVertexRing, couldn't create a GPU renderer: %s", SDL_GetError());
+        return TEST_SKIPPED;
+    }
+
+    referenceSurface = SDL_CreateSurface(TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, RENDER_COMPARE_FORMAT);
+    SDLTest_AssertCheck(referenceSurface != NULL, "Check SDL_CreateSurface result");
+    if (!referenceSurface) {
+        return TEST_ABORTED;
+    }
+    for (y = 0; y < TESTRENDER_SCREEN_H; y++) {
+        for (x = 0; x < TESTRENDER_SCREEN_W; x++) {
+            Uint32 *pixel = (Uint32 *)((Uint8 *)referenceSurface->pixels + y * referenceSurface->pitch) + x;
+            *pixel = getVertexRingColor(x, y);
+        }
+    }
+
+    /* Flush every row on its own, so the command queues fill the ring several times over and it wraps around */
+    clearScreen();
+    for (y = 0; y < TESTRENDER_SCREEN_H; y++) {
+        drawVertexRingPixels(y, 1);
+        CHECK_FUNC(SDL_FlushRenderer, (renderer))
+    }
+    compare(referenceSurface, ALLOWABLE_ERROR_OPAQUE);
+    CHECK_FUNC(SDL_RenderPresent, (renderer))
+
+    /* Queue every pixel at once, so a single command queue is larger than the ring and it has to grow */
+    clearScreen();
+    drawVertexRingPixels(0, TESTRENDER_SCREEN_H);
+    compare(referenceSurface, ALLOWABLE_ERROR_OPAQUE);
+    CHECK_FUNC(SDL_RenderPresent, (renderer))
+
+    /* One rect per pixel at the very least needs a vertex for each of its corners */
+    vertex_bytes = SDL_GetNumberProperty(SDL_GetRendererProperties(renderer), SDL_PROP_RENDERER_GPU_VERTEX_BYTES_NUMBER, 0);
+    SDLTest_AssertCheck(vertex_bytes >= TESTRENDER_SCREEN_W * TESTRENDER_SCREEN_H * 4 * 2 * (Sint64)sizeof(float),
+                        "Check SDL_PROP_RENDERER_GPU_VERTEX_BYTES_NUMBER, expected at least %d, got %" SDL_PRIs64,
+                        TESTRENDER_SCREEN_W * TESTRENDER_SCREEN_H * 4 * 2 * (int)sizeof(float), vertex_bytes);
+
+    SDL_DestroySurface(referenceSurface);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Render test cases */
@@ -2389,6 +2593,10 @@ static const SDLTest_TestCaseReference renderTestRGBSurfaceNoAlpha = {
     render_testRGBSurfaceNoAlpha, "render_testRGBSurfaceNoAlpha", "Tests RGB surface with no alpha using software renderer", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference renderTestReorderCommands = {
+    render_testReorderCommands, "render_testReorderCommands", "Tests that reordering render commands doesn't change the result", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference renderTestColorspaceLinear = {
     render_testColorspaceLinear, "render_testColorspaceLinear", "Tests colorspace support (sRGB -> linear)", TEST_ENABLED
 };
@@ -2398,6 +2606,10 @@ static const SDLTest_TestCaseReference renderTestColorspaceSRGB = {
 };
 
 /* Sequence of Render test cases */
+static const SDLTest_TestCaseReference renderTestGPUVertexRing = {
+    render_testGPUVertexRing, "render_testGPUVertexRing", "Tests that the GPU renderer's vertex ring wraps around and grows", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference *renderTests[] = {
     &renderTestGetNumRenderDrivers,
     &renderTestPrimitives,
@@ -2416,8 +2628,10 @@ static const SDLTest_TestCaseReference *renderTests[] = {
     &renderTestTextureState,
     &renderTestGetSetTextureScaleMode,
     &renderTestRGBSurfaceNoAlpha,
+    &renderTestReorderCommands,
     &renderTestColorspaceLinear,
     &renderTestColorspaceSRGB,
+    &renderTestGPUVertexRing,
     NULL
 };
 
@@ -1481,6 +1481,110 @@ static int SDLCALL stdlib_strtod(void *arg)
     return TEST_COMPLETED;
 }
 
+/* Counts characters one at a time, the way SDL_utf8strlen() and SDL_utf8strnlen() are specified */
+static size_t ReferenceUTF8Length(const char *str, size_t bytes)
+{
+    size_t result = 0;
+    while (SDL_StepUTF8(&str, &bytes)) {
+        ++result;
+    }
+    return result;
+}
+
+static int SDLCALL stdlib_utf8strlen(void *arg)
+{
+    static const char *pieces[] = { "a", "Z", "~", "\xc3\xa9", "\xe2\x82\xac", "\xf0\x9f\x98\x80", "\x80", "\xc3", "\xe2\x82", "\xed\xa0\x80", "\xff" };
+    char buffer[512];
+    size_t len, expected, actual;
+    int i, failures = 0;
+
+    SDLTest_AssertCheck(SDL_utf8strlen("") == 0, "Check SDL_utf8strlen(\"\")");
+    SDLTest_AssertCheck(SDL_utf8strlen("h\xc3\xa9llo") == 5, "Check SDL_utf8strlen(\"h\\xc3\\xa9llo\")");
+    SDLTest_AssertCheck(SDL_utf8strnlen("h\xc3\xa9llo", 2) == 2, "Check SDL_utf8strnlen(\"h\\xc3\\xa9llo\", 2)");
+
+    /* Long ASCII runs with valid and broken sequences mixed in, at every alignment */
+    for (i = 0; i < 2000; ++i) {
+        const int ascii_odds = SDLTest_RandomIntegerInRange(0, 100);
+        const size_t offset = (size_t)SDLTest_RandomIntegerInRange(0, 31);
+
+        len = offset;
+        while (len < sizeof(buffer) - 8 && SDLTest_RandomIntegerInRange(0, 200) != 0) {
+            const char *piece = pieces[SDLTest_RandomIntegerInRange(0, 100) < ascii_odds ? 0 : SDLTest_RandomIntegerInRange(0, SDL_arraysize(pieces) - 1)];
+            SDL_memcpy(&buffer[len], piece, SDL_strlen(piece));
+            len += SDL_strlen(piece);
+        }
+        buffer[len] = '\0';
+
+        expected = ReferenceUTF8Length(&buffer[offset], len - offset + 1);
+        actual = SDL_utf8strlen(&buffer[offset]);
+        if (actual != expected) {
+            SDLTest_AssertCheck(false, "Check SDL_utf8strlen(), expected %d, got %d", (int)expected, (int)actual);
+            ++failures;
+        }
+
+        len = (size_t)SDLTest_RandomIntegerInRange(0, (int)(len - offset));
+        expected = ReferenceUTF8Length(&buffer[offset], len);
+        actual = SDL_utf8strnlen(&buffer[offset], len);
+        if (actual != expected) {
+            SDLTest_AssertCheck(false, "Check SDL_utf8strnlen(%d), expected %d, got %d", (int)len, (int)expected, (int)actual);
+            ++failures;
+        }
+    }
+    SDLTest_AssertCheck(failures == 0, "Check random strings match the reference, %d failures", failures);
+
+    return TEST_COMPLETED;
+}
+
+static int SDLCALL stdlib_strcasecmp(void *arg)
+{
+    char str1[64], str2[64];
+    int i, failures = 0;
+
+    SDLTest_AssertCheck(SDL_strcasecmp("Hello", "hELLO") == 0, "Check SDL_strcasecmp(\"Hello\", \"hELLO\")");
+    SDLTest_AssertCheck(SDL_strcasecmp("abc", "ABD") < 0, "Check SDL_strcasecmp(\"abc\", \"ABD\")");
+    SDLTest_AssertCheck(SDL_strcasecmp("abc", "AB") > 0, "Check SDL_strcasecmp(\"abc\", \"AB\")");
+    SDLTest_AssertCheck(SDL_strcasecmp("[", "a") < 0, "Check SDL_strcasecmp(\"[\", \"a\") folds to lowercase");
+    SDLTest_AssertCheck(SDL_strcasecmp("Caf\xc3\x89 au lait", "CAF\xc3\xa9 AU LAIT") == 0, "Check SDL_strcasecmp() folds after ASCII");
+    SDLTest_AssertCheck(SDL_strcasecmp("stra\xc3\x9f" "e", "STRASSE") == 0, "Check SDL_strcasecmp() with a character that folds to two");
+    SDLTest_AssertCheck(SDL_strncasecmp("Caf\xc3\x89!", "caf\xc3\xa9?", 5) == 0, "Check SDL_strncasecmp() stops after maxlen bytes");
+    SDLTest_AssertCheck(SDL_strncasecmp("abcd", "ABCE", 3) == 0, "Check SDL_strncasecmp(\"abcd\", \"ABCE\", 3)");
+    SDLTest_AssertCheck(SDL_strncasecmp("abcd", "ABCE", 4) < 0, "Check SDL_strncasecmp(\"abcd\", \"ABCE\", 4)");
+
+    /* Random ASCII strings against a simple case-insensitive comparison */
+    for (i = 0; i < 10000; ++i) {
+        const int len1 = SDLTest_RandomIntegerInRange(0, sizeof(str1) - 1);
+        const int len2 = SDLTest_RandomIntegerInRange(0, sizeof(str2) - 1);
+        int j, expected = 0, actual;
+
+        for (j = 0; j < len1; ++j) {
+            str1[j] = (char)SDLTest_RandomIntegerInRange('@', 'c');
+        }
+        str1[len1] = '\0';
+        for (j = 0; j < len2; ++j) {
+            str2[j] = (j < len1 && SDLTest_RandomIntegerInRange(0, 7) != 0) ? (char)(str1[j] ^ 0x20) : (char)SDLTest_RandomIntegerInRange('@', 'c');
+        }
+        str2[len2] = '\0';
+
+        for (j = 0;; ++j) {
+            const int a = SDL_tolower((unsigned char)str1[j]);
+            const int b = SDL_tolower((unsigned char)str2[j]);
+            if (a != b || a == 0) {
+                expected = (a < b) ? -1 : (a > b) ? 1 : 0;
+                break;
+            }
+        }
+
+        actual = SDL_strcasecmp(str1, str2);
+        if ((actual < 0 ? -1 : actual > 0 ? 1 : 0) != expected) {
+            SDLTest_AssertCheck(false, "Check SDL_strcasecmp(\"%s\", \"%s\"), expected %d, got %d", str1, str2, expected, actual);
+            ++failures;
+        }
+    }
+    SDLTest_AssertCheck(failures == 0, "Check random strings match the reference, %d failures", failures);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Standard C routine test cases */
@@ -1540,6 +1644,14 @@ static const SDLTest_TestCaseReference stdlibTest_strtod = {
     stdlib_strtod, "stdlib_strtod", "Calls to SDL_strtod", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference stdlibTest_utf8strlen = {
+    stdlib_utf8strlen, "stdlib_utf8strlen", "Calls to SDL_utf8strlen and SDL_utf8strnlen", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference stdlibTest_strcasecmp = {
+    stdlib_strcasecmp, "stdlib_strcasecmp", "Calls to SDL_strcasecmp and SDL_strncasecmp", TEST_ENABLED
+};
+
 /* Sequence of Standard C routine test cases */
 static const SDLTest_TestCaseReference *stdlibTests[] = {
     &stdlibTest_strnlen,
@@ -1556,6 +1668,8 @@ static const SDLTest_TestCaseReference *stdlibTests[] = {
     &stdlibTest_wcstox,
     &stdlibTest_strtox,
     &stdlibTest_strtod,
+    &stdlibTest_utf8strlen,
+    &stdlibTest_strcasecmp,
     NULL
 };
 
@@ -1879,6 +1879,169 @@ static int SDLCALL surface_testPalettization(void *arg)
     return TEST_COMPLETED;
 }
 
+static int SDLCALL surface_testPaletteMapLookup(void *arg)
+{
+    const SDL_PixelFormatDetails *details = SDL_GetPixelFormatDetails(SDL_PIXELFORMAT_INDEX8);
+    SDL_Color colors[256];
+    SDL_Surface *source, *output;
+    SDL_Palette *palette;
+    int x, y, mismatches = 0;
+
+    /* Enough distinct colors that the blitter switches from searching the palette to its lookup cube */
+    for (x = 0; x < SDL_arraysize(colors); x++) {
+        colors[x].r = SDLTest_RandomUint8();
+        colors[x].g = SDLTest_RandomUint8();
+        colors[x].b = SDLTest_RandomUint8();
+        colors[x].a = SDL_ALPHA_OPAQUE;
+    }
+    palette = SDL_CreatePalette(SDL_arraysize(colors));
+    SDLTest_AssertCheck(palette != NULL, "SDL_CreatePalette()");
+    SDL_SetPaletteColors(palette, colors, 0, SDL_arraysize(colors));
+
+    source = SDL_CreateSurface(64, 64, SDL_PIXELFORMAT_RGBA8888);
+    SDLTest_AssertCheck(source != NULL, "SDL_CreateSurface()");
+    for (y = 0; y < source->h; y++) {
+        for (x = 0; x < source->w; x++) {
+            /* Mostly opaque colors, which use the cube, and a few rows of translucent ones, which don't */
+            const Uint8 a = (y < 48) ? SDL_ALPHA_OPAQUE : SDLTest_RandomUint8();
+            SDL_WriteSurfacePixel(source, x, y, SDLTest_RandomUint8(), SDLTest_RandomUint8(), SDLTest_RandomUint8(), a);
+        }
+    }
+
+    output = SDL_ConvertSurfaceAndColorspace(source, SDL_PIXELFORMAT_INDEX8, palette, SDL_COLORSPACE_UNKNOWN, 0);
+    SDLTest_AssertCheck(output != NULL, "SDL_ConvertSurfaceAndColorspace()");
+    if (output) {
+        for (y = 0; y < source->h; y++) {
+            for (x = 0; x < source->w; x++) {
+                Uint8 r, g, b, a;
+                Uint8 actual = ((Uint8 *)output->pixels)[y * output->pitch + x];
+                Uint32 expected;
+
+                SDL_ReadSurfacePixel(source, x, y, &r, &g, &b, &a);
+                expected = SDL_MapRGBA(details, palette, r, g, b, a);
+                if (actual != expected) {
+                    if (mismatches++ == 0) {
+                        SDLTest_LogError("Pixel %d,%d (%02x%02x%02x%02x) mapped to %u, SDL_MapRGBA() gives %" SDL_PRIu32, x, y, r, g, b, a, actual, expected);
+                    }
+                }
+            }
+        }
+    }
+    SDLTest_AssertCheck(mismatches == 0, "Expected every pixel to map like SDL_MapRGBA(), %d didn't", mismatches);
+
+    SDL_DestroyPalette(palette);
+    SDL_DestroySurface(source);
+    SDL_DestroySurface(output);
+
+    return TEST_COMPLETED;
+}
+
+/* Convert mid gray to black and white, returning how many pixels came out white */
+static int DitherGray(SDL_Surface *source, SDL_Palette *palette, const char *method)
+{
+    SDL_Surface *output;
+    int x, y, white = 0;
+
+    SDL_SetStringProperty(SDL_GetSurfaceProperties(source), SDL_PROP_SURFACE_DITHER_STRING, method);
+    output = SDL_ConvertSurfaceAndColorspace(source, SDL_PIXELFORMAT_INDEX8, palette, SDL_COLORSPACE_UNKNOWN, 0);
+    SDLTest_AssertCheck(output != NULL, "SDL_ConvertSurfaceAndColorspace() with %s dithering", method);
+    if (!output) {
+        return -1;
+    }
+    for (y = 0; y < output->h; y++) {
+        for (x = 0; x < output->w; x++) {
+            white += ((Uint8 *)output->pixels)[y * output->pitch + x];
+        }
+    }
+    SDL_DestroySurface(output);
+    return white;
+}
+
+static int SDLCALL surface_testDither(void *arg)
+{
+    const SDL_Color colors[] = { { 0x00, 0x00, 0x00, 0xff }, { 0xff, 0xff, 0xff, 0xff } };
+    const char *methods[] = { "ordered", "floyd-steinberg" };
+    SDL_Surface *source;
+    SDL_Palette *palette;
+    int i, total, white;
+
+    palette = SDL_CreatePalette(SDL_arraysize(colors));
+    SDLTest_AssertCheck(palette != NULL, "SDL_CreatePalette()");
+    SDL_SetPaletteColors(palette, colors, 0, SDL_arraysize(colors));
+
+    source = SDL_CreateSurface(32, 32, SDL_PIXELFORMAT_XRGB8888);
+    SDLTest_AssertCheck(source != NULL, "SDL_CreateSurface()");
+    SDL_FillSurfaceRect(source, NULL, SDL_MapSurfaceRGB(source, 0x80, 0x80, 0x80));
+    total = source->w * source->h;
+
+    white = DitherGray(source, palette, "none");
+    SDLTest_AssertCheck(white == total, "Expected every pixel to be white without dithering, got %d of %d", white, total);
+
+    for (i = 0; i < SDL_arraysize(methods); i++) {
+        white = DitherGray(source, palette, methods[i]);
+        SDLTest_AssertCheck(white > total * 3 / 8 && white < total * 5 / 8, "Expected about half the pixels to be white with %s dithering, got %d of %d", methods[i], white, total);
+    }
+
+    SDL_DestroyPalette(palette);
+    SDL_DestroySurface(source);
+
+    return TEST_COMPLETED;
+}
+
+static int SDLCALL surface_testDitherColorkey(void *arg)
+{
+    const SDL_Color colors[] = { { 0x00, 0x00, 0x00, 0xff }, { 0xff, 0xff, 0xff, 0xff } };
+    SDL_Surface *source, *keyed, *reference, *output;
+    SDL_Palette *palette;
+    Uint32 key;
+    int x, y, mismatches = 0;
+
+    palette = SDL_CreatePalette(SDL_arraysize(colors));
+    SDLTest_AssertCheck(palette != NULL, "SDL_CreatePalette()");
+    SDL_SetPaletteColors(palette, colors, 0, SDL_arraysize(colors));
+
+    source = SDL_CreateSurface(32, 8, SDL_PIXELFORMAT_XRGB8888);
+    SDLTest_AssertCheck(source != NULL, "SDL_CreateSurface()");
+    SDL_FillSurfaceRect(source, NULL, SDL_MapSurfaceRGB(source, 0x80, 0x80, 0x80));
+    SDL_SetStringProperty(SDL_GetSurfaceProperties(source), SDL_PROP_SURFACE_DITHER_STRING, "ordered");
+
+    reference = SDL_ConvertSurfaceAndColorspace(source, SDL_PIXELFORMAT_INDEX8, palette, SDL_COLORSPACE_UNKNOWN, 0);
+    SDLTest_AssertCheck(reference != NULL, "SDL_ConvertSurfaceAndColorspace()");
+
+    /* Keyed pixels are left alone, and must not shift the pattern of the pixels after them */
+    keyed = SDL_DuplicateSurface(source);
+    SDLTest_AssertCheck(keyed != NULL, "SDL_DuplicateSurface()");
+    key = SDL_MapSurfaceRGB(keyed, 0xff, 0x00, 0x00);
+    for (y = 0; y < keyed->h; y++) {
+        for (x = y % 3; x < keyed->w; x += 3) {
+            SDL_WriteSurfacePixel(keyed, x, y, 0xff, 0x00, 0x00, 0xff);
+        }
+    }
+    SDL_SetSurfaceColorKey(keyed, true, key);
+
+    output = SDL_DuplicateSurface(reference);
+    SDLTest_AssertCheck(output != NULL, "SDL_DuplicateSurface()");
+    SDLTest_AssertCheck(SDL_BlitSurface(keyed, NULL, output, NULL), "SDL_BlitSurface()");
+
+    for (y = 0; y < output->h; y++) {
+        for (x = 0; x < output->w; x++) {
+            const int offset = y * output->pitch + x;
+            if (((Uint8 *)output->pixels)[offset] != ((Uint8 *)reference->pixels)[offset]) {
+                mismatches++;
+            }
+        }
+    }
+    SDLTest_AssertCheck(mismatches == 0, "Expected the keyed blit to keep the dither pattern, %d pixels differ", mismatches);
+
+    SDL_DestroyPalette(palette);
+    SDL_DestroySurface(source);
+    SDL_DestroySurface(keyed);
+    SDL_DestroySurface(reference);
+    SDL_DestroySurface(output);
+
+    return TEST_COMPLETED;
+}
+
 static int SDLCALL surface_testClearSurface(void *arg)
 {
     SDL_PixelFormat formats[] = {
@@ -1989,7 +2152,7 @@ static int SDLCALL surface_testScale(void *arg)
         SDL_PIXELFORMAT_ARGB128_FLOAT, SDL_PIXELFORMAT_RGBA128_FLOAT,
     };
     SDL_ScaleMode modes[] = {
-        SDL_SCALEMODE_NEAREST, SDL_SCALEMODE_LINEAR, SDL_SCALEMODE_PIXELART
+        SDL_SCALEMODE_NEAREST, SDL_SCALEMODE_LINEAR, SDL_SCALEMODE_PIXELART, SDL_SCALEMODE_BICUBIC
     };
     SDL_Surface *surface, *result;
     SDL_PixelFormat format;
@@ -2028,7 +2191,8 @@ static int SDLCALL surface_testScale(void *arg)
                 SDL_GetPixelFormatName(format),
                 mode == SDL_SCALEMODE_NEAREST ? "nearest" :
                 mode == SDL_SCALEMODE_LINEAR ? "linear" :
-                mode == SDL_SCALEMODE_PIXELART ? "pixelart" : "unknown",
+                mode == SDL_SCALEMODE_PIXELART ? "pixelart" :
+                mode == SDL_SCALEMODE_BICUBIC ? "bicubic" : "unknown",
                 srcR, srcG, srcB, srcA, actualR, actualG, actualB, actualA);
 
             SDL_DestroySurface(surface);
@@ -2039,6 +2203,162 @@ static int SDLCALL surface_testScale(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Tests the filtered scalers on sizes that exercise both the wide kernels and their tails
+ */
+static int SDLCALL surface_testScaleFiltered(void *arg)
+{
+    const SDL_ScaleMode modes[] = { SDL_SCALEMODE_LINEAR, SDL_SCALEMODE_BICUBIC };
+    const SDL_Point sizes[] = { { 83, 17 }, { 19, 61 }, { 8, 8 }, { 2, 300 } };
+    const Uint32 color = 0x80C02040;
+    SDL_Surface *source, *solid, *result;
+    int i, j, x, y;
+
+    source = SDL_CreateSurface(37, 29, SDL_PIXELFORMAT_ARGB8888);
+    solid = SDL_CreateSurface(37, 29, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(source != NULL && solid != NULL, "SDL_CreateSurface()");
+    if (!source || !solid) {
+        goto out;
+    }
+    for (y = 0; y < source->h; ++y) {
+        Uint32 *s = (Uint32 *)((Uint8 *)source->pixels + y * source->pitch);
+        Uint32 *c = (Uint32 *)((Uint8 *)solid->pixels + y * solid->pitch);
+        for (x = 0; x < source->w; ++x) {
+            s[x] = SDLTest_RandomUint32();
+            c[x] = color;
+        }
+    }
+
+    for (i = 0; i < SDL_arraysize(modes); ++i) {
+        const char *name = modes[i] == SDL_SCALEMODE_LINEAR ? "linear" : "bicubic";
+        int mismatches = 0;
+
+        /* Stretching to the same size samples every pixel exactly */
+        result = SDL_CreateSurface(source->w, source->h, source->format);
+        SDLTest_AssertCheck(result != NULL, "SDL_CreateSurface()");
+        if (result) {
+            bool ret = SDL_StretchSurface(source, NULL, result, NULL, modes[i]);
+            SDLTest_AssertCheck(ret, "SDL_StretchSurface(%s, same size)", name);
+            for (y = 0; y < result->h; ++y) {
+                if (SDL_memcmp((Uint8 *)result->pixels + y * result->pitch, (Uint8 *)source->pixels + y * source->pitch, source->w * 4) != 0) {
+                    ++mismatches;
+                }
+            }
+            SDLTest_AssertCheck(mismatches == 0, "Checking %s scaling to the same size, %d rows differ", name, mismatches);
+            SDL_DestroySurface(result);
+        }
+
+        /* A solid color stays solid, whatever the ratio */
+        for (j = 0; j < SDL_arraysize(sizes); ++j) {
+            mismatches = 0;
+            result = SDL_ScaleSurface(solid, sizes[j].x, sizes[j].y, modes[i]);
+            SDLTest_AssertCheck(result != NULL, "SDL_ScaleSurface(%s, %dx%d)", name, sizes[j].x, sizes[j].y);
+            if (!result) {
+                continue;
+            }
+            for (y = 0; y < result->h; ++y) {
+                const Uint32 *d = (const Uint32 *)((const Uint8 *)result->pixels + y * result->pitch);
+                for (x = 0; x < result->w; ++x) {
+                    if (d[x] != color) {
+                        ++mismatches;
+                    }
+                }
+            }
+            SDLTest_AssertCheck(mismatches == 0, "Checking %s scaling of a solid color to %dx%d, %d pixels differ", name, sizes[j].x, sizes[j].y, mismatches);
+            SDL_DestroySurface(result);
+        }
+    }
+
+out:
+    SDL_DestroySurface(source);
+    SDL_DestroySurface(solid);
+    return TEST_COMPLETED;
+}
+
+static int CompareSurfacePixels(SDL_Surface *a, SDL_Surface *b)
+{
+    int y, mismatches = 0;
+
+    for (y = 0; y < a->h; ++y) {
+        if (SDL_memcmp((Uint8 *)a->pixels + y * a->pitch, (Uint8 *)b->pixels + y * b->pitch, a->w * SDL_BYTESPERPIXEL(a->format)) != 0) {
+            ++mismatches;
+        }
+    }
+    return mismatches;
+}
+
+static void RunSurfaceOperations(SDL_Surface *source, SDL_Surface **results)
+{
+    const SDL_Rect rects[] = { { 0, 0, 517, 301 }, { 13, 40, 211, 177 } };
+    const SDL_ScaleMode modes[] = { SDL_SCALEMODE_NEAREST, SDL_SCALEMODE_LINEAR, SDL_SCALEMODE_BICUBIC };
+    int i;
+
+    SDL_BlitSurface(source, NULL, results[0], NULL);
+    SDL_FillSurfaceRects(results[1], rects, SDL_arraysize(rects), 0x11223344);
+    SDL_ConvertPixels(source->w, source->h, source->format, source->pixels, source->pitch,
+                      results[2]->format, results[2]->pixels, results[2]->pitch);
+    for (i = 0; i < SDL_arraysize(modes); ++i) {
+        SDL_BlitSurfaceScaled(source, NULL, results[3 + i], NULL, modes[i]);
+    }
+}
+
+/**
+ * Tests that blits, fills, conversions and scaling give the same results when run in bands on the blit threads
+ */
+static int SDLCALL surface_testParallelBlit(void *arg)
+{
+    SDL_Surface *source, *serial[6], *parallel[6];
+    int i, x, y;
+
+    SDL_zeroa(serial);
+    SDL_zeroa(parallel);
+
+    source = SDL_CreateSurface(300, 200, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(source != NULL, "SDL_CreateSurface()");
+    if (!source) {
+        goto out;
+    }
+    for (y = 0; y < source->h; ++y) {
+        Uint32 *s = (Uint32 *)((Uint8 *)source->pixels + y * source->pitch);
+        for (x = 0; x < source->w; ++x) {
+            s[x] = SDLTest_RandomUint32();
+        }
+    }
+
+    for (i = 0; i < SDL_arraysize(serial); ++i) {
+        const SDL_PixelFormat format = (i == 0) ? SDL_PIXELFORMAT_RGB565 : SDL_PIXELFORMAT_ARGB8888;
+        const int w = (i < 3) ? source->w : 517;
+        const int h = (i < 3) ? source->h : 301;
+        serial[i] = SDL_CreateSurface(w, h, format);
+        parallel[i] = SDL_CreateSurface(w, h, format);
+        SDLTest_AssertCheck(serial[i] != NULL && parallel[i] != NULL, "SDL_CreateSurface()");
+        if (!serial[i] || !parallel[i]) {
+            goto out;
+        }
+    }
+
+    RunSurfaceOperations(source, serial);
+
+    SDL_SetHint(SDL_HINT_SURFACE_PARALLEL_BLIT, "1");
+    SDL_SetHint(SDL_HINT_SURFACE_PARALLEL_BLIT_MIN_AREA, "0");
+    RunSurfaceOperations(source, parallel);
+    SDL_ResetHint(SDL_HINT_SURFACE_PARALLEL_BLIT);
+    SDL_ResetHint(SDL_HINT_SURFACE_PARALLEL_BLIT_MIN_AREA);
+
+    for (i = 0; i < SDL_arraysize(serial); ++i) {
+        const int mismatches = CompareSurfacePixels(serial[i], parallel[i]);
+        SDLTest_AssertCheck(mismatches == 0, "Checking parallel operation %d, %d rows differ", i, mismatches);
+    }
+
+out:
+    for (i = 0; i < SDL_arraysize(serial); ++i) {
+        SDL_DestroySurface(serial[i]);
+        SDL_DestroySurface(parallel[i]);
+    }
+    SDL_DestroySurface(source);
+    return TEST_COMPLETED;
+}
+
 #define GENERATE_SHIFTS
 
 static Uint32 Calculate(int v, int bits, int vmax, int shift)
@@ -2244,6 +2564,18 @@ static const SDLTest_TestCaseReference surfaceTestPalettization = {
     surface_testPalettization, "surface_testPalettization", "Test surface palettization.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference surfaceTestPaletteMapLookup = {
+    surface_testPaletteMapLookup, "surface_testPaletteMapLookup", "Test that palettizing blits pick the same colors as SDL_MapRGBA().", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTestDither = {
+    surface_testDither, "surface_testDither", "Test dithering to a palette.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTestDitherColorkey = {
+    surface_testDitherColorkey, "surface_testDitherColorkey", "Test dithering to a palette with a colorkey.", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference surfaceTestClearSurface = {
     surface_testClearSurface, "surface_testClearSurface", "Test clear surface operations.", TEST_ENABLED
 };
@@ -2256,6 +2588,14 @@ static const SDLTest_TestCaseReference surfaceTestScale = {
     surface_testScale, "surface_testScale", "Test scaling operations.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference surfaceTestScaleFiltered = {
+    surface_testScaleFiltered, "surface_testScaleFiltered", "Test linear and bicubic scaling.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTestParallelBlit = {
+    surface_testParallelBlit, "surface_testParallelBlit", "Test blitting in parallel bands.", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference surfaceTest16BitTo32Bit = {
     surface_test16BitTo32Bit, "surface_test16BitTo32Bit", "Test conversion from 16-bit to 32-bit pixels.", TEST_ENABLED
 };
@@ -2290,9 +2630,14 @@ static const SDLTest_TestCaseReference *surfaceTests[] = {
     &surfaceTestFlip,
     &surfaceTestPalette,
     &surfaceTestPalettization,
+    &surfaceTestPaletteMapLookup,
+    &surfaceTestDither,
+    &surfaceTestDitherColorkey,
     &surfaceTestClearSurface,
     &surfaceTestPremultiplyAlpha,
     &surfaceTestScale,
+    &surfaceTestScaleFiltered,
+    &surfaceTestParallelBlit,
     &surfaceTest16BitTo32Bit,
     NULL
 };
@@ -174,6 +174,217 @@ static int SDLCALL timer_addRemoveTimer(void *arg)
 #endif
 }
 
+#ifndef SDL_PLATFORM_EMSCRIPTEN
+
+/* Records when the timer was called, in the Uint64 that param points to */
+static Uint64 SDLCALL timerRecordCallback(void *param, SDL_TimerID timerID, Uint64 interval)
+{
+    *(Uint64 *)param = SDL_GetTicksNS();
+    return 0;
+}
+
+/* Number of times timerBlockingCallback() has been called */
+static SDL_AtomicInt g_blockingCalls;
+
+/* Holds up the timer thread the first time it's called, so everything else falls behind */
+static Uint64 SDLCALL timerBlockingCallback(void *param, SDL_TimerID timerID, Uint64 interval)
+{
+    if (SDL_AddAtomicInt(&g_blockingCalls, 1) == 0) {
+        SDL_Delay(100);
+        *(Uint64 *)param = SDL_GetTicksNS();
+    }
+    return interval;
+}
+
+#define NUM_REARM_CALLS 3
+
+/* The interval timerRearmCallback() is called with each time, in nanoseconds */
+static const Uint64 g_rearmIntervals[NUM_REARM_CALLS] = { 100 * SDL_NS_PER_MS, 5 * SDL_NS_PER_MS, 80 * SDL_NS_PER_MS };
+static Uint64 g_rearmTicks[NUM_REARM_CALLS];
+static Uint64 g_rearmIntervalsSeen[NUM_REARM_CALLS];
+static SDL_AtomicInt g_rearmCalls;
+
+/* Returns the next interval from g_rearmIntervals each time, and stops at the end */
+static Uint64 SDLCALL timerRearmCallback(void *param, SDL_TimerID timerID, Uint64 interval)
+{
+    const int call = SDL_AddAtomicInt(&g_rearmCalls, 1);
+
+    if (call < NUM_REARM_CALLS) {
+        g_rearmTicks[call] = SDL_GetTicksNS();
+        g_rearmIntervalsSeen[call] = interval;
+    }
+    return (call + 1 < NUM_REARM_CALLS) ? g_rearmIntervals[call + 1] : 0;
+}
+
+#endif
+
+/**
+ * Call to SDL_AddTimerNS with delays longer than the first level of the timer wheel
+ */
+static int SDLCALL timer_longDelays(void *arg)
+{
+#ifdef SDL_PLATFORM_EMSCRIPTEN
+    SDLTest_Log("Timer callbacks on Emscripten require a main loop to handle events");
+    return TEST_SKIPPED;
+#else
+    /* The first level of the wheel covers about 64 ms, and the second about 4 seconds */
+    const Uint64 delays[] = { 70, 130, 260, 530 };
+    Uint64 ticks[SDL_arraysize(delays)];
+    SDL_TimerID ids[SDL_arraysize(delays)];
+    Uint64 start;
+    int i;
+
+    SDL_zeroa(ticks);
+    start = SDL_GetTicksNS();
+    for (i = 0; i < SDL_arraysize(delays); i++) {
+        ids[i] = SDL_AddTimerNS(SDL_MS_TO_NS(delays[i]), timerRecordCallback, &ticks[i]);
+        SDLTest_AssertCheck(ids[i] > 0, "Check result value, expected: >0, got: %" SDL_PRIu32, ids[i]);
+    }
+
+    SDL_Delay((Uint32)delays[SDL_arraysize(delays) - 1] + 500);
+    SDLTest_AssertPass("Call to SDL_Delay()");
+
+    for (i = 0; i < SDL_arraysize(delays); i++) {
+        const Sint64 elapsed = ticks[i] ? (Sint64)SDL_NS_TO_MS(ticks[i] - start) : -1;
+
+        /* Removing a timer that has already been called fails */
+        SDLTest_AssertCheck(!SDL_RemoveTimer(ids[i]), "Check %" SDL_PRIu64 " ms timer WAS called", delays[i]);
+        SDLTest_AssertCheck(elapsed >= (Sint64)delays[i] && elapsed < (Sint64)delays[i] + 400,
+                            "Check %" SDL_PRIu64 " ms timer was called on time, got: %" SDL_PRIs64 " ms", delays[i], elapsed);
+    }
+
+    return TEST_COMPLETED;
+#endif
+}
+
+/**
+ * Timers that come due while a callback holds up the timer thread are called as soon as it's done
+ *
+ * \sa SDL_GetTimerStatistics
+ */
+static int SDLCALL timer_catchUp(void *arg)
+{
+#ifdef SDL_PLATFORM_EMSCRIPTEN
+    SDLTest_Log("Timer callbacks on Emscripten require a main loop to handle events");
+    return TEST_SKIPPED;
+#else
+    SDL_TimerID blocking_id, late_id;
+    Uint64 unblocked = 0, late = 0;
+    Uint64 callbacks_before = 0, callbacks = 0, average_lateness = 0, max_lateness = 0;
+    bool result;
+
+    result = SDL_GetTimerStatistics(&callbacks_before, NULL, NULL);
+    SDLTest_AssertCheck(result, "Check SDL_GetTimerStatistics() result, expected: true, got: %i", result);
+
+    SDL_SetAtomicInt(&g_blockingCalls, 0);
+    blocking_id = SDL_AddTimerNS(SDL_MS_TO_NS(10), timerBlockingCallback, &unblocked);
+    late_id = SDL_AddTimerNS(SDL_MS_TO_NS(30), timerRecordCallback, &late);
+    SDLTest_AssertCheck(blocking_id > 0 && late_id > 0, "Check SDL_AddTimerNS() results, expected: >0, got: %" SDL_PRIu32 " and %" SDL_PRIu32, blocking_id, late_id);
+
+    SDL_Delay(400);
+    SDLTest_AssertPass("Call to SDL_Delay(400)");
+
+    result = SDL_RemoveTimer(blocking_id);
+    SDLTest_AssertCheck(result == true, "Check periodic timer was still running, expected: true, got: %i", result);
+    SDLTest_AssertCheck(SDL_GetAtomicInt(&g_blockingCalls) >= 3, "Check periodic timer kept going after falling behind, expected: >=3 calls, got: %d", SDL_GetAtomicInt(&g_blockingCalls));
+
+    result = SDL_RemoveTimer(late_id);
+    SDLTest_AssertCheck(result == false && late != 0, "Check late timer WAS called");
+    if (late != 0 && unblocked != 0) {
+        SDLTest_AssertCheck(late >= unblocked && late - unblocked < SDL_MS_TO_NS(50),
+                            "Check late timer was called right after the timer thread caught up, got: %" SDL_PRIs64 " ms",
+                            (Sint64)SDL_NS_TO_MS((Sint64)(late - unblocked)));
+    }
+
+    /* The late timer was due about 70 ms before it could be called */
+    result = SDL_GetTimerStatistics(&callbacks, &average_lateness, &max_lateness);
+    SDLTest_AssertCheck(result, "Check SDL_GetTimerStatistics() result, expected: true, got: %i", result);
+    SDLTest_AssertCheck(callbacks >= callbacks_before + 4, "Check callback count, expected: >=%" SDL_PRIu64 ", got: %" SDL_PRIu64, callbacks_before + 4, callbacks);
+    SDLTest_AssertCheck(max_lateness >= SDL_MS_TO_NS(50) && average_lateness <= max_lateness,
+                        "Check lateness, expected: max >=50 ms, got: average %" SDL_PRIu64 " ns, max %" SDL_PRIu64 " ns", average_lateness, max_lateness);
+
+    return TEST_COMPLETED;
+#endif
+}
+
+/**
+ * Call to SDL_RemoveTimer on a timer that is still waiting in an upper level of the timer wheel
+ */
+static int SDLCALL timer_removeLongDelay(void *arg)
+{
+#ifdef SDL_PLATFORM_EMSCRIPTEN
+    SDLTest_Log("Timer callbacks on Emscripten require a main loop to handle events");
+    return TEST_SKIPPED;
+#else
+    SDL_TimerID removed_id, kept_id;
+    Uint64 removed = 0, kept = 0;
+    bool result;
+
+    /* These are close enough to share a slot on the second level */
+    removed_id = SDL_AddTimerNS(SDL_MS_TO_NS(300), timerRecordCallback, &removed);
+    kept_id = SDL_AddTimerNS(SDL_MS_TO_NS(310), timerRecordCallback, &kept);
+    SDLTest_AssertCheck(removed_id > 0 && kept_id > 0, "Check SDL_AddTimerNS() results, expected: >0, got: %" SDL_PRIu32 " and %" SDL_PRIu32, removed_id, kept_id);
+
+    SDL_Delay(20);
+    result = SDL_RemoveTimer(removed_id);
+    SDLTest_AssertCheck(result == true, "Check SDL_RemoveTimer() result, expected: true, got: %i", result);
+
+    SDL_Delay(700);
+    SDLTest_AssertPass("Call to SDL_Delay(700)");
+
+    result = SDL_RemoveTimer(kept_id);
+    SDLTest_AssertCheck(result == false && kept != 0, "Check the other timer WAS called");
+    SDLTest_AssertCheck(removed == 0, "Check the removed timer WAS NOT called");
+
+    return TEST_COMPLETED;
+#endif
+}
+
+/**
+ * Timer callbacks that return a different interval are called again after that interval
+ */
+static int SDLCALL timer_rearmTimer(void *arg)
+{
+#ifdef SDL_PLATFORM_EMSCRIPTEN
+    SDLTest_Log("Timer callbacks on Emscripten require a main loop to handle events");
+    return TEST_SKIPPED;
+#else
+    const Uint64 deadline = SDL_GetTicks() + 2000;
+    SDL_TimerID id;
+    Uint64 start;
+    int i;
+
+    SDL_SetAtomicInt(&g_rearmCalls, 0);
+    SDL_zeroa(g_rearmTicks);
+    SDL_zeroa(g_rearmIntervalsSeen);
+
+    start = SDL_GetTicksNS();
+    id = SDL_AddTimerNS(g_rearmIntervals[0], timerRearmCallback, NULL);
+    SDLTest_AssertCheck(id > 0, "Check result value, expected: >0, got: %" SDL_PRIu32, id);
+
+    while (SDL_GetAtomicInt(&g_rearmCalls) < NUM_REARM_CALLS && SDL_GetTicks() < deadline) {
+        SDL_Delay(10);
+    }
+    /* The last call returned 0, so there shouldn't be any more */
+    SDL_Delay(200);
+    SDLTest_AssertCheck(SDL_GetAtomicInt(&g_rearmCalls) == NUM_REARM_CALLS, "Check number of calls, expected: %d, got: %d", NUM_REARM_CALLS, SDL_GetAtomicInt(&g_rearmCalls));
+
+    for (i = 0; i < NUM_REARM_CALLS; i++) {
+        SDLTest_AssertCheck(g_rearmIntervalsSeen[i] == g_rearmIntervals[i],
+                            "Check interval of call %d, expected: %" SDL_PRIu64 ", got: %" SDL_PRIu64, i + 1, g_rearmIntervals[i], g_rearmIntervalsSeen[i]);
+    }
+    SDLTest_AssertCheck(g_rearmTicks[0] >= start + g_rearmIntervals[0], "Check first call wasn't early");
+    /* The next interval is counted from when the callback started, so allow for a little time spent getting there */
+    SDLTest_AssertCheck(g_rearmTicks[2] >= g_rearmTicks[1] + g_rearmIntervals[2] - SDL_MS_TO_NS(5),
+                        "Check last call came after the interval returned before it, got: %" SDL_PRIs64 " ms",
+                        (Sint64)SDL_NS_TO_MS((Sint64)(g_rearmTicks[2] - g_rearmTicks[1])));
+
+    SDLTest_AssertCheck(SDL_RemoveTimer(id) == false, "Check timer was removed after returning 0");
+
+    return TEST_COMPLETED;
+#endif
+}
+
 /* ================= Test References ================== */
 
 /* Timer test cases */
@@ -193,9 +404,25 @@ static const SDLTest_TestCaseReference timerTest4 = {
     timer_addRemoveTimer, "timer_addRemoveTimer", "Call to SDL_AddTimer and SDL_RemoveTimer", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference timerTest5 = {
+    timer_longDelays, "timer_longDelays", "Call to SDL_AddTimerNS with delays longer than the first level of the timer wheel", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference timerTest6 = {
+    timer_catchUp, "timer_catchUp", "Timers that come due while the timer thread is held up are called as soon as it's done", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference timerTest7 = {
+    timer_removeLongDelay, "timer_removeLongDelay", "Call to SDL_RemoveTimer on a timer in an upper level of the timer wheel", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference timerTest8 = {
+    timer_rearmTimer, "timer_rearmTimer", "Timer callbacks that return a different interval", TEST_ENABLED
+};
+
 /* Sequence of Timer test cases */
 static const SDLTest_TestCaseReference *timerTests[] = {
-    &timerTest1, &timerTest2, &timerTest3, &timerTest4, NULL
+    &timerTest1, &timerTest2, &timerTest3, &timerTest4, &timerTest5, &timerTest6, &timerTest7, &timerTest8, NULL
 };
 
 /* Timer test suite (global) */
@@ -2614,6 +2614,170 @@ static int SDLCALL video_raiseWindow(void *arg)
     return TEST_COMPLETED;
 }
 
+#define OFFSCREEN_HASH_FRAMES 8
+
+/* The frames drawn by video_offscreenFrameHashes: the whole window first, then a few rectangles per frame */
+typedef struct OffscreenHashFrame
+{
+    SDL_Rect rects[2];
+    int numrects;
+    Uint32 color;
+} OffscreenHashFrame;
+
+/* Draw the frames into an offscreen window in hash mode and return what was written to the frame stream */
+static char *captureOffscreenFrameHashes(const OffscreenHashFrame *frames, bool partial, Uint8 unused)
+{
+    SDL_Window *window;
+    SDL_Surface *surface;
+    SDL_IOStream *stream;
+    char *hashes = NULL;
+    int i, j, x, y;
+
+    stream = SDL_IOFromDynamicMem();
+    SDLTest_AssertCheck(stream != NULL, "Validate that SDL_IOFromDynamicMem() returned a stream");
+    if (!stream) {
+        return NULL;
+    }
+
+    window = SDL_CreateWindow("video_offscreenFrameHashes", 64, 48, 0);
+    SDLTest_AssertCheck(window != NULL, "Validate that SDL_CreateWindow() returned a window");
+    if (window) {
+        SDL_SetPointerProperty(SDL_GetWindowProperties(window), SDL_PROP_WINDOW_OFFSCREEN_FRAME_STREAM_POINTER, stream);
+        surface = SDL_GetWindowSurface(window);
+        SDLTest_AssertCheck(surface != NULL && surface->format == SDL_PIXELFORMAT_XRGB8888, "Validate that the window has an XRGB8888 surface");
+
+        for (i = 0; surface && i < OFFSCREEN_HASH_FRAMES; ++i) {
+            const OffscreenHashFrame *frame = &frames[i];
+
+            /* Only the color channels are defined, so fill the unused byte with something different each run */
+            for (j = 0; j < frame->numrects; ++j) {
+                const SDL_Rect *rect = &frame->rects[j];
+                for (y = rect->y; y < rect->y + rect->h; ++y) {
+                    Uint32 *row = (Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch);
+                    for (x = rect->x; x < rect->x + rect->w; ++x) {
+                        row[x] = ((Uint32)unused << 24) | ((frame->color + (Uint32)(x * 3 + y * 5)) & 0x00FFFFFF);
+                    }
+                }
+            }
+
+            if (partial) {
+                SDLTest_AssertCheck(SDL_UpdateWindowSurfaceRects(window, frame->rects, frame->numrects), "Call to SDL_UpdateWindowSurfaceRects()");
+            } else {
+                SDLTest_AssertCheck(SDL_UpdateWindowSurface(window), "Call to SDL_UpdateWindowSurface()");
+            }
+        }
+
+        /* Destroying the window waits for every queued frame to be hashed */
+        SDL_DestroyWindow(window);
+    }
+
+    if (SDL_WriteU8(stream, 0)) {
+        const char *text = (const char *)SDL_GetPointerProperty(SDL_GetIOProperties(stream), SDL_PROP_IOSTREAM_DYNAMIC_MEMORY_POINTER, NULL);
+        hashes = text ? SDL_strdup(text) : NULL;
+    }
+    SDL_CloseIO(stream);
+    return hashes;
+}
+
+/**
+ * Tests that the offscreen driver's "hash" frame capture gives the same hashes
+ * whether the window is updated in full or a few rectangles at a time.
+ *
+ * \sa SDL_UpdateWindowSurfaceRects
+ */
+static int SDLCALL video_offscreenFrameHashes(void *arg)
+{
+    OffscreenHashFrame frames[OFFSCREEN_HASH_FRAMES];
+    char *partial_hashes = NULL;
+    char *full_hashes = NULL;
+    int video_refs = 0;
+    int i, j, lines;
+
+    /* Switch to the offscreen driver, remembering how many times video was initialized so it can be put back */
+    if (SDL_strcmp(SDL_GetCurrentVideoDriver(), "offscreen") != 0) {
+        while (SDL_WasInit(SDL_INIT_VIDEO)) {
+            SDL_QuitSubSystem(SDL_INIT_VIDEO);
+            ++video_refs;
+        }
+        SDL_SetHintWithPriority(SDL_HINT_VIDEO_DRIVER, "offscreen", SDL_HINT_OVERRIDE);
+        if (!SDL_InitSubSystem(SDL_INIT_VIDEO)) {
+            SDLTest_Log("The offscreen video driver isn't available, skipping");
+            SDL_ResetHint(SDL_HINT_VIDEO_DRIVER);
+            for (i = 0; i < video_refs; ++i) {
+                SDL_InitSubSystem(SDL_INIT_VIDEO);
+            }
+            return TEST_SKIPPED;
+        }
+    }
+    SDL_SetHint(SDL_HINT_VIDEO_OFFSCREEN_SAVE_FRAMES, "hash");
+    /* Use the driver's own XRGB8888 framebuffer rather than a renderer-backed one */
+    SDL_SetHint(SDL_HINT_FRAMEBUFFER_ACCELERATION, "0");
+
+    /* The first frame covers the whole window, so both runs start from the same pixels */
+    for (i = 0; i < OFFSCREEN_HASH_FRAMES; ++i) {
+        frames[i].color = (Uint32)SDLTest_RandomUint32();
+        if (i == 0) {
+            frames[i].numrects = 1;
+            frames[i].rects[0].x = 0;
+            frames[i].rects[0].y = 0;
+            frames[i].rects[0].w = 64;
+            frames[i].rects[0].h = 48;
+            continue;
+        }
+        frames[i].numrects = SDLTest_RandomIntegerInRange(1, 2);
+        for (j = 0; j < frames[i].numrects; ++j) {
+            SDL_Rect *rect = &frames[i].rects[j];
+            rect->x = SDLTest_RandomIntegerInRange(0, 56);
+            rect->y = SDLTest_RandomIntegerInRange(0, 40);
+            rect->w = SDLTest_RandomIntegerInRange(1, 64 - rect->x);
+            rect->h = SDLTest_RandomIntegerInRange(1, 48 - rect->y);
+        }
+    }
+
+    partial_hashes = captureOffscreenFrameHashes(frames, true, 0xFF);
+    full_hashes = captureOffscreenFrameHashes(frames, false, 0x00);
+    SDLTest_AssertCheck(partial_hashes != NULL && full_hashes != NULL, "Validate that both runs wrote frame hashes");
+
+    if (partial_hashes && full_hashes) {
+        /* Each line is "<frame number> <size> <hash>", and the frame numbers keep counting across windows */
+        const char *partial_line = partial_hashes;
+        const char *full_line = full_hashes;
+
+        for (lines = 0; *partial_line && *full_line; ++lines) {
+            const char *partial_end = SDL_strchr(partial_line, '\n');
+            const char *full_end = SDL_strchr(full_line, '\n');
+            const char *partial_hash = SDL_strchr(partial_line, ' ');
+            const char *full_hash = SDL_strchr(full_line, ' ');
+
+            if (!partial_end || !full_end || !partial_hash || !full_hash) {
+                break;
+            }
+            SDLTest_AssertCheck((partial_end - partial_hash) == (full_end - full_hash) &&
+                                SDL_strncmp(partial_hash, full_hash, partial_end - partial_hash) == 0,
+                                "Check frame %d hash, expected: %.*s, got: %.*s", lines + 1,
+                                (int)(full_end - full_hash) - 1, full_hash + 1, (int)(partial_end - partial_hash) - 1, partial_hash + 1);
+            partial_line = partial_end + 1;
+            full_line = full_end + 1;
+        }
+        SDLTest_AssertCheck(lines == OFFSCREEN_HASH_FRAMES, "Check number of frame hashes, expected: %d, got: %d", OFFSCREEN_HASH_FRAMES, lines);
+    }
+
+    SDL_free(partial_hashes);
+    SDL_free(full_hashes);
+    SDL_ResetHint(SDL_HINT_VIDEO_OFFSCREEN_SAVE_FRAMES);
+    SDL_ResetHint(SDL_HINT_FRAMEBUFFER_ACCELERATION);
+    if (video_refs > 0) {
+        /* Put back the video driver the rest of the tests expect */
+        SDL_QuitSubSystem(SDL_INIT_VIDEO);
+        SDL_ResetHint(SDL_HINT_VIDEO_DRIVER);
+        for (i = 0; i < video_refs; ++i) {
+            SDL_InitSubSystem(SDL_INIT_VIDEO);
+        }
+    }
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Video test cases */
@@ -2707,6 +2871,9 @@ static const SDLTest_TestCaseReference videoTestGetWindowSurface = {
 static const SDLTest_TestCaseReference videoTestRaiseWindow = {
     video_raiseWindow, "video_raiseWindow", "Checks window focus", TEST_ENABLED
 };
+static const SDLTest_TestCaseReference videoTestOffscreenFrameHashes = {
+    video_offscreenFrameHashes, "video_offscreenFrameHashes", "Checks offscreen frame hashes after partial updates", TEST_ENABLED
+};
 
 /* Sequence of Video test cases */
 static const SDLTest_TestCaseReference *videoTests[] = {
@@ -2733,6 +2900,7 @@ static const SDLTest_TestCaseReference *videoTests[] = {
     &videoTestCreateMaximized,
     &videoTestGetWindowSurface,
     &videoTestRaiseWindow,
+    &videoTestOffscreenFrameHashes,
     NULL
 };
 
@@ -0,0 +1,172 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark for SDL_crc32() and SDL_crc16(): checks each code path against a bitwise reference and reports GB/s. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+static const struct
+{
+    const char *name;
+    const char *cpu_feature_mask;
+} paths[] = {
+    { "table", "-pclmul,-arm-crc32" },
+    { "pclmul", "-arm-crc32" },
+    { "arm-crc32", "-pclmul" },
+};
+
+static Uint32 ReferenceCRC32(Uint32 crc, const Uint8 *data, size_t len)
+{
+    crc = ~crc;
+    while (len--) {
+        int i;
+        crc ^= *data++;
+        for (i = 0; i < 8; ++i) {
+            crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+static Uint16 ReferenceCRC16(Uint16 crc, const Uint8 *data, size_t len)
+{
+    while (len--) {
+        int i;
+        crc ^= *data++;
+        for (i = 0; i < 8; ++i) {
+            crc = (Uint16)((crc >> 1) ^ (0xA001 & (0 - (crc & 1))));
+        }
+    }
+    return crc;
+}
+
+/* Checks odd lengths and alignments, and that feeding the data in pieces gives the same result */
+static bool Verify(const Uint8 *data, size_t size)
+{
+    int i;
+
+    for (i = 0; i < 1000; ++i) {
+        const size_t offset = (size_t)SDL_rand(64);
+        const size_t len = (size_t)SDL_rand((Sint32)SDL_min(size - offset, 4096));
+        const size_t split = len ? (size_t)SDL_rand((Sint32)len) : 0;
+        const Uint32 crc32 = ReferenceCRC32(0, data + offset, len);
+        const Uint16 crc16 = ReferenceCRC16(0, data + offset, len);
+
+        if (SDL_crc32(0, data + offset, len) != crc32 ||
+            SDL_crc32(SDL_crc32(0, data + offset, split), data + offset + split, len - split) != crc32) {
+            SDL_Log("SDL_crc32() mismatch, offset %u, length %u", (unsigned int)offset, (unsigned int)len);
+            return false;
+        }
+        if (SDL_crc16(0, data + offset, len) != crc16 ||
+            SDL_crc16(SDL_crc16(0, data + offset, split), data + offset + split, len - split) != crc16) {
+            SDL_Log("SDL_crc16() mismatch, offset %u, length %u", (unsigned int)offset, (unsigned int)len);
+            return false;
+        }
+    }
+    return true;
+}
+
+static double Measure(bool crc32, const Uint8 *data, size_t size, int milliseconds)
+{
+    const Uint64 start = SDL_GetTicksNS();
+    const Uint64 end = start + (Uint64)milliseconds * SDL_NS_PER_MS;
+    Uint64 now, bytes = 0;
+    Uint32 crc = 0;
+
+    do {
+        if (crc32) {
+            crc = SDL_crc32(crc, data, size);
+        } else {
+            crc = SDL_crc16((Uint16)crc, data, size);
+        }
+        bytes += size;
+        now = SDL_GetTicksNS();
+    } while (now < end);
+
+    return ((double)bytes / 1e9) / ((double)(now - start) / SDL_NS_PER_SECOND);
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    Uint8 *data = NULL;
+    size_t size = 1024 * 1024;
+    int milliseconds = 500;
+    int result = 1;
+    int i;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--size") == 0 && argv[i + 1]) {
+                size = (size_t)SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--ms") == 0 && argv[i + 1]) {
+                milliseconds = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0 || size < 4096 || milliseconds <= 0) {
+            static const char *options[] = { "[--size BYTES]", "[--ms N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    data = (Uint8 *)SDL_malloc(size);
+    if (!data) {
+        goto done;
+    }
+    SDL_srand(0);
+    for (i = 0; i < (int)size; ++i) {
+        data[i] = (Uint8)SDL_rand(256);
+    }
+
+    SDL_Log("Checksumming %u byte blocks, %d ms per path", (unsigned int)size, milliseconds);
+
+    for (i = 0; i < (int)SDL_arraysize(paths); ++i) {
+        /* SDL_Quit() resets the detected CPU features, so the hint is picked up again */
+        SDL_SetHint(SDL_HINT_CPU_FEATURE_MASK, paths[i].cpu_feature_mask);
+
+        if ((SDL_strcmp(paths[i].name, "pclmul") == 0 && !SDL_HasSSE2()) ||
+            (SDL_strcmp(paths[i].name, "arm-crc32") == 0 && !SDL_HasNEON())) {
+            SDL_Quit();
+            continue;
+        }
+
+        if (!Verify(data, size)) {
+            goto done;
+        }
+        SDL_Log("%10s: crc32 %6.2f GB/s, crc16 %6.2f GB/s", paths[i].name,
+                Measure(true, data, size, milliseconds), Measure(false, data, size, milliseconds));
+        SDL_Quit();
+    }
+
+    result = 0;
+
+done:
+    SDL_free(data);
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
@@ -152,6 +152,8 @@ int main(int argc, char *argv[])
         char **globlist;
         SDL_Storage *storage = NULL;
         SDL_IOStream *stream;
+        SDL_AsyncIOQueue *queue;
+        SDL_AsyncIO *asyncio;
         const char *text = "foo\n";
         SDL_PathInfo pathinfo;
 
@@ -223,6 +225,79 @@ int main(int argc, char *argv[])
                 SDL_free(textB);
             }
 
+            queue = SDL_CreateAsyncIOQueue();
+            if (!queue) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_CreateAsyncIOQueue() failed: %s", SDL_GetError());
+            } else if (!SDL_CopyFileAsync("testfilesystem-B", "testfilesystem-C", queue, NULL)) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_CopyFileAsync('testfilesystem-B', 'testfilesystem-C') failed: %s", SDL_GetError());
+            } else {
+                SDL_AsyncIOOutcome outcome;
+                size_t sizeC;
+                char *textC;
+
+                do {
+                    if (!SDL_WaitAsyncIOResult(queue, &outcome, -1)) {
+                        outcome.type = SDL_ASYNCIO_TASK_READ;  /* nothing for us yet, keep waiting. */
+                    } else if (outcome.type == SDL_ASYNCIO_TASK_WRITE) {
+                        SDL_Log("SDL_CopyFileAsync progress: %" SDL_PRIu64 " of %" SDL_PRIu64 " bytes", outcome.bytes_transferred, outcome.bytes_requested);
+                    }
+                } while (outcome.type != SDL_ASYNCIO_TASK_CLOSE);
+
+                if (outcome.result != SDL_ASYNCIO_COMPLETE) {
+                    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_CopyFileAsync('testfilesystem-B', 'testfilesystem-C') didn't complete");
+                }
+
+                textC = (char *)SDL_LoadFile("testfilesystem-C", &sizeC);
+                if (!textC || sizeC != SDL_strlen(text) || SDL_strcmp(textC, text) != 0) {
+                    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Contents of testfilesystem-C didn't match, expected %s, got %s", text, textC);
+                }
+                SDL_free(textC);
+
+                asyncio = SDL_AsyncIOFromFile("testfilesystem-C", "r");
+                if (!asyncio) {
+                    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_AsyncIOFromFile('testfilesystem-C', 'r') failed: %s", SDL_GetError());
+                } else {
+                    SDL_AsyncIOReadRequest requests[4];
+                    char batched[4];
+                    int i, num_outcomes = 0;
+
+                    /* one byte at a time, back to back, so the backend can merge them. */
+                    for (i = 0; i < (int)SDL_arraysize(requests); i++) {
+                        requests[i].asyncio = asyncio;
+                        requests[i].ptr = &batched[i];
+                        requests[i].offset = (Uint64)i;
+                        requests[i].size = 1;
+                        requests[i].userdata = NULL;
+                    }
+
+                    if (SDL_ReadAsyncIOBatch(requests, (int)SDL_arraysize(requests), queue) != (int)SDL_arraysize(requests)) {
+                        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_ReadAsyncIOBatch() failed: %s", SDL_GetError());
+                    } else {
+                        while (num_outcomes < (int)SDL_arraysize(requests)) {
+                            if (SDL_WaitAsyncIOResult(queue, &outcome, -1)) {
+                                if (outcome.result != SDL_ASYNCIO_COMPLETE || outcome.bytes_transferred != 1) {
+                                    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_ReadAsyncIOBatch() read at offset %d failed", (int)outcome.offset);
+                                }
+                                num_outcomes++;
+                            }
+                        }
+                        if (SDL_memcmp(batched, text, sizeof(batched)) != 0) {
+                            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_ReadAsyncIOBatch() data didn't match");
+                        }
+                    }
+
+                    SDL_CloseAsyncIO(asyncio, false, queue, NULL);
+                    while (!SDL_WaitAsyncIOResult(queue, &outcome, -1)) {
+                        /* wait for the close to finish before removing the file. */
+                    }
+                }
+
+                if (!SDL_RemovePath("testfilesystem-C")) {
+                    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_RemovePath('testfilesystem-C') failed: %s", SDL_GetError());
+                }
+            }
+            SDL_DestroyAsyncIOQueue(queue);
+
             if (!SDL_RemovePath("testfilesystem-A")) {
                 SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_RemovePath('testfilesystem-A') failed: %s", SDL_GetError());
             }
@@ -19,6 +19,8 @@
 #include <SDL3/SDL_main.h>
 #include <SDL3/SDL_test.h>
 
+#include <stddef.h> /* offsetof */
+
 typedef struct {
     Uint8 major;
     Uint8 minor;
@@ -183,16 +185,39 @@ generic_compare_r(void *userdata, const void *a, const void *b)
     } while (0);
 #endif
 
-#define TEST_QSORT_ARRAY(TYPE, ARRAY, SIZE, COMPARE_CBFN, CHECK_ARRAY_ELEMS, IS_LE)          \
-    do {                                                                                     \
-        TYPE *sorted = SDL_calloc((SIZE), sizeof(TYPE));                                     \
-        SDL_assert(sorted != NULL);                                                          \
-                                                                                             \
-        TEST_QSORT_ARRAY_QSORT(TYPE, ARRAY, SIZE, COMPARE_CBFN, CHECK_ARRAY_ELEMS, IS_LE);   \
-                                                                                             \
-        TEST_QSORT_ARRAY_QSORT_R(TYPE, ARRAY, SIZE, COMPARE_CBFN, CHECK_ARRAY_ELEMS, IS_LE); \
-                                                                                             \
-        SDL_free(sorted);                                                                    \
+#ifdef TEST_STDLIB_QSORT
+#define TEST_QSORT_ARRAY_MERGESORT_R(TYPE, ARRAY, SIZE, COMPARE_CBFN, CHECK_ARRAY_ELEMS, IS_LE) \
+    do {                                                                                        \
+        SDLTest_AssertPass(STR(TYPE) "mergesort is not available in the C library");            \
+    } while (0)
+#else
+#define TEST_QSORT_ARRAY_MERGESORT_R(TYPE, ARRAY, SIZE, COMPARE_CBFN, CHECK_ARRAY_ELEMS, IS_LE)          \
+    do {                                                                                                 \
+        SDLTest_AssertPass(STR(TYPE) "Testing SDL_mergesort_r of array with size %u", (unsigned)(SIZE)); \
+        global_compare_cbfn = (COMPARE_CBFN);                                                            \
+        TEST_QSORT_ARRAY_GENERIC(TYPE, ARRAY, SIZE,                                                      \
+            SDL_mergesort_r(sorted, (SIZE), sizeof(TYPE), generic_compare_r, &a_global_var),             \
+            CHECK_ARRAY_ELEMS, IS_LE, "SDL_mergesort_r");                                                \
+        SDLTest_AssertPass(STR(TYPE) "Testing SDL_parallel_mergesort_r of array with size %u",           \
+            (unsigned)(SIZE));                                                                           \
+        TEST_QSORT_ARRAY_GENERIC(TYPE, ARRAY, SIZE,                                                      \
+            SDL_parallel_mergesort_r(sorted, (SIZE), sizeof(TYPE), generic_compare_r, &a_global_var),    \
+            CHECK_ARRAY_ELEMS, IS_LE, "SDL_parallel_mergesort_r");                                       \
+    } while (0);
+#endif
+
+#define TEST_QSORT_ARRAY(TYPE, ARRAY, SIZE, COMPARE_CBFN, CHECK_ARRAY_ELEMS, IS_LE)              \
+    do {                                                                                         \
+        TYPE *sorted = SDL_calloc((SIZE), sizeof(TYPE));                                         \
+        SDL_assert(sorted != NULL);                                                              \
+                                                                                                 \
+        TEST_QSORT_ARRAY_QSORT(TYPE, ARRAY, SIZE, COMPARE_CBFN, CHECK_ARRAY_ELEMS, IS_LE);       \
+                                                                                                 \
+        TEST_QSORT_ARRAY_QSORT_R(TYPE, ARRAY, SIZE, COMPARE_CBFN, CHECK_ARRAY_ELEMS, IS_LE);     \
+                                                                                                 \
+        TEST_QSORT_ARRAY_MERGESORT_R(TYPE, ARRAY, SIZE, COMPARE_CBFN, CHECK_ARRAY_ELEMS, IS_LE); \
+                                                                                                 \
+        SDL_free(sorted);                                                                        \
     } while (0)
 
 #define INT_ISLE(A, B) ((A) <= (B))
@@ -436,6 +461,183 @@ static int SDLCALL qsort_testRandomSorted(void *arg)
     return TEST_COMPLETED;
 }
 
+#ifndef TEST_STDLIB_QSORT
+typedef struct {
+    Sint32 i32;
+    float f;
+    Uint64 u64;
+    double d;
+    unsigned int order;
+} KeyedItem;
+
+static int SDLCALL
+compare_keyed_i32(const void *_a, const void *_b)
+{
+    const KeyedItem *a = (const KeyedItem *)_a;
+    const KeyedItem *b = (const KeyedItem *)_b;
+    return (a->i32 < b->i32) ? -1 : ((a->i32 > b->i32) ? 1 : 0);
+}
+
+static int SDLCALL
+compare_keyed_i32_r(void *userdata, const void *a, const void *b)
+{
+    (void)userdata;
+    return compare_keyed_i32(a, b);
+}
+
+#define CHECK_KEYED_ITEMS(SORTED, SIZE, FIELD, WHAT)                                                       \
+    do {                                                                                                   \
+        unsigned int check_index;                                                                          \
+        Uint64 bad_order = 0, bad_stability = 0;                                                           \
+        for (check_index = 1; check_index < (SIZE); check_index++) {                                       \
+            const KeyedItem *prev = &(SORTED)[check_index - 1];                                            \
+            const KeyedItem *item = &(SORTED)[check_index];                                                \
+            if (prev->FIELD > item->FIELD) {                                                               \
+                bad_order += 1;                                                                            \
+            } else if (prev->FIELD == item->FIELD && prev->order > item->order) {                          \
+                bad_stability += 1;                                                                        \
+            }                                                                                              \
+        }                                                                                                  \
+        SDLTest_AssertCheck(bad_order == 0, "%s array (size=%u) is sorted (bad count=%" SDL_PRIu64 ")",    \
+            (WHAT), (unsigned)(SIZE), bad_order);                                                          \
+        SDLTest_AssertCheck(bad_stability == 0, "%s kept equal keys in order (bad count=%" SDL_PRIu64 ")", \
+            (WHAT), bad_stability);                                                                        \
+    } while (0)
+
+static void
+fill_keyed_items(KeyedItem *items, unsigned int count, int max_value)
+{
+    unsigned int i;
+
+    for (i = 0; i < count; i++) {
+        items[i].i32 = SDLTest_RandomIntegerInRange(-max_value, max_value);
+        items[i].f = (float)SDLTest_RandomIntegerInRange(-max_value, max_value) * 0.5f;
+        items[i].u64 = ((Uint64)SDLTest_RandomUint32() << 32) | (Uint64)SDLTest_RandomIntegerInRange(0, max_value);
+        items[i].d = SDLTest_RandomDouble() * (double)max_value - (double)max_value / 2.0;
+        items[i].order = i;
+    }
+}
+
+static int SDLCALL qsort_testStable(void *arg)
+{
+    unsigned int iteration;
+    (void)arg;
+
+    for (iteration = 0; iteration < count_arraylens; iteration++) {
+        const unsigned int arraylen = arraylens[iteration];
+        KeyedItem *items = SDL_malloc(sizeof(KeyedItem) * arraylen);
+        KeyedItem *sorted = SDL_malloc(sizeof(KeyedItem) * arraylen);
+
+        /* Few distinct keys, so there are many runs of equal elements */
+        fill_keyed_items(items, arraylen, 10);
+
+        SDL_memcpy(sorted, items, sizeof(KeyedItem) * arraylen);
+        SDLTest_AssertCheck(SDL_mergesort(sorted, arraylen, sizeof(KeyedItem), compare_keyed_i32), "Call to SDL_mergesort()");
+        CHECK_KEYED_ITEMS(sorted, arraylen, i32, "SDL_mergesort");
+
+        SDL_memcpy(sorted, items, sizeof(KeyedItem) * arraylen);
+        SDLTest_AssertCheck(SDL_parallel_mergesort_r(sorted, arraylen, sizeof(KeyedItem), compare_keyed_i32_r, NULL), "Call to SDL_parallel_mergesort_r()");
+        CHECK_KEYED_ITEMS(sorted, arraylen, i32, "SDL_parallel_mergesort_r");
+
+        SDL_free(items);
+        SDL_free(sorted);
+    }
+    return TEST_COMPLETED;
+}
+
+static int SDLCALL qsort_testRadix(void *arg)
+{
+    unsigned int iteration;
+    (void)arg;
+
+    for (iteration = 0; iteration < count_arraylens; iteration++) {
+        const unsigned int arraylen = arraylens[iteration];
+        KeyedItem *items = SDL_malloc(sizeof(KeyedItem) * arraylen);
+        KeyedItem *sorted = SDL_malloc(sizeof(KeyedItem) * arraylen);
+        unsigned int i;
+
+        fill_keyed_items(items, arraylen, 1000);
+
+        SDL_memcpy(sorted, items, sizeof(KeyedItem) * arraylen);
+        SDLTest_AssertCheck(SDL_radixsort(sorted, arraylen, sizeof(KeyedItem), offsetof(KeyedItem, i32), SDL_SORT_KEY_SINT32), "Call to SDL_radixsort(SDL_SORT_KEY_SINT32)");
+        CHECK_KEYED_ITEMS(sorted, arraylen, i32, "SDL_radixsort(SDL_SORT_KEY_SINT32)");
+
+        SDL_memcpy(sorted, items, sizeof(KeyedItem) * arraylen);
+        SDLTest_AssertCheck(SDL_radixsort(sorted, arraylen, sizeof(KeyedItem), offsetof(KeyedItem, f), SDL_SORT_KEY_FLOAT), "Call to SDL_radixsort(SDL_SORT_KEY_FLOAT)");
+        CHECK_KEYED_ITEMS(sorted, arraylen, f, "SDL_radixsort(SDL_SORT_KEY_FLOAT)");
+
+        SDL_memcpy(sorted, items, sizeof(KeyedItem) * arraylen);
+        SDLTest_AssertCheck(SDL_radixsort(sorted, arraylen, sizeof(KeyedItem), offsetof(KeyedItem, u64), SDL_SORT_KEY_UINT64), "Call to SDL_radixsort(SDL_SORT_KEY_UINT64)");
+        CHECK_KEYED_ITEMS(sorted, arraylen, u64, "SDL_radixsort(SDL_SORT_KEY_UINT64)");
+
+        SDL_memcpy(sorted, items, sizeof(KeyedItem) * arraylen);
+        SDLTest_AssertCheck(SDL_radixsort(sorted, arraylen, sizeof(KeyedItem), offsetof(KeyedItem, d), SDL_SORT_KEY_DOUBLE), "Call to SDL_radixsort(SDL_SORT_KEY_DOUBLE)");
+        CHECK_KEYED_ITEMS(sorted, arraylen, d, "SDL_radixsort(SDL_SORT_KEY_DOUBLE)");
+
+        /* Every element must still be there */
+        for (i = 0; i < arraylen; i++) {
+            if (sorted[i].order >= arraylen || SDL_memcmp(&sorted[i], &items[sorted[i].order], sizeof(KeyedItem)) != 0) {
+                SDLTest_AssertCheck(false, "sorted[%u] matches its original element", i);
+                break;
+            }
+        }
+
+        SDL_free(items);
+        SDL_free(sorted);
+    }
+
+    return TEST_COMPLETED;
+}
+
+static bool
+run_benchmark(void)
+{
+    const unsigned int count = 1024 * 1024;
+    KeyedItem *items = SDL_malloc(sizeof(KeyedItem) * count);
+    KeyedItem *sorted = SDL_malloc(sizeof(KeyedItem) * count);
+    int i;
+    bool result = false;
+
+    if (!items || !sorted) {
+        SDL_LogError(SDL_LOG_CATEGORY_TEST, "Couldn't allocate benchmark buffers");
+        goto done;
+    }
+    fill_keyed_items(items, count, SDL_MAX_SINT32 / 2);
+
+    SDL_Log("Sorting %u elements of %u bytes, %d job threads", count, (unsigned int)sizeof(KeyedItem), SDL_GetNumJobThreads());
+    for (i = 0; i < 4; ++i) {
+        static const char *names[] = { "SDL_qsort_r", "SDL_mergesort_r", "SDL_parallel_mergesort_r", "SDL_radixsort" };
+        Uint64 start, elapsed;
+
+        SDL_memcpy(sorted, items, sizeof(KeyedItem) * count);
+        start = SDL_GetPerformanceCounter();
+        switch (i) {
+        case 0:
+            SDL_qsort_r(sorted, count, sizeof(KeyedItem), compare_keyed_i32_r, NULL);
+            break;
+        case 1:
+            SDL_mergesort_r(sorted, count, sizeof(KeyedItem), compare_keyed_i32_r, NULL);
+            break;
+        case 2:
+            SDL_parallel_mergesort_r(sorted, count, sizeof(KeyedItem), compare_keyed_i32_r, NULL);
+            break;
+        case 3:
+            SDL_radixsort(sorted, count, sizeof(KeyedItem), offsetof(KeyedItem, i32), SDL_SORT_KEY_SINT32);
+            break;
+        }
+        elapsed = SDL_GetPerformanceCounter() - start;
+
+        SDL_Log("%-26s %8.3f ms", names[i], (double)elapsed * 1000.0 / SDL_GetPerformanceFrequency());
+    }
+    result = true;
+
+done:
+    SDL_free(items);
+    SDL_free(sorted);
+    return result;
+}
+#endif
+
 static const SDLTest_TestCaseReference qsortTestAlreadySorted = {
     qsort_testAlreadySorted, "qsort_testAlreadySorted", "Test sorting already sorted array", TEST_ENABLED
 };
@@ -452,11 +654,25 @@ static const SDLTest_TestCaseReference qsortTestRandomSorted = {
     qsort_testRandomSorted, "qsort_testRandomSorted", "Test sorting a random array", TEST_ENABLED
 };
 
+#ifndef TEST_STDLIB_QSORT
+static const SDLTest_TestCaseReference qsortTestStable = {
+    qsort_testStable, "qsort_testStable", "Test that the merge sorts keep equal elements in order", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference qsortTestRadix = {
+    qsort_testRadix, "qsort_testRadix", "Test sorting by a numeric key", TEST_ENABLED
+};
+#endif
+
 static const SDLTest_TestCaseReference *qsortTests[] = {
     &qsortTestAlreadySorted,
     &qsortTestAlreadySortedExceptLast,
     &qsortTestReverseSorted,
     &qsortTestRandomSorted,
+#ifndef TEST_STDLIB_QSORT
+    &qsortTestStable,
+    &qsortTestRadix,
+#endif
     NULL
 };
 
@@ -479,6 +695,7 @@ int main(int argc, char *argv[])
     SDLTest_CommonState *state;
     SDLTest_TestSuiteRunner *runner;
     bool list = false;
+    bool benchmark = false;
 
     /* Initialize test framework */
     state = SDLTest_CommonCreateState(argv, 0);
@@ -519,11 +736,19 @@ int main(int argc, char *argv[])
             } else if (SDL_strcasecmp(argv[i], "--list") == 0) {
                 consumed = 1;
                 list = true;
+#ifndef TEST_STDLIB_QSORT
+            } else if (SDL_strcasecmp(argv[i], "--benchmark") == 0) {
+                consumed = 1;
+                benchmark = true;
+#endif
             }
         }
         if (consumed <= 0) {
             static const char *options[] = {
                 "[--list]",
+#ifndef TEST_STDLIB_QSORT
+                "[--benchmark]",
+#endif
                 "[--array-lengths N1 [N2 [N3 [...]]]",
                 NULL
             };
@@ -547,6 +772,10 @@ int main(int argc, char *argv[])
             }
         }
         result = 0;
+#ifndef TEST_STDLIB_QSORT
+    } else if (benchmark) {
+        result = run_benchmark() ? 0 : 1;
+#endif
     } else {
         result = SDLTest_ExecuteTestSuiteRunner(runner);
     }
@@ -0,0 +1,216 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark for the UTF-8 and case-insensitive string functions: checks each code path against a reference and reports MB/s. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+static const struct
+{
+    const char *name;
+    const char *cpu_feature_mask;
+} paths[] = {
+    /* The scalar path goes first, the others are checked against it */
+    { "scalar", "-sse2,-avx2,-neon" },
+    { "sse2", "-avx2,-neon" },
+    { "avx2", "-neon" },
+    { "neon", "-sse2,-avx2" },
+};
+
+static const char *pieces[] = { "\xc3\xa9", "\xe2\x82\xac", "\xf0\x9f\x98\x80", "\x80", "\xc3", "\xe2\x82", "\xff" };
+
+static size_t ReferenceUTF8Length(const char *str, size_t bytes)
+{
+    size_t result = 0;
+    while (SDL_StepUTF8(&str, &bytes)) {
+        ++result;
+    }
+    return result;
+}
+
+/* Fills `text` with mostly ASCII, with a non-ASCII or invalid sequence about every `spacing` bytes */
+static void FillText(char *text, size_t size, int spacing)
+{
+    size_t i = 0;
+
+    while (i < size - 8) {
+        if (spacing && SDL_rand(spacing) == 0) {
+            const char *piece = pieces[SDL_rand(SDL_arraysize(pieces))];
+            SDL_memcpy(&text[i], piece, SDL_strlen(piece));
+            i += SDL_strlen(piece);
+        } else {
+            text[i++] = (char)(' ' + SDL_rand(95));
+        }
+    }
+    text[i] = '\0';
+}
+
+#define NUM_VERIFY_CASES 1000
+
+/* What the scalar path returned for each case, which every other path has to match */
+static size_t scalar_lengths[2][NUM_VERIFY_CASES];
+
+/* Checks lengths at odd offsets and sizes, so the vector loops and their tails are both used */
+static bool Verify(const char *text, size_t size, size_t *lengths, bool scalar)
+{
+    const size_t len = SDL_strlen(text);
+    int i;
+
+    /* Every path gets the same offsets and sizes */
+    SDL_srand(1);
+    for (i = 0; i < NUM_VERIFY_CASES; ++i) {
+        const size_t offset = (size_t)SDL_rand(64);
+        const size_t bytes = (size_t)SDL_rand((Sint32)SDL_min(len - offset, 4096));
+        const size_t result = SDL_utf8strnlen(text + offset, bytes);
+
+        if (result != ReferenceUTF8Length(text + offset, bytes)) {
+            SDL_Log("SDL_utf8strnlen() mismatch, offset %u, length %u", (unsigned int)offset, (unsigned int)bytes);
+            return false;
+        }
+        if (scalar) {
+            lengths[i] = result;
+        } else if (result != lengths[i]) {
+            SDL_Log("SDL_utf8strnlen() differs from the scalar path, offset %u, length %u", (unsigned int)offset, (unsigned int)bytes);
+            return false;
+        }
+    }
+    if (SDL_utf8strlen(text) != ReferenceUTF8Length(text, size)) {
+        SDL_Log("SDL_utf8strlen() mismatch");
+        return false;
+    }
+    return true;
+}
+
+static double MeasureUTF8(const char *text, int milliseconds)
+{
+    const size_t len = SDL_strlen(text);
+    const Uint64 start = SDL_GetTicksNS();
+    const Uint64 end = start + (Uint64)milliseconds * SDL_NS_PER_MS;
+    Uint64 now, bytes = 0;
+    size_t total = 0;
+
+    do {
+        total += SDL_utf8strlen(text);
+        bytes += len;
+        now = SDL_GetTicksNS();
+    } while (now < end);
+
+    (void)total;
+    return ((double)bytes / 1e6) / ((double)(now - start) / SDL_NS_PER_SECOND);
+}
+
+static double MeasureCaseCompare(const char *text, const char *upper, int milliseconds)
+{
+    const size_t len = SDL_strlen(text);
+    const Uint64 start = SDL_GetTicksNS();
+    const Uint64 end = start + (Uint64)milliseconds * SDL_NS_PER_MS;
+    Uint64 now, bytes = 0;
+    int total = 0;
+
+    do {
+        total += SDL_strcasecmp(text, upper);
+        bytes += len;
+        now = SDL_GetTicksNS();
+    } while (now < end);
+
+    (void)total;
+    return ((double)bytes / 1e6) / ((double)(now - start) / SDL_NS_PER_SECOND);
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    char *ascii = NULL, *mixed = NULL, *upper = NULL;
+    size_t size = 64 * 1024;
+    int milliseconds = 500;
+    int result = 1;
+    int i;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--size") == 0 && argv[i + 1]) {
+                size = (size_t)SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--ms") == 0 && argv[i + 1]) {
+                milliseconds = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0 || size < 4096 || milliseconds <= 0) {
+            static const char *options[] = { "[--size BYTES]", "[--ms N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    ascii = (char *)SDL_malloc(size);
+    mixed = (char *)SDL_malloc(size);
+    if (!ascii || !mixed) {
+        goto done;
+    }
+    SDL_srand(0);
+    FillText(ascii, size, 0);
+    FillText(mixed, size, 16);
+    upper = SDL_strdup(ascii);
+    if (!upper) {
+        goto done;
+    }
+    SDL_strupr(upper);
+
+    SDL_Log("Scanning %u byte strings, %d ms per path", (unsigned int)size, milliseconds);
+
+    for (i = 0; i < (int)SDL_arraysize(paths); ++i) {
+        /* SDL_Quit() resets the detected CPU features, so the hint is picked up again */
+        SDL_SetHint(SDL_HINT_CPU_FEATURE_MASK, paths[i].cpu_feature_mask);
+
+        if ((SDL_strcmp(paths[i].name, "sse2") == 0 && !SDL_HasSSE2()) ||
+            (SDL_strcmp(paths[i].name, "avx2") == 0 && !SDL_HasAVX2()) ||
+            (SDL_strcmp(paths[i].name, "neon") == 0 && !SDL_HasNEON())) {
+            SDL_Quit();
+            continue;
+        }
+
+        if (!Verify(ascii, size, scalar_lengths[0], i == 0) || !Verify(mixed, size, scalar_lengths[1], i == 0)) {
+            goto done;
+        }
+        if (SDL_strcasecmp(ascii, upper) != 0) {
+            SDL_Log("SDL_strcasecmp() mismatch");
+            goto done;
+        }
+        SDL_Log("%10s: utf8strlen ascii %8.1f MB/s, mixed %8.1f MB/s, strcasecmp %8.1f MB/s", paths[i].name,
+                MeasureUTF8(ascii, milliseconds), MeasureUTF8(mixed, milliseconds),
+                MeasureCaseCompare(ascii, upper, milliseconds));
+        SDL_Quit();
+    }
+
+    result = 0;
+
+done:
+    SDL_free(ascii);
+    SDL_free(mixed);
+    SDL_free(upper);
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
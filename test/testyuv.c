@@ -373,6 +373,278 @@ done:
     return result;
 }
 
+static bool run_benchmark(void)
+{
+    static const struct
+    {
+        SDL_PixelFormat yuv_format;
+        SDL_PixelFormat rgb_format;
+        SDL_Colorspace colorspace;
+        bool encode;
+    } pairs[] = {
+        { SDL_PIXELFORMAT_YV12, SDL_PIXELFORMAT_RGB565, SDL_COLORSPACE_BT709_LIMITED, false },
+        { SDL_PIXELFORMAT_YV12, SDL_PIXELFORMAT_RGB24, SDL_COLORSPACE_BT709_LIMITED, false },
+        { SDL_PIXELFORMAT_YV12, SDL_PIXELFORMAT_XRGB8888, SDL_COLORSPACE_BT709_LIMITED, false },
+        { SDL_PIXELFORMAT_YV12, SDL_PIXELFORMAT_ABGR8888, SDL_COLORSPACE_BT709_LIMITED, false },
+        { SDL_PIXELFORMAT_IYUV, SDL_PIXELFORMAT_RGBA8888, SDL_COLORSPACE_BT709_LIMITED, false },
+        { SDL_PIXELFORMAT_IYUV, SDL_PIXELFORMAT_BGRA8888, SDL_COLORSPACE_BT709_LIMITED, false },
+        { SDL_PIXELFORMAT_P408, SDL_PIXELFORMAT_XRGB8888, SDL_COLORSPACE_BT709_LIMITED, false },
+        { SDL_PIXELFORMAT_NV12, SDL_PIXELFORMAT_RGB565, SDL_COLORSPACE_BT709_LIMITED, false },
+        { SDL_PIXELFORMAT_NV12, SDL_PIXELFORMAT_RGB24, SDL_COLORSPACE_BT709_LIMITED, false },
+        { SDL_PIXELFORMAT_NV12, SDL_PIXELFORMAT_XRGB8888, SDL_COLORSPACE_BT709_LIMITED, false },
+        { SDL_PIXELFORMAT_NV21, SDL_PIXELFORMAT_ABGR8888, SDL_COLORSPACE_BT709_LIMITED, false },
+        { SDL_PIXELFORMAT_YUY2, SDL_PIXELFORMAT_RGB565, SDL_COLORSPACE_BT709_LIMITED, false },
+        { SDL_PIXELFORMAT_YUY2, SDL_PIXELFORMAT_RGB24, SDL_COLORSPACE_BT709_LIMITED, false },
+        { SDL_PIXELFORMAT_YUY2, SDL_PIXELFORMAT_XRGB8888, SDL_COLORSPACE_BT709_LIMITED, false },
+        { SDL_PIXELFORMAT_UYVY, SDL_PIXELFORMAT_XRGB8888, SDL_COLORSPACE_BT709_LIMITED, false },
+        { SDL_PIXELFORMAT_YVYU, SDL_PIXELFORMAT_XRGB8888, SDL_COLORSPACE_BT709_LIMITED, false },
+        { SDL_PIXELFORMAT_P010, SDL_PIXELFORMAT_XBGR2101010, SDL_COLORSPACE_BT2020_FULL, false },
+        { SDL_PIXELFORMAT_P416, SDL_PIXELFORMAT_RGB48, SDL_COLORSPACE_BT2020_FULL, false },
+        { SDL_PIXELFORMAT_YV12, SDL_PIXELFORMAT_XRGB8888, SDL_COLORSPACE_BT709_LIMITED, true },
+        { SDL_PIXELFORMAT_IYUV, SDL_PIXELFORMAT_ABGR8888, SDL_COLORSPACE_BT709_LIMITED, true },
+        { SDL_PIXELFORMAT_NV12, SDL_PIXELFORMAT_XRGB8888, SDL_COLORSPACE_BT709_LIMITED, true },
+        { SDL_PIXELFORMAT_NV12, SDL_PIXELFORMAT_BGRA8888, SDL_COLORSPACE_BT709_LIMITED, true },
+        { SDL_PIXELFORMAT_NV21, SDL_PIXELFORMAT_RGBA8888, SDL_COLORSPACE_BT709_LIMITED, true },
+        { SDL_PIXELFORMAT_P010, SDL_PIXELFORMAT_XBGR2101010, SDL_COLORSPACE_BT2020_FULL, true },
+    };
+    const int w = 1920;
+    const int h = 1080;
+    const int iterations = 100;
+    const int yuv_len = MAX_YUV_SURFACE_SIZE(w, h, 0);
+    const int rgb_len = w * h * 8;
+    Uint8 *yuv = (Uint8 *)SDL_malloc(yuv_len);
+    Uint8 *rgb = (Uint8 *)SDL_malloc(rgb_len);
+    bool result = false;
+    int i, j;
+
+    if (!yuv || !rgb) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't allocate benchmark buffers");
+        goto done;
+    }
+
+    /* The converters don't depend on the pixel values, so any data will do */
+    for (i = 0; i < yuv_len; ++i) {
+        yuv[i] = (Uint8)SDL_rand(256);
+    }
+    for (i = 0; i < rgb_len; ++i) {
+        rgb[i] = (Uint8)SDL_rand(256);
+    }
+
+    for (i = 0; i < (int)SDL_arraysize(pairs); ++i) {
+        const int yuv_pitch = CalculateYUVPitch(pairs[i].yuv_format, w);
+        const int rgb_pitch = w * SDL_BYTESPERPIXEL(pairs[i].rgb_format);
+        Uint64 start, elapsed;
+        double ms;
+
+        start = SDL_GetPerformanceCounter();
+        for (j = 0; j < iterations; ++j) {
+            bool converted;
+
+            if (pairs[i].encode) {
+                converted = SDL_ConvertPixelsAndColorspace(w, h, pairs[i].rgb_format, SDL_COLORSPACE_SRGB, 0, rgb, rgb_pitch, pairs[i].yuv_format, pairs[i].colorspace, 0, yuv, yuv_pitch);
+            } else {
+                converted = SDL_ConvertPixelsAndColorspace(w, h, pairs[i].yuv_format, pairs[i].colorspace, 0, yuv, yuv_pitch, pairs[i].rgb_format, SDL_COLORSPACE_SRGB, 0, rgb, rgb_pitch);
+            }
+            if (!converted) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't convert between %s and %s: %s", SDL_GetPixelFormatName(pairs[i].yuv_format), SDL_GetPixelFormatName(pairs[i].rgb_format), SDL_GetError());
+                goto done;
+            }
+        }
+        elapsed = SDL_GetPerformanceCounter() - start;
+
+        ms = (double)elapsed * 1000.0 / SDL_GetPerformanceFrequency() / iterations;
+        SDL_Log("%-28s %s %-28s %8.3f ms/frame, %8.1f Mpixels/s",
+                SDL_GetPixelFormatName(pairs[i].yuv_format), pairs[i].encode ? "<-" : "->", SDL_GetPixelFormatName(pairs[i].rgb_format),
+                ms, (w * h) / (ms * 1000.0));
+    }
+    result = true;
+
+done:
+    SDL_free(yuv);
+    SDL_free(rgb);
+    return result;
+}
+
+/* Open the dummy camera's test pattern, asking for `spec`, and return the first frame converted to XRGB8888 */
+static SDL_Surface *capture_camera_frame(const SDL_CameraSpec *spec)
+{
+    SDL_CameraID *cameras;
+    SDL_Camera *camera = NULL;
+    SDL_Surface *frame = NULL;
+    SDL_Surface *result = NULL;
+    Uint64 timeout;
+
+    cameras = SDL_GetCameras(NULL);
+    if (cameras && cameras[0]) {
+        camera = SDL_OpenCamera(cameras[0], spec);
+    }
+    SDL_free(cameras);
+    if (!camera) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't open test pattern camera: %s", SDL_GetError());
+        return NULL;
+    }
+
+    timeout = SDL_GetTicks() + 5000;
+    while (!frame && SDL_GetTicks() < timeout) {
+        frame = SDL_AcquireCameraFrame(camera, NULL);
+        if (!frame) {
+            SDL_Delay(5);
+        }
+    }
+    if (frame) {
+        /* RGB frames are tagged with the camera's YUV colorspace, but hold plain sRGB pixels */
+        result = SDL_CreateSurface(frame->w, frame->h, SDL_PIXELFORMAT_XRGB8888);
+        if (result && !SDL_ConvertPixelsAndColorspace(frame->w, frame->h,
+                            frame->format, SDL_ISPIXELFORMAT_FOURCC(frame->format) ? SDL_GetSurfaceColorspace(frame) : SDL_COLORSPACE_SRGB, 0, frame->pixels, frame->pitch,
+                            result->format, SDL_COLORSPACE_SRGB, 0, result->pixels, result->pitch)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't convert camera frame: %s", SDL_GetError());
+            SDL_DestroySurface(result);
+            result = NULL;
+        }
+        SDL_ReleaseCameraFrame(camera, frame);
+    } else {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Timed out waiting for a camera frame");
+    }
+    SDL_CloseCamera(camera);
+    return result;
+}
+
+/* Return the largest difference in any color channel between two XRGB8888 surfaces of the same size */
+static int compare_xrgb_surfaces(SDL_Surface *actual, SDL_Surface *expected)
+{
+    int x, y, c;
+    int max_delta = 0;
+
+    for (y = 0; y < actual->h; ++y) {
+        const Uint8 *a = (const Uint8 *)actual->pixels + y * actual->pitch;
+        const Uint8 *e = (const Uint8 *)expected->pixels + y * expected->pitch;
+        for (x = 0; x < actual->w; ++x) {
+            for (c = 0; c < 3; ++c) {
+                max_delta = SDL_max(max_delta, SDL_abs((int)a[x * 4 + c] - e[x * 4 + c]));
+            }
+        }
+    }
+    return max_delta;
+}
+
+/* Compare the camera's single pass scale and convert against converting and then stretching with SDL_StretchSurface() */
+static bool run_camera_scaling_test(void)
+{
+    static const SDL_PixelFormat yuv_formats[] = {
+        SDL_PIXELFORMAT_YUY2,
+        SDL_PIXELFORMAT_UYVY,
+        SDL_PIXELFORMAT_YVYU,
+        SDL_PIXELFORMAT_NV12,
+        SDL_PIXELFORMAT_NV21,
+        SDL_PIXELFORMAT_IYUV,
+        SDL_PIXELFORMAT_YV12
+    };
+    /* Non-YUV outputs are scaled in bands of rows through scratch buffers and converted one band at a time */
+    static const SDL_PixelFormat rgb_formats[] = {
+        SDL_PIXELFORMAT_XRGB8888,
+        SDL_PIXELFORMAT_RGB24
+    };
+    /* Odd heights leave a 4:2:0 chroma row, and a band, half filled */
+    static const struct
+    {
+        int w, h;
+    } sizes[] = {
+        { 64, 37 },
+        { 150, 101 },
+        { 47, 29 }
+    };
+    const int src_w = 98;
+    const int src_h = 61;
+    const int tolerance = 8;
+    bool result = true;
+    int i, j, k;
+
+    SDL_SetHint(SDL_HINT_CAMERA_DRIVER, "dummy");
+
+    for (i = 0; i < (int)SDL_arraysize(yuv_formats); ++i) {
+        const SDL_PixelFormat src_format = yuv_formats[i];
+        char pattern[64];
+        SDL_Surface *source;
+
+        (void)SDL_snprintf(pattern, sizeof(pattern), "%c%c%c%c %dx%d",
+                           (char)(src_format & 0xFF), (char)((src_format >> 8) & 0xFF),
+                           (char)((src_format >> 16) & 0xFF), (char)((src_format >> 24) & 0xFF), src_w, src_h);
+        SDL_SetHint(SDL_HINT_CAMERA_DUMMY_TEST_PATTERN, pattern);
+        if (!SDL_InitSubSystem(SDL_INIT_CAMERA)) {
+            SDL_Log("Skipping camera scaling test, the dummy camera driver isn't available: %s", SDL_GetError());
+            break;
+        }
+
+        /* The unscaled frame, straight from the camera */
+        source = capture_camera_frame(NULL);
+        if (!source) {
+            result = false;
+        }
+
+        for (j = 0; source && j < (int)SDL_arraysize(sizes); ++j) {
+            const int w = sizes[j].w;
+            const int h = sizes[j].h;
+            SDL_Surface *stretched = SDL_CreateSurface(w, h, SDL_PIXELFORMAT_XRGB8888);
+
+            if (!stretched || !SDL_StretchSurface(source, NULL, stretched, NULL, SDL_SCALEMODE_LINEAR)) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't stretch reference frame: %s", SDL_GetError());
+                SDL_DestroySurface(stretched);
+                result = false;
+                break;
+            }
+
+            for (k = 0; k < (int)(SDL_arraysize(yuv_formats) + SDL_arraysize(rgb_formats)); ++k) {
+                const bool yuv_output = (k < (int)SDL_arraysize(yuv_formats));
+                const SDL_PixelFormat dst_format = yuv_output ? yuv_formats[k] : rgb_formats[k - SDL_arraysize(yuv_formats)];
+                SDL_CameraSpec spec;
+                SDL_Surface *actual;
+                SDL_Surface *expected;
+
+                SDL_zero(spec);
+                spec.format = dst_format;
+                spec.width = w;
+                spec.height = h;
+                spec.framerate_numerator = 100;
+                spec.framerate_denominator = 1;
+
+                /* A YUV output loses the same precision in the reference by going through that format too */
+                if (yuv_output) {
+                    SDL_Surface *converted = SDL_ConvertSurface(stretched, dst_format);
+                    expected = converted ? SDL_ConvertSurface(converted, SDL_PIXELFORMAT_XRGB8888) : NULL;
+                    SDL_DestroySurface(converted);
+                } else {
+                    expected = SDL_DuplicateSurface(stretched);
+                }
+
+                actual = capture_camera_frame(&spec);
+                if (!actual || !expected) {
+                    result = false;
+                } else {
+                    const int delta = compare_xrgb_surfaces(actual, expected);
+                    if (delta > tolerance) {
+                        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s %dx%d -> %s %dx%d differs from the reference by up to %d",
+                                     SDL_GetPixelFormatName(src_format), src_w, src_h, SDL_GetPixelFormatName(dst_format), w, h, delta);
+                        result = false;
+                    } else {
+                        SDL_Log("%s %dx%d -> %s %dx%d: within %d of the reference",
+                                SDL_GetPixelFormatName(src_format), src_w, src_h, SDL_GetPixelFormatName(dst_format), w, h, delta);
+                    }
+                }
+                SDL_DestroySurface(actual);
+                SDL_DestroySurface(expected);
+            }
+            SDL_DestroySurface(stretched);
+        }
+
+        SDL_DestroySurface(source);
+        SDL_QuitSubSystem(SDL_INIT_CAMERA);
+    }
+
+    SDL_ResetHint(SDL_HINT_CAMERA_DUMMY_TEST_PATTERN);
+    SDL_ResetHint(SDL_HINT_CAMERA_DRIVER);
+    return result;
+}
+
 static bool create_textures(SDL_Renderer *renderer, SDL_Surface *original, SDL_PixelFormat yuv_format, SDL_PixelFormat rgb_format, bool planar, bool monochrome, int luminance, SDL_Texture *output[3])
 {
     SDL_Colorspace rgb_colorspace = SDL_COLORSPACE_SRGB;
@@ -855,6 +1127,9 @@ int main(int argc, char **argv)
         /* Test: odd width and height with intrinsics, extra pitch */
         { true, 33, 3 },
         { true, 37, 3 },
+        /* Test: several blocks of the widest intrinsics, with and without a remainder */
+        { true, 64, 0 },
+        { true, 67, 3 },
     };
     char *filename = NULL;
     SDL_Surface *original = NULL;
@@ -870,6 +1145,8 @@ int main(int argc, char **argv)
     bool should_run_automated_tests = false;
     bool should_run_colorspace_test = false;
     bool should_test_all_formats = false;
+    bool should_run_benchmark = false;
+    bool should_run_camera_scaling_test = false;
     SDLTest_CommonState *state;
     int result = 0;
 
@@ -970,6 +1247,12 @@ int main(int argc, char **argv)
             } else if (SDL_strcmp(argv[i], "--colorspace-test") == 0) {
                 should_run_colorspace_test = true;
                 consumed = 1;
+            } else if (SDL_strcmp(argv[i], "--benchmark") == 0) {
+                should_run_benchmark = true;
+                consumed = 1;
+            } else if (SDL_strcmp(argv[i], "--camera-scaling-test") == 0) {
+                should_run_camera_scaling_test = true;
+                consumed = 1;
             } else if (SDL_strcmp(argv[i], "--renderer") == 0 && argv[i + 1]) {
                 renderer_name = argv[i + 1];
                 consumed = 2;
@@ -984,7 +1267,7 @@ int main(int argc, char **argv)
                 "[--yv12|--iyuv|--p408|--yuy2|--uyvy|--yvyu|--nv12|--nv21|--p010|--p416]",
                 "[--rgb555|--rgb565|--rgb24|--argb|--abgr|--rgba|--bgra]",
                 "[--monochrome] [--luminance N%] [--planar]",
-                "[--automated] [--colorspace-test] [--renderer NAME]",
+                "[--automated] [--colorspace-test] [--benchmark] [--camera-scaling-test] [--renderer NAME]",
                 "[sample.png]",
                 NULL,
             };
@@ -1007,6 +1290,9 @@ int main(int argc, char **argv)
                 result = 2;
             }
         }
+        if (!run_camera_scaling_test()) {
+            result = 2;
+        }
         goto done;
     }
 
@@ -1017,6 +1303,20 @@ int main(int argc, char **argv)
         goto done;
     }
 
+    if (should_run_benchmark) {
+        if (!run_benchmark()) {
+            result = 2;
+        }
+        goto done;
+    }
+
+    if (should_run_camera_scaling_test) {
+        if (!run_camera_scaling_test()) {
+            result = 2;
+        }
+        goto done;
+    }
+
     filename = GetResourceFilename(filename, "testyuv.png");
     png = SDL_LoadSurface(filename);
     if (png) {